@@ -184,6 +184,40 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+  option (HDF5_ENABLE_URING_VFD "Build the Linux io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_URING_VFD)
+    set (CMAKE_REQUIRED_DEFINITIONS "${CMAKE_REQUIRED_DEFINITIONS} -D_GNU_SOURCE")
+    CHECK_C_SOURCE_COMPILES ("
+      #include <linux/io_uring.h>
+      #include <sys/syscall.h>
+      int main (void)
+      {
+          struct io_uring_params p;
+          p.features = IORING_FEAT_SINGLE_MMAP;
+          return (int)p.features + IORING_OP_READ + IORING_OP_WRITE_FIXED + __NR_io_uring_setup;
+      }" URING_VFD_COMPILES)
+    # The driver can open the file with O_DIRECT and allocates its bounce
+    # buffers with posix_memalign(), as the direct VFD does
+    CHECK_C_SOURCE_COMPILES ("
+      #include <fcntl.h>
+      int main (void)
+      {
+          return O_DIRECT;
+      }" URING_VFD_HAVE_O_DIRECT)
+    CHECK_FUNCTION_EXISTS (posix_memalign URING_VFD_HAVE_POSIX_MEMALIGN)
+    if (URING_VFD_COMPILES AND URING_VFD_HAVE_O_DIRECT AND URING_VFD_HAVE_POSIX_MEMALIGN)
+      set (${HDF_PREFIX}_HAVE_URING 1)
+      add_definitions ("-D_GNU_SOURCE")
+    else ()
+      message (WARNING "The io_uring VFD was requested but cannot be built.\nPlease check that the kernel headers provide <linux/io_uring.h> and that O_DIRECT and posix_memalign() are available, and/or re-configure without option HDF5_ENABLE_URING_VFD.")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
@@ -84,7 +84,7 @@ typedef struct H5AC_addr_list_ud_t {
 /********************/
 
 static herr_t H5AC__broadcast_candidate_list(H5AC_t *cache_ptr, unsigned *num_entries_ptr,
-                                             haddr_t **haddr_buf_ptr_ptr);
+                                             haddr_t **haddr_buf_ptr_ptr, MPI_Request *bcast_req_ptr);
 static herr_t H5AC__broadcast_clean_list(H5AC_t *cache_ptr);
 static herr_t H5AC__construct_candidate_list(H5AC_t *cache_ptr, H5AC_aux_t *aux_ptr, int sync_point_op);
 static herr_t H5AC__copy_candidate_list_to_buffer(const H5AC_t *cache_ptr, unsigned *num_entries_ptr,
@@ -240,6 +240,41 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_add_candidate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_coll_bulk_read()
+ *
+ * Purpose:     Run an operation that reads metadata collectively, with
+ *		the metadata broadcast by process 0 in bulk instead of
+ *		entry by entry.  See H5C_coll_bulk_read() for details.
+ *
+ *		*bulk_read is set to FALSE, without running the operation,
+ *		when metadata reads aren't collective, the file is open on
+ *		a single process, or a bulk read is already under way.  The
+ *		caller then runs the operation itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_coll_bulk_read(H5F_t *f, H5AC_coll_bulk_read_op_t op, void *op_data, hbool_t *bulk_read)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f != NULL);
+    HDassert(op != NULL);
+    HDassert(bulk_read != NULL);
+
+    if (H5C_coll_bulk_read(f, op, op_data, bulk_read) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "bulk collective metadata read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_coll_bulk_read() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5AC__broadcast_candidate_list()
@@ -253,6 +288,10 @@ done:
  *		copy is returned in *haddr_buf_ptr_ptr, the caller
  *		must free it.
  *
+ *		The broadcast of the list itself is only started, with
+ *		its request returned in *bcast_req_ptr.  The caller must
+ *		complete the request before freeing the copy of the list.
+ *
  *		This function must only be called by the process with
  *		MPI_rank 0.
  *
@@ -265,7 +304,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5AC__broadcast_candidate_list(H5AC_t *cache_ptr, unsigned *num_entries_ptr, haddr_t **haddr_buf_ptr_ptr)
+H5AC__broadcast_candidate_list(H5AC_t *cache_ptr, unsigned *num_entries_ptr, haddr_t **haddr_buf_ptr_ptr,
+                               MPI_Request *bcast_req_ptr)
 {
     H5AC_aux_t *aux_ptr       = NULL;
     haddr_t *   haddr_buf_ptr = NULL;
@@ -287,6 +327,7 @@ H5AC__broadcast_candidate_list(H5AC_t *cache_ptr, unsigned *num_entries_ptr, had
     HDassert(*num_entries_ptr == 0);
     HDassert(haddr_buf_ptr_ptr != NULL);
     HDassert(*haddr_buf_ptr_ptr == NULL);
+    HDassert(bcast_req_ptr != NULL);
 
     /* First broadcast the number of entries in the list so that the
      * receivers can set up buffers to receive them.  If there aren't
@@ -309,11 +350,14 @@ H5AC__broadcast_candidate_list(H5AC_t *cache_ptr, unsigned *num_entries_ptr, had
         HDassert(chk_num_entries == num_entries);
         HDassert(haddr_buf_ptr != NULL);
 
-        /* Now broadcast the list of candidate entries */
+        /* Now start broadcasting the list of candidate entries.  Process 0
+         * already has the list, so it goes on to apply it while the
+         * broadcast proceeds, and completes the broadcast afterwards.
+         */
         buf_size = sizeof(haddr_t) * num_entries;
-        if (MPI_SUCCESS !=
-            (mpi_result = MPI_Bcast((void *)haddr_buf_ptr, (int)buf_size, MPI_BYTE, 0, aux_ptr->mpi_comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_result)
+        if (MPI_SUCCESS != (mpi_result = MPI_Ibcast((void *)haddr_buf_ptr, (int)buf_size, MPI_BYTE, 0,
+                                                     aux_ptr->mpi_comm, bcast_req_ptr)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Ibcast failed", mpi_result)
     } /* end if */
 
     /* Pass the number of entries and the buffer pointer
@@ -400,6 +444,7 @@ H5AC__broadcast_clean_list(H5AC_t *cache_ptr)
 {
     haddr_t *   addr_buf_ptr = NULL;
     H5AC_aux_t *aux_ptr;
+    MPI_Request bcast_req = MPI_REQUEST_NULL;
     int         mpi_result;
     unsigned    num_entries = 0;
     herr_t      ret_value   = SUCCEED; /* Return value */
@@ -442,9 +487,9 @@ H5AC__broadcast_clean_list(H5AC_t *cache_ptr)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "Can't build address list for clean entries")
 
         /* Now broadcast the list of cleaned entries */
-        if (MPI_SUCCESS !=
-            (mpi_result = MPI_Bcast((void *)addr_buf_ptr, (int)buf_size, MPI_BYTE, 0, aux_ptr->mpi_comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_result)
+        if (MPI_SUCCESS != (mpi_result = MPI_Ibcast((void *)addr_buf_ptr, (int)buf_size, MPI_BYTE, 0,
+                                                    aux_ptr->mpi_comm, &bcast_req)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Ibcast failed", mpi_result)
     } /* end if */
 
     /* if it is defined, call the sync point done callback.  Note
@@ -454,7 +499,13 @@ H5AC__broadcast_clean_list(H5AC_t *cache_ptr)
     if (aux_ptr->sync_point_done)
         (aux_ptr->sync_point_done)(num_entries, addr_buf_ptr);
 
+    /* The address buffer can't be released until the broadcast completes */
+    if (MPI_SUCCESS != (mpi_result = MPI_Wait(&bcast_req, MPI_STATUS_IGNORE)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Wait failed", mpi_result)
+
 done:
+    if (bcast_req != MPI_REQUEST_NULL)
+        MPI_Wait(&bcast_req, MPI_STATUS_IGNORE);
     if (addr_buf_ptr)
         addr_buf_ptr = (haddr_t *)H5MM_xfree((void *)addr_buf_ptr);
 
@@ -1210,6 +1261,8 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
     H5AC_t *    cache_ptr;
     H5AC_aux_t *aux_ptr;
     haddr_t *   candidates_list_ptr = NULL;
+    MPI_Request bcast_req           = MPI_REQUEST_NULL; /* Candidate list broadcast */
+    MPI_Request sync_req            = MPI_REQUEST_NULL; /* Sync point barrier */
     int         mpi_result;
     unsigned    num_candidates = 0;
     herr_t      ret_value      = SUCCEED; /* Return value */
@@ -1226,13 +1279,16 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
     HDassert(aux_ptr->metadata_write_strategy == H5AC_METADATA_WRITE_STRATEGY__DISTRIBUTED);
 
     /* to prevent "messages from the future" we must synchronize all
-     * processes before we write any entries.
+     * processes before we write any entries.  Only start the barrier
+     * here -- H5C_apply_candidate_list() completes it just before the
+     * entries are written, so the candidate list exchange and the
+     * serialization of the entries overlap with it.
      */
-    if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
-        HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
+    if (MPI_SUCCESS != (mpi_result = MPI_Ibarrier(aux_ptr->mpi_comm, &sync_req)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Ibarrier failed", mpi_result)
 
     if (aux_ptr->mpi_rank == 0) {
-        if (H5AC__broadcast_candidate_list(cache_ptr, &num_candidates, &candidates_list_ptr) < 0)
+        if (H5AC__broadcast_candidate_list(cache_ptr, &num_candidates, &candidates_list_ptr, &bcast_req) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Can't broadcast candidate slist.")
 
         HDassert(H5SL_count(aux_ptr->candidate_slist_ptr) == 0);
@@ -1255,7 +1311,7 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, cache_ptr, num_candidates, candidates_list_ptr,
-                                          aux_ptr->mpi_rank, aux_ptr->mpi_size);
+                                          aux_ptr->mpi_rank, aux_ptr->mpi_size, &sync_req);
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
@@ -1272,10 +1328,11 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
             (aux_ptr->write_done)();
 
         /* to prevent "messages from the past" we must synchronize all
-         * processes again before we go on.
+         * processes again before we go on.  Process 0 tidies up its
+         * lists while the barrier completes.
          */
-        if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
+        if (MPI_SUCCESS != (mpi_result = MPI_Ibarrier(aux_ptr->mpi_comm, &sync_req)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Ibarrier failed", mpi_result)
 
         /* if this is process zero, tidy up the dirtied,
          * and flushed and still clean lists.
@@ -1285,6 +1342,12 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
                 HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Can't tidy up process 0 lists.")
     } /* end if */
 
+    /* Complete the outstanding broadcast and barrier */
+    if (MPI_SUCCESS != (mpi_result = MPI_Wait(&bcast_req, MPI_STATUS_IGNORE)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Wait failed", mpi_result)
+    if (MPI_SUCCESS != (mpi_result = MPI_Wait(&sync_req, MPI_STATUS_IGNORE)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Wait failed", mpi_result)
+
     /* if it is defined, call the sync point done callback.  Note
      * that this callback is defined purely for testing purposes,
      * and should be undefined under normal operating circumstances.
@@ -1293,6 +1356,13 @@ H5AC__propagate_and_apply_candidate_list(H5F_t *f)
         (aux_ptr->sync_point_done)(num_candidates, candidates_list_ptr);
 
 done:
+    /* Nonblocking collectives can't be freed, only completed */
+    if (bcast_req != MPI_REQUEST_NULL)
+        if (MPI_SUCCESS != (mpi_result = MPI_Wait(&bcast_req, MPI_STATUS_IGNORE)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Wait failed", mpi_result)
+    if (sync_req != MPI_REQUEST_NULL)
+        if (MPI_SUCCESS != (mpi_result = MPI_Wait(&sync_req, MPI_STATUS_IGNORE)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Wait failed", mpi_result)
     if (candidates_list_ptr)
         candidates_list_ptr = (haddr_t *)H5MM_xfree((void *)candidates_list_ptr);
 
@@ -1423,10 +1493,11 @@ done:
 static herr_t
 H5AC__receive_haddr_list(MPI_Comm mpi_comm, unsigned *num_entries_ptr, haddr_t **haddr_buf_ptr_ptr)
 {
-    haddr_t *haddr_buf_ptr = NULL;
-    int      mpi_result;
-    unsigned num_entries;
-    herr_t   ret_value = SUCCEED; /* Return value */
+    haddr_t *   haddr_buf_ptr = NULL;
+    MPI_Request req           = MPI_REQUEST_NULL;
+    int         mpi_result;
+    unsigned    num_entries;
+    herr_t      ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -1451,10 +1522,15 @@ H5AC__receive_haddr_list(MPI_Comm mpi_comm, unsigned *num_entries_ptr, haddr_t *
         if (NULL == (haddr_buf_ptr = (haddr_t *)H5MM_malloc(buf_size)))
             HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for haddr buffer")
 
-        /* Now receive the list of candidate entries */
+        /* Now receive the list of candidate entries.  Process 0 sends the
+         * list with a nonblocking broadcast, which must be matched by a
+         * nonblocking broadcast here.
+         */
         if (MPI_SUCCESS !=
-            (mpi_result = MPI_Bcast((void *)haddr_buf_ptr, (int)buf_size, MPI_BYTE, 0, mpi_comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_result)
+            (mpi_result = MPI_Ibcast((void *)haddr_buf_ptr, (int)buf_size, MPI_BYTE, 0, mpi_comm, &req)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Ibcast failed", mpi_result)
+        if (MPI_SUCCESS != (mpi_result = MPI_Wait(&req, MPI_STATUS_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Wait failed", mpi_result)
     } /* end if */
 
     /* finally, pass the number of entries and the buffer pointer
@@ -1605,11 +1681,13 @@ done:
  *		each entry on the candidate list to exactly one process for
  *		flushing.
  *
- *		At this point, all processes participate in a barrier to
- *		avoid messages from the past/future bugs.
+ *		At this point, all processes start a nonblocking barrier
+ *		to avoid messages from the past/future bugs.
  *
- *		Each process then flushes the entries assigned to it, and
- *		marks all other entries on the candidate list as clean.
+ *		Each process then serializes the entries assigned to it,
+ *		and marks all other entries on the candidate list as clean.
+ *		Once the barrier completes, the serialized entries are
+ *		written in one collective vectored write.
  *
  *		Finally, all processes participate in a second barrier to
  *		avoid messages from the past/future bugs.
@@ -1635,6 +1713,7 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
     H5AC_t *    cache_ptr;
     H5AC_aux_t *aux_ptr;
     haddr_t *   haddr_buf_ptr = NULL;
+    MPI_Request sync_req      = MPI_REQUEST_NULL; /* Sync point barrier */
     int         mpi_result;
     unsigned    num_entries = 0;
     herr_t      ret_value   = SUCCEED; /* Return value */
@@ -1669,17 +1748,20 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
          *
          * When flushing from within the close operation from a file,
          * it's possible to skip this barrier (on the second flush of the cache).
+         *
+         * The barrier is only started here, and completed by
+         * H5C_apply_candidate_list() just before the entries are written.
          */
         if (!H5CX_get_mpi_file_flushing())
-            if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
+            if (MPI_SUCCESS != (mpi_result = MPI_Ibarrier(aux_ptr->mpi_comm, &sync_req)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Ibarrier failed", mpi_result)
 
         /* Enable writes during this operation */
         aux_ptr->write_permitted = TRUE;
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, cache_ptr, num_entries, haddr_buf_ptr, aux_ptr->mpi_rank,
-                                          aux_ptr->mpi_size);
+                                          aux_ptr->mpi_size, &sync_req);
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
@@ -1695,9 +1777,11 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
         if (aux_ptr->write_done)
             (aux_ptr->write_done)();
 
-        /* final sync point barrier */
-        if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
+        /* final sync point barrier, which completes while process 0
+         * tidies up its lists
+         */
+        if (MPI_SUCCESS != (mpi_result = MPI_Ibarrier(aux_ptr->mpi_comm, &sync_req)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Ibarrier failed", mpi_result)
 
         /* if this is process zero, tidy up the dirtied,
          * and flushed and still clean lists.
@@ -1705,6 +1789,9 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
         if (aux_ptr->mpi_rank == 0)
             if (H5AC__tidy_cache_0_lists(cache_ptr, num_entries, haddr_buf_ptr) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Can't tidy up process 0 lists.")
+
+        if (MPI_SUCCESS != (mpi_result = MPI_Wait(&sync_req, MPI_STATUS_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Wait failed", mpi_result)
     } /* end if */
 
     /* if it is defined, call the sync point done callback.  Note
@@ -1715,6 +1802,10 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
         (aux_ptr->sync_point_done)(num_entries, haddr_buf_ptr);
 
 done:
+    /* Nonblocking collectives can't be freed, only completed */
+    if (sync_req != MPI_REQUEST_NULL)
+        if (MPI_SUCCESS != (mpi_result = MPI_Wait(&sync_req, MPI_STATUS_IGNORE)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Wait failed", mpi_result)
     if (haddr_buf_ptr)
         haddr_buf_ptr = (haddr_t *)H5MM_xfree((void *)haddr_buf_ptr);
 
@@ -1738,11 +1829,11 @@ done:
  *		within its min clean requirement.  Note that this list
  *		(the candidate list) may be empty.
  *
- *              Then, all processes participate in a barrier.
+ *              Then, all processes start a nonblocking barrier.
  *
- *		After the barrier, process 0 broadcasts the number of
- *		entries in the candidate list prepared above, and all
- *		other processes receive this number.
+ *		Process 0 then broadcasts the number of entries in the
+ *		candidate list prepared above, and all other processes
+ *		receive this number.
  *
  *		If this number is zero, we are done, and the function
  *		returns without further action.
@@ -1754,8 +1845,10 @@ done:
  *		each entry on the candidate list to exactly one process
  *		for flushing.
  *
- *		Each process then flushes the entries assigned to it, and
- *		marks all other entries on the candidate list as clean.
+ *		Each process then serializes the entries assigned to it,
+ *		and marks all other entries on the candidate list as clean.
+ *		Once the barrier completes, the serialized entries are
+ *		written in one collective vectored write.
  *
  *		Finally, all processes participate in a second barrier to
  *		avoid messages from the past/future bugs.
@@ -2098,6 +2191,13 @@ H5AC__run_sync_point(H5F_t *f, int sync_point_op)
     HDassert((sync_point_op == H5AC_SYNC_POINT_OP__FLUSH_TO_MIN_CLEAN) ||
              (sync_point_op == H5AC_METADATA_WRITE_STRATEGY__DISTRIBUTED));
 
+    /* Process 0 can't run a sync point by itself while recording a bulk
+     * collective metadata read.  Failing makes all processes redo the
+     * operation, reaching the sync point together.
+     */
+    if (H5C_coll_bulk_read_recording())
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't run a sync point during a bulk collective read")
+
 #if H5AC_DEBUG_DIRTY_BYTES_CREATION
     HDfprintf(stdout, "%d:H5AC_propagate...:%u: (u/uu/i/iu/r/ru) = %zu/%u/%zu/%u/%zu/%u\n", aux_ptr->mpi_rank,
               aux_ptr->dirty_bytes_propagations, aux_ptr->unprotect_dirty_bytes,
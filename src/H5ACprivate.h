@@ -168,6 +168,9 @@ typedef H5C_notify_action_t H5AC_notify_action_t;
 #define H5AC_NOTIFY_ACTION_CHILD_UNSERIALIZED H5C_NOTIFY_ACTION_CHILD_UNSERIALIZED
 #define H5AC_NOTIFY_ACTION_CHILD_SERIALIZED   H5C_NOTIFY_ACTION_CHILD_SERIALIZED
 
+/* Operation run by a bulk collective metadata read */
+typedef H5C_coll_bulk_read_op_t H5AC_coll_bulk_read_op_t;
+
 #define H5AC__CLASS_NO_FLAGS_SET          H5C__CLASS_NO_FLAGS_SET
 #define H5AC__CLASS_SPECULATIVE_LOAD_FLAG H5C__CLASS_SPECULATIVE_LOAD_FLAG
 
@@ -443,6 +446,7 @@ H5_DLL herr_t              H5AC_proxy_entry_dest(H5AC_proxy_entry_t *pentry);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5AC_add_candidate(H5AC_t *cache_ptr, haddr_t addr);
+H5_DLL herr_t H5AC_coll_bulk_read(H5F_t *f, H5AC_coll_bulk_read_op_t op, void *op_data, hbool_t *bulk_read);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Debugging functions */
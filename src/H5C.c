@@ -155,6 +155,9 @@ static herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t
 static herr_t H5C__verify_len_eoa(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len,
                                   hbool_t actual);
 
+static herr_t H5C__borrow_entry_image(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len,
+                                      void *udata, const uint8_t **image);
+
 #if H5C_DO_SLIST_SANITY_CHECKS
 static hbool_t H5C__entry_in_skip_list(H5C_t *cache_ptr, H5C_cache_entry_t *target_ptr);
 #endif /* H5C_DO_SLIST_SANITY_CHECKS */
@@ -422,6 +425,10 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->coll_head_ptr   = NULL;
     cache_ptr->coll_tail_ptr   = NULL;
     cache_ptr->coll_write_list = NULL;
+
+    cache_ptr->coll_bulk_mode   = H5C_COLL_BULK_READ_NONE;
+    cache_ptr->coll_bulk_images = NULL;
+    cache_ptr->coll_bulk_size   = (size_t)0;
 #endif /* H5_HAVE_PARALLEL */
 
 #if H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS
@@ -1371,6 +1378,7 @@ H5C_insert_entry(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *thing, u
 
     entry_ptr->image_ptr        = NULL;
     entry_ptr->image_up_to_date = FALSE;
+    entry_ptr->image_borrowed   = FALSE;
 
     entry_ptr->is_protected = FALSE;
     entry_ptr->is_read_only = FALSE;
@@ -2059,7 +2067,11 @@ H5C_resize_entry(void *thing, size_t new_size)
         } /* end if */
 
         /* Release the current image */
-        if (entry_ptr->image_ptr)
+        if (entry_ptr->image_borrowed) {
+            entry_ptr->image_ptr      = NULL;
+            entry_ptr->image_borrowed = FALSE;
+        } /* end if */
+        else if (entry_ptr->image_ptr)
             entry_ptr->image_ptr = H5MM_xfree(entry_ptr->image_ptr);
 
         /* do a flash cache size increase if appropriate */
@@ -2256,6 +2268,18 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, NULL, "an extreme sanity check failed on entry")
 #endif /* H5C_DO_EXTREME_SANITY_CHECKS */
 
+#ifdef H5_HAVE_PARALLEL
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        coll_access = H5CX_get_coll_metadata_read();
+
+    /* A process recording a bulk collective read of another file can't
+     * broadcast metadata for this one
+     */
+    if (coll_access && cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_NONE &&
+        H5C_coll_bulk_read_recording())
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, NULL, "can't read metadata collectively during a bulk read")
+#endif /* H5_HAVE_PARALLEL */
+
     /* Load the cache image, if requested */
     if (cache_ptr->load_image) {
         cache_ptr->load_image = FALSE;
@@ -2269,11 +2293,6 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     /* Get the ring type from the API context */
     ring = H5CX_get_ring();
 
-#ifdef H5_HAVE_PARALLEL
-    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
-        coll_access = H5CX_get_coll_metadata_read();
-#endif /* H5_HAVE_PARALLEL */
-
     /* first check to see if the target is in cache */
     H5C__SEARCH_INDEX(cache_ptr, addr, entry_ptr, NULL)
 
@@ -2309,7 +2328,21 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
                bcast. */
 #ifdef H5_HAVE_PARALLEL
         if (coll_access) {
-            if (!(entry_ptr->is_dirty) && !(entry_ptr->coll_access)) {
+            if (!(entry_ptr->is_dirty) && !(entry_ptr->coll_access) &&
+                cache_ptr->coll_bulk_mode != H5C_COLL_BULK_READ_NONE) {
+                /* In a bulk read, process 0 records the entry's image in case
+                 * other processes need to load it, instead of broadcasting it
+                 */
+                if (cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_RECORD && entry_ptr->image_ptr)
+                    if (H5C__coll_bulk_read_record(cache_ptr, addr, entry_ptr->size, entry_ptr->image_ptr) <
+                        0)
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, NULL, "can't record entry's image")
+
+                /* Mark the entry as collective and insert into the collective list */
+                entry_ptr->coll_access = TRUE;
+                H5C__INSERT_IN_COLL_LIST(cache_ptr, entry_ptr, NULL)
+            } /* end if */
+            else if (!(entry_ptr->is_dirty) && !(entry_ptr->coll_access)) {
                 MPI_Comm comm;     /* File MPI Communicator */
                 int      mpi_code; /* MPI error code */
                 int      buf_size;
@@ -2344,7 +2377,10 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
                 entry_ptr->coll_access = TRUE;
                 H5C__INSERT_IN_COLL_LIST(cache_ptr, entry_ptr, NULL)
             } /* end if */
-            else if (entry_ptr->coll_access) {
+            else if (entry_ptr->coll_access && cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_NONE) {
+                /* Entries stay in place during a bulk read, so that the
+                 * entries it marks as collective stay at the head
+                 */
                 H5C__MOVE_TO_TOP_IN_COLL_LIST(cache_ptr, entry_ptr, NULL)
             } /* end else-if */
         }     /* end if */
@@ -2617,8 +2653,10 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     } /* end if */
 
 #ifdef H5_HAVE_PARALLEL
-    /* Make sure the size of the collective entries in the cache remain in check */
-    if (coll_access)
+    /* Make sure the size of the collective entries in the cache remain in check
+     * (bulk collective reads check once they are done)
+     */
+    if (coll_access && cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_NONE)
         if (cache_ptr->max_cache_size * 80 < cache_ptr->coll_list_size * 100)
             if (H5C_clear_coll_entries(cache_ptr, TRUE) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, NULL, "can't clear collective metadata entries")
@@ -6859,9 +6897,10 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
          *
          * Otherwise, free the buffer if it exists.
          */
-        if (suppress_image_entry_frees && entry_ptr->include_in_image) {
+        if ((suppress_image_entry_frees && entry_ptr->include_in_image) || entry_ptr->image_borrowed) {
 
-            entry_ptr->image_ptr = NULL;
+            entry_ptr->image_ptr      = NULL;
+            entry_ptr->image_borrowed = FALSE;
         }
         else if (entry_ptr->image_ptr != NULL) {
 
@@ -7096,6 +7135,82 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__verify_len_eoa() */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__borrow_entry_image
+ *
+ * Purpose:     Attempt to borrow the on-disk image of an entry directly
+ *              from the file driver's memory image of the file, instead
+ *              of reading it into a freshly allocated buffer.
+ *
+ *              On return, *image is NULL when the image can't be borrowed
+ *              (driver doesn't keep the file in memory, the file is
+ *              writable, or the checksum doesn't verify), in which case
+ *              the caller should fall back to reading the entry.
+ *              Otherwise *len holds the final length of the image.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__borrow_entry_image(H5F_t *f, const H5C_class_t *type, haddr_t addr, size_t *len, void *udata,
+                        const uint8_t **image)
+{
+    const void *mem        = NULL;  /* Pointer into the driver's memory image */
+    size_t      actual_len = *len;  /* Final length of the image              */
+    htri_t      chk_ret;            /* Return from verify_chksum callback     */
+    herr_t      ret_value = SUCCEED; /* Return value                          */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f);
+    HDassert(type);
+    HDassert(len && *len > 0);
+    HDassert(image);
+
+    *image = NULL;
+
+    if (H5F_shared_block_borrow(H5F_SHARED(f), type->mem_type, addr, *len, &mem) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't borrow image from file driver")
+    if (NULL == mem)
+        HGOTO_DONE(SUCCEED)
+
+    /* Resolve the actual size of speculatively loaded entries */
+    if (type->flags & H5C__CLASS_SPECULATIVE_LOAD_FLAG) {
+        /* Leave failures to the regular read path, which retries */
+        if (type->get_final_load_size(mem, *len, udata, &actual_len) < 0)
+            HGOTO_DONE(SUCCEED)
+
+        if (actual_len != *len) {
+            /* Verify that the length isn't past the EOA for the file */
+            if (H5C__verify_len_eoa(f, type, addr, &actual_len, TRUE) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "actual_len exceeds EOA")
+
+            if (actual_len > *len) {
+                if (H5F_shared_block_borrow(H5F_SHARED(f), type->mem_type, addr, actual_len, &mem) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't borrow image from file driver")
+                if (NULL == mem)
+                    HGOTO_DONE(SUCCEED)
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    /* Verify the checksum for the metadata image */
+    if (type->verify_chksum) {
+        if ((chk_ret = type->verify_chksum(mem, actual_len, udata)) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "failure from verify_chksum callback")
+        if (chk_ret == FALSE)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    *len   = actual_len;
+    *image = (const uint8_t *)mem;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__borrow_entry_image() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C__load_entry
@@ -7127,11 +7242,13 @@ H5C__load_entry(H5F_t *f,
     H5C_cache_entry_t *entry = NULL;  /* Alias for thing loaded, as cache entry   */
     size_t             len;           /* Size of image in file                    */
 #ifdef H5_HAVE_PARALLEL
-    int      mpi_rank = 0;             /* MPI process rank                         */
-    MPI_Comm comm     = MPI_COMM_NULL; /* File MPI Communicator                    */
-    int      mpi_code;                 /* MPI error code                           */
-#endif                                 /* H5_HAVE_PARALLEL */
-    void *ret_value = NULL;            /* Return value                             */
+    int      mpi_rank  = 0;             /* MPI process rank                         */
+    MPI_Comm comm      = MPI_COMM_NULL; /* File MPI Communicator                    */
+    hbool_t  bulk_read = FALSE;         /* Whether the read is part of a bulk collective read */
+    int      mpi_code;                  /* MPI error code                           */
+#endif                                  /* H5_HAVE_PARALLEL */
+    const uint8_t *borrowed  = NULL; /* Image borrowed from the file driver     */
+    void *         ret_value = NULL; /* Return value                             */
 
     FUNC_ENTER_STATIC
 
@@ -7163,12 +7280,27 @@ H5C__load_entry(H5F_t *f,
         if (H5C__verify_len_eoa(f, type, addr, &len, FALSE) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid len with respect to EOA")
 
-    /* Allocate the buffer for reading the on-disk entry image */
-    if (NULL == (image = (uint8_t *)H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+#if H5C_IMAGE_EXTRA_SPACE == 0
+    /* Try to deserialize straight from the file driver's memory image */
+    if (0 == (type->flags & H5C__CLASS_SKIP_READS)
+#ifdef H5_HAVE_PARALLEL
+        && !coll_access
+#endif /* H5_HAVE_PARALLEL */
+    )
+        if (H5C__borrow_entry_image(f, type, addr, &len, udata, &borrowed) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, NULL, "can't borrow image")
+#endif /* H5C_IMAGE_EXTRA_SPACE == 0 */
+
+    if (borrowed)
+        image = (uint8_t *)(uintptr_t)borrowed;
+    else {
+        /* Allocate the buffer for reading the on-disk entry image */
+        if (NULL == (image = (uint8_t *)H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
 #if H5C_DO_MEMORY_SANITY_CHECKS
-    H5MM_memcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+        H5MM_memcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+    } /* end else */
 
 #ifdef H5_HAVE_PARALLEL
     if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
@@ -7176,11 +7308,14 @@ H5C__load_entry(H5F_t *f,
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "Can't get MPI rank")
         if ((comm = H5F_mpi_get_comm(f)) == MPI_COMM_NULL)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "get_comm request failed")
+
+        /* Bulk collective reads take the place of the broadcast of the image */
+        bulk_read = coll_access && f->shared->cache->coll_bulk_mode != H5C_COLL_BULK_READ_NONE;
     }  /* end if */
 #endif /* H5_HAVE_PARALLEL */
 
     /* Get the on-disk entry image */
-    if (0 == (type->flags & H5C__CLASS_SKIP_READS)) {
+    if (NULL == borrowed && 0 == (type->flags & H5C__CLASS_SKIP_READS)) {
         unsigned tries, max_tries;   /* The # of read attempts               */
         unsigned retries;            /* The # of retries                     */
         htri_t   chk_ret;            /* return from verify_chksum callback   */
@@ -7210,7 +7345,11 @@ H5C__load_entry(H5F_t *f,
             } /* end if */
 
 #ifdef H5_HAVE_PARALLEL
-            if (!coll_access || 0 == mpi_rank) {
+            if (bulk_read) {
+                if (H5C__coll_bulk_read(f, type->mem_type, addr, len, image) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
+            } /* end if */
+            else if (!coll_access || 0 == mpi_rank) {
 #endif /* H5_HAVE_PARALLEL */
                 if (H5F_block_read(f, type->mem_type, addr, len, image) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
@@ -7220,7 +7359,7 @@ H5C__load_entry(H5F_t *f,
              * bcast the metadata read from process 0 to all ranks in the file
              * communicator
              */
-            if (coll_access) {
+            if (coll_access && !bulk_read) {
                 int buf_size;
 
                 H5_CHECKED_ASSIGN(buf_size, int, len, size_t);
@@ -7254,7 +7393,12 @@ H5C__load_entry(H5F_t *f,
 
                     if (actual_len > len) {
 #ifdef H5_HAVE_PARALLEL
-                        if (!coll_access || 0 == mpi_rank) {
+                        if (bulk_read) {
+                            if (H5C__coll_bulk_read(f, type->mem_type, addr + len, actual_len - len,
+                                                    image + len) < 0)
+                                HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't read image")
+                        }
+                        else if (!coll_access || 0 == mpi_rank) {
 #endif /* H5_HAVE_PARALLEL */
                             /* If the thing's image needs to be bigger for a speculatively
                              * loaded thing, go get the on-disk image again (the extra portion).
@@ -7267,7 +7411,7 @@ H5C__load_entry(H5F_t *f,
                         /* If the collective metadata read optimization is turned on,
                          * Bcast the metadata read from process 0 to all ranks in the file
                          * communicator */
-                        if (coll_access) {
+                        if (coll_access && !bulk_read) {
                             int buf_size;
 
                             H5_CHECKED_ASSIGN(buf_size, int, actual_len - len, size_t);
@@ -7324,6 +7468,16 @@ H5C__load_entry(H5F_t *f,
 
     entry = (H5C_cache_entry_t *)thing;
 
+    /* A borrowed image can't be serialized into, so give entries that
+     * were dirtied during deserialization a private copy.
+     */
+    if (borrowed && dirty) {
+        if (NULL == (image = (uint8_t *)H5MM_malloc(len)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+        H5MM_memcpy(image, borrowed, len);
+        borrowed = NULL;
+    } /* end if */
+
     /* In general, an entry should be clean just after it is loaded.
      *
      * However, when this code is used in the metadata cache, it is
@@ -7352,6 +7506,7 @@ H5C__load_entry(H5F_t *f,
     HDassert(entry->size < H5C_MAX_ENTRY_SIZE);
     entry->image_ptr        = image;
     entry->image_up_to_date = !dirty;
+    entry->image_borrowed   = (borrowed != NULL);
     entry->type             = type;
     entry->is_dirty         = dirty;
     entry->dirtied          = FALSE;
@@ -7427,7 +7582,7 @@ done:
         /* Release resources */
         if (thing && type->free_icr(thing) < 0)
             HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, NULL, "free_icr callback failed")
-        if (image)
+        if (image && (const uint8_t *)image != borrowed)
             image = (uint8_t *)H5MM_xfree(image);
     } /* end if */
 
@@ -8972,6 +9127,19 @@ H5C__generate_image(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr)
     HDassert(!entry_ptr->is_protected);
     HDassert(entry_ptr->type);
 
+    /* An image borrowed from the file driver is read-only -- switch the
+     * entry to a private buffer before serializing into it.
+     */
+    if (entry_ptr->image_borrowed) {
+        if (NULL == (entry_ptr->image_ptr = H5MM_malloc(entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+        entry_ptr->image_borrowed = FALSE;
+#if H5C_DO_MEMORY_SANITY_CHECKS
+        H5MM_memcpy(((uint8_t *)entry_ptr->image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE,
+                    H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+    } /* end if */
+
     /* make note of the entry's current address */
     old_addr = entry_ptr->addr;
 
@@ -9251,7 +9419,11 @@ H5C_remove_entry(void *_entry)
      */
 
     /* Free the buffer for the on disk image */
-    if (entry->image_ptr != NULL)
+    if (entry->image_borrowed) {
+        entry->image_ptr      = NULL;
+        entry->image_borrowed = FALSE;
+    } /* end if */
+    else if (entry->image_ptr != NULL)
         entry->image_ptr = H5MM_xfree(entry->image_ptr);
 
     /* Reset the pointer to the cache the entry is within */
@@ -269,6 +269,12 @@ typedef struct H5CX_t {
                                                 (H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME) */
     hbool_t mpio_global_no_coll_cause_set;   /* Whether global reason for breaking collective I/O is set */
     hbool_t mpio_global_no_coll_cause_valid; /* Whether global reason for breaking collective I/O is valid */
+    double   mpio_type_construct_time;       /* Time spent building MPI datatypes for selections
+                                                (H5D_MPIO_TYPE_CONSTRUCT_TIME_NAME) */
+    hbool_t  mpio_type_construct_time_set;   /* Whether MPI datatype construction time is set */
+    unsigned mpio_type_cache_hits;           /* # of MPI datatypes found in the file's datatype cache
+                                                (H5D_MPIO_TYPE_CACHE_HITS_NAME) */
+    hbool_t  mpio_type_cache_hits_set;       /* Whether MPI datatype cache hits are set */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
     int mpio_coll_chunk_link_hard; /* Instrumented "collective chunk link hard" value
                                       (H5D_XFER_COLL_CHUNK_LINK_HARD_NAME) */
@@ -3277,6 +3283,41 @@ H5CX_set_mpio_global_no_coll_cause(uint32_t mpio_global_no_coll_cause)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_mpio_global_no_coll_cause() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_add_mpio_type_stats
+ *
+ * Purpose:     Adds the time spent building an MPI datatype for a selection,
+ *              and whether the datatype was found in the file's datatype
+ *              cache, to the totals for the current API call context.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_add_mpio_type_stats(double construct_time, unsigned cache_hits)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(head && *head);
+    HDassert((*head)->ctx.dxpl_id != H5P_DEFAULT);
+
+    /* If we're using the default DXPL, don't modify it */
+    if ((*head)->ctx.dxpl_id != H5P_DATASET_XFER_DEFAULT) {
+        /* Cache the values for later, marking them to set in DXPL when context popped */
+        (*head)->ctx.mpio_type_construct_time += construct_time;
+        (*head)->ctx.mpio_type_construct_time_set = TRUE;
+        (*head)->ctx.mpio_type_cache_hits += cache_hits;
+        (*head)->ctx.mpio_type_cache_hits_set = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_add_mpio_type_stats() */
+
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 
 /*-------------------------------------------------------------------------
@@ -3585,6 +3626,8 @@ H5CX__pop_common(hbool_t update_dxpl_props)
         H5CX_SET_PROP(H5D_MPIO_ACTUAL_IO_MODE_NAME, mpio_actual_io_mode)
         H5CX_SET_PROP(H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, mpio_local_no_coll_cause)
         H5CX_SET_PROP(H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME, mpio_global_no_coll_cause)
+        H5CX_SET_PROP(H5D_MPIO_TYPE_CONSTRUCT_TIME_NAME, mpio_type_construct_time)
+        H5CX_SET_PROP(H5D_MPIO_TYPE_CACHE_HITS_NAME, mpio_type_cache_hits)
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
         H5CX_SET_PROP(H5D_XFER_COLL_CHUNK_LINK_HARD_NAME, mpio_coll_chunk_link_hard)
         H5CX_SET_PROP(H5D_XFER_COLL_CHUNK_MULTI_HARD_NAME, mpio_coll_chunk_multi_hard)
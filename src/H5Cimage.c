@@ -606,6 +606,7 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t
     HDassert(ds_entry_ptr->size < H5C_MAX_ENTRY_SIZE);
     ds_entry_ptr->image_ptr        = pf_entry_ptr->image_ptr;
     ds_entry_ptr->image_up_to_date = !dirty;
+    ds_entry_ptr->image_borrowed   = FALSE;
     ds_entry_ptr->type             = type;
     ds_entry_ptr->is_dirty         = dirty | pf_entry_ptr->is_dirty;
     ds_entry_ptr->dirtied          = FALSE;
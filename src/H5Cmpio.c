@@ -48,6 +48,20 @@
 /****************/
 #define H5C_APPLY_CANDIDATE_LIST__DEBUG 0
 
+/* Limit on the size of the images process 0 sends in a bulk collective
+ * metadata read.  Ranges read after the limit is reached aren't recorded,
+ * and are read by every process itself.
+ */
+#define H5C_COLL_BULK_READ_MAX_SIZE (64 * 1024 * 1024)
+
+/* Size of an image in the broadcast of a bulk collective metadata read */
+#define H5C_COLL_BULK_IMAGE_SIZE(len) (sizeof(haddr_t) + sizeof(size_t) + (len))
+
+/* Outcomes of process 0's run of a bulk collective metadata read */
+#define H5C_COLL_BULK_READ_FAILED   0 /* All processes run the operation again */
+#define H5C_COLL_BULK_READ_PACKED   1 /* The images follow in one broadcast */
+#define H5C_COLL_BULK_READ_UNPACKED 2 /* The images follow one by one */
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -60,6 +74,8 @@ static herr_t H5C__flush_candidate_entries(H5F_t *f, unsigned entries_to_flush[H
                                            unsigned entries_to_clear[H5C_RING_NTYPES]);
 static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned entries_to_flush,
                                             unsigned entries_to_clear);
+static herr_t H5C__coll_bulk_image_free_cb(void *item, void *key, void *op_data);
+static herr_t H5C__coll_bulk_unstage_entries(H5C_t *cache_ptr, hbool_t independent);
 
 /*********************/
 /* Package Variables */
@@ -73,6 +89,9 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned
 /* Local Variables */
 /*******************/
 
+/* Cache in a bulk collective metadata read, if any */
+static H5C_t *H5C_coll_bulk_cache_g = NULL;
+
 /*-------------------------------------------------------------------------
  * Function:    H5C_apply_candidate_list
  *
@@ -141,6 +160,13 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned
  *              or marking clean the candidate entries as indicated.
  *              If necessary, we scan the pinned list as well.
  *
+ *              The images of the entries this process flushes are
+ *              gathered and written in one collective vectored write,
+ *              which is why all processes must call this function.  If
+ *              sync_req isn't NULL, it is the request for the barrier
+ *              that starts the sync point, and it is completed just
+ *              before the entries are written.
+ *
  *              Note that this function will fail if any protected or
  *              clean entries appear on the candidate list.
  *
@@ -162,7 +188,7 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, H5C_ring_t ring, unsigned
  */
 herr_t
 H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, haddr_t *candidates_list_ptr,
-                         int mpi_rank, int mpi_size)
+                         int mpi_rank, int mpi_size, MPI_Request *sync_req)
 {
     int                i;
     int                m;
@@ -216,14 +242,13 @@ H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, ha
     HDfprintf(stdout, "%s", tbl_buf);
 #endif /* H5C_APPLY_CANDIDATE_LIST__DEBUG */
 
-    if (f->shared->coll_md_write) {
-        /* Sanity check */
-        HDassert(NULL == cache_ptr->coll_write_list);
-
-        /* Create skip list of entries for collective write */
-        if (NULL == (cache_ptr->coll_write_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for entries")
-    } /* end if */
+    /* All processes apply the candidate list, so defer writing the entries
+     * and write them in one collective operation, whether or not collective
+     * metadata writes were requested for the file.
+     */
+    HDassert(NULL == cache_ptr->coll_write_list);
+    if (NULL == (cache_ptr->coll_write_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for entries")
 
     n = num_candidates / (unsigned)mpi_size;
     if (num_candidates % (unsigned)mpi_size > INT_MAX)
@@ -381,16 +406,19 @@ H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, ha
     if (H5C__flush_candidate_entries(f, entries_to_flush, entries_to_clear) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "flush candidates failed")
 
-    /* If we've deferred writing to do it collectively, take care of that now */
-    if (f->shared->coll_md_write) {
-        /* Sanity check */
-        HDassert(cache_ptr->coll_write_list);
+    /* No process may write before all have reached the sync point */
+    if (sync_req) {
+        int mpi_code;
 
-        /* Write collective list */
-        if (H5C__collective_write(f) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write metadata collectively")
+        if (MPI_SUCCESS != (mpi_code = MPI_Wait(sync_req, MPI_STATUS_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Wait failed", mpi_code)
     } /* end if */
 
+    /* Write the entries we've deferred collectively */
+    HDassert(cache_ptr->coll_write_list);
+    if (H5C__collective_write(f) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write metadata collectively")
+
 done:
     if (candidate_assignment_table != NULL)
         candidate_assignment_table = (unsigned *)H5MM_xfree((void *)candidate_assignment_table);
@@ -934,6 +962,486 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_clear_coll_entries */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C_coll_bulk_read
+ *
+ * Purpose:     Run an operation that reads metadata collectively (such as
+ *              opening an object by name) with one broadcast of all the
+ *              metadata it reads, instead of one broadcast per entry.
+ *
+ *              Process 0 runs the operation first, by itself.  Its loads
+ *              of collectively accessed entries read the file without
+ *              broadcasting, and a copy of every range read is recorded.
+ *              The recorded images are then broadcast together, and the
+ *              other processes run the operation with their loads served
+ *              from the images.  As every process makes the same
+ *              collective accesses in the same order, the entries end up
+ *              marked as collective on all of them, as they would with a
+ *              broadcast for each.
+ *
+ *              If the operation fails on process 0, or needs a collective
+ *              operation of its own (opening a file through an external
+ *              link, say), all processes run it again without the bulk
+ *              read.  The entries process 0 marked as collective by
+ *              itself are marked as independent again first, since the
+ *              other processes haven't seen its reads.  Entries are kept
+ *              in place in the list of collective entries during a bulk
+ *              read, so that this leaves the lists the same on all
+ *              processes, unless process 0 evicted collective entries the
+ *              others still have: then every collective entry is marked
+ *              as independent on all processes.
+ *
+ *              Once the operation succeeds on process 0 it isn't run
+ *              again there, so that the objects it opens aren't lost:
+ *              if there isn't memory to pack the images, they are
+ *              broadcast one by one.
+ *
+ *              *bulk_read is set to FALSE, without running the operation,
+ *              when the metadata reads aren't collective, the file is only
+ *              open on one process, or a bulk read is already under way
+ *              (the operation calling itself back, say).
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_coll_bulk_read(H5F_t *f, H5C_coll_bulk_read_op_t op, void *op_data, hbool_t *bulk_read)
+{
+    H5C_t *                cache_ptr;
+    H5C_coll_bulk_image_t *images = NULL;         /* Images received from process 0 */
+    uint8_t *              buf    = NULL;         /* Packed images */
+    uint64_t               hdr[4] = {0, 0, 0, 0}; /* Outcome, # of images, size of buf, clear all */
+    MPI_Comm               comm     = MPI_COMM_NULL;
+    int                    mpi_rank = 0;
+    int                    mpi_size = 1;
+    int                    mpi_code;
+    herr_t                 op_ret    = FAIL;
+    herr_t                 ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(op);
+    HDassert(bulk_read);
+
+    *bulk_read = FALSE;
+
+    /* Operations nested in a bulk read, and caches with a cache image still
+     * to load (which is broadcast itself), don't use bulk reads
+     */
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) && NULL == H5C_coll_bulk_cache_g && !cache_ptr->load_image &&
+        H5CX_get_coll_metadata_read()) {
+        if (MPI_COMM_NULL == (comm = H5F_mpi_get_comm(f)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "get_comm request failed")
+        if ((mpi_rank = H5F_mpi_get_rank(f)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get MPI rank")
+        if ((mpi_size = H5F_mpi_get_size(f)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get MPI size")
+    } /* end if */
+    if (mpi_size < 2)
+        HGOTO_DONE(SUCCEED)
+
+    *bulk_read            = TRUE;
+    H5C_coll_bulk_cache_g = cache_ptr;
+    if (0 == mpi_rank) {
+        uint32_t coll_list_len = cache_ptr->coll_list_len; /* # of collective entries before the operation */
+
+        /* Run the operation alone, recording the images read */
+        cache_ptr->coll_bulk_mode = H5C_COLL_BULK_READ_RECORD;
+        op_ret                    = (op)(op_data);
+        cache_ptr->coll_bulk_mode = H5C_COLL_BULK_READ_NONE;
+
+        if (op_ret >= 0) {
+            hdr[0] = H5C_COLL_BULK_READ_PACKED;
+            if (cache_ptr->coll_bulk_images && cache_ptr->coll_bulk_size > 0) {
+                hdr[1] = (uint64_t)H5SL_count(cache_ptr->coll_bulk_images);
+                hdr[2] = (uint64_t)cache_ptr->coll_bulk_size;
+
+                /* Pack the images, or send them one by one without the memory to */
+                if (NULL != (buf = (uint8_t *)H5MM_malloc(cache_ptr->coll_bulk_size))) {
+                    H5SL_node_t *node;
+                    uint8_t *    p = buf;
+
+                    for (node = H5SL_first(cache_ptr->coll_bulk_images); node; node = H5SL_next(node)) {
+                        H5C_coll_bulk_image_t *image = (H5C_coll_bulk_image_t *)H5SL_item(node);
+
+                        H5MM_memcpy(p, &image->addr, sizeof(haddr_t));
+                        p += sizeof(haddr_t);
+                        H5MM_memcpy(p, &image->len, sizeof(size_t));
+                        p += sizeof(size_t);
+                        H5MM_memcpy(p, image->image, image->len);
+                        p += image->len;
+                    } /* end for */
+                    HDassert((size_t)(p - buf) == cache_ptr->coll_bulk_size);
+                } /* end if */
+                else
+                    hdr[0] = H5C_COLL_BULK_READ_UNPACKED;
+            } /* end if */
+        }     /* end if */
+        else {
+            H5C_cache_entry_t *entry_ptr;
+            uint32_t           nstaged = 0;
+
+            /* Check whether the entries marked as collective before the
+             * operation are all still there, once the entries marked during
+             * it are left out
+             */
+            for (entry_ptr = cache_ptr->coll_head_ptr; entry_ptr && entry_ptr->coll_bulk_staged;
+                 entry_ptr = entry_ptr->coll_next)
+                nstaged++;
+            hdr[3] = (cache_ptr->coll_list_len - nstaged != coll_list_len);
+        } /* end else */
+
+        if (MPI_SUCCESS != (mpi_code = MPI_Bcast(hdr, (int)sizeof(hdr), MPI_BYTE, 0, comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        if (hdr[0] == H5C_COLL_BULK_READ_PACKED && hdr[2] > 0) {
+            if (MPI_SUCCESS != (mpi_code = MPI_Bcast(buf, (int)hdr[2], MPI_BYTE, 0, comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        } /* end if */
+        else if (hdr[0] == H5C_COLL_BULK_READ_UNPACKED) {
+            H5SL_node_t *node;
+
+            for (node = H5SL_first(cache_ptr->coll_bulk_images); node; node = H5SL_next(node)) {
+                H5C_coll_bulk_image_t *image = (H5C_coll_bulk_image_t *)H5SL_item(node);
+                uint8_t                desc[sizeof(haddr_t) + sizeof(size_t)];
+
+                H5MM_memcpy(desc, &image->addr, sizeof(haddr_t));
+                H5MM_memcpy(desc + sizeof(haddr_t), &image->len, sizeof(size_t));
+                if (MPI_SUCCESS != (mpi_code = MPI_Bcast(desc, (int)sizeof(desc), MPI_BYTE, 0, comm)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+                if (image->len > 0)
+                    if (MPI_SUCCESS !=
+                        (mpi_code = MPI_Bcast(image->image, (int)image->len, MPI_BYTE, 0, comm)))
+                        HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+            } /* end for */
+        }     /* end else-if */
+    }         /* end if */
+    else {
+        if (MPI_SUCCESS != (mpi_code = MPI_Bcast(hdr, (int)sizeof(hdr), MPI_BYTE, 0, comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+
+        if (hdr[0] != H5C_COLL_BULK_READ_FAILED && hdr[2] > 0) {
+            const uint8_t *p;
+            size_t         u;
+
+            if (NULL == (buf = (uint8_t *)H5MM_malloc((size_t)hdr[2])))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for images")
+            if (hdr[0] == H5C_COLL_BULK_READ_PACKED) {
+                if (MPI_SUCCESS != (mpi_code = MPI_Bcast(buf, (int)hdr[2], MPI_BYTE, 0, comm)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+            } /* end if */
+            else {
+                uint8_t *q = buf;
+
+                /* Receive the images one by one, in the packed layout */
+                for (u = 0; u < (size_t)hdr[1]; u++) {
+                    size_t len;
+
+                    if (MPI_SUCCESS != (mpi_code = MPI_Bcast(q, (int)(sizeof(haddr_t) + sizeof(size_t)),
+                                                             MPI_BYTE, 0, comm)))
+                        HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+                    H5MM_memcpy(&len, q + sizeof(haddr_t), sizeof(size_t));
+                    q += sizeof(haddr_t) + sizeof(size_t);
+                    if (len > 0)
+                        if (MPI_SUCCESS != (mpi_code = MPI_Bcast(q, (int)len, MPI_BYTE, 0, comm)))
+                            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+                    q += len;
+                } /* end for */
+                HDassert((uint64_t)(q - buf) == hdr[2]);
+            } /* end else */
+
+            /* Stage the images, pointing into the buffer */
+            if (NULL == (images = (H5C_coll_bulk_image_t *)H5MM_malloc((size_t)hdr[1] *
+                                                                        sizeof(H5C_coll_bulk_image_t))))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for images")
+            if (NULL == (cache_ptr->coll_bulk_images = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't create skip list for images")
+            for (u = 0, p = buf; u < (size_t)hdr[1]; u++) {
+                H5MM_memcpy(&images[u].addr, p, sizeof(haddr_t));
+                p += sizeof(haddr_t);
+                H5MM_memcpy(&images[u].len, p, sizeof(size_t));
+                p += sizeof(size_t);
+                images[u].image = (uint8_t *)(uintptr_t)p;
+                p += images[u].len;
+
+                if (H5SL_insert(cache_ptr->coll_bulk_images, &images[u], &images[u].addr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't insert image into skip list")
+            } /* end for */
+        }     /* end if */
+
+        /* Run the operation, reading from the images */
+        if (hdr[0] != H5C_COLL_BULK_READ_FAILED) {
+            cache_ptr->coll_bulk_mode = H5C_COLL_BULK_READ_STAGED;
+            op_ret                    = (op)(op_data);
+            cache_ptr->coll_bulk_mode = H5C_COLL_BULK_READ_NONE;
+        } /* end if */
+    }     /* end else */
+
+    if (hdr[0] != H5C_COLL_BULK_READ_FAILED) {
+        /* The entries marked as collective are now the same on all processes */
+        if (H5C__coll_bulk_unstage_entries(cache_ptr, FALSE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't reset collective metadata entries")
+
+        /* Keep the size of the collective entries in check, which is
+         * skipped while the images are read, as it depends on the order
+         * the entries were loaded in
+         */
+        if (cache_ptr->max_cache_size * 80 < cache_ptr->coll_list_size * 100)
+            if (H5C_clear_coll_entries(cache_ptr, TRUE) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't clear collective metadata entries")
+    } /* end if */
+    else {
+        /* Run the operation again on all processes, with the entries process
+         * 0 marked as collective by itself marked as independent again (the
+         * cache stays set as the bulk read's, so the operation doesn't start
+         * another)
+         */
+        if (0 == mpi_rank)
+            H5E_clear_stack(NULL);
+        if (hdr[3]) {
+            if (H5C_clear_coll_entries(cache_ptr, FALSE) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't clear collective metadata entries")
+        } /* end if */
+        else if (H5C__coll_bulk_unstage_entries(cache_ptr, TRUE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't clear collective metadata entries")
+        op_ret = (op)(op_data);
+    } /* end else */
+
+    if (op_ret < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "operation failed")
+
+done:
+    if (*bulk_read) {
+        cache_ptr->coll_bulk_mode = H5C_COLL_BULK_READ_NONE;
+        H5C_coll_bulk_cache_g     = NULL;
+
+        /* Don't leave entries marked as staged after an error */
+        if (ret_value < 0 && H5C__coll_bulk_unstage_entries(cache_ptr, FALSE) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't reset collective metadata entries")
+
+        /* Release the images (which point into the buffer on processes other than 0) */
+        if (cache_ptr->coll_bulk_images) {
+            if (images) {
+                if (H5SL_close(cache_ptr->coll_bulk_images) < 0)
+                    HDONE_ERROR(H5E_CACHE, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list for images")
+            } /* end if */
+            else if (H5SL_destroy(cache_ptr->coll_bulk_images, H5C__coll_bulk_image_free_cb, NULL) < 0)
+                HDONE_ERROR(H5E_CACHE, H5E_CANTCLOSEOBJ, FAIL, "can't destroy skip list for images")
+            cache_ptr->coll_bulk_images = NULL;
+        } /* end if */
+        cache_ptr->coll_bulk_size = 0;
+    } /* end if */
+    H5MM_xfree(images);
+    H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_coll_bulk_read */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C_coll_bulk_read_recording
+ *
+ * Purpose:     Check whether this process is running an operation by
+ *              itself, recording the metadata it reads for a bulk
+ *              collective metadata read.  Collective operations can't be
+ *              made while recording.
+ *
+ * Return:      TRUE if recording, FALSE otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5C_coll_bulk_read_recording(void)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    FUNC_LEAVE_NOAPI(H5C_coll_bulk_cache_g &&
+                     H5C_coll_bulk_cache_g->coll_bulk_mode == H5C_COLL_BULK_READ_RECORD)
+} /* H5C_coll_bulk_read_recording */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__coll_bulk_read
+ *
+ * Purpose:     Read a range of the file for a collectively accessed entry
+ *              during a bulk collective metadata read.  Process 0 reads
+ *              the file and records the image, while the other processes
+ *              copy the range from the images received from process 0,
+ *              falling back to reading the file themselves for ranges
+ *              that weren't recorded.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__coll_bulk_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t len, void *buf)
+{
+    H5C_t *cache_ptr;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->coll_bulk_mode != H5C_COLL_BULK_READ_NONE);
+    HDassert(buf);
+
+    if (cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_STAGED && cache_ptr->coll_bulk_images) {
+        H5C_coll_bulk_image_t *image;
+
+        if (NULL != (image = (H5C_coll_bulk_image_t *)H5SL_less(cache_ptr->coll_bulk_images, &addr)) &&
+            H5F_addr_le(addr + len, image->addr + image->len)) {
+            H5MM_memcpy(buf, image->image + (addr - image->addr), len);
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    }     /* end if */
+
+    if (H5F_block_read(f, type, addr, len, buf) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read image")
+
+    if (cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_RECORD)
+        if (H5C__coll_bulk_read_record(cache_ptr, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't record image")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__coll_bulk_read */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__coll_bulk_read_record
+ *
+ * Purpose:     Record an image on process 0 for the broadcast at the end
+ *              of a bulk collective metadata read.  A longer image for an
+ *              address replaces a shorter one, and images past the size
+ *              limit of the broadcast are dropped.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__coll_bulk_read_record(H5C_t *cache_ptr, haddr_t addr, size_t len, const void *image)
+{
+    H5C_coll_bulk_image_t *bulk_image = NULL;
+    herr_t                 ret_value  = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->coll_bulk_mode == H5C_COLL_BULK_READ_RECORD);
+    HDassert(image);
+
+    if (NULL == cache_ptr->coll_bulk_images)
+        if (NULL == (cache_ptr->coll_bulk_images = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't create skip list for images")
+
+    /* Check for an image already recorded at the address (from a retried read) */
+    if (NULL != (bulk_image = (H5C_coll_bulk_image_t *)H5SL_search(cache_ptr->coll_bulk_images, &addr))) {
+        if (len <= bulk_image->len) {
+            H5MM_memcpy(bulk_image->image, image, len);
+            bulk_image = NULL;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        if (NULL == H5SL_remove(cache_ptr->coll_bulk_images, &addr))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTREMOVE, FAIL, "can't remove image from skip list")
+        cache_ptr->coll_bulk_size -= H5C_COLL_BULK_IMAGE_SIZE(bulk_image->len);
+        bulk_image = (H5C_coll_bulk_image_t *)H5MM_xfree(bulk_image);
+    } /* end if */
+
+    if (cache_ptr->coll_bulk_size + H5C_COLL_BULK_IMAGE_SIZE(len) > H5C_COLL_BULK_READ_MAX_SIZE)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate the image along with its description */
+    if (NULL == (bulk_image = (H5C_coll_bulk_image_t *)H5MM_malloc(sizeof(H5C_coll_bulk_image_t) + len)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for image")
+    bulk_image->addr  = addr;
+    bulk_image->len   = len;
+    bulk_image->image = (uint8_t *)(bulk_image + 1);
+    H5MM_memcpy(bulk_image->image, image, len);
+
+    if (H5SL_insert(cache_ptr->coll_bulk_images, bulk_image, &bulk_image->addr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't insert image into skip list")
+    cache_ptr->coll_bulk_size += H5C_COLL_BULK_IMAGE_SIZE(len);
+    bulk_image = NULL;
+
+done:
+    H5MM_xfree(bulk_image);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__coll_bulk_read_record */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__coll_bulk_image_free_cb
+ *
+ * Purpose:     Skip list callback to free an image recorded by process 0.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__coll_bulk_image_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    H5MM_xfree(item);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__coll_bulk_image_free_cb */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__coll_bulk_unstage_entries
+ *
+ * Purpose:     Reset the entries marked as collective during a bulk
+ *              collective metadata read, which are at the head of the
+ *              list of collective entries, optionally marking them as
+ *              independent again.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__coll_bulk_unstage_entries(H5C_t *cache_ptr, hbool_t independent)
+{
+    H5C_cache_entry_t *entry_ptr;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    entry_ptr = cache_ptr->coll_head_ptr;
+    while (entry_ptr && entry_ptr->coll_bulk_staged) {
+        H5C_cache_entry_t *next_ptr = entry_ptr->coll_next;
+
+        entry_ptr->coll_bulk_staged = FALSE;
+        if (independent) {
+            entry_ptr->coll_access = FALSE;
+            H5C__REMOVE_FROM_COLL_LIST(cache_ptr, entry_ptr, FAIL)
+        } /* end if */
+
+        entry_ptr = next_ptr;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__coll_bulk_unstage_entries */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C__collective_write
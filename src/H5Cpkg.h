@@ -3470,8 +3470,11 @@ if ( ( (entry_ptr) == NULL ) ||                                                \
     HDassert( (cache_ptr)->magic == H5C__H5C_T_MAGIC );                 \
     HDassert( (entry_ptr) );                                            \
                                                                         \
-    /* insert the entry at the head of the list. */                     \
+    /* insert the entry at the head of the list, noting whether it */   \
+    /* was marked as collective during a bulk collective read. */       \
                                                                         \
+    (entry_ptr)->coll_bulk_staged =                                     \
+        ((cache_ptr)->coll_bulk_mode != H5C_COLL_BULK_READ_NONE);       \
     H5C__COLL_DLL_PREPEND((entry_ptr), (cache_ptr)->coll_head_ptr,      \
                           (cache_ptr)->coll_tail_ptr,                   \
                           (cache_ptr)->coll_list_len,                   \
@@ -3584,6 +3587,46 @@ typedef struct H5C_tag_info_t {
     hbool_t corked;             /* Whether this object is corked */
 } H5C_tag_info_t;
 
+#ifdef H5_HAVE_PARALLEL
+/****************************************************************************
+ *
+ * enum H5C_coll_bulk_read_mode_t
+ *
+ * Role of the cache in a bulk collective metadata read (see
+ * H5C_coll_bulk_read()).  While process 0 is recording, it runs the
+ * operation by itself, reading the metadata it needs without broadcasting
+ * it and keeping a copy of each image read.  The copies are then broadcast
+ * to the other processes together, which stage them and run the operation
+ * with their reads served from the staged images.
+ *
+ ****************************************************************************/
+typedef enum H5C_coll_bulk_read_mode_t {
+    H5C_COLL_BULK_READ_NONE,   /* Not in a bulk collective read */
+    H5C_COLL_BULK_READ_RECORD, /* Process 0, recording images */
+    H5C_COLL_BULK_READ_STAGED  /* Other processes, reading staged images */
+} H5C_coll_bulk_read_mode_t;
+
+/****************************************************************************
+ *
+ * structure H5C_coll_bulk_image_t
+ *
+ * Image of a range of the file read by process 0 during a bulk collective
+ * metadata read, kept in the cache's coll_bulk_images skip list.
+ *
+ * addr: File address of the image (must be first, for skiplist).
+ *
+ * len: Length of the image in bytes.
+ *
+ * image: Pointer to the image.
+ *
+ ****************************************************************************/
+typedef struct H5C_coll_bulk_image_t {
+    haddr_t  addr;  /* File address of the image (must be first, for skiplist) */
+    size_t   len;   /* Length of the image */
+    uint8_t *image; /* Image */
+} H5C_coll_bulk_image_t;
+#endif /* H5_HAVE_PARALLEL */
+
 
 /****************************************************************************
  *
@@ -4908,6 +4951,11 @@ struct H5C_t {
 
     /* Fields for collective metadata writes */
     H5SL_t *                    coll_write_list;
+
+    /* Fields for bulk collective metadata reads */
+    H5C_coll_bulk_read_mode_t   coll_bulk_mode;
+    H5SL_t *                    coll_bulk_images;
+    size_t                      coll_bulk_size;
 #endif /* H5_HAVE_PARALLEL */
 
     /* Fields for automatic cache size adjustment */
@@ -5063,6 +5111,10 @@ typedef int (*H5C_tag_iter_cb_t)(H5C_cache_entry_t *entry, void *ctx);
 /* Package Private Prototypes */
 /******************************/
 H5_DLL herr_t H5C__prep_image_for_file_close(H5F_t *f, hbool_t *image_generated);
+#ifdef H5_HAVE_PARALLEL
+H5_DLL herr_t H5C__coll_bulk_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t len, void *buf);
+H5_DLL herr_t H5C__coll_bulk_read_record(H5C_t *cache_ptr, haddr_t addr, size_t len, const void *image);
+#endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t * cache_ptr,
     H5C_cache_entry_t** entry_ptr_ptr, const H5C_class_t * type, haddr_t addr,
     void * udata);
@@ -903,6 +903,9 @@ typedef struct H5C_class_t {
 typedef herr_t (*H5C_write_permitted_func_t)(const H5F_t *f, hbool_t *write_permitted_ptr);
 typedef herr_t (*H5C_log_flush_func_t)(H5C_t *cache_ptr, haddr_t addr, hbool_t was_dirty, unsigned flags);
 
+/* Type definition of the operation run by a bulk collective metadata read */
+typedef herr_t (*H5C_coll_bulk_read_op_t)(void *op_data);
+
 /****************************************************************************
  *
  * H5C_ring_t & associated #defines
@@ -1017,6 +1020,12 @@ typedef int H5C_ring_t;
  * image_up_to_date:  Boolean flag that is set to TRUE when *image_ptr
  *         is up to date, and set to false when the entry is dirtied.
  *
+ * image_borrowed:  Boolean flag that is set to TRUE when *image_ptr
+ *         points into the memory image of the file kept by the file
+ *         driver, rather than a buffer owned by the cache.  Such an image
+ *         is read-only and must not be freed; it is replaced with a
+ *         private buffer before the entry is serialized.
+ *
  * type:    Pointer to the instance of H5C_class_t containing pointers
  *        to the methods for cache entries of the current type.  This
  *        field should be NULL when the instance of H5C_cache_entry_t
@@ -1596,6 +1605,7 @@ typedef struct H5C_cache_entry_t {
     size_t             size;
     void *             image_ptr;
     hbool_t            image_up_to_date;
+    hbool_t            image_borrowed;
     const H5C_class_t *type;
     hbool_t            is_dirty;
     hbool_t            dirtied;
@@ -1610,6 +1620,7 @@ typedef struct H5C_cache_entry_t {
     hbool_t clear_on_unprotect;
     hbool_t flush_immediately;
     hbool_t coll_access;
+    hbool_t coll_bulk_staged;
 #endif /* H5_HAVE_PARALLEL */
     hbool_t flush_in_progress;
     hbool_t destroy_in_progress;
@@ -2300,10 +2311,13 @@ H5_DLL herr_t H5C_get_logging_status(const H5C_t *cache, /*OUT*/ hbool_t *is_ena
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates,
-                                       haddr_t *candidates_list_ptr, int mpi_rank, int mpi_size);
+                                       haddr_t *candidates_list_ptr, int mpi_rank, int mpi_size,
+                                       MPI_Request *sync_req);
 H5_DLL herr_t H5C_construct_candidate_list__clean_cache(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_construct_candidate_list__min_clean(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_clear_coll_entries(H5C_t *cache_ptr, hbool_t partial);
+H5_DLL herr_t H5C_coll_bulk_read(H5F_t *f, H5C_coll_bulk_read_op_t op, void *op_data, hbool_t *bulk_read);
+H5_DLL hbool_t H5C_coll_bulk_read_recording(void);
 H5_DLL herr_t H5C_mark_entries_as_clean(H5F_t *f, unsigned ce_array_len, haddr_t *ce_array_ptr);
 #endif /* H5_HAVE_PARALLEL */
 
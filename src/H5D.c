@@ -1259,6 +1259,68 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_chunks
+ *
+ * Purpose:     Writes a batch of entire chunks to the file directly,
+ *              inserting the new ones into the chunk index together.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const uint32_t filters[],
+                const hsize_t *offsets[], const size_t data_sizes[], const void *bufs[])
+{
+    H5VL_object_t *vol_obj = NULL;
+    size_t         u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*Iu**h*z**x", dset_id, dxpl_id, count, filters, offsets, data_sizes, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset ID")
+    if (count > 0) {
+        if (!filters)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters cannot be NULL")
+        if (!offsets)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+        if (!data_sizes)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data_sizes cannot be NULL")
+        if (!bufs)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs cannot be NULL")
+    } /* end if */
+    for (u = 0; u < count; u++) {
+        if (!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf cannot be NULL, chunk = %zu", u)
+        if (!offsets[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offset cannot be NULL, chunk = %zu", u)
+        if (0 == data_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data_size cannot be zero, chunk = %zu", u)
+
+        /* Make sure data size is less than 4 GiB */
+        if (data_sizes[u] != (size_t)(uint32_t)data_sizes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid data_size - chunks cannot be > 4 GiB")
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Write chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI, dxpl_id, H5_REQUEST_NULL, count,
+                              filters, offsets, data_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_chunks() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dscatter
  *
@@ -142,6 +142,7 @@ const H5D_chunk_ops_t H5D_COPS_BT2[1] = {{
     H5D__bt2_idx_create,         /* create */
     H5D__bt2_idx_is_space_alloc, /* is_space_alloc */
     H5D__bt2_idx_insert,         /* insert */
+    NULL,                        /* bulk_insert */
     H5D__bt2_idx_get_addr,       /* get_addr */
     NULL,                        /* resize */
     H5D__bt2_idx_iterate,        /* iterate */
@@ -106,6 +106,11 @@
 
 /*#define H5D_CHUNK_DEBUG */
 
+/* Number of newly allocated chunks gathered before they are inserted into
+ * the chunk index together
+ */
+#define H5D_CHUNK_BULK_NRECS 8192
+
 /* Flags for the "edge_chunk_state" field below */
 #define H5D_RDCC_DISABLE_FILTERS 0x01u /* Disable filters on this chunk */
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS                                                                      \
@@ -243,8 +248,29 @@ typedef struct H5D_chunk_coll_info_t {
     size_t   num_io; /* Number of write operations */
     haddr_t *addr;   /* array of the file addresses of the write operation */
 } H5D_chunk_coll_info_t;
+
+/* Chunk placed without the other processes' knowledge, exchanged at a collective operation */
+typedef struct H5D_chunk_arena_t {
+    hsize_t index;                    /* Linear index of the chunk (skip list key) */
+    hsize_t scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    haddr_t addr;                     /* Address of the chunk in this process's arena */
+    hbool_t full;                     /* Whether the chunk is completely written by the operation */
+} H5D_chunk_arena_t;
 #endif /* H5_HAVE_PARALLEL */
 
+/* Run of chunks, adjacent in the file, to fill with a single write */
+typedef struct H5D_chunk_fill_run_t {
+    haddr_t     addr;             /* File address of the first chunk in the run */
+    size_t      chunk_size;       /* Size of each chunk in the run */
+    size_t      nchunks;          /* Number of chunks in the run */
+    size_t      max_nchunks;      /* Maximum number of chunks in a run */
+    const void *fill_buf;         /* Fill (possibly filtered) image of each chunk */
+    void *      batch_buf;        /* Buffer holding copies of the fill image */
+    size_t      batch_nchunks;    /* Number of copies of the fill image in batch_buf */
+    const void *batch_fill_buf;   /* Fill image copied into batch_buf */
+    size_t      batch_chunk_size; /* Size of the fill image copied into batch_buf */
+} H5D_chunk_fill_run_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -303,16 +329,28 @@ static herr_t   H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, h
 static herr_t   H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush);
 static hbool_t  H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims, const uint32_t *chunk_dims,
                                                  const hsize_t *chunk_scaled, const hsize_t *dset_dims);
+static int      H5D__chunk_bulk_rec_cmp(const void *rec1, const void *rec2);
 static void *   H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t relax,
                                 hbool_t prev_unfilt_chunk);
 static herr_t   H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbool_t dirty,
                                   void *chunk, uint32_t naccessed);
 static herr_t   H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
 static herr_t   H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
+static herr_t   H5D__chunk_fill_run_add(H5F_shared_t *f_sh, H5D_chunk_fill_run_t *run, haddr_t addr,
+                                        size_t chunk_size, const void *fill_buf);
+static herr_t   H5D__chunk_fill_run_flush(H5F_shared_t *f_sh, H5D_chunk_fill_run_t *run);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, H5D_chunk_coll_info_t *chunk_info,
                                          size_t chunk_size, const void *fill_buf);
 static int    H5D__chunk_cmp_addr(const void *addr1, const void *addr2);
+static herr_t H5D__chunk_arena_insert(const H5D_t *dset, const H5D_chunk_info_t *chunk_info,
+                                      H5D_chunk_ud_t *udata, hbool_t full);
+static herr_t H5D__chunk_arena_fill_init(const H5D_t *dset, H5D_fill_buf_info_t *fb_info,
+                                         hbool_t *fb_info_init);
+static herr_t H5D__chunk_arena_gather(const H5D_t *dset, H5D_chunk_arena_t *local, size_t nlocal,
+                                      H5D_chunk_arena_t **all, size_t *ntotal);
+static int    H5D__chunk_arena_cmp(const void *rec1, const void *rec2);
+static herr_t H5D__chunk_arena_free_cb(void *item, void *key, void *opdata);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Debugging helper routine callback */
@@ -354,6 +392,11 @@ H5FL_DEFINE(H5D_chunk_info_t);
 /* Declare a free list to manage the chunk sequence information */
 H5FL_BLK_DEFINE_STATIC(chunk);
 
+#ifdef H5_HAVE_PARALLEL
+/* Declare a free list to manage the H5D_chunk_arena_t struct */
+H5FL_DEFINE_STATIC(H5D_chunk_arena_t);
+#endif /* H5_HAVE_PARALLEL */
+
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
@@ -473,6 +516,196 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__chunk_direct_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_write_multi
+ *
+ * Purpose:     Internal routine to write a batch of chunks directly into
+ *              the file.  The chunks are allocated and written one by one,
+ *              then the new ones are inserted into the chunk index
+ *              together, with H5D__chunk_bulk_insert().
+ *
+ *              A chunk may only appear once in a batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_write_multi(const H5D_t *dset, size_t count, const uint32_t filters[],
+                              const hsize_t *offsets[], const size_t data_sizes[], const void *bufs[])
+{
+    const H5O_layout_t *  layout = &(dset->shared->layout); /* Dataset layout */
+    H5D_chk_idx_info_t    idx_info;                         /* Chunked index info */
+    H5D_chunk_bulk_rec_t *recs  = NULL;                     /* Index records for the new chunks */
+    size_t                nrecs = 0;                        /* # of new chunks */
+    hbool_t               unwritten = FALSE;                /* Whether the last queued chunk is unwritten */
+    hsize_t               offset_copy[H5O_LAYOUT_NDIMS];    /* Internal copy of chunk offset */
+    hsize_t               scaled[H5O_LAYOUT_NDIMS];         /* Scaled coordinates for a chunk */
+    unsigned              ndims = dset->shared->ndims;      /* Rank of the dataset */
+    size_t                u         = 0;                    /* Local index variable */
+    herr_t                ret_value = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Sanity checks */
+    HDassert(layout->type == H5D_CHUNKED);
+    HDassert(count == 0 || (filters && offsets && data_sizes && bufs));
+
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+
+#ifdef H5_HAVE_PARALLEL
+    /* The chunks are allocated and indexed by this process alone */
+    if (H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "can't write a batch of chunks with parallel I/O")
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if (!H5D__chunk_is_space_alloc(&layout->storage)) {
+        H5D_io_info_t io_info; /* to hold the dset info */
+
+        io_info.dset = dset;
+        io_info.f_sh = H5F_SHARED(dset->oloc.file);
+
+        /* Allocate storage */
+        if (H5D__alloc_storage(&io_info, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+    }
+
+    if (NULL == (recs = (H5D_chunk_bulk_rec_t *)H5MM_malloc(count * sizeof(H5D_chunk_bulk_rec_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk records")
+
+    /* Check the offsets of all the chunks before writing any of them */
+    for (u = 0; u < count; u++) {
+        unsigned v; /* Local index variable */
+
+        if (H5D__get_offset_copy(dset, offsets[u], offset_copy) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+        H5VM_chunk_scaled(ndims, offset_copy, layout->u.chunk.dim, scaled);
+        for (v = 0; v < ndims; v++)
+            if (scaled[v] >= layout->u.chunk.chunks[v])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "offset exceeds dimensions of dataset")
+
+        recs[u].index = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, scaled);
+    } /* end for */
+    if (count > 1) {
+        HDqsort(recs, count, sizeof(H5D_chunk_bulk_rec_t), H5D__chunk_bulk_rec_cmp);
+        for (u = 1; u < count; u++)
+            if (recs[u].index == recs[u - 1].index)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk appears more than once in batch")
+    } /* end if */
+
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &(dset->shared->dcpl_cache.pline);
+    idx_info.layout  = &(dset->shared->layout.u.chunk);
+    idx_info.storage = &(dset->shared->layout.storage.u.chunk);
+
+    for (u = 0; u < count; u++) {
+        H5D_chunk_ud_t udata;                 /* User data for querying chunk info */
+        H5F_block_t    old_chunk;             /* Offset/length of old chunk */
+        hbool_t        need_insert   = FALSE; /* Whether the chunk needs to be inserted into the index */
+        hbool_t        realloc_chunk = FALSE; /* Whether the chunk moves to new space */
+
+        /* Calculate the index of this chunk */
+        if (H5D__get_offset_copy(dset, offsets[u], offset_copy) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "failure to copy offset array")
+        H5VM_chunk_scaled(ndims, offset_copy, layout->u.chunk.dim, scaled);
+        scaled[ndims] = 0;
+
+        /* Find out the file address of the chunk (if any) */
+        if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Set the file block information for the old chunk */
+        /* (Which is only defined when overwriting an existing chunk) */
+        old_chunk.offset = udata.chunk_block.offset;
+        old_chunk.length = udata.chunk_block.length;
+
+        /* Set up the size of chunk for user data */
+        udata.chunk_block.length = data_sizes[u];
+
+        /* If there are no filters and we are overwriting the chunk we can
+         * just set values, otherwise create the chunk it if it doesn't exist,
+         * or reallocate the chunk if its size has changed.  A reallocated
+         * chunk's old space is only released once the new chunk is written,
+         * so the old index entry stays valid if the write fails.
+         */
+        if (0 != idx_info.pline->nused || !H5F_addr_defined(old_chunk.offset)) {
+            realloc_chunk =
+                H5F_addr_defined(old_chunk.offset) && old_chunk.length != udata.chunk_block.length;
+            if (realloc_chunk)
+                udata.chunk_block.offset = HADDR_UNDEF;
+            if (H5D__chunk_file_alloc(&idx_info, realloc_chunk ? NULL : &old_chunk, &udata.chunk_block,
+                                      &need_insert, scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+        } /* end if */
+
+        /* Make sure the address of the chunk is returned. */
+        if (!H5F_addr_defined(udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk address isn't defined")
+
+        /* Queue the chunk record for insertion into the index */
+        if (need_insert && layout->storage.u.chunk.ops->insert) {
+            recs[nrecs].index       = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, scaled);
+            recs[nrecs].chunk_idx   = udata.chunk_idx;
+            recs[nrecs].chunk_block = udata.chunk_block;
+            recs[nrecs].filter_mask = filters[u];
+            nrecs++;
+
+            unwritten = TRUE;
+        } /* end if */
+
+        /* Evict the (old) entry from the cache if present, but do not flush
+         * it to disk */
+        if (UINT_MAX != udata.idx_hint) {
+            const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /*raw data chunk cache */
+
+            if (H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+        } /* end if */
+
+        /* Write the data to the file */
+        if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset,
+                                   data_sizes[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+        unwritten = FALSE;
+
+        /* Release the old chunk, unless doing SWMR writes (see H5D__chunk_file_alloc) */
+        if (realloc_chunk && !(H5F_INTENT(idx_info.f) & H5F_ACC_SWMR_WRITE))
+            if (H5MF_xfree(idx_info.f, H5FD_MEM_DRAW, old_chunk.offset, old_chunk.length) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+    } /* end for */
+
+    /* Insert the new chunks into the index */
+    if (H5D__chunk_bulk_insert(&idx_info, nrecs, recs, dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addrs into index")
+
+done:
+    /* If the loop above failed partway, index the chunks already written so
+     * their space isn't leaked.  The last chunk's new space is released
+     * instead when its write failed, leaving its old index entry (if any)
+     * in place.
+     */
+    if (ret_value < 0 && u < count && nrecs > 0) {
+        if (unwritten) {
+            nrecs--;
+            if (H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, recs[nrecs].chunk_block.offset,
+                           (hsize_t)recs[nrecs].chunk_block.length) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+        } /* end if */
+        if (nrecs > 0 && H5D__chunk_bulk_insert(&idx_info, nrecs, recs, dset) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addrs into index")
+    } /* end if */
+
+    /* The lookups above may have cached chunks that were not indexed yet */
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+
+    H5MM_xfree(recs);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_write_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_direct_read
  *
@@ -916,6 +1149,13 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
     if (NULL == (dapl = (H5P_genplist_t *)H5I_object(dapl_id)))
         HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for fapl ID")
 
+#ifdef H5_HAVE_PARALLEL
+    /* Chunks first written independently are placed in a process's raw data arena whole */
+    if (H5D__chunk_arena_active(f, dset->shared) &&
+        (hsize_t)dset->shared->layout.u.chunk.size > H5MF_arena_size(f))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size is larger than the raw data arena size")
+#endif /* H5_HAVE_PARALLEL */
+
     /* Use the properties in dapl_id if they have been set, otherwise use the properties from the file */
     if (H5P_get(dapl, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &rdcc->nslots) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache number of slots")
@@ -984,6 +1224,15 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
     if (H5D__chunk_set_info(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set # of chunks for dataset")
 
+#ifdef H5_HAVE_PARALLEL
+    /* Make sure the processes have raw data arenas to place chunks in */
+    if (H5D__chunk_arena_active(f, dset->shared)) {
+        if (H5MF_arena_attach(f) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to reserve raw data arenas")
+        rdcc->arena_user = TRUE;
+    } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_init() */
@@ -2702,11 +2951,28 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
                 /* Set up the size of chunk for user data */
                 udata.chunk_block.length = io_info->dset->shared->layout.u.chunk.size;
 
-                /* Allocate the chunk */
-                if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert,
-                                          chunk_info->scaled) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
-                                "unable to insert/resize chunk on chunk level")
+#ifdef H5_HAVE_PARALLEL
+                /* Place the chunk in this process's raw data arena, without
+                 * involving the other processes
+                 */
+                if (io_info->using_mpi_vfd &&
+                    H5D__chunk_arena_active(io_info->dset->oloc.file, io_info->dset->shared)) {
+                    hbool_t full; /* Whether the whole chunk is written */
+
+                    full = (hbool_t)(chunk_info->chunk_points * type_info->dst_type_size ==
+                                         ctg_store.contig.dset_size &&
+                                     fm->fsel_type != H5S_SEL_POINTS);
+                    if (H5D__chunk_arena_insert(io_info->dset, chunk_info, &udata, full) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                    "unable to place chunk in raw data arena")
+                } /* end if */
+                else
+#endif /* H5_HAVE_PARALLEL */
+                    /* Allocate the chunk */
+                    if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert,
+                                              chunk_info->scaled) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
+                                    "unable to insert/resize chunk on chunk level")
 
                 /* Make sure the address of the chunk is returned. */
                 if (!H5F_addr_defined(udata.chunk_block.offset))
@@ -2785,6 +3051,12 @@ H5D__chunk_flush(H5D_t *dset)
     if (nerrors)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+#ifdef H5_HAVE_PARALLEL
+    /* Enter the chunks placed in the processes' raw data arenas into the index */
+    if (H5D__chunk_arena_active(dset->oloc.file, dset->shared) && H5D__chunk_arena_reconcile(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to index chunks in raw data arenas")
+#endif /* H5_HAVE_PARALLEL */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_flush() */
@@ -2882,6 +3154,13 @@ H5D__chunk_dest(H5D_t *dset)
     /* Release cache structures */
     if (rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+#ifdef H5_HAVE_PARALLEL
+    /* (Chunks still in the list were never indexed, so their data is lost) */
+    if (rdcc->arena_chunks && H5SL_destroy(rdcc->arena_chunks, H5D__chunk_arena_free_cb, NULL) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release raw data arena chunk list")
+    if (rdcc->arena_user)
+        H5MF_arena_detach(dset->oloc.file);
+#endif /* H5_HAVE_PARALLEL */
     HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
 
     /* Compose chunked index info struct */
@@ -3214,6 +3493,25 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udat
         /* Check for cached information */
         if (!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
             H5D_chk_idx_info_t idx_info; /* Chunked index info */
+#ifdef H5_HAVE_PARALLEL
+            H5D_chunk_arena_t *arena_chunk; /* Chunk placed in this process's raw data arena */
+
+            /* Check for a chunk that isn't in the index yet */
+            if (dset->shared->cache.chunk.arena_chunks) {
+                hsize_t chunk_index; /* Linear index of the chunk */
+
+                chunk_index = H5VM_array_offset_pre(dset->shared->layout.u.chunk.ndims - 1,
+                                                    dset->shared->layout.u.chunk.down_chunks, scaled);
+                if (NULL != (arena_chunk = (H5D_chunk_arena_t *)H5SL_search(
+                                 dset->shared->cache.chunk.arena_chunks, &chunk_index))) {
+                    udata->chunk_block.offset = arena_chunk->addr;
+                    udata->chunk_block.length = dset->shared->layout.u.chunk.size;
+                    udata->chunk_idx          = chunk_index;
+                    H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+                    HGOTO_DONE(SUCCEED)
+                } /* end if */
+            }     /* end if */
+#endif            /* H5_HAVE_PARALLEL */
 
             /* Compose chunked index info struct */
             idx_info.f       = dset->oloc.file;
@@ -4243,6 +4541,106 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_allocated() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_fill_run_add
+ *
+ * Purpose:     Add a newly allocated chunk to the run of chunks waiting to
+ *              be filled.  When the chunk can't extend the run (it's not
+ *              adjacent to the run in the file, uses another fill image or
+ *              the run is full), the run is written out and a new one is
+ *              started with the chunk.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_fill_run_add(H5F_shared_t *f_sh, H5D_chunk_fill_run_t *run, haddr_t addr, size_t chunk_size,
+                        const void *fill_buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(run);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(chunk_size > 0);
+    HDassert(fill_buf);
+
+    /* Check if the chunk extends the current run */
+    if (run->nchunks > 0 && run->nchunks < run->max_nchunks && run->chunk_size == chunk_size &&
+        run->fill_buf == fill_buf && H5F_addr_eq(run->addr + (run->nchunks * chunk_size), addr))
+        run->nchunks++;
+    else {
+        /* Write out the current run */
+        if (H5D__chunk_fill_run_flush(f_sh, run) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write fill values to chunks")
+
+        /* Start a new run with this chunk */
+        run->addr        = addr;
+        run->chunk_size  = chunk_size;
+        run->nchunks     = 1;
+        run->max_nchunks = MAX(1, H5D_TEMP_BUF_MAX_SIZE / chunk_size);
+        run->fill_buf    = fill_buf;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_fill_run_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_fill_run_flush
+ *
+ * Purpose:     Write the fill values for a run of chunks that are adjacent
+ *              in the file, with one write operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_fill_run_flush(H5F_shared_t *f_sh, H5D_chunk_fill_run_t *run)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(run);
+
+    if (run->nchunks == 1) {
+        /* Write the fill image directly */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, run->addr, run->chunk_size, run->fill_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    } /* end if */
+    else if (run->nchunks > 1) {
+        /* Make sure the batch buffer holds enough copies of this fill image */
+        if (run->batch_fill_buf != run->fill_buf || run->batch_chunk_size != run->chunk_size)
+            run->batch_nchunks = 0;
+        if (run->batch_nchunks < run->nchunks) {
+            if (NULL == (run->batch_buf = H5MM_realloc(run->batch_buf, run->nchunks * run->chunk_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for fill buffer")
+            H5VM_array_fill((uint8_t *)run->batch_buf + (run->batch_nchunks * run->chunk_size), run->fill_buf,
+                            run->chunk_size, run->nchunks - run->batch_nchunks);
+            run->batch_nchunks    = run->nchunks;
+            run->batch_fill_buf   = run->fill_buf;
+            run->batch_chunk_size = run->chunk_size;
+        } /* end if */
+
+        /* Write all the chunks in the run at once */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, run->addr, run->nchunks * run->chunk_size,
+                                   run->batch_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    } /* end if */
+
+    /* The run is empty now */
+    run->nchunks = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_fill_run_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_allocate
  *
@@ -4299,7 +4697,10 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
                                                     dimension */
     unsigned             nunfilt_edge_chunk_dims = 0; /* Number of dimensions on an edge */
     H5O_storage_chunk_t *sc                      = &(layout->storage.u.chunk); /* Convenience variable */
-    herr_t               ret_value               = SUCCEED;                    /* Return value */
+    H5D_chunk_fill_run_t fill_run;                                             /* Chunks to fill at once */
+    H5D_chunk_bulk_rec_t *bulk_recs  = NULL; /* Chunks waiting to be inserted into the index */
+    size_t                nbulk_recs = 0;    /* # of chunks waiting to be inserted */
+    herr_t                ret_value  = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -4315,6 +4716,9 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     /* The last dimension in scaled chunk coordinates is always 0 */
     scaled[space_ndims] = (hsize_t)0;
 
+    /* No chunks are waiting to be filled yet */
+    HDmemset(&fill_run, 0, sizeof(fill_run));
+
     /* Check if any space dimensions are 0, if so we do not have to do anything
      */
     for (op_dim = 0; op_dim < (unsigned)space_ndims; op_dim++)
@@ -4623,18 +5027,46 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
                 } /* end if */
                 else {
 #endif /* H5_HAVE_PARALLEL */
-                    if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
-                                               udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
+                    /* VL fill values are regenerated for each chunk, so they
+                     * are written right away.  Otherwise, chunks using the same
+                     * fill image are gathered into large writes.
+                     */
+                    if (fb_info.has_vlen_fill_type) {
+                        if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
+                                                   udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
+                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+                    } /* end if */
+                    else if (H5D__chunk_fill_run_add(H5F_SHARED(dset->oloc.file), &fill_run,
+                                                     udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
 #ifdef H5_HAVE_PARALLEL
                 } /* end else */
 #endif            /* H5_HAVE_PARALLEL */
             }     /* end if */
 
-            /* Insert the chunk record into the index */
-            if (need_insert && ops->insert)
-                if ((ops->insert)(&idx_info, &udata, dset) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+            /* Queue the chunk record for insertion into the index */
+            if (need_insert && ops->insert) {
+                H5D_chunk_bulk_rec_t *rec; /* Record for this chunk */
+
+                if (NULL == bulk_recs &&
+                    NULL == (bulk_recs = (H5D_chunk_bulk_rec_t *)H5MM_malloc(H5D_CHUNK_BULK_NRECS *
+                                                                               sizeof(H5D_chunk_bulk_rec_t))))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk records")
+
+                rec              = &bulk_recs[nbulk_recs];
+                rec->index       = H5VM_array_offset_pre(space_ndims, layout->u.chunk.down_chunks, scaled);
+                rec->chunk_idx   = udata.chunk_idx;
+                rec->chunk_block = udata.chunk_block;
+                rec->filter_mask = udata.filter_mask;
+
+                /* Insert a full batch of chunks */
+                if (++nbulk_recs == H5D_CHUNK_BULK_NRECS) {
+                    if (H5D__chunk_bulk_insert(&idx_info, nbulk_recs, bulk_recs, dset) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
+                                    "unable to insert chunk addrs into index")
+                    nbulk_recs = 0;
+                } /* end if */
+            }     /* end if */
 
             /* Increment indices and adjust the edge chunk state */
             carry = TRUE;
@@ -4686,6 +5118,14 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             max_unalloc[op_dim] = min_unalloc[op_dim] - 1;
     } /* end for(op_dim=0...) */
 
+    /* Insert the last batch of chunks */
+    if (nbulk_recs > 0 && H5D__chunk_bulk_insert(&idx_info, nbulk_recs, bulk_recs, dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addrs into index")
+
+    /* Write out the last run of chunks */
+    if (H5D__chunk_fill_run_flush(H5F_SHARED(dset->oloc.file), &fill_run) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+
 #ifdef H5_HAVE_PARALLEL
     /* do final collective I/O */
     if (using_mpi && blocks_written)
@@ -4704,6 +5144,12 @@ done:
     /* Free the unfiltered fill value buffer */
     unfilt_fill_buf = H5D__chunk_mem_xfree(unfilt_fill_buf, &def_pline);
 
+    /* Free the buffer for writing runs of chunks */
+    fill_run.batch_buf = H5MM_xfree(fill_run.batch_buf);
+
+    /* Free the chunk records */
+    H5MM_xfree(bulk_recs);
+
 #ifdef H5_HAVE_PARALLEL
     if (using_mpi && chunk_info.addr)
         H5MM_free(chunk_info.addr);
@@ -5710,6 +6156,561 @@ H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[])
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_addrmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_active
+ *
+ * Purpose:     Check if chunks of a dataset in file F that are written
+ *              independently are placed in the processes' raw data
+ *              arenas, instead of all being allocated when the dataset is
+ *              created.
+ *
+ *              Only unfiltered datasets whose space is allocated
+ *              incrementally do this: filtered chunks change size on
+ *              every write, so they are always written collectively.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5D__chunk_arena_active(const H5F_t *f, const H5D_shared_t *shared)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(f);
+    HDassert(shared);
+
+    FUNC_LEAVE_NOAPI(shared->layout.type == H5D_CHUNKED && shared->dcpl_cache.pline.nused == 0 &&
+                     shared->dcpl_cache.fill.alloc_time == H5D_ALLOC_TIME_INCR && H5MF_arena_enabled(f))
+} /* end H5D__chunk_arena_active() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_insert
+ *
+ * Purpose:     Place a chunk that is about to be written independently in
+ *              this process's raw data arena, writing fill values first
+ *              if the chunk isn't FULLy written.
+ *
+ *              The chunk is remembered in the dataset's list of arena
+ *              chunks, where this process finds it until the next
+ *              collective operation enters it into the chunk index.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_arena_insert(const H5D_t *dset, const H5D_chunk_info_t *chunk_info, H5D_chunk_ud_t *udata,
+                        hbool_t full)
+{
+    H5D_rdcc_t *        rdcc        = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_chunk_arena_t * arena_chunk = NULL;                         /* Chunk placed in the arena */
+    H5D_fill_buf_info_t fb_info;                                    /* Dataset's fill buffer info */
+    hbool_t             fb_info_init = FALSE;   /* Whether the fill value buffer has been initialized */
+    herr_t              ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(chunk_info);
+    HDassert(udata);
+    HDassert(udata->chunk_block.length == dset->shared->layout.u.chunk.size);
+
+    /* Carve the chunk out of this process's arena (H5D__chunk_arena_io_init()
+     * made sure there is room before the write started)
+     */
+    if (!H5F_addr_defined(udata->chunk_block.offset =
+                              H5MF_arena_alloc(dset->oloc.file, (hsize_t)udata->chunk_block.length)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "raw data arena is exhausted")
+
+    /* Initialize the parts of the chunk that won't be written */
+    if (!full) {
+        if (H5D__chunk_arena_fill_init(dset, &fb_info, &fb_info_init) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize fill buffer info")
+        if (fb_info_init && H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW,
+                                                   udata->chunk_block.offset,
+                                                   (size_t)udata->chunk_block.length, fb_info.fill_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write fill values to chunk")
+    } /* end if */
+
+    /* Remember the chunk until it is indexed */
+    if (NULL == rdcc->arena_chunks)
+        if (NULL == (rdcc->arena_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for raw data arena chunks")
+    if (NULL == (arena_chunk = H5FL_CALLOC(H5D_chunk_arena_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate raw data arena chunk info")
+    arena_chunk->index = H5VM_array_offset_pre(dset->shared->layout.u.chunk.ndims - 1,
+                                               dset->shared->layout.u.chunk.down_chunks, chunk_info->scaled);
+    H5MM_memcpy(arena_chunk->scaled, chunk_info->scaled, sizeof(arena_chunk->scaled));
+    arena_chunk->addr = udata->chunk_block.offset;
+    arena_chunk->full = full;
+    if (H5SL_insert(rdcc->arena_chunks, arena_chunk, &arena_chunk->index) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert raw data arena chunk into skip list")
+    arena_chunk = NULL;
+
+done:
+    if (fb_info_init && H5D__fill_term(&fb_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release fill buffer info")
+    if (arena_chunk)
+        arena_chunk = H5FL_FREE(H5D_chunk_arena_t, arena_chunk);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_arena_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_fill_init
+ *
+ * Purpose:     Set up a buffer holding the fill value image of a whole
+ *              chunk, if fill values should be written to new chunks.
+ *              FB_INFO_INIT is only set when the buffer was set up.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_arena_fill_init(const H5D_t *dset, H5D_fill_buf_info_t *fb_info, hbool_t *fb_info_init)
+{
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    const H5O_fill_t * fill  = &(dset->shared->dcpl_cache.fill);  /* Fill value info */
+    H5D_fill_value_t   fill_status;                               /* The fill value status */
+    size_t             chunk_size;                                /* Size of chunk in bytes */
+    herr_t             ret_value = SUCCEED;                       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(fb_info);
+    HDassert(fb_info_init);
+
+    /* Check the dataset's fill-value status */
+    if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+    /* Same check as when chunks are allocated at once */
+    if (fill->fill_time == H5D_FILL_TIME_ALLOC ||
+        (fill->fill_time == H5D_FILL_TIME_IFSET &&
+         (fill_status == H5D_FILL_VALUE_USER_DEFINED || fill_status == H5D_FILL_VALUE_DEFAULT))) {
+        H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+
+        /* (casting away const OK - QAK) */
+        if (H5D__fill_init(fb_info, NULL, (H5MM_allocate_t)H5D__chunk_mem_alloc, (void *)pline,
+                           (H5MM_free_t)H5D__chunk_mem_xfree, (void *)pline, fill, dset->shared->type,
+                           dset->shared->type_id, (size_t)0, chunk_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize fill buffer info")
+        *fb_info_init = TRUE;
+
+        /* VL fill values are only converted when the buffer is refilled */
+        if (fb_info->has_vlen_fill_type && H5D__fill_refill_vl(fb_info, fb_info->elmts_per_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "can't refill fill value buffer")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_arena_fill_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_gather
+ *
+ * Purpose:     Exchange chunk records between all processes.  ALL
+ *              receives every process's records, sorted by chunk index
+ *              (NULL if no process has any).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_arena_gather(const H5D_t *dset, H5D_chunk_arena_t *local, size_t nlocal, H5D_chunk_arena_t **all,
+                        size_t *ntotal)
+{
+    MPI_Comm comm;                /* File's communicator */
+    int      mpi_size;            /* # of processes */
+    int      mpi_code;            /* MPI return code */
+    int      local_size;          /* Size of this process's records */
+    int *    counts = NULL;       /* Sizes of all processes' records */
+    int *    displs;              /* Offsets of all processes' records */
+    size_t   total_size = 0;      /* Size of all records */
+    int      u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(local || nlocal == 0);
+    HDassert(all);
+    HDassert(ntotal);
+
+    *all    = NULL;
+    *ntotal = 0;
+
+    if (MPI_COMM_NULL == (comm = H5F_mpi_get_comm(dset->oloc.file)))
+        HGOTO_ERROR(H5E_DATASET, H5E_MPI, FAIL, "can't retrieve MPI communicator")
+    if ((mpi_size = H5F_mpi_get_size(dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_MPI, FAIL, "can't retrieve MPI size")
+
+    if (NULL == (counts = (int *)H5MM_malloc(2 * (size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate record counts")
+    displs = counts + mpi_size;
+
+    H5_CHECKED_ASSIGN(local_size, int, nlocal * sizeof(H5D_chunk_arena_t), size_t);
+    if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&local_size, 1, MPI_INT, counts, 1, MPI_INT, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+    for (u = 0; u < mpi_size; u++) {
+        H5_CHECKED_ASSIGN(displs[u], int, total_size, size_t);
+        total_size += (size_t)counts[u];
+    } /* end for */
+
+    if (total_size > 0) {
+        if (NULL == (*all = (H5D_chunk_arena_t *)H5MM_malloc(total_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk records")
+        if (MPI_SUCCESS != (mpi_code = MPI_Allgatherv(local, local_size, MPI_BYTE, *all, counts, displs,
+                                                      MPI_BYTE, comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allgatherv failed", mpi_code)
+        *ntotal = total_size / sizeof(H5D_chunk_arena_t);
+
+        /* Put the records in the same order on every process */
+        HDqsort(*all, *ntotal, sizeof(H5D_chunk_arena_t), H5D__chunk_arena_cmp);
+    } /* end if */
+
+done:
+    H5MM_xfree(counts);
+    if (ret_value < 0) {
+        *all    = (H5D_chunk_arena_t *)H5MM_xfree(*all);
+        *ntotal = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_arena_gather() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_reconcile
+ *
+ * Purpose:     Enter the chunks that all processes placed in their raw
+ *              data arenas into the dataset's chunk index, and replace
+ *              the arenas that are running low.
+ *
+ *              Collective: it must be called by all processes, at
+ *              operations they already perform together (flushing or
+ *              closing the dataset, changing its extent, collective I/O).
+ *              A chunk written independently by more than one process
+ *              since the last such operation is an error.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_arena_reconcile(const H5D_t *dset)
+{
+    H5D_rdcc_t *          rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_chk_idx_info_t    idx_info;                            /* Chunked index info */
+    H5SL_t *              pending = NULL;                      /* This process's list of arena chunks */
+    H5D_chunk_arena_t *   local   = NULL;                      /* This process's arena chunks */
+    H5D_chunk_arena_t *   all    = NULL;                       /* All processes' arena chunks */
+    H5D_chunk_bulk_rec_t *recs   = NULL;                       /* Index records for the arena chunks */
+    size_t                nlocal = 0;                          /* # of this process's arena chunks */
+    size_t                ntotal = 0;                          /* # of all processes' arena chunks */
+    size_t                u;                                   /* Local index variable */
+    herr_t                ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Sanity checks */
+    HDassert(H5D__chunk_arena_active(dset->oloc.file, dset->shared));
+    HDassert(dset->shared->layout.storage.u.chunk.ops->insert);
+
+    /* Set aside the chunks this process placed in its arena, so that the
+     * lookups below only see the index.  They go back on the list if they
+     * can't be indexed, to be tried again at the next collective operation.
+     */
+    pending            = rdcc->arena_chunks;
+    rdcc->arena_chunks = NULL;
+    if (pending && (nlocal = H5SL_count(pending)) > 0) {
+        H5SL_node_t *node; /* Current node in skip list */
+
+        if (NULL == (local = (H5D_chunk_arena_t *)H5MM_malloc(nlocal * sizeof(H5D_chunk_arena_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk records")
+        for (node = H5SL_first(pending), u = 0; node; node = H5SL_next(node), u++)
+            H5MM_memcpy(&local[u], H5SL_item(node), sizeof(H5D_chunk_arena_t));
+    } /* end if */
+
+    /* Exchange them with the other processes */
+    if (H5D__chunk_arena_gather(dset, local, nlocal, &all, &ntotal) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't exchange raw data arena chunks")
+
+    if (ntotal > 0) {
+        /* Compose chunked index info struct */
+        idx_info.f       = dset->oloc.file;
+        idx_info.pline   = &dset->shared->dcpl_cache.pline;
+        idx_info.layout  = &dset->shared->layout.u.chunk;
+        idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+        /* Forget the arena addresses of the last chunk looked up */
+        H5D__chunk_cinfo_cache_reset(&rdcc->last);
+
+        if (NULL == (recs = (H5D_chunk_bulk_rec_t *)H5MM_malloc(ntotal * sizeof(H5D_chunk_bulk_rec_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk records")
+
+        /* Gather the index records for the chunks */
+        for (u = 0; u < ntotal; u++) {
+            H5D_chunk_ud_t udata; /* Index pass-through */
+
+            if (u > 0 && all[u].index == all[u - 1].index)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                            "chunk was written independently by more than one process")
+
+            if (H5D__chunk_lookup(dset, all[u].scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+            if (H5F_addr_defined(udata.chunk_block.offset))
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk in raw data arena is already indexed")
+
+            recs[u].index              = all[u].index;
+            recs[u].chunk_idx          = udata.chunk_idx;
+            recs[u].chunk_block.offset = all[u].addr;
+            recs[u].chunk_block.length = dset->shared->layout.u.chunk.size;
+            recs[u].filter_mask        = 0;
+        } /* end for */
+
+        /* Insert the chunks into the index, in the same order everywhere */
+        if (H5D__chunk_bulk_insert(&idx_info, ntotal, recs, dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addrs into index")
+
+        /* The lookups above cached the chunks as unallocated */
+        H5D__chunk_cinfo_cache_reset(&rdcc->last);
+
+        /* The chunks are indexed now */
+        if (pending && H5SL_free(pending, H5D__chunk_arena_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release raw data arena chunks")
+
+        /* Replace the arenas that are running low */
+        if (H5MF_arena_refill(dset->oloc.file) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to reserve raw data arenas")
+    } /* end if */
+
+done:
+    /* Put back the list of chunks in this process's arena */
+    HDassert(NULL == rdcc->arena_chunks);
+    rdcc->arena_chunks = pending;
+    if (ret_value < 0)
+        H5D__chunk_cinfo_cache_reset(&rdcc->last);
+    H5MM_xfree(local);
+    H5MM_xfree(all);
+    H5MM_xfree(recs);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_arena_reconcile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_io_init
+ *
+ * Purpose:     Prepare a read or write of a dataset whose chunks are
+ *              placed in raw data arenas.
+ *
+ *              For collective I/O, the chunks placed so far are indexed,
+ *              then chunks selected for writing that still have no space
+ *              are allocated (and filled, unless some process writes all
+ *              of a chunk) by all processes together.  Collective I/O
+ *              needs every selected chunk to have an address, so a read
+ *              that selects unwritten chunks is done independently
+ *              instead.
+ *
+ *              An independent write fails before writing anything if the
+ *              new chunks it selects don't fit in what is left of this
+ *              process's arena, which can only be refilled collectively.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_arena_io_init(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm)
+{
+    const H5D_t *         dset = io_info->dset; /* Dataset being accessed */
+    H5D_chk_idx_info_t    idx_info;             /* Chunked index info */
+    H5SL_node_t *         chunk_node;           /* Current node in chunk skip list */
+    H5D_chunk_arena_t *   local = NULL;         /* This process's unallocated chunks */
+    H5D_chunk_arena_t *   all   = NULL;         /* All processes' unallocated chunks */
+    size_t                nsel;                 /* # of selected chunks */
+    size_t                nlocal = 0, ntotal = 0; /* # of unallocated chunks */
+    H5D_chunk_coll_info_t chunk_fill_info = {0, NULL}; /* Chunks to fill */
+    H5D_fill_buf_info_t   fb_info;                     /* Dataset's fill buffer info */
+    hbool_t               fb_info_init = FALSE; /* Whether the fill value buffer has been initialized */
+    H5FD_mpio_xfer_t      xfer_mode;            /* Parallel transfer for this request */
+    size_t                u;                    /* Local index variable */
+    herr_t                ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(io_info);
+    HDassert(fm);
+    HDassert(H5D__chunk_arena_active(dset->oloc.file, dset->shared));
+
+    /* Independent reads work with the chunks as they are */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+    if (xfer_mode != H5FD_MPIO_COLLECTIVE && io_info->op_type == H5D_IO_OP_READ)
+        HGOTO_DONE(SUCCEED)
+
+    /* Index the chunks the processes wrote independently */
+    if (xfer_mode == H5FD_MPIO_COLLECTIVE && H5D__chunk_arena_reconcile(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to index chunks in raw data arenas")
+
+    /* Find the selected chunks without space */
+    if ((nsel = fm->use_single ? 1 : (fm->sel_chunks ? H5SL_count(fm->sel_chunks) : 0)) > 0)
+        if (NULL == (local = (H5D_chunk_arena_t *)H5MM_malloc(nsel * sizeof(H5D_chunk_arena_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk records")
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while (chunk_node) {
+        H5D_chunk_info_t *chunk_info; /* Chunk information */
+        H5D_chunk_ud_t    udata;      /* Index pass-through */
+
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        if (H5D__chunk_lookup(dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if (!H5F_addr_defined(udata.chunk_block.offset)) {
+            local[nlocal].index = H5VM_array_offset_pre(dset->shared->layout.u.chunk.ndims - 1,
+                                                        dset->shared->layout.u.chunk.down_chunks,
+                                                        chunk_info->scaled);
+            H5MM_memcpy(local[nlocal].scaled, chunk_info->scaled, sizeof(local[nlocal].scaled));
+            local[nlocal].addr = HADDR_UNDEF;
+            local[nlocal].full = (hbool_t)(chunk_info->chunk_points * H5T_GET_SIZE(dset->shared->type) ==
+                                               dset->shared->layout.u.chunk.size &&
+                                           fm->fsel_type != H5S_SEL_POINTS);
+            nlocal++;
+        } /* end if */
+
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+
+    if (xfer_mode != H5FD_MPIO_COLLECTIVE) {
+        if (!H5MF_arena_fits(dset->oloc.file, nlocal, (hsize_t)dset->shared->layout.u.chunk.size))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                        "not enough space left in raw data arena until the next collective operation")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    if (io_info->op_type == H5D_IO_OP_READ) {
+        int local_unalloc = (nlocal > 0); /* Whether this process reads unwritten chunks */
+        int any_unalloc;                  /* Whether any process does */
+        int mpi_code;                     /* MPI return code */
+
+        if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&local_unalloc, &any_unalloc, 1, MPI_INT, MPI_LOR,
+                                                     H5F_mpi_get_comm(dset->oloc.file))))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+        if (any_unalloc && H5CX_set_io_xfer_mode(H5FD_MPIO_INDEPENDENT) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Exchange the chunks to allocate with the other processes */
+    if (H5D__chunk_arena_gather(dset, local, nlocal, &all, &ntotal) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't exchange unallocated chunks")
+    if (ntotal == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Compose chunked index info struct */
+    idx_info.f       = dset->oloc.file;
+    idx_info.pline   = &dset->shared->dcpl_cache.pline;
+    idx_info.layout  = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    if (NULL == (chunk_fill_info.addr = (haddr_t *)H5MM_malloc(ntotal * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk address array")
+
+    /* Allocate the chunks, in the same order everywhere */
+    for (u = 0; u < ntotal; u++) {
+        H5D_chunk_ud_t udata;               /* Index pass-through */
+        hbool_t        full;                /* Whether some process writes all of the chunk */
+        hbool_t        need_insert = FALSE; /* Whether the chunk needs to be inserted into the index */
+
+        /* Merge the processes' records for the chunk */
+        full = all[u].full;
+        while (u + 1 < ntotal && all[u + 1].index == all[u].index)
+            full = full || all[++u].full;
+
+        if (H5D__chunk_lookup(dset, all[u].scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        HDassert(!H5F_addr_defined(udata.chunk_block.offset));
+
+        udata.chunk_block.length = dset->shared->layout.u.chunk.size;
+        if (H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, all[u].scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
+        if (need_insert && (idx_info.storage->ops->insert)(&idx_info, &udata, dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+
+        if (!full)
+            chunk_fill_info.addr[chunk_fill_info.num_io++] = udata.chunk_block.offset;
+    } /* end for */
+
+    /* The lookups above cached the chunks as unallocated */
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+
+    /* Fill the chunks no process writes completely */
+    if (chunk_fill_info.num_io > 0) {
+        if (H5D__chunk_arena_fill_init(dset, &fb_info, &fb_info_init) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize fill buffer info")
+        if (fb_info_init && H5D__chunk_collective_fill(dset, &chunk_fill_info,
+                                                       (size_t)dset->shared->layout.u.chunk.size,
+                                                       fb_info.fill_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    } /* end if */
+
+done:
+    if (fb_info_init && H5D__fill_term(&fb_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release fill buffer info")
+    H5MM_xfree(chunk_fill_info.addr);
+    H5MM_xfree(local);
+    H5MM_xfree(all);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_arena_io_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_cmp
+ *
+ * Purpose:     Compare the chunk indices of two chunk records, for sorting
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_arena_cmp(const void *rec1, const void *rec2)
+{
+    hsize_t index1 = ((const H5D_chunk_arena_t *)rec1)->index;
+    hsize_t index2 = ((const H5D_chunk_arena_t *)rec2)->index;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(index1 < index2 ? -1 : (index1 > index2 ? 1 : 0))
+} /* end H5D__chunk_arena_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_arena_free_cb
+ *
+ * Purpose:     Release a chunk record from the list of arena chunks
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_arena_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *opdata)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(item);
+
+    item = H5FL_FREE(H5D_chunk_arena_t, item);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5D__chunk_arena_free_cb() */
 #endif /* H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -6946,6 +7947,105 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_file_alloc() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_bulk_rec_cmp
+ *
+ * Purpose:     Compare the chunk indices of two bulk insertion records,
+ *              for sorting
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_bulk_rec_cmp(const void *rec1, const void *rec2)
+{
+    hsize_t index1 = ((const H5D_chunk_bulk_rec_t *)rec1)->index;
+    hsize_t index2 = ((const H5D_chunk_bulk_rec_t *)rec2)->index;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(index1 < index2 ? -1 : (index1 > index2 ? 1 : 0))
+} /* end H5D__chunk_bulk_rec_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_bulk_insert
+ *
+ * Purpose:     Insert a batch of newly allocated chunks into the chunk
+ *              index.  The records are sorted by chunk index first, so
+ *              that indices which can load a sorted batch directly (see
+ *              the "bulk_insert" index callback) fill their nodes in one
+ *              pass, and the others append to the same nodes in turn
+ *              rather than visiting them in random order.
+ *
+ *              Since the records are sorted before they are inserted,
+ *              every process makes the same index modifications when the
+ *              batch is collective.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_bulk_insert(const H5D_chk_idx_info_t *idx_info, size_t nrecs, H5D_chunk_bulk_rec_t *recs,
+                       const H5D_t *dset)
+{
+    const H5D_chunk_ops_t *ops       = idx_info->storage->ops; /* Chunk index operations */
+    herr_t                 ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(nrecs == 0 || recs);
+
+    if (nrecs == 0 || NULL == ops->insert)
+        HGOTO_DONE(SUCCEED)
+
+    /* Put the records in chunk index order */
+    if (nrecs > 1)
+        HDqsort(recs, nrecs, sizeof(H5D_chunk_bulk_rec_t), H5D__chunk_bulk_rec_cmp);
+
+    if (ops->bulk_insert) {
+        if ((ops->bulk_insert)(idx_info, nrecs, recs, dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addresses into index")
+    } /* end if */
+    else {
+        H5D_chunk_ud_t udata;                     /* Index pass-through */
+        hsize_t        scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of chunk */
+        unsigned       ndims;                     /* Rank of the chunks' scaled coordinates */
+        size_t         u;                         /* Local index variable */
+
+        /* Set up the common part of the insertion info */
+        HDmemset(&udata, 0, sizeof(udata));
+        HDmemset(scaled, 0, sizeof(scaled));
+        udata.common.layout  = idx_info->layout;
+        udata.common.storage = idx_info->storage;
+        udata.common.scaled  = scaled;
+
+        /* The last dimension of a chunk is the datatype size */
+        ndims = idx_info->layout->ndims - 1;
+
+        for (u = 0; u < nrecs; u++) {
+            /* Recover the chunk's scaled coordinates from its index */
+            if (H5VM_array_calc_pre(recs[u].index, ndims, idx_info->layout->down_chunks, scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute chunk coordinates")
+
+            udata.chunk_block = recs[u].chunk_block;
+            udata.chunk_idx   = recs[u].chunk_idx;
+            udata.filter_mask = recs[u].filter_mask;
+
+            if ((ops->insert)(idx_info, &udata, dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+        } /* end for */
+    }     /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_bulk_insert() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_format_convert_cb
  *
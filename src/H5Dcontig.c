@@ -103,6 +103,13 @@ static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t H5D__contig_sieve_win_flush(H5F_shared_t *f_sh, H5D_rdcdc_win_t *win);
+static H5D_rdcdc_win_t *H5D__contig_sieve_lookup(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len);
+static herr_t H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len,
+                                      hbool_t invalidate);
+static herr_t H5D__contig_sieve_fill(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig,
+                                     const H5D_contig_storage_t *store_contig, haddr_t addr, size_t len,
+                                     hbool_t for_write, H5D_rdcdc_win_t **win_out);
 
 /*********************/
 /* Package Variables */
@@ -183,7 +190,9 @@ H5D__contig_fill(const H5D_io_info_t *io_info)
 #ifdef H5_HAVE_PARALLEL
     MPI_Comm mpi_comm = MPI_COMM_NULL; /* MPI communicator for file */
     int      mpi_rank = (-1);          /* This process's rank  */
+    int      mpi_size = (-1);          /* Total # of processes */
     int      mpi_code;                 /* MPI return code */
+    size_t   npieces        = 0;       /* Number of pieces of the dataset filled so far */
     hbool_t  blocks_written = FALSE;   /* Flag to indicate that chunk was actually written */
     hbool_t  using_mpi =
         FALSE; /* Flag to indicate that the file is being accessed with an MPI-capable file driver */
@@ -212,6 +221,10 @@ H5D__contig_fill(const H5D_io_info_t *io_info)
         if ((mpi_rank = H5F_mpi_get_rank(dset->oloc.file)) < 0)
             HGOTO_ERROR(H5E_INTERNAL, H5E_MPI, FAIL, "Can't retrieve MPI rank")
 
+        /* Get the MPI size */
+        if ((mpi_size = H5F_mpi_get_size(dset->oloc.file)) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_MPI, FAIL, "Can't retrieve MPI size")
+
         /* Set the MPI-capable file driver flag */
         using_mpi = TRUE;
     }  /* end if */
@@ -266,11 +279,14 @@ H5D__contig_fill(const H5D_io_info_t *io_info)
 #ifdef H5_HAVE_PARALLEL
         /* Check if this file is accessed with an MPI-capable file driver */
         if (using_mpi) {
-            /* Write the chunks out from only one process */
+            /* Spread the pieces of the dataset round-robin across the
+             * processes, so they all write fill values at once
+             */
             /* !! Use the internal "independent" DXPL!! -QAK */
-            if (H5_PAR_META_WRITE == mpi_rank)
+            if ((int)(npieces % (size_t)mpi_size) == mpi_rank)
                 if (H5D__contig_write_one(&ioinfo, offset, size) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to write fill value to dataset")
+            npieces++;
 
             /* Indicate that blocks are being written */
             blocks_written = TRUE;
@@ -528,12 +544,21 @@ H5D__contig_is_space_alloc(const H5O_storage_t *storage)
 hbool_t
 H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
 {
+    unsigned u;                 /* Local index variable */
+    hbool_t  ret_value = FALSE; /* Return value */
+
     FUNC_ENTER_PACKAGE_NOERR
 
     /* Sanity checks */
     HDassert(shared_dset);
 
-    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++)
+        if (shared_dset->cache.contig.win[u].sieve_size > 0) {
+            ret_value = TRUE;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_is_data_cached() */
 
 /*-------------------------------------------------------------------------
@@ -669,167 +694,404 @@ done:
 } /* end H5D__contig_write_one() */
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__contig_readvv_sieve_cb
+ * Function:	H5D__contig_sieve_win_flush
  *
- * Purpose:	Callback operator for H5D__contig_readvv() with sieve buffer.
+ * Purpose:	Write a single dirty sieve buffer window back to the file.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Quincey Koziol
- *              Thursday, Sept 30, 2010
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+H5D__contig_sieve_win_flush(H5F_shared_t *f_sh, H5D_rdcdc_win_t *win)
 {
-    H5D_contig_readvv_sieve_ud_t *udata =
-        (H5D_contig_readvv_sieve_ud_t *)_udata;     /* User data for H5VM_opvv() operator */
-    H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
-    H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
-    const H5D_contig_storage_t *store_contig =
-        udata->store_contig; /* Contiguous storage info for this I/O operation */
-    unsigned char *buf;      /* Pointer to buffer to fill */
-    haddr_t        addr;     /* Actual address to read */
-    haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* Size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Stash local copies of these value */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
+    if (win->sieve_dirty) {
+        /* Write to file */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->sieve_loc, win->sieve_size, win->sieve_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+        /* Reset sieve buffer dirty flag */
+        win->sieve_dirty = FALSE;
     } /* end if */
 
-    /* Compute offset on disk */
-    addr = store_contig->dset_addr + dst_off;
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_win_flush() */
 
-    /* Compute offset in memory */
-    buf = udata->rbuf + src_off;
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_lookup
+ *
+ * Purpose:	Find the sieve buffer window holding all of the bytes in
+ *              [ADDR, ADDR+LEN), if there is one.
+ *
+ * Return:	Success:	Pointer to the window
+ *		Failure:	NULL (the range is not cached entirely in
+ *                              one window)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcdc_win_t *
+H5D__contig_sieve_lookup(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len)
+{
+    unsigned         u;                /* Local index variable */
+    H5D_rdcdc_win_t *ret_value = NULL; /* Return value */
 
-    /* Check if the sieve buffer is allocated yet */
-    if (NULL == dset_contig->sieve_buf) {
-        /* Check if we can actually hold the I/O request in the sieve buffer */
-        if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
+
+        if (win->sieve_size > 0 && addr >= win->sieve_loc &&
+            (addr + len) <= (win->sieve_loc + win->sieve_size)) {
+            /* Mark the window as most recently used */
+            win->lru_stamp = ++dset_contig->lru_clock;
+
+            ret_value = win;
+            break;
         } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_evict
+ *
+ * Purpose:	Flush any dirty sieve buffer windows that overlap the file
+ *              range [ADDR, ADDR+LEN) and, if INVALIDATE is set, drop
+ *              them from the cache as well.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len,
+                        hbool_t invalidate)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
+    FUNC_ENTER_STATIC
 
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
 
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
+        /* Check for any overlap with this window */
+        if (win->sieve_size > 0 && win->sieve_loc < (addr + len) &&
+            addr < (win->sieve_loc + win->sieve_size)) {
+            /* Flush the window, if it's dirty */
+            if (H5D__contig_sieve_win_flush(f_sh, win) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer window")
 
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+            /* Force the window to be re-read the next time */
+            if (invalidate) {
+                win->sieve_loc  = HADDR_UNDEF;
+                win->sieve_size = 0;
+            } /* end if */
+        }     /* end if */
+    }         /* end for */
 
-            /* Read the new sieve buffer */
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
-                                      dset_contig->sieve_buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_evict() */
 
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_fill
+ *
+ * Purpose:	Set up a sieve buffer window holding the file range
+ *              [ADDR, ADDR+LEN), replacing an unused or the least
+ *              recently used window.
+ *
+ *              The caller must have evicted any windows overlapping the
+ *              range already.  The new window is clipped so that it
+ *              doesn't overlap its neighbors, the end of the dataset or
+ *              the end of the file.  When the request falls just before
+ *              a cached window (i.e. the dataset is being walked
+ *              backwards), the window is placed to end at that neighbor
+ *              instead of starting at ADDR, so the data read ahead is in
+ *              the direction of access.
+ *
+ *              When the window is set up for a write (FOR_WRITE), the
+ *              existing data is only read when the window holds more than
+ *              the request.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_fill(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig,
+                       const H5D_contig_storage_t *store_contig, haddr_t addr, size_t len,
+                       hbool_t for_write, H5D_rdcdc_win_t **win_out)
+{
+    H5D_rdcdc_win_t *win = NULL; /* Window to fill */
+    haddr_t          lo, hi;     /* Bounds of the free range around the request */
+    haddr_t          start;      /* Start of the new window */
+    haddr_t          rel_eoa;    /* Relative end of file address	*/
+    hbool_t          win_above = FALSE; /* Whether a cached window bounds the range from above */
+    hsize_t          min;        /* temporary minimum value (avoids some ugly macro nesting) */
+    unsigned         u;          /* Local index variable */
+    herr_t           ret_value = SUCCEED; /* Return value */
 
-            /* Reset sieve buffer dirty flag */
-            dset_contig->sieve_dirty = FALSE;
-        } /* end else */
-    }     /* end if */
-    else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
+    FUNC_ENTER_STATIC
 
-        /* If entire read is within the sieve buffer, read it from the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+    HDassert(len <= dset_contig->sieve_buf_size);
 
-            /* Grab the data out of the buffer */
-            H5MM_memcpy(buf, base_sieve_buf, len);
+    /* Choose an unused window, or the least recently used one */
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        if (0 == dset_contig->win[u].sieve_size) {
+            win = &dset_contig->win[u];
+            break;
         } /* end if */
-        /* Entire request is not within this data sieve buffer */
-        else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-                }     /* end if */
-
-                /* Read directly into the user's buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-            } /* end if */
-            /* Element size fits within the buffer size */
+        if (NULL == win || dset_contig->win[u].lru_stamp < win->lru_stamp)
+            win = &dset_contig->win[u];
+    } /* end for */
+
+    /* Flush the window if it's dirty and drop it from the cache */
+    if (win->sieve_size > 0) {
+        if (H5D__contig_sieve_win_flush(f_sh, win) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer window")
+        win->sieve_loc  = HADDR_UNDEF;
+        win->sieve_size = 0;
+    } /* end if */
+
+    /* Allocate room for the data sieve buffer */
+    if (NULL == win->sieve_buf)
+        if (NULL == (win->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Make certain we don't read off the end of the file */
+    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+
+    /* Don't read past the end of the data element or the end of the file,
+     * and don't overlap any other window.
+     */
+    lo = store_contig->dset_addr;
+    hi = MIN(rel_eoa, store_contig->dset_addr + store_contig->dset_size);
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        const H5D_rdcdc_win_t *other = &dset_contig->win[u];
+
+        if (other->sieve_size > 0) {
+            if ((other->sieve_loc + other->sieve_size) <= addr)
+                lo = MAX(lo, other->sieve_loc + other->sieve_size);
             else {
-                /* Flush the sieve buffer if it's dirty */
-                if (dset_contig->sieve_dirty) {
-                    /* Write to file */
-                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                               dset_contig->sieve_buf) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                    /* Reset sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = FALSE;
+                HDassert(other->sieve_loc >= (addr + len));
+                if (other->sieve_loc < hi) {
+                    hi        = other->sieve_loc;
+                    win_above = TRUE;
                 } /* end if */
+            }     /* end else */
+        }         /* end if */
+    }             /* end for */
+    HDassert(lo <= addr);
 
-                /* Determine the new sieve buffer size & location */
-                dset_contig->sieve_loc = addr;
+    /* Determine the new sieve buffer location, reading ahead backwards if the
+     * request is just below another window
+     */
+    start = addr;
+    if (win_above && (hi - (addr + len)) < dset_contig->sieve_buf_size) {
+        if ((hi - lo) > dset_contig->sieve_buf_size)
+            start = MIN(addr, hi - dset_contig->sieve_buf_size);
+        else
+            start = lo;
+    } /* end if */
+    win->sieve_loc = start;
+
+    /* Compute the size of the sieve buffer */
+    min = MIN(hi - start, dset_contig->sieve_buf_size);
+    H5_CHECKED_ASSIGN(win->sieve_size, size_t, min, hsize_t);
+    HDassert((win->sieve_loc + win->sieve_size) >= (addr + len));
+
+    /* Read the new sieve buffer, unless it will be overwritten entirely */
+    if (!for_write || win->sieve_size > len)
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, win->sieve_loc, win->sieve_size, win->sieve_buf) <
+            0) {
+            win->sieve_loc  = HADDR_UNDEF;
+            win->sieve_size = 0;
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+        } /* end if */
 
-                /* Make certain we don't read off the end of the file */
-                if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+    /* Reset sieve buffer dirty flag and mark the window as most recently used */
+    win->sieve_dirty = FALSE;
+    win->lru_stamp   = ++dset_contig->lru_clock;
 
-                /* Only need this when resizing sieve buffer */
-                max_data = store_contig->dset_size - dst_off;
+    *win_out = win;
 
-                /* Compute the size of the sieve buffer.
-                 * Don't read off the end of the file, don't read past
-                 * the end of the data element, and don't read more than
-                 * the buffer size.
-                 */
-                min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_fill() */
 
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_flush
+ *
+ * Purpose:	Write all dirty sieve buffer windows back to the file.
+ *              The windows are written in file order and runs of adjacent
+ *              dirty windows are merged into a single write.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_sieve_flush(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig)
+{
+    H5D_rdcdc_win_t *dirty[H5D_SIEVE_NWINDOWS]; /* Dirty windows, in file order */
+    unsigned char *  merge_buf = NULL;          /* Buffer for merging adjacent windows */
+    unsigned         ndirty    = 0;             /* Number of dirty windows */
+    unsigned         u, v;                      /* Local index variables */
+    herr_t           ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_PACKAGE
 
-                /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+    HDassert(dset_contig);
 
-                /* Reset sieve buffer dirty flag */
-                dset_contig->sieve_dirty = FALSE;
-            } /* end else */
-        }     /* end else */
-    }         /* end else */
+    /* Collect the dirty windows, sorted by file address */
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++)
+        if (dset_contig->win[u].sieve_size > 0 && dset_contig->win[u].sieve_dirty) {
+            for (v = ndirty; v > 0 && dirty[v - 1]->sieve_loc > dset_contig->win[u].sieve_loc; v--)
+                dirty[v] = dirty[v - 1];
+            dirty[v] = &dset_contig->win[u];
+            ndirty++;
+        } /* end if */
+
+    for (u = 0; u < ndirty; u = v) {
+        size_t merge_size = dirty[u]->sieve_size; /* Size of the run of adjacent windows */
+
+        /* Find the run of windows adjacent to this one */
+        for (v = u + 1; v < ndirty && (dirty[v - 1]->sieve_loc + dirty[v - 1]->sieve_size) == dirty[v]->sieve_loc;
+             v++)
+            merge_size += dirty[v]->sieve_size;
+
+        if ((v - u) == 1) {
+            if (H5D__contig_sieve_win_flush(f_sh, dirty[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer window")
+        } /* end if */
+        else {
+            unsigned char *p; /* Pointer into merge buffer */
+            unsigned       w; /* Local index variable */
+
+            /* Gather the windows into one buffer */
+            if (NULL == (merge_buf = H5FL_BLK_MALLOC(sieve_buf, merge_size)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+            for (w = u, p = merge_buf; w < v; p += dirty[w]->sieve_size, w++)
+                H5MM_memcpy(p, dirty[w]->sieve_buf, dirty[w]->sieve_size);
+
+            /* Write to file */
+            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, dirty[u]->sieve_loc, merge_size, merge_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+            merge_buf = H5FL_BLK_FREE(sieve_buf, merge_buf);
+
+            /* Reset sieve buffer dirty flags */
+            for (w = u; w < v; w++)
+                dirty[w]->sieve_dirty = FALSE;
+        } /* end else */
+    }     /* end for */
+
+done:
+    if (merge_buf)
+        merge_buf = H5FL_BLK_FREE(sieve_buf, merge_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_free
+ *
+ * Purpose:	Release the sieve buffer windows for a dataset.  Any dirty
+ *              data must have been flushed already.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__contig_sieve_free(H5D_rdcdc_t *dset_contig)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset_contig);
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
+
+        if (win->sieve_buf)
+            win->sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, win->sieve_buf);
+        win->sieve_loc   = HADDR_UNDEF;
+        win->sieve_size  = 0;
+        win->sieve_dirty = FALSE;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_sieve_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_readvv_sieve_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_readvv() with sieve buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *              Thursday, Sept 30, 2010
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_readvv_sieve_ud_t *udata =
+        (H5D_contig_readvv_sieve_ud_t *)_udata;     /* User data for H5VM_opvv() operator */
+    H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
+    H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
+    const H5D_contig_storage_t *store_contig =
+        udata->store_contig;     /* Contiguous storage info for this I/O operation */
+    H5D_rdcdc_win_t *win;        /* Sieve buffer window holding the data */
+    unsigned char *  buf;        /* Pointer to buffer to fill */
+    haddr_t          addr;       /* Actual address to read */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Compute offset on disk */
+    addr = store_contig->dset_addr + dst_off;
+
+    /* Compute offset in memory */
+    buf = udata->rbuf + src_off;
+
+    /* If entire read is within a sieve buffer window, read it from the buffer */
+    if (NULL != (win = H5D__contig_sieve_lookup(dset_contig, addr, len)))
+        H5MM_memcpy(buf, win->sieve_buf + (addr - win->sieve_loc), len);
+    /* Check if we can actually hold the I/O request in the sieve buffer */
+    else if (len > dset_contig->sieve_buf_size) {
+        /* Flush any dirty windows that overlap the request */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, len, FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
+
+        /* Read directly into the user's buffer */
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+    } /* end if */
+    /* Element size fits within the buffer size */
+    else {
+        /* Drop any windows that only partially hold the request */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, len, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
+
+        /* Read a new window holding the request */
+        if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, addr, len, FALSE, &win) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer window")
+
+        /* Grab the data out of the buffer */
+        H5MM_memcpy(buf, win->sieve_buf + (addr - win->sieve_loc), len);
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -887,7 +1149,8 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
                    size_t dset_len_arr[], hsize_t dset_off_arr[], size_t mem_max_nseq, size_t *mem_curr_seq,
                    size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
-    ssize_t ret_value = -1; /* Return value */
+    const void *image     = NULL; /* Memory image of the dataset's storage */
+    ssize_t     ret_value = -1;   /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -900,8 +1163,39 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
-    /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    /* Check if the file driver can lend out the dataset's storage directly.
+     * Only the range covered by the sequences is borrowed, so that the
+     * driver sees the part of the dataset actually being read.
+     */
+    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_MEMORY_IMAGE) && *dset_curr_seq < dset_max_nseq) {
+        hsize_t start = dset_off_arr[*dset_curr_seq];
+        hsize_t end   = start + dset_len_arr[*dset_curr_seq];
+        size_t  u;
+
+        /* (Point selections needn't be in increasing order) */
+        for (u = *dset_curr_seq + 1; u < dset_max_nseq; u++) {
+            start = MIN(start, dset_off_arr[u]);
+            end   = MAX(end, dset_off_arr[u] + dset_len_arr[u]);
+        } /* end for */
+
+        if (H5F_shared_block_borrow(io_info->f_sh, H5FD_MEM_DRAW, io_info->store->contig.dset_addr + start,
+                                    (size_t)(end - start), &image) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't get memory image of dataset storage")
+
+        /* Rebase the image on the start of the dataset, to match the sequence offsets */
+        if (image)
+            image = (const unsigned char *)image - start;
+    } /* end if */
+
+    if (image) {
+        /* Copy the sequences straight out of the file's memory image */
+        if ((ret_value = H5VM_memcpyvv(io_info->u.rbuf, mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                                       image, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr)) <
+            0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "vectorized memcpy failed")
+    } /* end if */
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+        /* Data sieving is enabled */
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -955,198 +1249,92 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
     H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
-        udata->store_contig;   /* Contiguous storage info for this I/O operation */
-    const unsigned char *buf;  /* Pointer to buffer to fill */
-    haddr_t              addr; /* Actual address to read */
-    haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+        udata->store_contig;       /* Contiguous storage info for this I/O operation */
+    H5D_rdcdc_win_t *    win;      /* Sieve buffer window to hold the data */
+    const unsigned char *buf;      /* Pointer to buffer to fill */
+    haddr_t              addr;     /* Actual address to read */
+    unsigned             u;        /* Local index variable */
+    herr_t               ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Stash local copies of these values */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->wbuf + src_off;
 
-    /* No data sieve buffer yet, go allocate one */
-    if (NULL == dset_contig->sieve_buf) {
-        /* Check if we can actually hold the I/O request in the sieve buffer */
-        if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-        } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
-
-            /* Clear memory */
-            if (dset_contig->sieve_size > len)
-                HDmemset(dset_contig->sieve_buf + len, 0, (dset_contig->sieve_size - len));
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
+    /* If entire write is within a sieve buffer window, write it to the buffer */
+    if (NULL != (win = H5D__contig_sieve_lookup(dset_contig, addr, len))) {
+        /* Put the data into the sieve buffer */
+        H5MM_memcpy(win->sieve_buf + (addr - win->sieve_loc), buf, len);
 
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-            /* Check if there is any point in reading the data from the file */
-            if (dset_contig->sieve_size > len) {
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+        /* Set sieve buffer dirty flag */
+        win->sieve_dirty = TRUE;
+    } /* end if */
+    /* Check if we can actually hold the I/O request in the sieve buffer */
+    else if (len > dset_contig->sieve_buf_size) {
+        /* Flush & drop any windows that overlap the request */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, len, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
+
+        /* Write directly from the user's buffer */
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    } /* end if */
+    /* Element size fits within the buffer size */
+    else {
+        /* Drop any windows that only partially hold the request */
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, addr, len, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
+
+        /* Check if it is possible to (exactly) prepend or append to an existing (dirty) window */
+        for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+            H5D_rdcdc_win_t *tmp_win = &dset_contig->win[u];
+
+            if (tmp_win->sieve_size > 0 && tmp_win->sieve_dirty &&
+                ((addr + len) == tmp_win->sieve_loc || addr == (tmp_win->sieve_loc + tmp_win->sieve_size)) &&
+                (len + tmp_win->sieve_size) <= dset_contig->sieve_buf_size) {
+                win = tmp_win;
+                break;
             } /* end if */
+        }     /* end for */
 
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = TRUE;
-
-            /* Stash local copies of these values */
-            sieve_start = dset_contig->sieve_loc;
-            sieve_size  = dset_contig->sieve_size;
-            sieve_end   = sieve_start + sieve_size;
-        } /* end else */
-    }     /* end if */
-    else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
+        if (win) {
+            /* Prepend to existing sieve buffer */
+            if ((addr + len) == win->sieve_loc) {
+                /* Move existing sieve information to correct location */
+                HDmemmove(win->sieve_buf + len, win->sieve_buf, win->sieve_size);
 
-        /* If entire write is within the sieve buffer, write it to the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+                /* Copy in new information (must be first in sieve buffer) */
+                H5MM_memcpy(win->sieve_buf, buf, len);
 
-            /* Put the data into the sieve buffer */
-            H5MM_memcpy(base_sieve_buf, buf, len);
+                /* Adjust sieve location */
+                win->sieve_loc = addr;
+            } /* end if */
+            /* Append to existing sieve buffer */
+            else {
+                /* Copy in new information */
+                H5MM_memcpy(win->sieve_buf + win->sieve_size, buf, len);
+            } /* end else */
 
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = TRUE;
+            /* Adjust sieve size */
+            win->sieve_size += len;
+            win->lru_stamp = ++dset_contig->lru_clock;
         } /* end if */
-        /* Entire request is not within this data sieve buffer */
+        /* Can't add the new data onto an existing window */
         else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-
-                    /* Force the sieve buffer to be re-read the next time */
-                    dset_contig->sieve_loc  = HADDR_UNDEF;
-                    dset_contig->sieve_size = 0;
-                } /* end if */
+            /* Set up a new window holding the request */
+            if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, addr, len, TRUE, &win) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer window")
 
-                /* Write directly from the user's buffer */
-                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-            } /* end if */
-            /* Element size fits within the buffer size */
-            else {
-                /* Check if it is possible to (exactly) prepend or append to existing (dirty) sieve buffer */
-                if (((addr + len) == sieve_start || addr == sieve_end) &&
-                    (len + sieve_size) <= dset_contig->sieve_buf_size && dset_contig->sieve_dirty) {
-                    /* Prepend to existing sieve buffer */
-                    if ((addr + len) == sieve_start) {
-                        /* Move existing sieve information to correct location */
-                        HDmemmove(dset_contig->sieve_buf + len, dset_contig->sieve_buf,
-                                  dset_contig->sieve_size);
-
-                        /* Copy in new information (must be first in sieve buffer) */
-                        H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-                        /* Adjust sieve location */
-                        dset_contig->sieve_loc = addr;
-
-                    } /* end if */
-                    /* Append to existing sieve buffer */
-                    else {
-                        /* Copy in new information */
-                        H5MM_memcpy(dset_contig->sieve_buf + sieve_size, buf, len);
-                    } /* end else */
-
-                    /* Adjust sieve size */
-                    dset_contig->sieve_size += len;
-                } /* end if */
-                /* Can't add the new data onto the existing sieve buffer */
-                else {
-                    /* Flush the sieve buffer if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-
-                    /* Determine the new sieve buffer size & location */
-                    dset_contig->sieve_loc = addr;
-
-                    /* Make certain we don't read off the end of the file */
-                    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-                    /* Only need this when resizing sieve buffer */
-                    max_data = store_contig->dset_size - dst_off;
-
-                    /* Compute the size of the sieve buffer.
-                     * Don't read off the end of the file, don't read past
-                     * the end of the data element, and don't read more than
-                     * the buffer size.
-                     */
-                    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                    /* Check if there is any point in reading the data from the file */
-                    if (dset_contig->sieve_size > len) {
-                        /* Read the new sieve buffer */
-                        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                                  dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-                    } /* end if */
-
-                    /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                    H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-                    /* Set sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = TRUE;
-                } /* end else */
-            }     /* end else */
-        }         /* end else */
-    }             /* end else */
+            /* Put the data into the sieve buffer */
+            H5MM_memcpy(win->sieve_buf + (addr - win->sieve_loc), buf, len);
+        } /* end else */
+
+        /* Set sieve buffer dirty flag */
+        win->sieve_dirty = TRUE;
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1327,9 +1515,8 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
     hbool_t       fix_ref     = FALSE; /* Flag to indicate that ref values should be fixed */
     H5D_shared_t *shared_fo =
         (H5D_shared_t *)cpy_info->shared_fo; /* Pointer to the shared struct for dataset object */
-    hbool_t try_sieve   = FALSE;             /* Try to get data from the sieve buffer */
-    haddr_t sieve_start = HADDR_UNDEF;       /* Start location of sieve buffer */
-    haddr_t sieve_end   = HADDR_UNDEF;       /* End locations of sieve buffer */
+    hbool_t          try_sieve = FALSE;      /* Try to get data from the sieve buffer */
+    H5D_rdcdc_win_t *sieve_win;              /* Sieve buffer window holding the data */
     herr_t  ret_value   = SUCCEED;           /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -1456,11 +1643,9 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
 
     /* If data sieving is enabled and the dataset is open in the file,
        set up to copy data out of the sieve buffer if deemed possible later */
-    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo && shared_fo->cache.contig.sieve_buf) {
-        try_sieve   = TRUE;
-        sieve_start = shared_fo->cache.contig.sieve_loc;
-        sieve_end   = sieve_start + shared_fo->cache.contig.sieve_size;
-    }
+    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo &&
+        H5D__contig_is_data_cached(shared_fo))
+        try_sieve = TRUE;
 
     while (total_src_nbytes > 0) {
         /* Check if we should reduce the number of bytes to transfer */
@@ -1488,8 +1673,9 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
         } /* end if */
 
         /* If the entire copy is within the sieve buffer, copy data from the sieve buffer */
-        if (try_sieve && (addr_src >= sieve_start) && ((addr_src + src_nbytes - 1) < sieve_end)) {
-            unsigned char *base_sieve_buf = shared_fo->cache.contig.sieve_buf + (addr_src - sieve_start);
+        if (try_sieve &&
+            NULL != (sieve_win = H5D__contig_sieve_lookup(&shared_fo->cache.contig, addr_src, src_nbytes))) {
+            unsigned char *base_sieve_buf = sieve_win->sieve_buf + (addr_src - sieve_win->sieve_loc);
 
             H5MM_memcpy(buf, base_sieve_buf, src_nbytes);
         }
@@ -143,6 +143,7 @@ const H5D_chunk_ops_t H5D_COPS_EARRAY[1] = {{
     H5D__earray_idx_create,         /* create */
     H5D__earray_idx_is_space_alloc, /* is_space_alloc */
     H5D__earray_idx_insert,         /* insert */
+    NULL,                           /* bulk_insert */
     H5D__earray_idx_get_addr,       /* get_addr */
     H5D__earray_idx_resize,         /* resize */
     H5D__earray_idx_iterate,        /* iterate */
@@ -112,6 +112,8 @@ static herr_t  H5D__farray_idx_create(const H5D_chk_idx_info_t *idx_info);
 static hbool_t H5D__farray_idx_is_space_alloc(const H5O_storage_chunk_t *storage);
 static herr_t  H5D__farray_idx_insert(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata,
                                       const H5D_t *dset);
+static herr_t  H5D__farray_idx_bulk_insert(const H5D_chk_idx_info_t *idx_info, size_t nrecs,
+                                           const H5D_chunk_bulk_rec_t *recs, const H5D_t *dset);
 static herr_t  H5D__farray_idx_get_addr(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata);
 static int     H5D__farray_idx_iterate(const H5D_chk_idx_info_t *idx_info, H5D_chunk_cb_func_t chunk_cb,
                                        void *chunk_udata);
@@ -141,6 +143,7 @@ const H5D_chunk_ops_t H5D_COPS_FARRAY[1] = {{
     H5D__farray_idx_create,         /* create */
     H5D__farray_idx_is_space_alloc, /* is_space_alloc */
     H5D__farray_idx_insert,         /* insert */
+    H5D__farray_idx_bulk_insert,    /* bulk_insert */
     H5D__farray_idx_get_addr,       /* get_addr */
     NULL,                           /* resize */
     H5D__farray_idx_iterate,        /* iterate */
@@ -996,6 +999,106 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__farray_idx_insert() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__farray_idx_bulk_insert
+ *
+ * Purpose:     Insert a batch of chunk addresses, sorted by chunk index,
+ *              into the indexing structure.  The elements are packed into
+ *              a single buffer and stored with one pass over the fixed
+ *              array's data block pages.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__farray_idx_bulk_insert(const H5D_chk_idx_info_t *idx_info, size_t nrecs,
+                            const H5D_chunk_bulk_rec_t *recs, const H5D_t H5_ATTR_UNUSED *dset)
+{
+    H5FA_t * fa;                  /* Pointer to fixed array structure */
+    hsize_t *idx       = NULL;    /* Fixed array element indices */
+    void *   elmts     = NULL;    /* Fixed array elements */
+    hbool_t  filtered;            /* Whether the chunks are filtered */
+    hbool_t  sorted    = TRUE;    /* Whether the element indices are strictly increasing */
+    size_t   u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(nrecs == 0 || recs);
+
+    if (nrecs == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check if the fixed array is open yet */
+    if (NULL == idx_info->storage->u.farray.fa) {
+        /* Open the fixed array in file */
+        if (H5D__farray_idx_open(idx_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "can't open fixed array")
+    }
+    else /* Patch the top level file pointer contained in fa if needed */
+        H5FA_patch_file(idx_info->storage->u.farray.fa, idx_info->f);
+
+    /* Set convenience pointer to fixed array structure */
+    fa       = idx_info->storage->u.farray.fa;
+    filtered = (hbool_t)(idx_info->pline->nused > 0);
+
+    /* Allocate the element buffers */
+    if (NULL == (idx = (hsize_t *)H5MM_malloc(nrecs * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk index buffer")
+    if (NULL == (elmts = H5MM_malloc(nrecs * (filtered ? sizeof(H5D_farray_filt_elmt_t) : sizeof(haddr_t)))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk element buffer")
+
+    /* Pack the elements */
+    for (u = 0; u < nrecs; u++) {
+        if (!H5F_addr_defined(recs[u].chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "The chunk should have allocated already")
+        if (recs[u].chunk_idx != (recs[u].chunk_idx & 0xffffffff)) /* negative value */
+            HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "chunk index must be less than 2^32")
+
+        idx[u] = recs[u].chunk_idx;
+        if (u > 0 && idx[u - 1] >= idx[u])
+            sorted = FALSE;
+
+        if (filtered) {
+            H5D_farray_filt_elmt_t *elmt = ((H5D_farray_filt_elmt_t *)elmts) + u;
+
+            elmt->addr = recs[u].chunk_block.offset;
+            H5_CHECKED_ASSIGN(elmt->nbytes, uint32_t, recs[u].chunk_block.length, hsize_t);
+            elmt->filter_mask = recs[u].filter_mask;
+        } /* end if */
+        else
+            ((haddr_t *)elmts)[u] = recs[u].chunk_block.offset;
+    } /* end for */
+
+    if (sorted) {
+        /* Set the info for all the chunks at once */
+        if (H5FA_set_bulk(fa, nrecs, idx, elmts) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set chunk info")
+    } /* end if */
+    else {
+        size_t elmt_size = filtered ? sizeof(H5D_farray_filt_elmt_t) : sizeof(haddr_t);
+
+        /* Fall back to setting the chunks one at a time */
+        for (u = 0; u < nrecs; u++)
+            if (H5FA_set(fa, idx[u], ((uint8_t *)elmts) + (u * elmt_size)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set chunk info")
+    } /* end else */
+
+done:
+    H5MM_xfree(idx);
+    H5MM_xfree(elmts);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__farray_idx_bulk_insert() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__farray_idx_get_addr
  *
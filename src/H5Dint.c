@@ -69,6 +69,16 @@ typedef struct {
     H5D_vlen_bufsize_common_t common;       /* VL data buffers & accumulatd size */
 } H5D_vlen_bufsize_generic_t;
 
+#ifdef H5_HAVE_PARALLEL
+/* User data for opening a dataset by name in a bulk collective metadata read */
+typedef struct {
+    const H5G_loc_t *loc;     /* Location to open the dataset from */
+    const char *     name;    /* Name of the dataset */
+    hid_t            dapl_id; /* Dataset access property list */
+    H5D_t *          dset;    /* Dataset opened */
+} H5D_open_name_ud_t;
+#endif /* H5_HAVE_PARALLEL */
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -93,6 +103,9 @@ static herr_t H5D__vlen_get_buf_size_cb(void *elem, hid_t type_id, unsigned ndim
 static herr_t H5D__vlen_get_buf_size_gen_cb(void *elem, hid_t type_id, unsigned ndim, const hsize_t *point,
                                             void *op_data);
 static herr_t H5D__check_filters(H5D_t *dataset);
+#ifdef H5_HAVE_PARALLEL
+static herr_t H5D__open_name_cb(void *_udata);
+#endif /* H5_HAVE_PARALLEL */
 
 /*********************/
 /* Package Variables */
@@ -116,9 +129,6 @@ H5FL_BLK_DEFINE(vlen_fl_buf);
 H5FL_DEFINE_STATIC(H5D_t);
 H5FL_DEFINE_STATIC(H5D_shared_t);
 
-/* Declare the external PQ free list for the sieve buffer information */
-H5FL_BLK_EXTERN(sieve_buf);
-
 /* Declare the external free list to manage the H5D_chunk_info_t struct */
 H5FL_EXTERN(H5D_chunk_info_t);
 
@@ -1348,8 +1358,13 @@ H5D__create(H5F_t *file, hid_t type_id, const H5S_t *space, hid_t dcpl_id, hid_t
     } /* end if */
 
     /* Check if this dataset is going into a parallel file and set space allocation time */
-    if (H5F_HAS_FEATURE(file, H5FD_FEAT_ALLOCATE_EARLY))
-        new_dset->shared->dcpl_cache.fill.alloc_time = H5D_ALLOC_TIME_EARLY;
+    if (H5F_HAS_FEATURE(file, H5FD_FEAT_ALLOCATE_EARLY)) {
+#ifdef H5_HAVE_PARALLEL
+        /* (Not needed for chunks placed in the processes' raw data arenas as they are written) */
+        if (!H5D__chunk_arena_active(file, new_dset->shared))
+#endif /* H5_HAVE_PARALLEL */
+            new_dset->shared->dcpl_cache.fill.alloc_time = H5D_ALLOC_TIME_EARLY;
+    } /* end if */
 
     /* Set the dataset's I/O operations */
     if (H5D__layout_set_io_ops(new_dset) < 0)
@@ -1473,6 +1488,23 @@ H5D__open_name(const H5G_loc_t *loc, const char *name, hid_t dapl_id)
     HDassert(loc);
     HDassert(name);
 
+#ifdef H5_HAVE_PARALLEL
+    {
+        H5D_open_name_ud_t udata;             /* User data for bulk read */
+        hbool_t            bulk_read = FALSE; /* Whether the dataset was opened with a bulk read */
+
+        /* Open the dataset with the metadata read collectively broadcast in bulk, if possible */
+        udata.loc     = loc;
+        udata.name    = name;
+        udata.dapl_id = dapl_id;
+        udata.dset    = NULL;
+        if (H5AC_coll_bulk_read(loc->oloc->file, H5D__open_name_cb, &udata, &bulk_read) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, NULL, "can't open dataset")
+        if (bulk_read)
+            HGOTO_DONE(udata.dset)
+    }
+#endif /* H5_HAVE_PARALLEL */
+
     /* Set up dataset location to fill in */
     dset_loc.oloc = &oloc;
     dset_loc.path = &path;
@@ -1504,6 +1536,33 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__open_name() */
 
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__open_name_cb
+ *
+ * Purpose:     Opens a dataset by name, as the operation of a bulk
+ *              collective metadata read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__open_name_cb(void *_udata)
+{
+    H5D_open_name_ud_t *udata     = (H5D_open_name_ud_t *)_udata;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (udata->dset = H5D__open_name(udata->loc, udata->name, udata->dapl_id)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "can't open dataset")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__open_name_cb() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*
  *-------------------------------------------------------------------------
  * Function: H5D_open
@@ -1853,11 +1912,27 @@ H5D__open_oid(H5D_t *dataset, hid_t dapl_id)
     if ((H5F_INTENT(dataset->oloc.file) & H5F_ACC_RDWR) &&
         !(*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage) &&
         H5F_HAS_FEATURE(dataset->oloc.file, H5FD_FEAT_ALLOCATE_EARLY)) {
-        H5D_io_info_t io_info;
+        H5D_io_info_t    io_info;
+        H5D_time_alloc_t time_alloc = H5D_ALLOC_OPEN; /* When space is being allocated */
+
+#ifdef H5_HAVE_PARALLEL
+        /* Allocation is collective, which process 0 can't do by itself while
+         * recording a bulk collective metadata read.  Failing makes all
+         * processes open the dataset again together.
+         */
+        if (H5C_coll_bulk_read_recording())
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't allocate during a bulk collective read")
+#endif /* H5_HAVE_PARALLEL */
 
         io_info.dset = dataset;
 
-        if (H5D__alloc_storage(&io_info, H5D_ALLOC_OPEN, FALSE, NULL) < 0)
+#ifdef H5_HAVE_PARALLEL
+        /* Only create the chunk index if chunks are placed in raw data arenas as they are written */
+        if (H5D__chunk_arena_active(dataset->oloc.file, dataset->shared))
+            time_alloc = H5D_ALLOC_WRITE;
+#endif /* H5_HAVE_PARALLEL */
+
+        if (H5D__alloc_storage(&io_info, time_alloc, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize file storage")
     } /* end if */
 
@@ -1932,10 +2007,8 @@ H5D_close(H5D_t *dataset)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve buffers, if they've been allocated */
+                H5D__contig_sieve_free(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -2126,10 +2199,8 @@ H5D_mult_refresh_close(hid_t dset_id)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve buffers, if they've been allocated */
+                H5D__contig_sieve_free(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -3036,6 +3107,12 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
     if (H5D__check_filters(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't apply filters")
 
+#ifdef H5_HAVE_PARALLEL
+    /* Index the chunks in the processes' raw data arenas while their indices are valid */
+    if (H5D__chunk_arena_active(dset->oloc.file, dset->shared) && H5D__chunk_arena_reconcile(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to index chunks in raw data arenas")
+#endif /* H5_HAVE_PARALLEL */
+
     /* Keep the current dataspace dimensions for later */
     HDcompile_assert(sizeof(curr_dims) == sizeof(dset->shared->curr_dims));
     H5MM_memcpy(curr_dims, dset->shared->curr_dims, H5S_MAX_RANK * sizeof(curr_dims[0]));
@@ -3157,6 +3234,16 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
             if (H5D__alloc_storage(&io_info, H5D_ALLOC_EXTEND, FALSE, curr_dims) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to extend dataset storage")
         }
+#ifdef H5_HAVE_PARALLEL
+        /* A dataset that was empty gets its chunk index now, while all processes are here */
+        else if (expand && H5D__chunk_arena_active(dset->oloc.file, dset->shared) &&
+                 !(*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage)) {
+            if (H5D__chunk_create(dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize chunked storage")
+            if (H5D__mark(dset, H5D_MARK_LAYOUT) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to mark layout as dirty")
+        }
+#endif /* H5_HAVE_PARALLEL */
         /*-------------------------------------------------------------------------
          * Remove chunk information in the case of chunked datasets
          * This removal takes place only in case we are shrinking the dateset
@@ -3208,19 +3295,10 @@ H5D__flush_sieve_buf(H5D_t *dataset)
     /* Check args */
     HDassert(dataset);
 
-    /* Flush the raw data buffer, if we have a dirty one */
-    if (dataset->shared->cache.contig.sieve_buf && dataset->shared->cache.contig.sieve_dirty) {
-        HDassert(dataset->shared->layout.type !=
-                 H5D_COMPACT); /* We should never have a sieve buffer for compact storage */
-
-        /* Write dirty data sieve buffer to file */
-        if (H5F_shared_block_write(
-                H5F_SHARED(dataset->oloc.file), H5FD_MEM_DRAW, dataset->shared->cache.contig.sieve_loc,
-                dataset->shared->cache.contig.sieve_size, dataset->shared->cache.contig.sieve_buf) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
-
-        /* Reset sieve buffer dirty flag */
-        dataset->shared->cache.contig.sieve_dirty = FALSE;
+    /* Flush the raw data buffers, if we have dirty ones */
+    if (dataset->shared->layout.type != H5D_COMPACT) {
+        if (H5D__contig_sieve_flush(H5F_SHARED(dataset->oloc.file), &dataset->shared->cache.contig) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush data sieve buffers")
     } /* end if */
 
 done:
@@ -46,7 +46,7 @@
 /* Setup/teardown routines */
 static herr_t H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *store,
                                H5D_io_info_t *io_info);
-static herr_t H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
+static herr_t H5D__typeinfo_init(H5D_t *dset, hid_t mem_type_id, hbool_t do_write, hsize_t nelmts,
                                  H5D_type_info_t *type_info);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset, const H5S_t *file_space,
@@ -169,7 +169,7 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     nelmts = H5S_GET_SELECT_NPOINTS(mem_space);
 
     /* Set up datatype info for operation */
-    if (H5D__typeinfo_init(dataset, mem_type_id, FALSE, &type_info) < 0)
+    if (H5D__typeinfo_init(dataset, mem_type_id, FALSE, nelmts, &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
     type_info_init = TRUE;
 
@@ -305,6 +305,11 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     io_op_init = TRUE;
 
 #ifdef H5_HAVE_PARALLEL
+    /* Index chunks in the processes' raw data arenas before any collective I/O */
+    if (io_info.using_mpi_vfd && H5D__chunk_arena_active(dataset->oloc.file, dataset->shared) &&
+        H5D__chunk_arena_io_init(&io_info, fm) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to prepare chunks in raw data arenas")
+
     /* Adjust I/O info for any parallel I/O */
     if (H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
@@ -390,8 +395,16 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
     if (0 == (H5F_INTENT(dataset->oloc.file) & H5F_ACC_RDWR))
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "no write intent on file")
 
+    /* Initialize dataspace information */
+    if (!file_space)
+        file_space = dataset->shared->space;
+    if (!mem_space)
+        mem_space = file_space;
+
+    nelmts = H5S_GET_SELECT_NPOINTS(mem_space);
+
     /* Set up datatype info for operation */
-    if (H5D__typeinfo_init(dataset, mem_type_id, TRUE, &type_info) < 0)
+    if (H5D__typeinfo_init(dataset, mem_type_id, TRUE, nelmts, &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
     type_info_init = TRUE;
 
@@ -418,14 +431,6 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
     }  /* end else */
 #endif /*H5_HAVE_PARALLEL*/
 
-    /* Initialize dataspace information */
-    if (!file_space)
-        file_space = dataset->shared->space;
-    if (!mem_space)
-        mem_space = file_space;
-
-    nelmts = H5S_GET_SELECT_NPOINTS(mem_space);
-
     /* Make certain that the number of elements in each selection is the same */
     if (nelmts != H5S_GET_SELECT_NPOINTS(file_space))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
@@ -522,6 +527,13 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
     io_op_init = TRUE;
 
 #ifdef H5_HAVE_PARALLEL
+    /* Index chunks in the processes' raw data arenas before any collective I/O, or
+     * make sure an independent write finds room for its new chunks there
+     */
+    if (io_info.using_mpi_vfd && H5D__chunk_arena_active(dataset->oloc.file, dataset->shared) &&
+        H5D__chunk_arena_io_init(&io_info, fm) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to prepare chunks in raw data arenas")
+
     /* Adjust I/O info for any parallel I/O */
     if (H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
@@ -644,7 +656,8 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_type_info_t *type_info)
+H5D__typeinfo_init(H5D_t *dset, hid_t mem_type_id, hbool_t do_write, hsize_t nelmts,
+                   H5D_type_info_t *type_info)
 {
     const H5T_t *     src_type;            /* Source datatype */
     const H5T_t *     dst_type;            /* Destination datatype */
@@ -707,11 +720,12 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
         type_info->need_bkg    = H5T_BKG_NO;
     } /* end if */
     else {
-        void *    tconv_buf;     /* Temporary conversion buffer pointer */
-        void *    bkgr_buf;      /* Background conversion buffer pointer */
-        size_t    max_temp_buf;  /* Maximum temporary buffer size */
-        H5T_bkg_t bkgr_buf_type; /* Background buffer type */
-        size_t    target_size;   /* Desired buffer size	*/
+        void *    tconv_buf;           /* Temporary conversion buffer pointer */
+        void *    bkgr_buf;            /* Background conversion buffer pointer */
+        size_t    max_temp_buf;        /* Maximum temporary buffer size */
+        H5T_bkg_t bkgr_buf_type;       /* Background buffer type */
+        size_t    target_size;         /* Desired buffer size	*/
+        hbool_t   default_buffer_info; /* Whether the buffer information are the defaults */
 
         /* Get info from API context */
         if (H5CX_get_max_temp_buf(&max_temp_buf) < 0)
@@ -743,16 +757,26 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
 
         /* Set up datatype conversion/background buffers */
 
-        target_size = max_temp_buf;
+        /* Detect if we have all default settings for buffers */
+        default_buffer_info =
+            (hbool_t)((H5D_TEMP_BUF_SIZE == max_temp_buf) && (NULL == tconv_buf) && (NULL == bkgr_buf));
+
+        /* When the library allocates the conversion buffer, size it from the
+         * selection, never going above the maximum buffer size:
+         * small selections don't pay for initializing a full-sized buffer.
+         * The size is rounded up to a power of two so that the type
+         * conversion free list can reuse the blocks released by earlier I/O
+         * operations.  Applications opt in to converting large selections
+         * in fewer (larger) strips by raising the maximum with
+         * H5Pset_buffer().
+         */
+        if (NULL == tconv_buf && nelmts > 0 && nelmts < (hsize_t)(max_temp_buf / type_info->max_type_size))
+            target_size = MIN((size_t)H5VM_power2up(nelmts * type_info->max_type_size), max_temp_buf);
+        else
+            target_size = max_temp_buf;
 
         /* If the buffer is too small to hold even one element, try to make it bigger */
         if (target_size < type_info->max_type_size) {
-            hbool_t default_buffer_info; /* Whether the buffer information are the defaults */
-
-            /* Detect if we have all default settings for buffers */
-            default_buffer_info =
-                (hbool_t)((H5D_TEMP_BUF_SIZE == max_temp_buf) && (NULL == tconv_buf) && (NULL == bkgr_buf));
-
             /* Check if we are using the default buffer info */
             if (default_buffer_info)
                 /* OK to get bigger for library default settings */
@@ -762,6 +786,9 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "temporary buffer max size is too small")
         } /* end if */
 
+        /* Remember the buffer size, for testing */
+        dset->shared->io_stats.tconv_buf_size = target_size;
+
         /* Compute the number of elements that will fit into buffer */
         type_info->request_nelmts = target_size / type_info->max_type_size;
 
@@ -783,10 +810,10 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
             size_t bkg_size; /* Desired background buffer size	*/
 
             /* Compute the background buffer size */
-            /* (don't try to use buffers smaller than the default size) */
+            /* (don't try to use buffers smaller than the conversion buffer) */
             bkg_size = type_info->request_nelmts * type_info->dst_type_size;
-            if (bkg_size < max_temp_buf)
-                bkg_size = max_temp_buf;
+            if (bkg_size < target_size)
+                bkg_size = target_size;
 
             /* Allocate background buffer */
             /* (Need calloc()-like call since memory needs to be initialized) */
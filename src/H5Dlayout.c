@@ -497,6 +497,16 @@ H5D__layout_oh_create(H5F_t *file, H5O_t *oh, H5D_t *dset, hid_t dapl_id)
         if (H5D__alloc_storage(&io_info, H5D_ALLOC_CREATE, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
     }
+#ifdef H5_HAVE_PARALLEL
+    /* Chunks placed in the processes' raw data arenas are entered into the
+     * index collectively later, so the (empty) index is created now
+     */
+    else if (H5D__chunk_arena_active(file, dset->shared) &&
+             0 != H5S_GET_EXTENT_NPOINTS(dset->shared->space)) {
+        if (H5D__chunk_create(dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize chunked storage")
+    }
+#endif /* H5_HAVE_PARALLEL */
 
     /* Update external storage message, if it's used */
     if (dset->shared->dcpl_cache.efl.nused > 0) {
@@ -69,6 +69,27 @@
 #define H5D_ALL_CHUNK_ADDR_THRES_COL     30
 #define H5D_ALL_CHUNK_ADDR_THRES_COL_NUM 10000
 
+/* Macro to pick the process which redistributes a chunk that may be shared.
+   Chunk indices are scrambled first, so that regular selection patterns
+   (e.g. every mpi_size-th chunk) don't all land on the same process. */
+#define H5D_CHUNK_DIRECTORY_RANK(IDX, SIZE)                                                                  \
+    ((int)((((uint64_t)(IDX)*UINT64_C(0x9E3779B97F4A7C15)) >> 32) % (uint64_t)(SIZE)))
+
+/* Macro to define the percentage above the average filter load (in bytes of
+   unfiltered chunk data) of a linked-chunk collective write at which the chunks
+   of a process are handed off to other processes for filtering */
+#define H5D_FILTER_LOAD_IMBALANCE_THRES 10
+
+/* MPI message tag for chunks handed off for filtering, and sent back filtered */
+#define H5D_FILTER_OFFLOAD_TAG 0
+
+/* Macro to check whether a filtered chunk written collectively needs new file
+   space or a new chunk index entry, because its size or its filter mask changed */
+#define H5D_CHUNK_NEEDS_REINSERT(STATES)                                                                     \
+    (!H5F_addr_defined((STATES).chunk_current.offset) ||                                                    \
+     (STATES).chunk_current.length != (STATES).new_chunk.length ||                                          \
+     (STATES).current_filter_mask != (STATES).new_filter_mask)
+
 /***** Macros for multi-chunk collective IO case. *****/
 /* The default value of the threshold to do collective IO for this chunk.
    If the average number of processes per chunk is greater than the default value,
@@ -151,6 +172,13 @@ typedef enum H5D_mpio_no_rank0_bcast_cause_t {
  *                              in the file for all of the chunks written to in the I/O operation, as
  *                              their sizes may have changed after their data has been filtered.
  *
+ *                  current_filter_mask - The filter mask of this chunk in the chunk index, before the
+ *                                        filtering operation. It is used to unfilter the chunk when
+ *                                        reading it from the file.
+ *
+ *                  new_filter_mask - The filter mask of this chunk after the filtering operation, which
+ *                                    is stored in the chunk index when it differs from the current one.
+ *
  *   owners - In the case of dataset writes only, this struct is used to manage which single processor
  *            will ultimately write data out to the chunk. It allows the other processors to act according
  *            to the decision and send their selection in the chunk, as well as the data they wish
@@ -193,6 +221,8 @@ typedef struct H5D_filtered_collective_io_info_t {
     struct {
         H5F_block_t chunk_current;
         H5F_block_t new_chunk;
+        unsigned    current_filter_mask;
+        unsigned    new_filter_mask;
     } chunk_states;
 
     struct {
@@ -207,8 +237,32 @@ typedef struct H5D_filtered_collective_io_info_t {
     } async_info;
 } H5D_filtered_collective_io_info_t;
 
-/* Function pointer typedef for sort function */
-typedef int (*H5D_mpio_sort_func_cb_t)(const void *, const void *);
+/*
+ * Record exchanged between the processes writing to a chunk and the chunk's
+ * "directory" process when redistributing shared chunks in
+ * H5D__chunk_redistribute_shared_chunks(). Each writer sends the index of
+ * every chunk it has selected to the chunk's directory process, which fills
+ * in the chunk's new owner and number of writers and sends the record back.
+ */
+typedef struct H5D_chunk_redistribute_info_t {
+    hsize_t index;
+    size_t  num_writers;
+    int     original_owner;
+    int     new_owner;
+} H5D_chunk_redistribute_info_t;
+
+/*
+ * Record shared by all processes for the collective re-allocation and
+ * re-insertion of the filtered chunks whose size or filter mask changed when
+ * they were filtered again. The chunk's scaled coordinates are recomputed
+ * from its index, so they aren't exchanged.
+ */
+typedef struct H5D_chunk_realloc_info_t {
+    hsize_t     index;
+    H5F_block_t chunk_current;
+    H5F_block_t new_chunk;
+    unsigned    filter_mask;
+} H5D_chunk_realloc_info_t;
 
 /********************/
 /* Local Prototypes */
@@ -245,10 +299,19 @@ static herr_t H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *
                                                     H5D_filtered_collective_io_info_t *local_chunk_array,
                                                     size_t *local_chunk_array_num_entries);
 #endif
-static herr_t H5D__mpio_array_gatherv(void *local_array, size_t local_array_num_entries,
-                                      size_t array_entry_size, void **gathered_array,
-                                      size_t *gathered_array_num_entries, hbool_t allgather, int root,
-                                      MPI_Comm comm, int (*sort_func)(const void *, const void *));
+static herr_t H5D__mpio_collective_filtered_chunk_reallocate(const H5D_io_info_t *             io_info,
+                                                             const H5D_chk_idx_info_t *        index_info,
+                                                             H5D_filtered_collective_io_info_t *chunk_list,
+                                                             size_t chunk_list_num_entries,
+                                                             H5D_chunk_realloc_info_t **realloc_list,
+                                                             size_t *realloc_list_num_entries);
+static herr_t H5D__mpio_collective_filtered_chunk_reinsert(const H5D_io_info_t *           io_info,
+                                                           const H5D_chk_idx_info_t *      index_info,
+                                                           const H5D_chunk_realloc_info_t *realloc_list,
+                                                           size_t realloc_list_num_entries);
+static herr_t H5D__mpio_collective_filtered_chunk_filter(const H5D_io_info_t *              io_info,
+                                                         H5D_filtered_collective_io_info_t *chunk_list,
+                                                         size_t chunk_list_num_entries);
 static herr_t H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chunk_list,
                                                        size_t num_entries, MPI_Datatype *new_mem_type,
                                                        hbool_t *mem_type_derived, MPI_Datatype *new_file_type,
@@ -257,12 +320,14 @@ static herr_t H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io
                                                       const H5D_io_info_t *              io_info,
                                                       const H5D_type_info_t *            type_info,
                                                       const H5D_chunk_map_t *            fm);
+static herr_t H5D__filtered_collective_chunk_filter(const H5D_io_info_t *io_info, void **buf, size_t *nbytes,
+                                                    unsigned *filter_mask);
 static int    H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2);
 static int    H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_info_entry1,
                                                          const void *filtered_collective_io_info_entry2);
 #if MPI_VERSION >= 3
-static int H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
-                                                            const void *filtered_collective_io_info_entry2);
+static int H5D__cmp_chunk_redistribute_info(const void *chunk_redistribute_info1,
+                                           const void *chunk_redistribute_info2);
 #endif
 
 /*********************/
@@ -499,145 +564,6 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__mpio_select_write() */
 
-/*-------------------------------------------------------------------------
- * Function:    H5D__mpio_array_gatherv
- *
- * Purpose:     Given an array, specified in local_array, by each processor
- *              calling this function, collects each array into a single
- *              array which is then either gathered to the processor
- *              specified by root, when allgather is false, or is
- *              distributed back to all processors when allgather is true.
- *
- *              The number of entries in the array contributed by an
- *              individual processor and the size of each entry should be
- *              specified in local_array_num_entries and array_entry_size,
- *              respectively.
- *
- *              The MPI communicator to use should be specified for comm.
- *
- *              If the sort_func argument is supplied, the array is sorted
- *              before the function returns.
- *
- *              Note: if allgather is specified as true, root is ignored.
- *
- * Return:      Non-negative on success/Negative on failure
- *
- * Programmer:  Jordan Henderson
- *              Sunday, April 9th, 2017
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5D__mpio_array_gatherv(void *local_array, size_t local_array_num_entries, size_t array_entry_size,
-                        void **_gathered_array, size_t *_gathered_array_num_entries, hbool_t allgather,
-                        int root, MPI_Comm comm, H5D_mpio_sort_func_cb_t sort_func)
-{
-    size_t gathered_array_num_entries = 0;    /* The size of the newly-constructed array */
-    void * gathered_array             = NULL; /* The newly-constructed array returned to the caller */
-    int *receive_counts_array = NULL; /* Array containing number of entries each processor is contributing */
-    int *displacements_array =
-        NULL; /* Array of displacements where each processor places its data in the final array */
-    int    mpi_code, mpi_rank, mpi_size;
-    int    sendcount;
-    herr_t ret_value = SUCCEED;
-
-    FUNC_ENTER_STATIC
-
-    HDassert(_gathered_array);
-    HDassert(_gathered_array_num_entries);
-
-    MPI_Comm_size(comm, &mpi_size);
-    MPI_Comm_rank(comm, &mpi_rank);
-
-    /* Determine the size of the end result array by collecting the number
-     * of entries contributed by each processor into a single total.
-     */
-    if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&local_array_num_entries, &gathered_array_num_entries, 1,
-                                                 MPI_INT, MPI_SUM, comm)))
-        HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
-
-    /* If 0 entries resulted from the collective operation, no processor is contributing anything and there is
-     * nothing to do */
-    if (gathered_array_num_entries > 0) {
-        /*
-         * If gathering to all processors, all processors need to allocate space for the resulting array, as
-         * well as the receive counts and displacements arrays for the collective MPI_Allgatherv call.
-         * Otherwise, only the root processor needs to allocate the space for an MPI_Gatherv call.
-         */
-        if (allgather || (mpi_rank == root)) {
-            if (NULL == (gathered_array = H5MM_malloc(gathered_array_num_entries * array_entry_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate gathered array")
-
-            if (NULL == (receive_counts_array = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive counts array")
-
-            if (NULL == (displacements_array = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive displacements array")
-        } /* end if */
-
-        /*
-         * If gathering to all processors, inform each processor of how many entries each other processor is
-         * contributing to the resulting array by collecting the counts into each processor's "receive counts"
-         * array. Otherwise, inform only the root processor of how many entries each other processor is
-         * contributing.
-         */
-        if (allgather) {
-            if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&local_array_num_entries, 1, MPI_INT,
-                                                         receive_counts_array, 1, MPI_INT, comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
-        } /* end if */
-        else {
-            if (MPI_SUCCESS != (mpi_code = MPI_Gather(&local_array_num_entries, 1, MPI_INT,
-                                                      receive_counts_array, 1, MPI_INT, root, comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Gather failed", mpi_code)
-        } /* end else */
-
-        if (allgather || (mpi_rank == root)) {
-            size_t i;
-
-            /* Multiply each receive count by the size of the array entry, since the data is sent as bytes. */
-            for (i = 0; i < (size_t)mpi_size; i++)
-                H5_CHECKED_ASSIGN(receive_counts_array[i], int,
-                                  (size_t)receive_counts_array[i] * array_entry_size, size_t);
-
-            /* Set receive buffer offsets for the collective MPI_Allgatherv/MPI_Gatherv call. */
-            displacements_array[0] = 0;
-            for (i = 1; i < (size_t)mpi_size; i++)
-                displacements_array[i] = displacements_array[i - 1] + receive_counts_array[i - 1];
-        } /* end if */
-
-        /* As the data is sent as bytes, calculate the true sendcount for the data. */
-        H5_CHECKED_ASSIGN(sendcount, int, local_array_num_entries *array_entry_size, size_t);
-
-        if (allgather) {
-            if (MPI_SUCCESS !=
-                (mpi_code = MPI_Allgatherv(local_array, sendcount, MPI_BYTE, gathered_array,
-                                           receive_counts_array, displacements_array, MPI_BYTE, comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Allgatherv failed", mpi_code)
-        } /* end if */
-        else {
-            if (MPI_SUCCESS !=
-                (mpi_code = MPI_Gatherv(local_array, sendcount, MPI_BYTE, gathered_array,
-                                        receive_counts_array, displacements_array, MPI_BYTE, root, comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Gatherv failed", mpi_code)
-        } /* end else */
-
-        if (sort_func && (allgather || (mpi_rank == root)))
-            HDqsort(gathered_array, gathered_array_num_entries, array_entry_size, sort_func);
-    } /* end if */
-
-    *_gathered_array             = gathered_array;
-    *_gathered_array_num_entries = gathered_array_num_entries;
-
-done:
-    if (receive_counts_array)
-        H5MM_free(receive_counts_array);
-    if (displacements_array)
-        H5MM_free(displacements_array);
-
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__mpio_array_gatherv() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5D__mpio_get_sum_chunk
  *
@@ -699,7 +625,7 @@ H5D__contig_collective_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_
     FUNC_ENTER_PACKAGE
 
     /* Sanity check */
-    HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
+    HDassert(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_HAS_MPI));
 
     /* Call generic internal collective I/O routine */
     if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
@@ -738,7 +664,7 @@ H5D__contig_collective_write(H5D_io_info_t *io_info, const H5D_type_info_t *type
     FUNC_ENTER_PACKAGE
 
     /* Sanity check */
-    HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
+    HDassert(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_HAS_MPI));
 
     /* Call generic internal collective I/O routine */
     if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
@@ -1012,8 +938,9 @@ H5D__link_chunk_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *typ
         NULL;                            /* Flags to indicate each chunk's MPI memory datatype is derived */
     int *  chunk_mpi_file_counts = NULL; /* Count of MPI file datatype for each chunk */
     int *  chunk_mpi_mem_counts  = NULL; /* Count of MPI memory datatype for each chunk */
-    int    mpi_code;                     /* MPI return code */
-    herr_t ret_value = SUCCEED;
+    H5S_mpio_type_cache_t *type_cache = NULL; /* File's cache of MPI datatypes for selections */
+    int                    mpi_code;          /* MPI return code */
+    herr_t                 ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
 
@@ -1139,6 +1066,10 @@ H5D__link_chunk_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *typ
                 HDfprintf(H5DEBUG(D), "after sorting the chunk address \n");
 #endif
 
+            /* Retrieve the file's cache of MPI datatypes for selections */
+            if (NULL == (type_cache = H5F_get_mpio_type_cache(io_info->dset->oloc.file)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI datatype cache")
+
             /* Obtain MPI derived datatype from all individual chunks */
             for (u = 0; u < num_chunk; u++) {
                 hsize_t *permute_map = NULL; /* array that holds the mapping from the old,
@@ -1153,7 +1084,7 @@ H5D__link_chunk_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *typ
                  *              where it will be freed.
                  */
                 if (H5S_mpio_space_type(chunk_addr_info_array[u].chunk_info.fspace, type_info->src_type_size,
-                                        &chunk_ftype[u],                  /* OUT: datatype created */
+                                        type_cache, &chunk_ftype[u],      /* OUT: datatype created */
                                         &chunk_mpi_file_counts[u],        /* OUT */
                                         &(chunk_mft_is_derived_array[u]), /* OUT */
                                         TRUE,                             /* this is a file space,
@@ -1171,7 +1102,7 @@ H5D__link_chunk_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *typ
                 if (is_permuted)
                     HDassert(permute_map);
                 if (H5S_mpio_space_type(chunk_addr_info_array[u].chunk_info.mspace, type_info->dst_type_size,
-                                        &chunk_mtype[u], &chunk_mpi_mem_counts[u],
+                                        type_cache, &chunk_mtype[u], &chunk_mpi_mem_counts[u],
                                         &(chunk_mbt_is_derived_array[u]), FALSE, /* this is a memory
                                                                                     space, so if the file
                                                                                     space is not
@@ -1314,20 +1245,22 @@ done:
  *                    III. Receive any modification data from other
  *                         processes and update the chunk data with these
  *                         modifications
- *                    IV. Filter the chunk
- *                 B. Contribute the modified chunks to an array gathered
- *                    by all processes which contains the new sizes of
- *                    every chunk modified in the collective IO operation
- *                 C. All processes collectively re-allocate each chunk
- *                    from the gathered array with their new sizes after
- *                    the filter operation
+ *                 B. Collectively filter the chunks, handing some of
+ *                    them off to other processes for filtering if the
+ *                    amount of chunk data to filter is unbalanced
+ *                 C. Contribute the chunks whose size or filter mask
+ *                    changed to an array gathered by all processes,
+ *                    which then collectively re-allocate each chunk in
+ *                    that array with its new size after the filter
+ *                    operation (chunks which kept their size are
+ *                    rewritten in place)
  *                 D. If this process has any chunks selected in the IO
  *                    operation, create an MPI derived type for memory and
  *                    file to write out the process' selected chunks to the
  *                    file
  *                 E. Perform the collective write
- *                 F. All processes collectively re-insert each modified
- *                    chunk from the gathered array into the chunk index
+ *                 F. All processes collectively re-insert each
+ *                    re-allocated chunk into the chunk index
  *
  *
  * Return:      Non-negative on success/Negative on failure
@@ -1342,18 +1275,17 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
                                        H5D_chunk_map_t *fm)
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
-    H5D_filtered_collective_io_info_t *collective_chunk_list =
-        NULL;                /* The list of chunks used during collective operations */
+    H5D_chunk_realloc_info_t *         realloc_list =
+        NULL;                /* The list of chunks re-allocated by all processes */
     H5D_storage_t ctg_store; /* Chunk storage information as contiguous dataset */
     MPI_Datatype  mem_type             = MPI_BYTE;
     MPI_Datatype  file_type            = MPI_BYTE;
     hbool_t       mem_type_is_derived  = FALSE;
     hbool_t       file_type_is_derived = FALSE;
     size_t        chunk_list_num_entries;
-    size_t        collective_chunk_list_num_entries;
-    size_t *      num_chunks_selected_array = NULL; /* Array of number of chunks selected on each process */
-    size_t        i;                                /* Local index variable */
-    int           mpi_rank, mpi_size, mpi_code;
+    size_t        realloc_list_num_entries = 0;
+    size_t        i; /* Local index variable */
+    int           mpi_rank, mpi_code;
     herr_t        ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -1362,11 +1294,9 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     HDassert(type_info);
     HDassert(fm);
 
-    /* Obtain the current rank of the process and the number of processes */
+    /* Obtain the current rank of the process */
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
-    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
     /* Set the actual-chunk-opt-mode property. */
     H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_LINK_CHUNK);
@@ -1383,7 +1313,6 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
 
     if (io_info->op_type == H5D_IO_OP_WRITE) { /* Filtered collective write */
         H5D_chk_idx_info_t index_info;
-        H5D_chunk_ud_t     udata;
         hsize_t            mpi_buf_count;
 
         /* Construct chunked index info */
@@ -1392,70 +1321,31 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
         index_info.layout  = &(io_info->dset->shared->layout.u.chunk);
         index_info.storage = &(io_info->dset->shared->layout.storage.u.chunk);
 
-        /* Set up chunk information for insertion to chunk index */
-        udata.common.layout  = index_info.layout;
-        udata.common.storage = index_info.storage;
-        udata.filter_mask    = 0;
-
         /* Iterate through all the chunks in the collective write operation,
-         * updating each chunk with the data modifications from other processes,
-         * then re-filtering the chunk.
+         * updating each chunk with the data modifications from other processes
          */
         for (i = 0; i < chunk_list_num_entries; i++)
             if (mpi_rank == chunk_list[i].owners.new_owner)
                 if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
 
-        /* Gather the new chunk sizes to all processes for a collective reallocation
-         * of the chunks in the file.
-         */
-        if (H5D__mpio_array_gatherv(chunk_list, chunk_list_num_entries,
-                                    sizeof(H5D_filtered_collective_io_info_t),
-                                    (void **)&collective_chunk_list, &collective_chunk_list_num_entries, true,
-                                    0, io_info->comm, NULL) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
-
-        /* Collectively re-allocate the modified chunks (from each process) in the file */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            hbool_t insert;
-
-            if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[i].chunk_states.chunk_current,
-                                      &collective_chunk_list[i].chunk_states.new_chunk, &insert,
-                                      collective_chunk_list[i].scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-        } /* end for */
-
-        if (NULL == (num_chunks_selected_array = (size_t *)H5MM_malloc((size_t)mpi_size * sizeof(size_t))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
+        /* Re-filter the chunks, spreading the work among all processes */
+        if (H5D__mpio_collective_filtered_chunk_filter(io_info, chunk_list, chunk_list_num_entries) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't collectively filter chunks")
 
-        if (MPI_SUCCESS !=
-            (mpi_code = MPI_Allgather(&chunk_list_num_entries, 1, MPI_UNSIGNED_LONG_LONG,
-                                      num_chunks_selected_array, 1, MPI_UNSIGNED_LONG_LONG, io_info->comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+        /* Collectively re-allocate the chunks (from each process) whose size or
+         * filter mask changed
+         */
+        if (H5D__mpio_collective_filtered_chunk_reallocate(io_info, &index_info, chunk_list,
+                                                           chunk_list_num_entries, &realloc_list,
+                                                           &realloc_list_num_entries) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't collectively re-allocate chunks")
 
         /* If this process has any chunks selected, create a MPI type for collectively
          * writing out the chunks to file. Otherwise, the process contributes to the
          * collective write with a none type.
          */
         if (chunk_list_num_entries) {
-            size_t offset;
-
-            /* During the collective re-allocation of chunks in the file, the record for each
-             * chunk is only updated in the collective array, not in the local copy of chunks on each
-             * process. However, each process needs the updated chunk records so that they can create
-             * a MPI type for the collective write that will write to the chunk's possible new locations
-             * in the file instead of the old ones. This ugly hack seems to be the best solution to
-             * copy the information back to the local array and avoid having to modify the collective
-             * write type function in an ugly way so that it will accept the collective array instead
-             * of the local array. This works correctly because the array gather function guarantees
-             * that the chunk data in the collective array is ordered in blocks by rank.
-             */
-            for (i = 0, offset = 0; i < (size_t)mpi_rank; i++)
-                offset += num_chunks_selected_array[i];
-
-            H5MM_memcpy(chunk_list, &collective_chunk_list[offset],
-                        num_chunks_selected_array[mpi_rank] * sizeof(H5D_filtered_collective_io_info_t));
-
             /* Create single MPI type encompassing each selection in the dataspace */
             if (H5D__mpio_filtered_collective_write_type(chunk_list, chunk_list_num_entries, &mem_type,
                                                          &mem_type_is_derived, &file_type,
@@ -1479,18 +1369,13 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
         if (H5D__final_collective_io(io_info, type_info, mpi_buf_count, file_type, mem_type) < 0)
             HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish MPI-IO")
 
-        /* Participate in the collective re-insertion of all chunks modified
-         * in this iteration into the chunk index
+        /* Participate in the collective re-insertion of all re-allocated chunks
+         * into the chunk index
          */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            udata.chunk_block   = collective_chunk_list[i].chunk_states.new_chunk;
-            udata.common.scaled = collective_chunk_list[i].scaled;
-            udata.chunk_idx     = collective_chunk_list[i].index;
-
-            if ((index_info.storage->ops->insert)(&index_info, &udata, io_info->dset) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk address into index")
-        } /* end for */
-    }     /* end if */
+        if (H5D__mpio_collective_filtered_chunk_reinsert(io_info, &index_info, realloc_list,
+                                                         realloc_list_num_entries) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "couldn't collectively re-insert chunks")
+    } /* end if */
 
 done:
     /* Free resources used by a process which had some selection */
@@ -1502,10 +1387,8 @@ done:
         H5MM_free(chunk_list);
     } /* end if */
 
-    if (num_chunks_selected_array)
-        H5MM_free(num_chunks_selected_array);
-    if (collective_chunk_list)
-        H5MM_free(collective_chunk_list);
+    if (realloc_list)
+        H5MM_free(realloc_list);
 
     /* Free the MPI buf and file types, if they were derived */
     if (mem_type_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&mem_type)))
@@ -1751,8 +1634,9 @@ done:
  *                         processes and update the chunk data with these
  *                         modifications
  *                    IV. Filter the chunk
- *                    V. Contribute the chunk to an array gathered by
- *                        all processes which contains every chunk
+ *                    V. If the chunk's size or filter mask changed,
+ *                        contribute it to an array gathered by all
+ *                        processes which contains every such chunk
  *                        modified in this iteration (up to one chunk
  *                        per process, some processes may not have a
  *                        selection/may have less chunks to work on than
@@ -1778,8 +1662,8 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
                                         H5D_chunk_map_t *fm)
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
-    H5D_filtered_collective_io_info_t *collective_chunk_list =
-        NULL;                  /* The list of chunks used during collective operations */
+    H5D_chunk_realloc_info_t *         realloc_list =
+        NULL;                  /* The list of chunks re-allocated by all processes in an iteration */
     H5D_storage_t store;       /* union of EFL and chunk pointer in file space */
     H5D_io_info_t ctg_io_info; /* Contiguous I/O info object */
     H5D_storage_t ctg_store;   /* Chunk storage information as contiguous dataset */
@@ -1787,13 +1671,11 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     MPI_Datatype *mem_type_array             = NULL;
     hbool_t *     file_type_is_derived_array = NULL;
     hbool_t *     mem_type_is_derived_array  = NULL;
-    hbool_t *     has_chunk_selected_array =
-        NULL; /* Array of whether or not each process is contributing a chunk to each iteration */
-    size_t chunk_list_num_entries;
-    size_t collective_chunk_list_num_entries;
-    size_t i, j; /* Local index variable */
-    int    mpi_rank, mpi_size, mpi_code;
-    herr_t ret_value = SUCCEED;
+    size_t        chunk_list_num_entries;
+    size_t        realloc_list_num_entries = 0;
+    size_t        i; /* Local index variable */
+    int           mpi_rank, mpi_code;
+    herr_t        ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
 
@@ -1801,11 +1683,9 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     HDassert(type_info);
     HDassert(fm);
 
-    /* Obtain the current rank of the process and the number of processes */
+    /* Obtain the current rank of the process */
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
-    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
     /* Set the actual chunk opt mode property */
     H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_MULTI_CHUNK);
@@ -1839,7 +1719,6 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     }      /* end if */
     else { /* Filtered collective write */
         H5D_chk_idx_info_t index_info;
-        H5D_chunk_ud_t     udata;
         size_t             max_num_chunks;
         hsize_t            mpi_buf_count;
 
@@ -1849,11 +1728,6 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
         index_info.layout  = &(io_info->dset->shared->layout.u.chunk);
         index_info.storage = &(io_info->dset->shared->layout.storage.u.chunk);
 
-        /* Set up chunk information for insertion to chunk index */
-        udata.common.layout  = index_info.layout;
-        udata.common.storage = index_info.storage;
-        udata.filter_mask    = 0;
-
         /* Retrieve the maximum number of chunks being written among all processes */
         if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&chunk_list_num_entries, &max_num_chunks, 1,
                                                      MPI_UNSIGNED_LONG_LONG, MPI_MAX, io_info->comm)))
@@ -1887,55 +1761,31 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
             hbool_t have_chunk_to_process =
                 (i < chunk_list_num_entries) && (mpi_rank == chunk_list[i].owners.new_owner);
 
-            if (have_chunk_to_process)
+            if (have_chunk_to_process) {
+                size_t nbytes; /* Size of the filtered chunk */
+
                 if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
+                H5_CHECKED_ASSIGN(nbytes, size_t, chunk_list[i].chunk_states.new_chunk.length, hsize_t);
+                if (H5D__filtered_collective_chunk_filter(io_info, &chunk_list[i].buf, &nbytes,
+                                                          &chunk_list[i].chunk_states.new_filter_mask) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't filter chunk")
+                chunk_list[i].chunk_states.new_chunk.length = nbytes;
+            } /* end if */
 
-            /* Gather the new chunk sizes to all processes for a collective re-allocation
-             * of the chunks in the file
+            /* Collectively re-allocate the chunks modified in this iteration whose
+             * size or filter mask changed
              */
-            if (H5D__mpio_array_gatherv(&chunk_list[i], have_chunk_to_process ? 1 : 0,
-                                        sizeof(H5D_filtered_collective_io_info_t),
-                                        (void **)&collective_chunk_list, &collective_chunk_list_num_entries,
-                                        true, 0, io_info->comm, NULL) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
-
-            /* Participate in the collective re-allocation of all chunks modified
-             * in this iteration.
-             */
-            for (j = 0; j < collective_chunk_list_num_entries; j++) {
-                hbool_t insert = FALSE;
-
-                if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[j].chunk_states.chunk_current,
-                                          &collective_chunk_list[j].chunk_states.new_chunk, &insert,
-                                          chunk_list[j].scaled) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-            } /* end for */
-
-            if (NULL ==
-                (has_chunk_selected_array = (hbool_t *)H5MM_malloc((size_t)mpi_size * sizeof(hbool_t))))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
-
-            if (MPI_SUCCESS !=
-                (mpi_code = MPI_Allgather(&have_chunk_to_process, 1, MPI_C_BOOL, has_chunk_selected_array, 1,
-                                          MPI_C_BOOL, io_info->comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+            if (H5D__mpio_collective_filtered_chunk_reallocate(
+                    io_info, &index_info, have_chunk_to_process ? &chunk_list[i] : NULL,
+                    have_chunk_to_process ? 1 : 0, &realloc_list, &realloc_list_num_entries) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't collectively re-allocate chunks")
 
             /* If this process has a chunk to work on, create a MPI type for the
              * memory and file for writing out the chunk
              */
             if (have_chunk_to_process) {
-                size_t offset;
-                int    mpi_type_count;
-
-                for (j = 0, offset = 0; j < (size_t)mpi_rank; j++)
-                    offset += has_chunk_selected_array[j];
-
-                /* Collect the new chunk info back to the local copy, since only the record in the
-                 * collective array gets updated by the chunk re-allocation */
-                H5MM_memcpy(&chunk_list[i].chunk_states.new_chunk,
-                            &collective_chunk_list[offset].chunk_states.new_chunk,
-                            sizeof(chunk_list[i].chunk_states.new_chunk));
+                int mpi_type_count;
 
                 H5_CHECKED_ASSIGN(mpi_type_count, int, chunk_list[i].chunk_states.new_chunk.length, hsize_t);
 
@@ -1975,26 +1825,16 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
                                          mem_type_array[i]) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish MPI-IO")
 
-            /* Participate in the collective re-insertion of all chunks modified
+            /* Participate in the collective re-insertion of all chunks re-allocated
              * in this iteration into the chunk index
              */
-            for (j = 0; j < collective_chunk_list_num_entries; j++) {
-                udata.chunk_block   = collective_chunk_list[j].chunk_states.new_chunk;
-                udata.common.scaled = collective_chunk_list[j].scaled;
-                udata.chunk_idx     = collective_chunk_list[j].index;
-
-                if ((index_info.storage->ops->insert)(&index_info, &udata, io_info->dset) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL,
-                                "unable to insert chunk address into index")
-            } /* end for */
+            if (H5D__mpio_collective_filtered_chunk_reinsert(io_info, &index_info, realloc_list,
+                                                             realloc_list_num_entries) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "couldn't collectively re-insert chunks")
 
-            if (collective_chunk_list) {
-                H5MM_free(collective_chunk_list);
-                collective_chunk_list = NULL;
-            } /* end if */
-            if (has_chunk_selected_array) {
-                H5MM_free(has_chunk_selected_array);
-                has_chunk_selected_array = NULL;
+            if (realloc_list) {
+                H5MM_free(realloc_list);
+                realloc_list = NULL;
             } /* end if */
         }     /* end for */
 
@@ -2019,8 +1859,8 @@ done:
         H5MM_free(chunk_list);
     } /* end if */
 
-    if (collective_chunk_list)
-        H5MM_free(collective_chunk_list);
+    if (realloc_list)
+        H5MM_free(realloc_list);
     if (file_type_array)
         H5MM_free(file_type_array);
     if (mem_type_array)
@@ -2060,20 +1900,25 @@ H5D__inter_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     FUNC_ENTER_STATIC
 
     if ((file_space != NULL) && (mem_space != NULL)) {
-        int      mpi_file_count;     /* Number of file "objects" to transfer */
-        hsize_t *permute_map = NULL; /* array that holds the mapping from the old,
-                                        out-of-order displacements to the in-order
-                                        displacements of the MPI datatypes of the
-                                        point selection of the file space */
+        H5S_mpio_type_cache_t *type_cache;         /* File's cache of MPI datatypes for selections */
+        int                    mpi_file_count;     /* Number of file "objects" to transfer */
+        hsize_t *              permute_map = NULL; /* array that holds the mapping from the old,
+                                                      out-of-order displacements to the in-order
+                                                      displacements of the MPI datatypes of the
+                                                      point selection of the file space */
         hbool_t is_permuted = FALSE;
 
+        /* Retrieve the file's cache of MPI datatypes for selections */
+        if (NULL == (type_cache = H5F_get_mpio_type_cache(io_info->dset->oloc.file)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI datatype cache")
+
         /* Obtain disk and memory MPI derived datatype */
         /* NOTE: The permute_map array can be allocated within H5S_mpio_space_type
          *              and will be fed into the next call to H5S_mpio_space_type
          *              where it will be freed.
          */
-        if (H5S_mpio_space_type(file_space, type_info->src_type_size, &mpi_file_type, &mpi_file_count,
-                                &mft_is_derived, /* OUT: datatype created */
+        if (H5S_mpio_space_type(file_space, type_info->src_type_size, type_cache, &mpi_file_type,
+                                &mpi_file_count, &mft_is_derived, /* OUT: datatype created */
                                 TRUE,            /* this is a file space, so
                                                     permute the datatype if the
                                                     point selection is out of
@@ -2088,8 +1933,8 @@ H5D__inter_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         /* Sanity check */
         if (is_permuted)
             HDassert(permute_map);
-        if (H5S_mpio_space_type(mem_space, type_info->src_type_size, &mpi_buf_type, &mpi_buf_count,
-                                &mbt_is_derived, /* OUT: datatype created */
+        if (H5S_mpio_space_type(mem_space, type_info->src_type_size, type_cache, &mpi_buf_type,
+                                &mpi_buf_count, &mbt_is_derived, /* OUT: datatype created */
                                 FALSE,           /* this is a memory space, so if
                                                     the file space is not
                                                     permuted, there is no need to
@@ -2244,37 +2089,37 @@ H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_in
 #if MPI_VERSION >= 3
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__cmp_filtered_collective_io_info_entry_owner
+ * Function:    H5D__cmp_chunk_redistribute_info
  *
- * Purpose:     Routine to compare filtered collective chunk io info
- *              entries's original owner fields
- *
- * Description: Callback for qsort() to compare filtered collective chunk
- *              io info entries's original owner fields
+ * Purpose:     Routine to compare two pointers to chunk redistribution
+ *              records by chunk index, then by original owner
  *
- * Return:      The difference between the two
- *              H5D_filtered_collective_io_info_t's original owner fields
+ * Description: Callback for qsort() to group the records a directory
+ *              process received for each chunk, lowest rank first
  *
- * Programmer:  Jordan Henderson
- *              Monday, Apr. 10th, 2017
+ * Return:      -1, 0, 1
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
-                                                 const void *filtered_collective_io_info_entry2)
+H5D__cmp_chunk_redistribute_info(const void *chunk_redistribute_info1, const void *chunk_redistribute_info2)
 {
-    int owner1 = -1, owner2 = -1;
+    const H5D_chunk_redistribute_info_t *info1 =
+        *(const H5D_chunk_redistribute_info_t *const *)chunk_redistribute_info1;
+    const H5D_chunk_redistribute_info_t *info2 =
+        *(const H5D_chunk_redistribute_info_t *const *)chunk_redistribute_info2;
+    int ret_value;
 
     FUNC_ENTER_STATIC_NOERR
 
-    owner1 = ((const H5D_filtered_collective_io_info_t *)filtered_collective_io_info_entry1)
-                 ->owners.original_owner;
-    owner2 = ((const H5D_filtered_collective_io_info_t *)filtered_collective_io_info_entry2)
-                 ->owners.original_owner;
+    if (info1->index != info2->index)
+        ret_value = (info1->index < info2->index) ? -1 : 1;
+    else
+        ret_value = (info1->original_owner > info2->original_owner) -
+                    (info1->original_owner < info2->original_owner);
 
-    FUNC_LEAVE_NOAPI(owner1 - owner2)
-} /* end H5D__cmp_filtered_collective_io_info_entry_owner() */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_chunk_redistribute_info() */
 #endif
 
 /*-------------------------------------------------------------------------
@@ -2678,6 +2523,8 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
             local_info_array[i].index                      = chunk_info->index;
             local_info_array[i].chunk_states.chunk_current = local_info_array[i].chunk_states.new_chunk =
                 udata.chunk_block;
+            local_info_array[i].chunk_states.current_filter_mask =
+                local_info_array[i].chunk_states.new_filter_mask = udata.filter_mask;
             local_info_array[i].num_writers           = 0;
             local_info_array[i].owners.original_owner = local_info_array[i].owners.new_owner = mpi_rank;
             local_info_array[i].buf                                                          = NULL;
@@ -2739,28 +2586,26 @@ done:
  *              to preserve file integrity after the write by ensuring
  *              that any shared chunks are only modified by one process.
  *
- *              The current implementation follows this 3-phase process:
- *
- *              - Collect everyone's list of chunks into one large list,
- *                sort the list in increasing order of chunk offset in the
- *                file and hand the list off to rank 0
- *
- *              - Rank 0 scans the list looking for matching runs of chunk
- *                offset in the file (corresponding to a shared chunk which
- *                has been selected by more than one rank in the I/O
- *                operation) and for each shared chunk, it redistributes
- *                the chunk to the process writing to the chunk which
- *                currently has the least amount of chunks assigned to it
- *                by modifying the "new_owner" field in each of the list
- *                entries corresponding to that chunk
- *
- *              - After the chunks have been redistributed, rank 0 re-sorts
- *                the list in order of previous owner so that each rank
- *                will get back exactly the array that they contributed to
- *                the redistribution operation, with the "new_owner" field
- *                of each chunk they are modifying having possibly been
- *                modified. Rank 0 then scatters each segment of the list
- *                back to its corresponding rank
+ *              Each chunk is looked after by a "directory" process, picked
+ *              by hashing the chunk's index, so no process has to see the
+ *              whole list of chunks:
+ *
+ *              - Every process sends the index of each chunk it has
+ *                selected to the chunk's directory process, in one
+ *                all-to-all exchange
+ *
+ *              - Each directory process sorts the (small) list it
+ *                received by chunk index, which groups together the
+ *                processes writing to each chunk. For every chunk it picks
+ *                the process writing to the chunk which currently has the
+ *                least amount of chunks assigned to it by this directory
+ *                process (in the case of ties, the lowest MPI rank) as the
+ *                new owner and counts the chunk's writers
+ *
+ *              - The directory processes send the new owner and number of
+ *                writers back in a second all-to-all exchange, in the
+ *                order the records were received, so each process gets
+ *                back exactly the records it contributed
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2775,21 +2620,29 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
                                       H5D_filtered_collective_io_info_t *local_chunk_array,
                                       size_t *                           local_chunk_array_num_entries)
 {
-    H5D_filtered_collective_io_info_t *shared_chunks_info_array =
-        NULL;                        /* The list of all chunks selected in the operation by all processes */
+    H5D_chunk_redistribute_info_t *send_info =
+        NULL; /* Records for this process' chunks, grouped by directory process */
+    H5D_chunk_redistribute_info_t *recv_info =
+        NULL; /* Records for the chunks this process is the directory process for */
+    H5D_chunk_redistribute_info_t **sorted_info =
+        NULL;                        /* The received records, sorted by chunk index */
     H5S_sel_iter_t *mem_iter = NULL; /* Memory iterator for H5D__gather_mem */
     unsigned char **mod_data =
         NULL; /* Array of chunk modification data buffers sent by a process to new chunk owners */
     MPI_Request *send_requests = NULL; /* Array of MPI_Isend chunk modification data send requests */
     MPI_Status * send_statuses = NULL; /* Array of MPI_Isend chunk modification send statuses */
+    MPI_Datatype info_type     = MPI_DATATYPE_NULL; /* MPI type for one redistribution record */
     hbool_t      mem_iter_init = FALSE;
-    size_t       shared_chunks_info_array_num_entries = 0;
-    size_t       num_send_requests                    = 0;
-    size_t *     num_assigned_chunks_array            = NULL;
+    hbool_t      info_type_derived         = FALSE;
+    size_t       recv_info_num_entries     = 0;
+    size_t       num_send_requests         = 0;
+    size_t *     num_assigned_chunks_array = NULL;
+    size_t *     send_info_map             = NULL; /* Index in local_chunk_array of each send_info record */
     size_t       i, last_assigned_idx;
     int *        send_counts        = NULL;
     int *        send_displacements = NULL;
-    int          scatter_recvcount_int;
+    int *        recv_counts        = NULL;
+    int *        recv_displacements = NULL;
     int          mpi_rank, mpi_size, mpi_code;
     herr_t       ret_value = SUCCEED;
 
@@ -2816,86 +2669,130 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
     if (NULL == (mem_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
 
-    /* Gather every rank's list of chunks to rank 0 to allow it to perform the redistribution operation. After
-     * this call, the gathered list will initially be sorted in increasing order of chunk offset in the file.
-     */
-    if (H5D__mpio_array_gatherv(local_chunk_array, *local_chunk_array_num_entries,
-                                sizeof(H5D_filtered_collective_io_info_t), (void **)&shared_chunks_info_array,
-                                &shared_chunks_info_array_num_entries, false, 0, io_info->comm,
-                                H5D__cmp_filtered_collective_io_info_entry) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather array")
-
-    /* Rank 0 redistributes any shared chunks to new owners as necessary */
-    if (mpi_rank == 0) {
-        if (NULL == (send_counts = (int *)H5MM_calloc((size_t)mpi_size * sizeof(int))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send counts buffer")
-
-        if (NULL == (send_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send displacements buffer")
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_contiguous((int)sizeof(H5D_chunk_redistribute_info_t), MPI_BYTE,
+                                                       &info_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_contiguous failed", mpi_code)
+    info_type_derived = TRUE;
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(&info_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+    if (NULL == (send_counts = (int *)H5MM_calloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send counts buffer")
+    if (NULL == (send_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send displacements buffer")
+    if (NULL == (recv_counts = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive counts buffer")
+    if (NULL == (recv_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive displacements buffer")
+
+    /* Group this process' chunks by directory process */
+    for (i = 0; i < *local_chunk_array_num_entries; i++)
+        send_counts[H5D_CHUNK_DIRECTORY_RANK(local_chunk_array[i].index, mpi_size)]++;
+
+    send_displacements[0] = 0;
+    for (i = 1; i < (size_t)mpi_size; i++)
+        send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
+
+    if (*local_chunk_array_num_entries) {
+        if (NULL == (send_info = (H5D_chunk_redistribute_info_t *)H5MM_malloc(
+                         *local_chunk_array_num_entries * sizeof(H5D_chunk_redistribute_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate redistribution send buffer")
+        if (NULL == (send_info_map = (size_t *)H5MM_malloc(*local_chunk_array_num_entries * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate redistribution send map")
+
+        /* Use the displacements as fill positions, then move them back */
+        for (i = 0; i < *local_chunk_array_num_entries; i++) {
+            int    dir = H5D_CHUNK_DIRECTORY_RANK(local_chunk_array[i].index, mpi_size);
+            size_t pos = (size_t)send_displacements[dir]++;
+
+            send_info[pos].index          = local_chunk_array[i].index;
+            send_info[pos].num_writers    = 0;
+            send_info[pos].original_owner = mpi_rank;
+            send_info[pos].new_owner      = mpi_rank;
+            send_info_map[pos]            = i;
+        } /* end for */
+        for (i = 0; i < (size_t)mpi_size; i++)
+            send_displacements[i] -= send_counts[i];
+    } /* end if */
 
+    /* Send each record to its chunk's directory process */
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Alltoall(send_counts, 1, MPI_INT, recv_counts, 1, MPI_INT, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
+
+    recv_displacements[0] = 0;
+    for (i = 1; i < (size_t)mpi_size; i++)
+        recv_displacements[i] = recv_displacements[i - 1] + recv_counts[i - 1];
+    recv_info_num_entries =
+        (size_t)recv_displacements[mpi_size - 1] + (size_t)recv_counts[mpi_size - 1];
+
+    if (recv_info_num_entries)
+        if (NULL == (recv_info = (H5D_chunk_redistribute_info_t *)H5MM_malloc(
+                         recv_info_num_entries * sizeof(H5D_chunk_redistribute_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate redistribution receive buffer")
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_info, send_counts, send_displacements, info_type,
+                                                 recv_info, recv_counts, recv_displacements, info_type,
+                                                 io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+    /* Redistribute the chunks this process is the directory process for */
+    if (recv_info_num_entries) {
+        if (NULL == (sorted_info = (H5D_chunk_redistribute_info_t **)H5MM_malloc(
+                         recv_info_num_entries * sizeof(H5D_chunk_redistribute_info_t *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate sorted redistribution records")
         if (NULL == (num_assigned_chunks_array = (size_t *)H5MM_calloc((size_t)mpi_size * sizeof(size_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                         "unable to allocate number of assigned chunks array")
 
-        for (i = 0; i < shared_chunks_info_array_num_entries;) {
-            H5D_filtered_collective_io_info_t *chunk_entry;
-            haddr_t last_seen_addr  = shared_chunks_info_array[i].chunk_states.chunk_current.offset;
+        for (i = 0; i < recv_info_num_entries; i++)
+            sorted_info[i] = &recv_info[i];
+        if (recv_info_num_entries > 1)
+            HDqsort(sorted_info, recv_info_num_entries, sizeof(sorted_info[0]),
+                    H5D__cmp_chunk_redistribute_info);
+
+        for (i = 0; i < recv_info_num_entries;) {
+            hsize_t chunk_index     = sorted_info[i]->index;
             size_t  set_begin_index = i;
             size_t  num_writers     = 0;
-            int     new_chunk_owner = shared_chunks_info_array[i].owners.original_owner;
+            int     new_chunk_owner = sorted_info[i]->original_owner;
 
-            /* Process each set of duplicate entries caused by another process writing to the same chunk */
+            /* Process each set of entries for the same chunk, one per writing process */
             do {
-                chunk_entry = &shared_chunks_info_array[i];
-
-                send_counts[chunk_entry->owners.original_owner] += (int)sizeof(*chunk_entry);
-
                 /* The new owner of the chunk is determined by the process
                  * writing to the chunk which currently has the least amount
                  * of chunks assigned to it
                  */
-                if (num_assigned_chunks_array[chunk_entry->owners.original_owner] <
+                if (num_assigned_chunks_array[sorted_info[i]->original_owner] <
                     num_assigned_chunks_array[new_chunk_owner])
-                    new_chunk_owner = chunk_entry->owners.original_owner;
+                    new_chunk_owner = sorted_info[i]->original_owner;
 
                 num_writers++;
-            } while (++i < shared_chunks_info_array_num_entries &&
-                     shared_chunks_info_array[i].chunk_states.chunk_current.offset == last_seen_addr);
+            } while (++i < recv_info_num_entries && sorted_info[i]->index == chunk_index);
 
             /* Set all of the chunk entries' "new_owner" fields */
             for (; set_begin_index < i; set_begin_index++) {
-                shared_chunks_info_array[set_begin_index].owners.new_owner = new_chunk_owner;
-                shared_chunks_info_array[set_begin_index].num_writers      = num_writers;
+                sorted_info[set_begin_index]->new_owner   = new_chunk_owner;
+                sorted_info[set_begin_index]->num_writers = num_writers;
             } /* end for */
 
             num_assigned_chunks_array[new_chunk_owner]++;
         } /* end for */
+    }     /* end if */
 
-        /* Sort the new list in order of previous owner so that each original owner of a chunk
-         * entry gets that entry back, with the possibly newly-modified "new_owner" field
-         */
-        if (shared_chunks_info_array_num_entries > 1)
-            HDqsort(shared_chunks_info_array, shared_chunks_info_array_num_entries,
-                    sizeof(H5D_filtered_collective_io_info_t),
-                    H5D__cmp_filtered_collective_io_info_entry_owner);
-
-        send_displacements[0] = 0;
-        for (i = 1; i < (size_t)mpi_size; i++)
-            send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
-    } /* end if */
+    /* Send the records back to the processes they came from */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(recv_info, recv_counts, recv_displacements, info_type,
+                                                 send_info, send_counts, send_displacements, info_type,
+                                                 io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
 
-    /* Scatter the segments of the list back to each process */
-    H5_CHECKED_ASSIGN(scatter_recvcount_int, int,
-                      *local_chunk_array_num_entries * sizeof(H5D_filtered_collective_io_info_t), size_t);
-    if (MPI_SUCCESS !=
-        (mpi_code = MPI_Scatterv(shared_chunks_info_array, send_counts, send_displacements, MPI_BYTE,
-                                 local_chunk_array, scatter_recvcount_int, MPI_BYTE, 0, io_info->comm)))
-        HMPI_GOTO_ERROR(FAIL, "unable to scatter shared chunks info buffer", mpi_code)
+    for (i = 0; i < *local_chunk_array_num_entries; i++) {
+        H5D_filtered_collective_io_info_t *chunk_entry = &local_chunk_array[send_info_map[i]];
 
-    if (shared_chunks_info_array) {
-        H5MM_free(shared_chunks_info_array);
-        shared_chunks_info_array = NULL;
-    } /* end if */
+        HDassert(chunk_entry->index == send_info[i].index);
+        chunk_entry->owners.new_owner = send_info[i].new_owner;
+        chunk_entry->num_writers      = send_info[i].num_writers;
+    } /* end for */
 
     /* Now that the chunks have been redistributed, each process must send its modification data
      * to the new owners of any of the chunks it previously possessed. Accordingly, each process
@@ -3050,6 +2947,20 @@ done:
         H5MM_free(send_counts);
     if (send_displacements)
         H5MM_free(send_displacements);
+    if (recv_counts)
+        H5MM_free(recv_counts);
+    if (recv_displacements)
+        H5MM_free(recv_displacements);
+    if (send_info)
+        H5MM_free(send_info);
+    if (send_info_map)
+        H5MM_free(send_info_map);
+    if (recv_info)
+        H5MM_free(recv_info);
+    if (sorted_info)
+        H5MM_free(sorted_info);
+    if (info_type_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&info_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
     if (mod_data)
         H5MM_free(mod_data);
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
@@ -3058,13 +2969,536 @@ done:
         H5MM_free(mem_iter);
     if (num_assigned_chunks_array)
         H5MM_free(num_assigned_chunks_array);
-    if (shared_chunks_info_array)
-        H5MM_free(shared_chunks_info_array);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_redistribute_shared_chunks() */
 #endif
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_collective_filtered_chunk_reallocate
+ *
+ * Purpose:     Collectively re-allocates file space for the filtered
+ *              chunks written by all processes whose size or filter mask
+ *              changed when they were filtered again.
+ *
+ *              Chunks which kept their size and filter mask are rewritten
+ *              in place and don't take part: their file space and their
+ *              index entries stay valid. Chunks which only changed their
+ *              filter mask keep their file space, but take part so that
+ *              their index entries are updated. The others are gathered
+ *              by all processes as
+ *              compact records, in order of rank, and every process makes
+ *              the same allocations in the same order, so that the file's
+ *              free space stays consistent. The new file location of each
+ *              chunk in chunk_list is updated, and the gathered list is
+ *              returned for the collective re-insertion of the chunks into
+ *              the chunk index after the write.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_collective_filtered_chunk_reallocate(const H5D_io_info_t *               io_info,
+                                               const H5D_chk_idx_info_t *          index_info,
+                                               H5D_filtered_collective_io_info_t * chunk_list,
+                                               size_t                              chunk_list_num_entries,
+                                               H5D_chunk_realloc_info_t **         _realloc_list,
+                                               size_t *                            _realloc_list_num_entries)
+{
+    H5D_chunk_realloc_info_t *local_list   = NULL; /* This process' chunks which need new file space */
+    H5D_chunk_realloc_info_t *realloc_list = NULL; /* Every process' chunks which need new file space */
+    MPI_Datatype              info_type    = MPI_DATATYPE_NULL;
+    hbool_t                   info_type_derived = FALSE;
+    size_t                    local_list_num_entries   = 0;
+    size_t                    realloc_list_num_entries = 0;
+    size_t                    i;
+    int *                     recv_counts        = NULL;
+    int *                     recv_displacements = NULL;
+    int                       send_count;
+    int                       mpi_rank, mpi_size, mpi_code;
+    herr_t                    ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io_info);
+    HDassert(index_info);
+    HDassert(chunk_list || 0 == chunk_list_num_entries);
+    HDassert(_realloc_list);
+    HDassert(_realloc_list_num_entries);
+
+    if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
+    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
+
+    /* Collect the chunks which need new file space */
+    if (chunk_list_num_entries)
+        if (NULL == (local_list = (H5D_chunk_realloc_info_t *)H5MM_malloc(chunk_list_num_entries *
+                                                                         sizeof(H5D_chunk_realloc_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk re-allocation list")
+
+    for (i = 0; i < chunk_list_num_entries; i++) {
+        H5F_block_t *chunk_current = &chunk_list[i].chunk_states.chunk_current;
+        H5F_block_t *new_chunk     = &chunk_list[i].chunk_states.new_chunk;
+
+        if (!H5D_CHUNK_NEEDS_REINSERT(chunk_list[i].chunk_states))
+            new_chunk->offset = chunk_current->offset;
+        else {
+            local_list[local_list_num_entries].index         = chunk_list[i].index;
+            local_list[local_list_num_entries].chunk_current = *chunk_current;
+            local_list[local_list_num_entries].new_chunk     = *new_chunk;
+            local_list[local_list_num_entries].filter_mask   = chunk_list[i].chunk_states.new_filter_mask;
+            local_list_num_entries++;
+        } /* end else */
+    }     /* end for */
+
+    /* Gather them to all processes */
+    if (NULL == (recv_counts = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive counts array")
+    if (NULL == (recv_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive displacements array")
+
+    H5_CHECKED_ASSIGN(send_count, int, local_list_num_entries, size_t);
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Allgather(&send_count, 1, MPI_INT, recv_counts, 1, MPI_INT, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+
+    recv_displacements[0] = 0;
+    for (i = 1; i < (size_t)mpi_size; i++)
+        recv_displacements[i] = recv_displacements[i - 1] + recv_counts[i - 1];
+    realloc_list_num_entries = (size_t)recv_displacements[mpi_size - 1] + (size_t)recv_counts[mpi_size - 1];
+
+    if (realloc_list_num_entries) {
+        size_t local_offset = (size_t)recv_displacements[mpi_rank];
+
+        if (NULL == (realloc_list = (H5D_chunk_realloc_info_t *)H5MM_malloc(
+                         realloc_list_num_entries * sizeof(H5D_chunk_realloc_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate gathered re-allocation list")
+
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_contiguous((int)sizeof(H5D_chunk_realloc_info_t), MPI_BYTE,
+                                                           &info_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_contiguous failed", mpi_code)
+        info_type_derived = TRUE;
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(&info_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_Allgatherv(local_list, send_count, info_type, realloc_list, recv_counts,
+                                       recv_displacements, info_type, io_info->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allgatherv failed", mpi_code)
+
+        /* Collectively re-allocate the chunks in the file. Chunks which kept
+         * their size keep their file space.
+         */
+        for (i = 0; i < realloc_list_num_entries; i++) {
+            hbool_t insert;
+
+            if (H5D__chunk_file_alloc(index_info, &realloc_list[i].chunk_current, &realloc_list[i].new_chunk,
+                                      &insert, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+        } /* end for */
+
+        /* Copy the new file locations of this process' chunks back, in the
+         * order they were contributed
+         */
+        for (i = 0; i < chunk_list_num_entries; i++)
+            if (H5D_CHUNK_NEEDS_REINSERT(chunk_list[i].chunk_states)) {
+                HDassert(realloc_list[local_offset].index == chunk_list[i].index);
+                chunk_list[i].chunk_states.new_chunk = realloc_list[local_offset++].new_chunk;
+            } /* end if */
+    }         /* end if */
+
+    *_realloc_list             = realloc_list;
+    *_realloc_list_num_entries = realloc_list_num_entries;
+    realloc_list               = NULL;
+
+done:
+    if (info_type_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&info_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if (recv_displacements)
+        H5MM_free(recv_displacements);
+    if (recv_counts)
+        H5MM_free(recv_counts);
+    if (realloc_list)
+        H5MM_free(realloc_list);
+    if (local_list)
+        H5MM_free(local_list);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_collective_filtered_chunk_reallocate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_collective_filtered_chunk_reinsert
+ *
+ * Purpose:     Collectively re-inserts the chunks re-allocated by
+ *              H5D__mpio_collective_filtered_chunk_reallocate() into the
+ *              chunk index, in the same order on every process.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_collective_filtered_chunk_reinsert(const H5D_io_info_t *           io_info,
+                                             const H5D_chk_idx_info_t *      index_info,
+                                             const H5D_chunk_realloc_info_t *realloc_list,
+                                             size_t                          realloc_list_num_entries)
+{
+    H5D_chunk_bulk_rec_t *recs = NULL;
+    size_t                i;
+    herr_t                ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io_info);
+    HDassert(index_info);
+    HDassert(realloc_list || 0 == realloc_list_num_entries);
+
+    if (0 == realloc_list_num_entries)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (recs = (H5D_chunk_bulk_rec_t *)H5MM_malloc(realloc_list_num_entries * sizeof(*recs))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk index records")
+
+    /* Set up chunk information for insertion to chunk index */
+    for (i = 0; i < realloc_list_num_entries; i++) {
+        recs[i].index       = realloc_list[i].index;
+        recs[i].chunk_idx   = realloc_list[i].index;
+        recs[i].chunk_block = realloc_list[i].new_chunk;
+        recs[i].filter_mask = realloc_list[i].filter_mask;
+    } /* end for */
+
+    /* Build the index entries for all the chunks at once */
+    if (H5D__chunk_bulk_insert(index_info, realloc_list_num_entries, recs, io_info->dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addresses into index")
+
+done:
+    if (recs)
+        H5MM_free(recs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_collective_filtered_chunk_reinsert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_collective_filtered_chunk_filter
+ *
+ * Purpose:     Collectively filters the chunks updated by each process
+ *              in a linked-chunk collective write, balancing the work
+ *              among the processes.
+ *
+ *              The filter load of a process is estimated as the size of
+ *              the unfiltered data of the chunks it owns. If a process'
+ *              load is more than H5D_FILTER_LOAD_IMBALANCE_THRES percent
+ *              above the average, all processes gather the sizes of the
+ *              chunks of such processes and compute the same plan for
+ *              handing some of them off, last chunks first, to processes
+ *              below the average load. The owner of a chunk that is
+ *              handed off sends its unfiltered data to the process
+ *              filtering it, filters its other chunks meanwhile and
+ *              receives the filtered data back, so that it still writes
+ *              the chunk itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_collective_filtered_chunk_filter(const H5D_io_info_t *              io_info,
+                                           H5D_filtered_collective_io_info_t *chunk_list,
+                                           size_t                             chunk_list_num_entries)
+{
+    H5D_filtered_collective_io_info_t **owned_chunks = NULL; /* The chunks this process owns */
+    uint64_t *   load_info      = NULL; /* The filter load and # of owned chunks of each process */
+    uint64_t *   loads          = NULL; /* The planned filter load of each process */
+    uint64_t *   chunk_sizes    = NULL; /* The unfiltered size of each chunk of the overloaded processes */
+    int *        chunk_filterer = NULL; /* The process filtering each of those chunks, or -1 for its owner */
+    int *        recv_counts    = NULL;
+    int *        recv_displacements = NULL;
+    void **      offload_bufs       = NULL; /* The chunks this process filters for other processes */
+    size_t *     offload_sizes      = NULL;
+    unsigned *   offload_masks      = NULL; /* The filter masks of those chunks */
+    int *        offload_owners     = NULL;
+    MPI_Request *requests           = NULL;
+    uint64_t     local_info[2]      = {0, 0};
+    uint64_t     avg_load = 0, max_load = 0, total_load = 0;
+    size_t       num_owned    = 0;
+    size_t       num_sizes    = 0;
+    size_t       num_offload  = 0; /* # of chunks this process filters for other processes */
+    size_t       num_requests = 0;
+    size_t       first_size   = 0; /* Index of this process' first chunk in chunk_sizes */
+    size_t       i;
+    int          mpi_rank, mpi_size, mpi_code;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io_info);
+    HDassert(chunk_list || 0 == chunk_list_num_entries);
+
+    if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
+    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
+
+    /* Collect the chunks this process owns and its filter load */
+    if (chunk_list_num_entries)
+        if (NULL == (owned_chunks = (H5D_filtered_collective_io_info_t **)H5MM_malloc(
+                         chunk_list_num_entries * sizeof(H5D_filtered_collective_io_info_t *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate owned chunks array")
+    for (i = 0; i < chunk_list_num_entries; i++)
+        if (mpi_rank == chunk_list[i].owners.new_owner) {
+            owned_chunks[num_owned++] = &chunk_list[i];
+            local_info[0] += (uint64_t)chunk_list[i].chunk_states.new_chunk.length;
+        } /* end if */
+    local_info[1] = (uint64_t)num_owned;
+
+    /* Check whether the filter loads of the processes are unbalanced */
+    if (mpi_size > 1) {
+        if (NULL == (load_info = (uint64_t *)H5MM_malloc(2 * (size_t)mpi_size * sizeof(uint64_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filter load array")
+        if (MPI_SUCCESS != (mpi_code = MPI_Allgather(local_info, 2, MPI_UINT64_T, load_info, 2,
+                                                     MPI_UINT64_T, io_info->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+
+        for (i = 0; i < (size_t)mpi_size; i++) {
+            total_load += load_info[2 * i];
+            max_load = MAX(max_load, load_info[2 * i]);
+        } /* end for */
+        avg_load = (total_load + (uint64_t)mpi_size - 1) / (uint64_t)mpi_size;
+    } /* end if */
+
+    if (max_load > avg_load + (avg_load * H5D_FILTER_LOAD_IMBALANCE_THRES) / 100) {
+        size_t filterer = 0; /* The next process below the average load */
+        int    r;
+
+        if (NULL == (loads = (uint64_t *)H5MM_malloc((size_t)mpi_size * sizeof(uint64_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate filter load array")
+        if (NULL == (recv_counts = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive counts buffer")
+        if (NULL == (recv_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive displacements buffer")
+
+        /* Gather the unfiltered sizes of the chunks of the overloaded processes */
+        for (r = 0; r < mpi_size; r++) {
+            loads[r] = load_info[2 * r];
+            H5_CHECK_OVERFLOW(load_info[2 * r + 1], uint64_t, int);
+            recv_counts[r] =
+                loads[r] > avg_load + (avg_load * H5D_FILTER_LOAD_IMBALANCE_THRES) / 100
+                    ? (int)load_info[2 * r + 1]
+                    : 0;
+            recv_displacements[r] = (int)num_sizes;
+            num_sizes += (size_t)recv_counts[r];
+        } /* end for */
+        first_size = (size_t)recv_displacements[mpi_rank];
+
+        if (NULL == (chunk_sizes = (uint64_t *)H5MM_malloc(num_sizes * sizeof(uint64_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk sizes array")
+        if (NULL == (chunk_filterer = (int *)H5MM_malloc(num_sizes * sizeof(int))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk filterer array")
+
+        for (i = 0; i < (size_t)recv_counts[mpi_rank]; i++)
+            chunk_sizes[first_size + i] = (uint64_t)owned_chunks[i]->chunk_states.new_chunk.length;
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, chunk_sizes, recv_counts,
+                                       recv_displacements, MPI_UINT64_T, io_info->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allgatherv failed", mpi_code)
+
+        /* Hand each overloaded process' chunks off, last first, to the
+         * processes below the average load in rank order, as long as that
+         * lowers the larger of the two loads. Every process computes the
+         * same plan, and no process both hands chunks off and filters
+         * chunks for others.
+         */
+        for (i = 0; i < num_sizes; i++)
+            chunk_filterer[i] = -1;
+        for (r = 0; r < mpi_size; r++) {
+            size_t k;
+
+            for (k = (size_t)recv_counts[r]; k > 0 && loads[r] > avg_load; k--) {
+                size_t   pos  = (size_t)recv_displacements[r] + k - 1;
+                uint64_t size = chunk_sizes[pos];
+
+                while (filterer < (size_t)mpi_size &&
+                       (recv_counts[filterer] > 0 || loads[filterer] >= avg_load))
+                    filterer++;
+                if (filterer == (size_t)mpi_size)
+                    break;
+
+                if (0 == size || size > (uint64_t)INT_MAX || loads[filterer] + size >= loads[r])
+                    continue;
+
+                chunk_filterer[pos] = (int)filterer;
+                loads[filterer] += size;
+                loads[r] -= size;
+            } /* end for */
+        }     /* end for */
+
+        /* Count the messages this process sends or receives */
+        for (i = 0; i < num_sizes; i++)
+            if (chunk_filterer[i] == mpi_rank)
+                num_offload++;
+        for (i = 0; i < (size_t)recv_counts[mpi_rank]; i++)
+            if (chunk_filterer[first_size + i] >= 0)
+                num_requests++;
+        num_requests = MAX(num_requests, 2 * num_offload);
+
+        if (num_requests)
+            if (NULL == (requests = (MPI_Request *)H5MM_malloc(num_requests * sizeof(MPI_Request))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate requests array")
+        num_requests = 0;
+
+        /* Send this process' chunks that are handed off, in order */
+        for (i = 0; i < (size_t)recv_counts[mpi_rank]; i++)
+            if (chunk_filterer[first_size + i] >= 0) {
+                if (MPI_SUCCESS !=
+                    (mpi_code = MPI_Isend(owned_chunks[i]->buf, (int)chunk_sizes[first_size + i], MPI_BYTE,
+                                          chunk_filterer[first_size + i], H5D_FILTER_OFFLOAD_TAG,
+                                          io_info->comm, &requests[num_requests])))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Isend failed", mpi_code)
+                num_requests++;
+            } /* end if */
+
+        /* Receive the chunks this process filters for other processes, in order */
+        if (num_offload) {
+            if (NULL == (offload_bufs = (void **)H5MM_calloc(num_offload * sizeof(void *))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate offloaded chunks array")
+            if (NULL == (offload_sizes = (size_t *)H5MM_malloc(num_offload * sizeof(size_t))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate offloaded chunk sizes")
+            if (NULL == (offload_masks = (unsigned *)H5MM_malloc(num_offload * sizeof(unsigned))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate offloaded chunk masks")
+            if (NULL == (offload_owners = (int *)H5MM_malloc(num_offload * sizeof(int))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate offloaded chunk owners")
+
+            for (r = 0, num_offload = 0; r < mpi_size; r++)
+                for (i = (size_t)recv_displacements[r];
+                     i < (size_t)recv_displacements[r] + (size_t)recv_counts[r]; i++)
+                    if (chunk_filterer[i] == mpi_rank) {
+                        offload_sizes[num_offload]  = (size_t)chunk_sizes[i];
+                        offload_owners[num_offload] = r;
+                        if (NULL == (offload_bufs[num_offload] = H5MM_malloc(offload_sizes[num_offload])))
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                        "couldn't allocate offloaded chunk buffer")
+                        if (MPI_SUCCESS != (mpi_code = MPI_Irecv(offload_bufs[num_offload],
+                                                                 (int)offload_sizes[num_offload], MPI_BYTE,
+                                                                 r, H5D_FILTER_OFFLOAD_TAG, io_info->comm,
+                                                                 &requests[num_offload])))
+                            HMPI_GOTO_ERROR(FAIL, "MPI_Irecv failed", mpi_code)
+                        num_offload++;
+                    } /* end if */
+
+            /* Filter them first, as their owners are waiting for them */
+            H5_CHECK_OVERFLOW(num_offload, size_t, int);
+            if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int)num_offload, requests, MPI_STATUSES_IGNORE)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+
+            /* Send each chunk back followed by its filter mask. Messages
+             * between two processes with the same tag aren't reordered, so
+             * the owner receives the mask right after the chunk.
+             */
+            for (i = 0; i < num_offload; i++) {
+                if (H5D__filtered_collective_chunk_filter(io_info, &offload_bufs[i], &offload_sizes[i],
+                                                          &offload_masks[i]) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't filter chunk")
+                if (offload_sizes[i] > (size_t)INT_MAX)
+                    HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "filtered chunk too large to send back")
+
+                if (MPI_SUCCESS != (mpi_code = MPI_Isend(offload_bufs[i], (int)offload_sizes[i], MPI_BYTE,
+                                                         offload_owners[i], H5D_FILTER_OFFLOAD_TAG,
+                                                         io_info->comm, &requests[2 * i])))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Isend failed", mpi_code)
+                if (MPI_SUCCESS != (mpi_code = MPI_Isend(&offload_masks[i], 1, MPI_UNSIGNED,
+                                                         offload_owners[i], H5D_FILTER_OFFLOAD_TAG,
+                                                         io_info->comm, &requests[2 * i + 1])))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Isend failed", mpi_code)
+            } /* end for */
+            num_requests = 2 * num_offload;
+        } /* end if */
+    }     /* end if */
+
+    /* Filter the chunks this process keeps */
+    for (i = 0; i < num_owned; i++)
+        if (i >= (recv_counts ? (size_t)recv_counts[mpi_rank] : 0) || chunk_filterer[first_size + i] < 0) {
+            size_t nbytes; /* Size of the filtered chunk */
+
+            H5_CHECKED_ASSIGN(nbytes, size_t, owned_chunks[i]->chunk_states.new_chunk.length, hsize_t);
+            if (H5D__filtered_collective_chunk_filter(io_info, &owned_chunks[i]->buf, &nbytes,
+                                                      &owned_chunks[i]->chunk_states.new_filter_mask) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't filter chunk")
+            owned_chunks[i]->chunk_states.new_chunk.length = nbytes;
+        } /* end if */
+
+    /* Wait for the chunks sent off to be received (or sent back) */
+    if (num_requests) {
+        H5_CHECK_OVERFLOW(num_requests, size_t, int);
+        if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int)num_requests, requests, MPI_STATUSES_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+        num_requests = 0;
+    } /* end if */
+
+    /* Receive this process' chunks back filtered, in order */
+    for (i = 0; recv_counts && i < (size_t)recv_counts[mpi_rank]; i++)
+        if (chunk_filterer[first_size + i] >= 0) {
+            H5D_filtered_collective_io_info_t *chunk_entry = owned_chunks[i];
+            MPI_Status                         status;
+            int                                count = 0;
+
+            if (MPI_SUCCESS != (mpi_code = MPI_Probe(chunk_filterer[first_size + i], H5D_FILTER_OFFLOAD_TAG,
+                                                     io_info->comm, &status)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Probe failed", mpi_code)
+            if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&status, MPI_BYTE, &count)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+
+            /* The chunk buffer holds at least the unfiltered data */
+            HDassert(count >= 0);
+            if ((hsize_t)count > chunk_entry->chunk_states.new_chunk.length)
+                if (NULL == (chunk_entry->buf = H5MM_realloc(chunk_entry->buf, (size_t)count)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't grow chunk data buffer")
+
+            if (MPI_SUCCESS != (mpi_code = MPI_Recv(chunk_entry->buf, count, MPI_BYTE, status.MPI_SOURCE,
+                                                    H5D_FILTER_OFFLOAD_TAG, io_info->comm,
+                                                    MPI_STATUS_IGNORE)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Recv failed", mpi_code)
+            if (MPI_SUCCESS != (mpi_code = MPI_Recv(&chunk_entry->chunk_states.new_filter_mask, 1,
+                                                    MPI_UNSIGNED, status.MPI_SOURCE, H5D_FILTER_OFFLOAD_TAG,
+                                                    io_info->comm, MPI_STATUS_IGNORE)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Recv failed", mpi_code)
+            chunk_entry->chunk_states.new_chunk.length = (hsize_t)count;
+        } /* end if */
+
+done:
+    if (offload_bufs) {
+        for (i = 0; i < num_offload; i++)
+            if (offload_bufs[i])
+                H5MM_free(offload_bufs[i]);
+        H5MM_free(offload_bufs);
+    } /* end if */
+    if (offload_sizes)
+        H5MM_free(offload_sizes);
+    if (offload_masks)
+        H5MM_free(offload_masks);
+    if (offload_owners)
+        H5MM_free(offload_owners);
+    if (requests)
+        H5MM_free(requests);
+    if (chunk_filterer)
+        H5MM_free(chunk_filterer);
+    if (chunk_sizes)
+        H5MM_free(chunk_sizes);
+    if (recv_displacements)
+        H5MM_free(recv_displacements);
+    if (recv_counts)
+        H5MM_free(recv_counts);
+    if (loads)
+        H5MM_free(loads);
+    if (load_info)
+        H5MM_free(load_info);
+    if (owned_chunks)
+        H5MM_free(owned_chunks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_collective_filtered_chunk_filter() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__mpio_filtered_collective_write_type
  *
@@ -3166,6 +3600,9 @@ done:
  *              write, or for reading the chunk from file during a
  *              collective read.
  *
+ *              The updated chunk data is left unfiltered after a write,
+ *              for the caller to filter it.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -3190,6 +3627,7 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     hbool_t           mem_iter_init  = FALSE;
     hbool_t           file_iter_init = FALSE;
     size_t            buf_size;
+    size_t            nbytes; /* Size of the chunk being unfiltered */
     size_t            i;
     H5S_t *           dataspace    = NULL; /* Other process' dataspace for the chunk */
     void *            tmp_gath_buf = NULL; /* Temporary gather buffer to gather into from application buffer
@@ -3258,10 +3696,12 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
         if (H5CX_set_io_xfer_mode(xfer_mode) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
 
+        filter_mask = chunk_entry->chunk_states.current_filter_mask;
+        H5_CHECKED_ASSIGN(nbytes, size_t, chunk_entry->chunk_states.new_chunk.length, hsize_t);
         if (H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, H5Z_FLAG_REVERSE, &filter_mask, err_detect,
-                         filter_cb, (size_t *)&chunk_entry->chunk_states.new_chunk.length, &buf_size,
-                         &chunk_entry->buf) < 0)
+                         filter_cb, &nbytes, &buf_size, &chunk_entry->buf) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't unfilter chunk for modifying")
+        chunk_entry->chunk_states.new_chunk.length = nbytes;
     } /* end if */
     else {
         chunk_entry->chunk_states.new_chunk.length = true_chunk_size;
@@ -3375,18 +3815,6 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
                 }
                 H5MM_free(chunk_entry->async_info.receive_buffer_array[i]);
             } /* end for */
-
-            /* Filter the chunk */
-            if (H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, 0, &filter_mask, err_detect, filter_cb,
-                             (size_t *)&chunk_entry->chunk_states.new_chunk.length, &buf_size,
-                             &chunk_entry->buf) < 0)
-                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
-
-#if H5_SIZEOF_SIZE_T > 4
-            /* Check for the chunk expanding too much to encode in a 32-bit value */
-            if (chunk_entry->chunk_states.new_chunk.length > ((size_t)0xffffffff))
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
-#endif
             break;
 
         default:
@@ -3414,4 +3842,54 @@ done:
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__filtered_collective_chunk_entry_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_chunk_filter
+ *
+ * Purpose:     Passes the unfiltered data of a chunk updated during a
+ *              collective write through the dataset's filter pipeline.
+ *              The buffer is replaced and the size updated as needed,
+ *              and the filter mask of the filtered chunk is returned.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_chunk_filter(const H5D_io_info_t *io_info, void **buf, size_t *nbytes,
+                                      unsigned *filter_mask)
+{
+    H5Z_EDC_t err_detect; /* Error detection info */
+    H5Z_cb_t  filter_cb;  /* I/O filter callback function */
+    size_t    buf_size  = *nbytes;
+    herr_t    ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io_info);
+    HDassert(buf && *buf);
+    HDassert(nbytes);
+    HDassert(filter_mask);
+
+    /* Retrieve filter settings from API context */
+    if (H5CX_get_err_detect(&err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if (H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    /* Filter the chunk */
+    *filter_mask = 0;
+    if (H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, 0, filter_mask, err_detect, filter_cb, nbytes,
+                     &buf_size, buf) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+
+#if H5_SIZEOF_SIZE_T > 4
+    /* Check for the chunk expanding too much to encode in a 32-bit value */
+    if (*nbytes > ((size_t)0xffffffff))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_chunk_filter() */
 #endif /* H5_HAVE_PARALLEL */
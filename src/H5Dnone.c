@@ -77,6 +77,7 @@ const H5D_chunk_ops_t H5D_COPS_NONE[1] = {{
     H5D__none_idx_create,         /* create */
     H5D__none_idx_is_space_alloc, /* is_space_alloc */
     NULL,                         /* insert */
+    NULL,                         /* bulk_insert */
     H5D__none_idx_get_addr,       /* get_addr */
     NULL,                         /* resize */
     H5D__none_idx_iterate,        /* iterate */
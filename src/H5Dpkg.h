@@ -62,6 +62,10 @@
 #define H5D_MARK_SPACE  0x01
 #define H5D_MARK_LAYOUT 0x02
 
+/* Number of data sieve buffer windows cached for each contiguous dataset */
+/* (Each window is at most the file's sieve buffer size, see H5Pset_sieve_buf_size) */
+#define H5D_SIEVE_NWINDOWS 4
+
 /* Default creation parameters for chunk index data structures */
 /* See H5O_layout_chunk_t */
 
@@ -283,6 +287,14 @@ typedef struct H5D_chunk_ud_t {
     hsize_t     chunk_idx;        /* Chunk index for EA, FA indexing */
 } H5D_chunk_ud_t;
 
+/* Chunk record for bulk insertion into a chunk index */
+typedef struct H5D_chunk_bulk_rec_t {
+    hsize_t     index;       /* Linear index of chunk in dataset (sort key) */
+    hsize_t     chunk_idx;   /* Chunk index for EA, FA indexing */
+    H5F_block_t chunk_block; /* Offset/length of chunk in file */
+    unsigned    filter_mask; /* Excluded filters */
+} H5D_chunk_bulk_rec_t;
+
 /* Typedef for "generic" chunk callbacks */
 typedef int (*H5D_chunk_cb_func_t)(const H5D_chunk_rec_t *chunk_rec, void *udata);
 
@@ -293,6 +305,8 @@ typedef herr_t (*H5D_chunk_create_func_t)(const H5D_chk_idx_info_t *idx_info);
 typedef hbool_t (*H5D_chunk_is_space_alloc_func_t)(const H5O_storage_chunk_t *storage);
 typedef herr_t (*H5D_chunk_insert_func_t)(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata,
                                           const H5D_t *dset);
+typedef herr_t (*H5D_chunk_bulk_insert_func_t)(const H5D_chk_idx_info_t *idx_info, size_t nrecs,
+                                               const H5D_chunk_bulk_rec_t *recs, const H5D_t *dset);
 typedef herr_t (*H5D_chunk_get_addr_func_t)(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata);
 typedef herr_t (*H5D_chunk_resize_func_t)(H5O_layout_chunk_t *layout);
 typedef int (*H5D_chunk_iterate_func_t)(const H5D_chk_idx_info_t *idx_info, H5D_chunk_cb_func_t chunk_cb,
@@ -316,7 +330,9 @@ typedef struct H5D_chunk_ops_t {
     H5D_chunk_is_space_alloc_func_t
                                 is_space_alloc; /* Query routine to determine if storage/index is allocated */
     H5D_chunk_insert_func_t     insert;         /* Routine to insert a chunk into an index */
-    H5D_chunk_get_addr_func_t   get_addr;       /* Routine to retrieve address of chunk in file */
+    H5D_chunk_bulk_insert_func_t
+                              bulk_insert; /* Routine to insert a sorted batch of chunks (may be NULL) */
+    H5D_chunk_get_addr_func_t get_addr;    /* Routine to retrieve address of chunk in file */
     H5D_chunk_resize_func_t     resize;     /* Routine to update chunk index info after resizing dataset */
     H5D_chunk_iterate_func_t    iterate;    /* Routine to iterate over chunks */
     H5D_chunk_remove_func_t     remove;     /* Routine to remove a chunk from an index */
@@ -421,15 +437,27 @@ typedef struct H5D_rdcc_t {
     hsize_t  scaled_dims[H5S_MAX_RANK];        /* The scaled dim sizes */
     hsize_t  scaled_power2up[H5S_MAX_RANK];    /* The scaled dim sizes, rounded up to next power of 2 */
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
+#ifdef H5_HAVE_PARALLEL
+    H5SL_t *arena_chunks; /* Chunks placed in this process's raw data arena, not yet in the index */
+    hbool_t arena_user;   /* Whether the dataset is registered as a user of the raw data arenas */
+#endif                    /* H5_HAVE_PARALLEL */
 } H5D_rdcc_t;
 
+/* One window of the raw data contiguous data cache */
+typedef struct H5D_rdcdc_win_t {
+    unsigned char *sieve_buf;   /* Buffer to hold data sieve buffer */
+    haddr_t        sieve_loc;   /* File location (offset) of the data sieve buffer */
+    size_t         sieve_size;  /* Size of the data sieve buffer used (in bytes) */
+    hbool_t        sieve_dirty; /* Flag to indicate that the data sieve buffer is dirty */
+    unsigned       lru_stamp;   /* Last access "time", for LRU replacement */
+} H5D_rdcdc_win_t;
+
 /* The raw data contiguous data cache */
+/* (Windows never overlap in the file, so each byte is cached at most once) */
 typedef struct H5D_rdcdc_t {
-    unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
-    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
-    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
-    size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
-    hbool_t        sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+    H5D_rdcdc_win_t win[H5D_SIEVE_NWINDOWS]; /* Data sieve buffer windows */
+    size_t          sieve_buf_size;          /* Size of each data sieve buffer allocated (in bytes) */
+    unsigned        lru_clock;               /* Access counter for window LRU replacement */
 } H5D_rdcdc_t;
 
 /*
@@ -466,6 +494,12 @@ struct H5D_shared_t {
         H5D_rdcc_t chunk;   /* Information about chunked data */
     } cache;
 
+    /* Raw data I/O statistics */
+    struct {
+        unsigned nzero_copy;     /* Number of selection I/O operations done directly on the app. buffer */
+        size_t   tconv_buf_size; /* Size of the type conversion buffer for the last I/O operation */
+    } io_stats;
+
     H5D_append_flush_t append_flush;   /* Append flush property information */
     char *             extfile_prefix; /* expanded external file prefix */
     char *             vds_prefix;     /* expanded vds prefix */
@@ -622,6 +656,8 @@ H5_DLL herr_t  H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *
 H5_DLL herr_t  H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f_dst,
                                 H5O_storage_contig_t *storage_dst, H5T_t *src_dtype, H5O_copy_t *cpy_info);
 H5_DLL herr_t  H5D__contig_delete(H5F_t *f, const H5O_storage_t *store);
+H5_DLL herr_t  H5D__contig_sieve_flush(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig);
+H5_DLL void    H5D__contig_sieve_free(H5D_rdcdc_t *dset_contig);
 
 /* Functions that operate on chunked dataset storage */
 H5_DLL htri_t  H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op);
@@ -634,11 +670,16 @@ H5_DLL herr_t  H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes);
 H5_DLL herr_t  H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_t old_dim[]);
 H5_DLL herr_t  H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
                                      H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t *scaled);
+H5_DLL herr_t  H5D__chunk_bulk_insert(const H5D_chk_idx_info_t *idx_info, size_t nrecs,
+                                      H5D_chunk_bulk_rec_t *recs, const H5D_t *dset);
 H5_DLL herr_t  H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[]);
 H5_DLL herr_t  H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim);
 H5_DLL herr_t  H5D__chunk_set_sizes(H5D_t *dset);
 #ifdef H5_HAVE_PARALLEL
-H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
+H5_DLL herr_t  H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
+H5_DLL hbool_t H5D__chunk_arena_active(const H5F_t *f, const H5D_shared_t *shared);
+H5_DLL herr_t  H5D__chunk_arena_reconcile(const H5D_t *dset);
+H5_DLL herr_t  H5D__chunk_arena_io_init(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk_t *layout_src,
@@ -651,6 +692,9 @@ H5_DLL herr_t H5D__chunk_delete(H5F_t *f, H5O_t *oh, H5O_storage_t *store);
 H5_DLL herr_t H5D__get_offset_copy(const H5D_t *dset, const hsize_t *offset, hsize_t *offset_copy);
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
                                       uint32_t data_size, const void *buf);
+H5_DLL herr_t H5D__chunk_direct_write_multi(const H5D_t *dset, size_t count, const uint32_t filters[],
+                                            const hsize_t *offsets[], const size_t data_sizes[],
+                                            const void *bufs[]);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, void *buf);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
@@ -737,6 +781,8 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__zero_copy_io_count_test(hid_t did, unsigned *count);
+H5_DLL herr_t H5D__tconv_buf_size_test(hid_t did, size_t *size);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
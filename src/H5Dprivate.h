@@ -80,6 +80,10 @@
     "local_no_collective_cause" /* cause of broken collective I/O in each process */
 #define H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME                                                             \
     "global_no_collective_cause"                 /* cause of broken collective I/O in all processes */
+#define H5D_MPIO_TYPE_CONSTRUCT_TIME_NAME                                                                    \
+    "mpio_type_construct_time" /* time spent building MPI datatypes for selections */
+#define H5D_MPIO_TYPE_CACHE_HITS_NAME                                                                        \
+    "mpio_type_cache_hits" /* # of MPI datatypes for selections found in the file's cache */
 #define H5D_XFER_EDC_NAME       "err_detect"     /* EDC */
 #define H5D_XFER_FILTER_CB_NAME "filter_cb"      /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME   "type_conv_cb"   /* Type conversion callback function */
@@ -108,6 +112,9 @@
 /* Default temporary buffer size */
 #define H5D_TEMP_BUF_SIZE (1024 * 1024)
 
+/* Maximum size of the buffer used to write fill values to adjacent chunks in one batch */
+#define H5D_TEMP_BUF_MAX_SIZE (16 * 1024 * 1024)
+
 /* Default I/O vector size */
 #define H5D_IO_VECTOR_SIZE 1024
 
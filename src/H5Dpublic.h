@@ -1025,6 +1025,53 @@ H5_DLL herr_t H5Dwrite_async(const char *app_file, const char *app_func, unsigne
 H5_DLL herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, const hsize_t *offset,
                              size_t data_size, const void *buf);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Writes a batch of raw data chunks from buffers directly to a
+ *        dataset in a file
+ *
+ * \dset_id
+ * \dxpl_id
+ * \param[in]  count       Number of chunks to write
+ * \param[in]  filters     Masks for identifying the filters in use, one
+ *                         per chunk
+ * \param[in]  offsets     Logical positions of the chunks' first elements
+ *                         in the dataspace, one array per chunk
+ * \param[in]  data_sizes  Sizes of the actual data to be written in bytes,
+ *                         one per chunk
+ * \param[in]  bufs        Buffers containing data to be written to the
+ *                         chunks, one per chunk
+ *
+ * \return \herr_t
+ *
+ * \details H5Dwrite_chunks() writes \p count raw data chunks to the
+ *          chunked dataset \p dset_id, as if H5Dwrite_chunk() were called
+ *          with \p filters[i], \p offsets[i], \p data_sizes[i] and
+ *          \p bufs[i] for each chunk \c i.
+ *
+ *          The chunks that are new to the file are added to the dataset's
+ *          chunk index together, after all of the batch has been written,
+ *          rather than one at a time. Applications that know their chunk
+ *          layout up front, and write many chunks at once, spend less
+ *          time building the chunk index this way.
+ *
+ *          Each chunk may only appear once in a batch. The offsets of all
+ *          of the chunks are checked before any chunk is written.
+ *
+ * \attention The cautions given for H5Dwrite_chunk() apply to this
+ *          function too.
+ *
+ * \note    H5Dwrite_chunks() is not supported under parallel and does
+ *          not support variable length types.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const uint32_t filters[],
+                              const hsize_t *offsets[], const size_t data_sizes[], const void *bufs[]);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -105,8 +105,15 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts, co
     HDassert(io_info->store);
     HDassert(io_info->u.rbuf);
 
-    /* Check for only one element in selection */
-    if (nelmts == 1) {
+    /* Check for only one element in selection, or for selections that are
+     * contiguous in both the file and memory.  Either can be transferred as
+     * a single sequence directly between the application's buffer and the
+     * dataset's storage, without setting up selection iterators or vector
+     * arrays.  (Empty selections, e.g. of processes taking part in
+     * collective I/O with nothing selected, must not touch the storage.)
+     */
+    if (nelmts == 1 || (nelmts > 1 && TRUE == H5S_SELECT_IS_CONTIGUOUS(file_space) &&
+                        TRUE == H5S_SELECT_IS_CONTIGUOUS(mem_space))) {
         hsize_t single_mem_off;  /* Offset in memory */
         hsize_t single_file_off; /* Offset in the file */
         size_t  single_mem_len;  /* Length in memory */
@@ -123,7 +130,7 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts, co
         curr_mem_seq = curr_file_seq = 0;
         single_file_off *= elmt_size;
         single_mem_off *= elmt_size;
-        single_file_len = single_mem_len = elmt_size;
+        single_file_len = single_mem_len = nelmts * elmt_size;
 
         /* Perform I/O on memory and file sequences */
         if (io_info->op_type == H5D_IO_OP_READ) {
@@ -140,8 +147,15 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts, co
                 HGOTO_ERROR(H5E_DATASPACE, H5E_WRITEERROR, FAIL, "write error")
         } /* end else */
 
-        /* Decrement number of elements left to process */
-        HDassert(((size_t)tmp_file_len % elmt_size) == 0);
+        /* Check that the whole sequence was transferred */
+        HDassert((size_t)tmp_file_len == (nelmts * elmt_size));
+
+        /* Track the number of contiguous selections transferred directly,
+         * bypassing the type conversion buffer.  (Single elements always
+         * took this path and are not counted.)
+         */
+        if (nelmts > 1)
+            io_info->dset->shared->io_stats.nzero_copy++;
     } /* end if */
     else {
         size_t mem_nelem;  /* Number of elements used in memory sequences */
@@ -79,6 +79,7 @@ const H5D_chunk_ops_t H5D_COPS_SINGLE[1] = {{
     H5D__single_idx_create,         /* create */
     H5D__single_idx_is_space_alloc, /* is_space_alloc */
     H5D__single_idx_insert,         /* insert */
+    NULL,                           /* bulk_insert */
     H5D__single_idx_get_addr,       /* get_addr */
     NULL,                           /* resize */
     H5D__single_idx_iterate,        /* iterate */
@@ -295,3 +295,83 @@ H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__current_cache_size_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__zero_copy_io_count_test
+ PURPOSE
+    Determine the number of zero-copy I/O operations done on a dataset
+ USAGE
+    herr_t H5D__zero_copy_io_count_test(did, count)
+        hid_t did;              IN: Dataset to query
+        unsigned *count;        OUT: Pointer to location to place count
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Retrieves the number of selection I/O operations on the dataset that
+    were transferred as a single sequence directly between the application's
+    buffer and the dataset's storage.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__zero_copy_io_count_test(hid_t did, unsigned *count)
+{
+    H5D_t *dset;                /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+    if (count)
+        *count = dset->shared->io_stats.nzero_copy;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__zero_copy_io_count_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__tconv_buf_size_test
+ PURPOSE
+    Determine the size of the type conversion buffer used for the last I/O
+    operation on a dataset
+ USAGE
+    herr_t H5D__tconv_buf_size_test(did, size)
+        hid_t did;              IN: Dataset to query
+        size_t *size;           OUT: Pointer to location to place size
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Retrieves the size of the type conversion buffer set up for the most
+    recent read or write on the dataset that required datatype conversion.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__tconv_buf_size_test(hid_t did, size_t *size)
+{
+    H5D_t *dset;                /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+    if (size)
+        *size = dset->shared->io_stats.tconv_buf_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__tconv_buf_size_test() */
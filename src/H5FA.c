@@ -408,6 +408,144 @@ BEGIN_FUNC(PRIV, ERR, herr_t, SUCCEED, FAIL, H5FA_set(const H5FA_t *fa, hsize_t
 
 END_FUNC(PRIV) /* end H5FA_set() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FA_set_bulk
+ *
+ * Purpose:     Set a batch of elements of a fixed array.  The element
+ *              indices must be in increasing order, which lets the data
+ *              block be protected once and each data block page be
+ *              protected once per run of indices that fall on it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PRIV, ERR, herr_t, SUCCEED, FAIL,
+           H5FA_set_bulk(const H5FA_t *fa, size_t nelmts, const hsize_t idx[], const void *elmts))
+
+    /* Local variables */
+    H5FA_hdr_t *      hdr       = fa->hdr;            /* Header for fixed array */
+    H5FA_dblock_t *   dblock    = NULL;               /* Pointer to fixed array Data block */
+    H5FA_dblk_page_t *dblk_page = NULL;               /* Pointer to fixed array Data block page */
+    unsigned dblock_cache_flags = H5AC__NO_FLAGS_SET; /* Flags to unprotecting fixed array Data block */
+    unsigned dblk_page_cache_flags =
+        H5AC__NO_FLAGS_SET;        /* Flags to unprotecting FIxed Array Data block page */
+    size_t  cur_page_idx = 0;      /* Index of the currently protected page */
+    size_t  elmt_size;             /* Size of a native element */
+    hbool_t hdr_dirty = FALSE;     /* Whether header information changed */
+    size_t  u;                     /* Local index variable */
+
+    /*
+     * Check arguments.
+     */
+    HDassert(fa);
+    HDassert(fa->hdr);
+    HDassert(nelmts == 0 || (idx && elmts));
+
+    /* Quick exit for empty batch */
+    if (nelmts == 0)
+        H5_LEAVE(SUCCEED)
+
+    /* Set the shared array header's file context for this operation */
+    hdr->f    = fa->f;
+    elmt_size = hdr->cparam.cls->nat_elmt_size;
+
+    /* Check if we need to create the fixed array data block */
+    if (!H5F_addr_defined(hdr->dblk_addr)) {
+        /* Create the data block */
+        hdr->dblk_addr = H5FA__dblock_create(hdr, &hdr_dirty);
+        if (!H5F_addr_defined(hdr->dblk_addr))
+            H5E_THROW(H5E_CANTCREATE, "unable to create fixed array data block")
+    } /* end if */
+
+    /* Protect data block */
+    if (NULL == (dblock = H5FA__dblock_protect(hdr, hdr->dblk_addr, H5AC__NO_FLAGS_SET)))
+        H5E_THROW(H5E_CANTPROTECT, "unable to protect fixed array data block, address = %llu",
+                  (unsigned long long)hdr->dblk_addr)
+
+    for (u = 0; u < nelmts; u++) {
+        const uint8_t *elmt = ((const uint8_t *)elmts) + (elmt_size * u);
+
+        HDassert(idx[u] < hdr->cparam.nelmts);
+        HDassert(u == 0 || idx[u - 1] < idx[u]);
+
+        /* Check for paging data block */
+        if (!dblock->npages) {
+            /* Set element in data block */
+            H5MM_memcpy(((uint8_t *)dblock->elmts) + (elmt_size * idx[u]), elmt, elmt_size);
+            dblock_cache_flags |= H5AC__DIRTIED_FLAG;
+        }                   /* end if */
+        else {              /* paging */
+            size_t page_idx; /* Index of page within data block */
+            size_t elmt_idx; /* Element index within the page */
+
+            /* Compute the page & element index */
+            page_idx = (size_t)(idx[u] / dblock->dblk_page_nelmts);
+            elmt_idx = (size_t)(idx[u] % dblock->dblk_page_nelmts);
+
+            /* Move to the page, if this element isn't on the one already protected */
+            if (NULL == dblk_page || page_idx != cur_page_idx) {
+                size_t  dblk_page_nelmts; /* # of elements in a data block page */
+                haddr_t dblk_page_addr;   /* Address of data block page */
+
+                /* Release the previous page */
+                if (dblk_page) {
+                    if (H5FA__dblk_page_unprotect(dblk_page, dblk_page_cache_flags) < 0)
+                        H5E_THROW(H5E_CANTUNPROTECT, "unable to release fixed array data block page")
+                    dblk_page             = NULL;
+                    dblk_page_cache_flags = H5AC__NO_FLAGS_SET;
+                } /* end if */
+
+                /* Get the address of the data block page */
+                dblk_page_addr = dblock->addr + H5FA_DBLOCK_PREFIX_SIZE(dblock) +
+                                 ((hsize_t)page_idx * dblock->dblk_page_size);
+
+                /* Check for using last page, to set the number of elements on the page */
+                if ((page_idx + 1) == dblock->npages)
+                    dblk_page_nelmts = dblock->last_page_nelmts;
+                else
+                    dblk_page_nelmts = dblock->dblk_page_nelmts;
+
+                /* Check if the page has been created yet */
+                if (!H5VM_bit_get(dblock->dblk_page_init, page_idx)) {
+                    /* Create the data block page */
+                    if (H5FA__dblk_page_create(hdr, dblk_page_addr, dblk_page_nelmts) < 0)
+                        H5E_THROW(H5E_CANTCREATE, "unable to create data block page")
+
+                    /* Mark data block page as initialized in data block */
+                    H5VM_bit_set(dblock->dblk_page_init, page_idx, TRUE);
+                    dblock_cache_flags |= H5AC__DIRTIED_FLAG;
+                } /* end if */
+
+                /* Protect the data block page */
+                if (NULL == (dblk_page = H5FA__dblk_page_protect(hdr, dblk_page_addr, dblk_page_nelmts,
+                                                                 H5AC__NO_FLAGS_SET)))
+                    H5E_THROW(H5E_CANTPROTECT,
+                              "unable to protect fixed array data block page, address = %llu",
+                              (unsigned long long)dblk_page_addr)
+                cur_page_idx = page_idx;
+            } /* end if */
+
+            /* Set the element in the data block page */
+            H5MM_memcpy(((uint8_t *)dblk_page->elmts) + (elmt_size * elmt_idx), elmt, elmt_size);
+            dblk_page_cache_flags |= H5AC__DIRTIED_FLAG;
+        } /* end else */
+    }     /* end for */
+
+    CATCH
+    /* Check for header modified */
+    if (hdr_dirty)
+        if (H5FA__hdr_modified(hdr) < 0)
+            H5E_THROW(H5E_CANTMARKDIRTY, "unable to mark fixed array header as modified")
+
+    /* Release resources */
+    if (dblk_page && H5FA__dblk_page_unprotect(dblk_page, dblk_page_cache_flags) < 0)
+        H5E_THROW(H5E_CANTUNPROTECT, "unable to release fixed array data block page")
+    if (dblock && H5FA__dblock_unprotect(dblock, dblock_cache_flags) < 0)
+        H5E_THROW(H5E_CANTUNPROTECT, "unable to release fixed array data block")
+
+END_FUNC(PRIV) /* end H5FA_set_bulk() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FA_get
  *
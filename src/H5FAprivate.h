@@ -123,6 +123,7 @@ H5_DLL H5FA_t *H5FA_open(H5F_t *f, haddr_t fa_addr, void *ctx_udata);
 H5_DLL herr_t  H5FA_get_nelmts(const H5FA_t *fa, hsize_t *nelmts);
 H5_DLL herr_t  H5FA_get_addr(const H5FA_t *fa, haddr_t *addr);
 H5_DLL herr_t  H5FA_set(const H5FA_t *fa, hsize_t idx, const void *elmt);
+H5_DLL herr_t  H5FA_set_bulk(const H5FA_t *fa, size_t nelmts, const hsize_t idx[], const void *elmts);
 H5_DLL herr_t  H5FA_get(const H5FA_t *fa, hsize_t idx, void *elmt);
 H5_DLL herr_t  H5FA_depend(H5FA_t *fa, H5AC_proxy_entry_t *parent);
 H5_DLL herr_t  H5FA_iterate(H5FA_t *fa, H5FA_operator_t op, void *udata);
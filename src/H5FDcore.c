@@ -33,6 +33,10 @@
 #include "H5Pprivate.h"  /* Property lists               */
 #include "H5SLprivate.h" /* Skip lists                   */
 
+#ifdef H5_HAVE_MMAP
+#include <sys/mman.h>
+#endif /* H5_HAVE_MMAP */
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_CORE_g = 0;
 
@@ -45,14 +49,29 @@ typedef struct H5FD_core_region_t {
     haddr_t end;   /* End address of the region            */
 } H5FD_core_region_t;
 
+/* An entry in the page table of a paged file */
+typedef struct H5FD_core_page_t {
+    unsigned char *buf;   /* Memory for the page, NULL until written  */
+    hbool_t        dirty; /* Whether the page needs writing to the backing store */
+} H5FD_core_page_t;
+
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
  * of the file (the current size of the underlying memory).
+ *
+ * Unless the application manages the file's memory through file image
+ * callbacks, the file is held in fixed-size pages instead of one buffer, so
+ * growing it never copies the data already written.  Pages are allocated
+ * on first write and read as zeros before that.  The contiguous 'mem' buffer
+ * is only built when someone asks for it with H5Fget_vfd_handle().
  */
 typedef struct H5FD_core_t {
     H5FD_t         pub;              /* public stuff, must be first          */
     char *         name;             /* for equivalence testing              */
     unsigned char *mem;              /* the underlying memory                */
+    hbool_t           paged;         /* whether the file is held in pages    */
+    H5FD_core_page_t *pages;         /* page table for a paged file          */
+    size_t            npages;        /* # of entries allocated in page table */
     haddr_t        eoa;              /* end of allocated region              */
     haddr_t        eof;              /* current allocated size               */
     size_t         increment;        /* multiples for mem allocation         */
@@ -107,6 +126,13 @@ typedef struct H5FD_core_fapl_t {
 #define H5FD_CORE_WRITE_TRACKING_FLAG      FALSE
 #define H5FD_CORE_WRITE_TRACKING_PAGE_SIZE 524288
 
+/* Size of each page of a paged file */
+#define H5FD_CORE_PAGE_SIZE (1024 * 1024)
+
+/* Page holding an address, and offset of the address within it */
+#define H5FD_CORE_PAGE_IDX(A) ((size_t)((A) / H5FD_CORE_PAGE_SIZE))
+#define H5FD_CORE_PAGE_OFF(A) ((size_t)((A) % H5FD_CORE_PAGE_SIZE))
+
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
  *
@@ -130,6 +156,14 @@ typedef struct H5FD_core_fapl_t {
 static herr_t  H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t  H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t  H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t  H5FD__core_set_bstore_size(H5FD_core_t *file, haddr_t size);
+static unsigned char *H5FD__core_page_get(H5FD_core_t *file, size_t idx);
+static void           H5FD__core_page_free(unsigned char *buf);
+static herr_t         H5FD__core_pages_resize(H5FD_core_t *file, haddr_t new_eof);
+static herr_t  H5FD__core_pages_write(H5FD_core_t *file, haddr_t addr, size_t size, const void *buf);
+static void    H5FD__core_pages_read(const H5FD_core_t *file, haddr_t addr, size_t size, void *buf);
+static void    H5FD__core_pages_destroy(H5FD_core_t *file);
+static herr_t  H5FD__core_pages_flatten(H5FD_core_t *file);
 static herr_t  H5FD__core_term(void);
 static void *  H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
@@ -327,6 +361,279 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_destroy_dirty_list() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_page_get
+ *
+ * Purpose:     Returns the memory for page IDX of a paged file, allocating
+ *              it if the page hasn't been used yet.  New pages are zeroed.
+ *              Where anonymous mappings are available they are used, so
+ *              the parts of a page which are never touched take no memory.
+ *
+ * Return:      Success:    Pointer to the page
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned char *
+H5FD__core_page_get(H5FD_core_t *file, size_t idx)
+{
+    unsigned char *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->paged);
+    HDassert(idx < file->npages);
+
+    if (NULL == file->pages[idx].buf) {
+#if defined(H5_HAVE_MMAP) && defined(MAP_ANONYMOUS)
+        void *x;
+
+        if (MAP_FAILED == (x = HDmmap(NULL, (size_t)H5FD_CORE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                                      MAP_PRIVATE | MAP_ANONYMOUS, -1, (HDoff_t)0)))
+            HSYS_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to map memory for page")
+        file->pages[idx].buf = (unsigned char *)x;
+#else
+        if (NULL == (file->pages[idx].buf = (unsigned char *)H5MM_calloc((size_t)H5FD_CORE_PAGE_SIZE)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate memory for page")
+#endif /* defined(H5_HAVE_MMAP) && defined(MAP_ANONYMOUS) */
+    }  /* end if */
+
+    ret_value = file->pages[idx].buf;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_page_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_page_free
+ *
+ * Purpose:     Releases the memory for a page from H5FD__core_page_get().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__core_page_free(unsigned char *buf)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if (buf) {
+#if defined(H5_HAVE_MMAP) && defined(MAP_ANONYMOUS)
+        HDmunmap(buf, (size_t)H5FD_CORE_PAGE_SIZE);
+#else
+        H5MM_xfree(buf);
+#endif /* defined(H5_HAVE_MMAP) && defined(MAP_ANONYMOUS) */
+    }  /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__core_page_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_resize
+ *
+ * Purpose:     Changes the size of a paged file to NEW_EOF.  Growing the
+ *              file only extends the page table; the new pages are
+ *              allocated when written.  Shrinking it releases the pages
+ *              past the new end and clears the rest of the last page, so
+ *              that the region reads as zeros if the file grows again.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_pages_resize(H5FD_core_t *file, haddr_t new_eof)
+{
+    size_t npages;              /* # of pages needed for NEW_EOF */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->paged);
+
+    npages = H5FD_CORE_PAGE_IDX(new_eof) + (H5FD_CORE_PAGE_OFF(new_eof) ? 1 : 0);
+
+    if (new_eof > file->eof) {
+        /* Grow the page table geometrically, so the table itself isn't
+         * copied each time the file grows by a page.
+         */
+        if (npages > file->npages) {
+            H5FD_core_page_t *x;
+            size_t            new_npages = MAX(npages, 2 * file->npages);
+
+            if (NULL == (x = (H5FD_core_page_t *)H5MM_realloc(file->pages,
+                                                               new_npages * sizeof(H5FD_core_page_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to grow page table")
+            HDmemset(x + file->npages, 0, (new_npages - file->npages) * sizeof(H5FD_core_page_t));
+            file->pages  = x;
+            file->npages = new_npages;
+        } /* end if */
+    }     /* end if */
+    else {
+        /* Release the pages past the new end */
+        for (u = npages; u < file->npages; u++) {
+            H5FD__core_page_free(file->pages[u].buf);
+            file->pages[u].buf   = NULL;
+            file->pages[u].dirty = FALSE;
+        } /* end for */
+
+        /* Clear the rest of the last page */
+        if (npages > 0 && H5FD_CORE_PAGE_OFF(new_eof) && file->pages[npages - 1].buf)
+            HDmemset(file->pages[npages - 1].buf + H5FD_CORE_PAGE_OFF(new_eof), 0,
+                     H5FD_CORE_PAGE_SIZE - H5FD_CORE_PAGE_OFF(new_eof));
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_pages_resize() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_write
+ *
+ * Purpose:     Copies SIZE bytes from BUF into a paged file at address
+ *              ADDR, which must be below the end of the file.  Without
+ *              write tracking, the pages written are marked dirty so that
+ *              only they are written to the backing store on flush.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_pages_write(H5FD_core_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->paged);
+    HDassert(addr + size <= file->eof);
+
+    while (size > 0) {
+        size_t         idx    = H5FD_CORE_PAGE_IDX(addr);
+        size_t         off    = H5FD_CORE_PAGE_OFF(addr);
+        size_t         nbytes = MIN(size, H5FD_CORE_PAGE_SIZE - off);
+        unsigned char *page;
+
+        if (NULL == (page = H5FD__core_page_get(file, idx)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to get page")
+        H5MM_memcpy(page + off, buf, nbytes);
+        if (!file->dirty_list)
+            file->pages[idx].dirty = TRUE;
+
+        addr += nbytes;
+        size -= nbytes;
+        buf = (const unsigned char *)buf + nbytes;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_pages_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_read
+ *
+ * Purpose:     Copies SIZE bytes at address ADDR of a paged file into
+ *              BUF.  The range must be below the end of the file.  Pages
+ *              which were never written read as zeros.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__core_pages_read(const H5FD_core_t *file, haddr_t addr, size_t size, void *buf)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(file->paged);
+    HDassert(addr + size <= file->eof);
+
+    while (size > 0) {
+        size_t idx    = H5FD_CORE_PAGE_IDX(addr);
+        size_t off    = H5FD_CORE_PAGE_OFF(addr);
+        size_t nbytes = MIN(size, H5FD_CORE_PAGE_SIZE - off);
+
+        if (file->pages[idx].buf)
+            H5MM_memcpy(buf, file->pages[idx].buf + off, nbytes);
+        else
+            HDmemset(buf, 0, nbytes);
+
+        addr += nbytes;
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__core_pages_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_destroy
+ *
+ * Purpose:     Releases all the pages of a paged file and its page table.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__core_pages_destroy(H5FD_core_t *file)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    for (u = 0; u < file->npages; u++)
+        H5FD__core_page_free(file->pages[u].buf);
+    file->pages  = (H5FD_core_page_t *)H5MM_xfree(file->pages);
+    file->npages = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__core_pages_destroy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_pages_flatten
+ *
+ * Purpose:     Moves the contents of a paged file into a single buffer,
+ *              for callers which need the file's memory as one block.
+ *              The file stays contiguous from then on.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_pages_flatten(H5FD_core_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->paged);
+    HDassert(NULL == file->mem);
+
+    if (file->eof > 0) {
+        if (NULL == (file->mem = (unsigned char *)H5MM_malloc((size_t)file->eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
+        H5FD__core_pages_read(file, (haddr_t)0, (size_t)file->eof, file->mem);
+    } /* end if */
+
+    H5FD__core_pages_destroy(file);
+    file->paged = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_pages_flatten() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_write_to_bstore
  *
@@ -339,11 +646,9 @@ done:
 static herr_t
 H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
 {
-    unsigned char *ptr = file->mem + addr; /* mutable pointer into the
-                                            * buffer (can't change mem)
-                                            */
-    HDoff_t offset    = (HDoff_t)addr;     /* Offset to write at */
-    herr_t  ret_value = SUCCEED;           /* Return value */
+    unsigned char *ptr       = NULL;          /* pointer into the file's memory */
+    HDoff_t        offset    = (HDoff_t)addr; /* Offset to write at */
+    herr_t         ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -359,14 +664,25 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
 
         h5_posix_io_t     bytes_in    = 0;  /* # of bytes to write  */
         h5_posix_io_ret_t bytes_wrote = -1; /* # of bytes written   */
+        size_t            avail       = size; /* # of bytes contiguous in memory */
+
+        /* A paged file is written a page at a time */
+        if (file->paged) {
+            if (NULL == (ptr = H5FD__core_page_get(file, H5FD_CORE_PAGE_IDX(addr))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to get page")
+            ptr += H5FD_CORE_PAGE_OFF(addr);
+            avail = MIN(size, H5FD_CORE_PAGE_SIZE - H5FD_CORE_PAGE_OFF(addr));
+        } /* end if */
+        else
+            ptr = file->mem + addr;
 
         /* Trying to write more bytes than the return type can handle is
          * undefined behavior in POSIX.
          */
-        if (size > H5_POSIX_MAX_IO_BYTES)
+        if (avail > H5_POSIX_MAX_IO_BYTES)
             bytes_in = H5_POSIX_MAX_IO_BYTES;
         else
-            bytes_in = (h5_posix_io_t)size;
+            bytes_in = (h5_posix_io_t)avail;
 
         do {
 #ifdef H5_HAVE_PREADWRITE
@@ -397,7 +713,7 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
         HDassert((size_t)bytes_wrote <= size);
 
         size -= (size_t)bytes_wrote;
-        ptr = (unsigned char *)ptr + bytes_wrote;
+        addr += (haddr_t)bytes_wrote;
 
     } /* end while */
 
@@ -405,6 +721,61 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write_to_bstore() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_set_bstore_size
+ *
+ * Purpose:     Extend or truncate the backing store to SIZE bytes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_set_bstore_size(H5FD_core_t *file, haddr_t size)
+{
+#ifdef H5_HAVE_WIN32_API
+    LARGE_INTEGER li;       /* 64-bit (union) integer for SetFilePointer() call */
+    DWORD         dwPtrLow; /* Low-order pointer bits from SetFilePointer()
+                             * Only used as an error code here.
+                             */
+    DWORD dwError;          /* DWORD error code from GetLastError() */
+    BOOL  bError;           /* Boolean error flag */
+#endif                      /* H5_HAVE_WIN32_API */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->fd >= 0);
+
+#ifdef H5_HAVE_WIN32_API
+    /* Windows uses this odd QuadPart union for 32/64-bit portability */
+    li.QuadPart = (__int64)size;
+
+    /* Extend the file to make sure it's large enough.
+     *
+     * Since INVALID_SET_FILE_POINTER can technically be a valid return value
+     * from SetFilePointer(), we also need to check GetLastError().
+     */
+    dwPtrLow = SetFilePointer(file->hFile, li.LowPart, &li.HighPart, FILE_BEGIN);
+    if (INVALID_SET_FILE_POINTER == dwPtrLow) {
+        dwError = GetLastError();
+        if (dwError != NO_ERROR)
+            HGOTO_ERROR(H5E_FILE, H5E_FILEOPEN, FAIL, "unable to set file pointer")
+    }
+
+    bError = SetEndOfFile(file->hFile);
+    if (0 == bError)
+        HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+#else  /* H5_HAVE_WIN32_API */
+    if (-1 == HDftruncate(file->fd, (HDoff_t)size))
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+#endif /* H5_HAVE_WIN32_API */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_set_bstore_size() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
  *
@@ -808,6 +1179,12 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     /* Save file image callbacks */
     file->fi_callbacks = file_image_info.callbacks;
 
+    /* Hold the file in pages, unless the application manages its memory
+     * through the file image callbacks, which expect a single buffer.
+     */
+    file->paged = !(file->fi_callbacks.image_malloc || file->fi_callbacks.image_memcpy ||
+                    file->fi_callbacks.image_realloc || file->fi_callbacks.image_free);
+
     /* Check the file locking flags in the fapl */
     if (ignore_disabled_file_locks_s != FAIL)
         /* The environment variable was set, so use that preferentially */
@@ -850,7 +1227,11 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
         /* Check if we should allocate the memory buffer and read in existing data */
         if (size) {
             /* Allocate memory for the file's data, using the file image callback if available. */
-            if (file->fi_callbacks.image_malloc) {
+            if (file->paged) {
+                if (H5FD__core_pages_resize(file, (haddr_t)size) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate page table")
+            } /* end if */
+            else if (file->fi_callbacks.image_malloc) {
                 if (NULL == (file->mem = (unsigned char *)file->fi_callbacks.image_malloc(
                                  size, H5FD_FILE_IMAGE_OP_FILE_OPEN, file->fi_callbacks.udata)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "image malloc callback failed")
@@ -871,6 +1252,10 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                                                                      file->fi_callbacks.udata))
                         HGOTO_ERROR(H5E_FILE, H5E_CANTCOPY, NULL, "image_memcpy callback failed")
                 } /* end if */
+                else if (file->paged) {
+                    if (H5FD__core_pages_write(file, (haddr_t)0, size, file_image_info.buffer) < 0)
+                        HGOTO_ERROR(H5E_FILE, H5E_CANTCOPY, NULL, "unable to copy file image")
+                } /* end if */
                 else
                     H5MM_memcpy(file->mem, file_image_info.buffer, size);
             } /* end if */
@@ -882,18 +1267,28 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
 
                 uint8_t *mem    = file->mem;  /* memory pointer for writes */
                 HDoff_t  offset = (HDoff_t)0; /* offset for reading */
+                haddr_t  addr   = 0;          /* address being read */
 
                 while (size > 0) {
-                    h5_posix_io_t     bytes_in   = 0;  /* # of bytes to read       */
-                    h5_posix_io_ret_t bytes_read = -1; /* # of bytes actually read */
+                    h5_posix_io_t     bytes_in   = 0;    /* # of bytes to read       */
+                    h5_posix_io_ret_t bytes_read = -1;   /* # of bytes actually read */
+                    size_t            avail      = size; /* # of bytes contiguous in memory */
+
+                    /* A paged file is read a page at a time */
+                    if (file->paged) {
+                        if (NULL == (mem = H5FD__core_page_get(file, H5FD_CORE_PAGE_IDX(addr))))
+                            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to get page")
+                        mem += H5FD_CORE_PAGE_OFF(addr);
+                        avail = MIN(size, H5FD_CORE_PAGE_SIZE - H5FD_CORE_PAGE_OFF(addr));
+                    } /* end if */
 
                     /* Trying to read more bytes than the return type can handle is
                      * undefined behavior in POSIX.
                      */
-                    if (size > H5_POSIX_MAX_IO_BYTES)
+                    if (avail > H5_POSIX_MAX_IO_BYTES)
                         bytes_in = H5_POSIX_MAX_IO_BYTES;
                     else
-                        bytes_in = (h5_posix_io_t)size;
+                        bytes_in = (h5_posix_io_t)avail;
 
                     do {
 #ifdef H5_HAVE_PREADWRITE
@@ -925,6 +1320,7 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                     HDassert((size_t)bytes_read <= size);
 
                     mem += bytes_read;
+                    addr += (haddr_t)bytes_read;
                     size -= (size_t)bytes_read;
                 } /* end while */
             }     /* end else */
@@ -964,6 +1360,7 @@ done:
             HDclose(file->fd);
         H5MM_xfree(file->name);
         H5MM_xfree(file->mem);
+        H5FD__core_pages_destroy(file);
         H5MM_xfree(file);
     } /* end if */
 
@@ -1014,6 +1411,8 @@ H5FD__core_close(H5FD_t *_file)
         else
             H5MM_xfree(file->mem);
     } /* end if */
+    if (file->paged)
+        H5FD__core_pages_destroy(file);
     HDmemset(file, 0, sizeof(H5FD_core_t));
     H5MM_xfree(file);
 
@@ -1277,16 +1676,17 @@ H5FD__core_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle)
                 HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get property of retrieving file descriptor")
 
             /* If property is set, pass back the file descriptor instead of the memory address */
-            if (want_posix_fd)
+            if (want_posix_fd) {
                 *file_handle = &(file->fd);
-            else
-                *file_handle = &(file->mem);
-        } /* end if */
-        else
-            *file_handle = &(file->mem);
-    } /* end if */
-    else
-        *file_handle = &(file->mem);
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    /* The memory address is only meaningful for a single buffer */
+    if (file->paged && H5FD__core_pages_flatten(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to gather file pages into one buffer")
+    *file_handle = &(file->mem);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1339,7 +1739,10 @@ H5FD__core_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         nbytes = MIN(size, (size_t)(file->eof - addr));
 #endif /* NDEBUG */
 
-        H5MM_memcpy(buf, file->mem + addr, nbytes);
+        if (file->paged)
+            H5FD__core_pages_read(file, addr, nbytes, buf);
+        else
+            H5MM_memcpy(buf, file->mem + addr, nbytes);
         size -= nbytes;
         addr += nbytes;
         buf = (char *)buf + nbytes;
@@ -1390,7 +1793,7 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
      * the first argument is null.
      */
     if (addr + size > file->eof) {
-        unsigned char *x;
+        unsigned char *x = NULL;
         size_t         new_eof;
 
         /* Determine new size of memory buffer */
@@ -1398,8 +1801,14 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
         if ((addr + size) % file->increment)
             new_eof += file->increment;
 
+        /* A paged file only needs a bigger page table */
+        if (file->paged) {
+            if (H5FD__core_pages_resize(file, (haddr_t)new_eof) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend file to %llu bytes",
+                            (unsigned long long)new_eof)
+        } /* end if */
         /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
+        else if (file->fi_callbacks.image_realloc) {
             if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
                              file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
@@ -1412,8 +1821,10 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
                             "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
         } /* end else */
 
-        HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
+        if (!file->paged) {
+            HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+            file->mem = x;
+        } /* end if */
 
         file->eof = new_eof;
     } /* end if */
@@ -1431,7 +1842,12 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     }
 
     /* Write from BUF to memory */
-    H5MM_memcpy(file->mem + addr, buf, size);
+    if (file->paged) {
+        if (H5FD__core_pages_write(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write to file pages")
+    } /* end if */
+    else
+        H5MM_memcpy(file->mem + addr, buf, size);
 
     /* Mark memory buffer as modified */
     file->dirty = TRUE;
@@ -1488,6 +1904,30 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
             } /* end while */
 
         } /* end if */
+        /* A paged file writes out the runs of pages changed since the last flush */
+        else if (file->paged) {
+            size_t npages = H5FD_CORE_PAGE_IDX(file->eof) + (H5FD_CORE_PAGE_OFF(file->eof) ? 1 : 0);
+            size_t u, v;
+
+            for (u = 0; u < npages; u = v) {
+                haddr_t start, end;
+
+                if (!file->pages[u].dirty) {
+                    v = u + 1;
+                    continue;
+                } /* end if */
+                for (v = u; v < npages && file->pages[v].dirty; v++)
+                    ;
+
+                start = (haddr_t)u * H5FD_CORE_PAGE_SIZE;
+                end   = MIN((haddr_t)v * H5FD_CORE_PAGE_SIZE, file->eof);
+                if (H5FD__core_write_to_bstore(file, start, (size_t)(end - start)) != SUCCEED)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+
+                for (; u < v; u++)
+                    file->pages[u].dirty = FALSE;
+            } /* end for */
+        }     /* end if */
         /* Otherwise, write the entire file out at once */
         else {
             if (H5FD__core_write_to_bstore(file, (haddr_t)0, (size_t)file->eof) != SUCCEED)
@@ -1497,6 +1937,14 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
         file->dirty = FALSE;
     }
 
+    /* A paged file's backing store isn't written as a whole: pages that were
+     * never written aren't extended into and a smaller file leaves stale
+     * data behind, so set its size to the EOA explicitly.
+     */
+    if (file->paged && file->fd >= 0 && file->backing_store && (file->pub.access_flags & H5F_ACC_RDWR))
+        if (H5FD__core_set_bstore_size(file, file->eoa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to set size of backing store")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_flush() */
@@ -1560,10 +2008,15 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
 
         /* Extend the file to make sure it's large enough */
         if (!H5F_addr_eq(file->eof, (haddr_t)new_eof)) {
-            unsigned char *x; /* Pointer to new buffer for file data */
+            unsigned char *x = NULL; /* Pointer to new buffer for file data */
 
+            /* Resize a paged file's page table */
+            if (file->paged) {
+                if (H5FD__core_pages_resize(file, (haddr_t)new_eof) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to resize file pages")
+            } /* end if */
             /* (Re)allocate memory for the file buffer, using callback if available */
-            if (file->fi_callbacks.image_realloc) {
+            else if (file->fi_callbacks.image_realloc) {
                 if (NULL ==
                     (x = (unsigned char *)file->fi_callbacks.image_realloc(
                          file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
@@ -1575,44 +2028,16 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
                     HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block")
             } /* end else */
 
-            if (file->eof < new_eof)
-                HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-            file->mem = x;
+            if (!file->paged) {
+                if (file->eof < new_eof)
+                    HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+                file->mem = x;
+            } /* end if */
 
             /* Update backing store, if using it and if closing */
-            if (closing && (file->fd >= 0) && file->backing_store) {
-#ifdef H5_HAVE_WIN32_API
-                LARGE_INTEGER li;       /* 64-bit (union) integer for SetFilePointer() call */
-                DWORD         dwPtrLow; /* Low-order pointer bits from SetFilePointer()
-                                         * Only used as an error code here.
-                                         */
-                DWORD dwError;          /* DWORD error code from GetLastError() */
-                BOOL  bError;           /* Boolean error flag */
-
-                /* Windows uses this odd QuadPart union for 32/64-bit portability */
-                li.QuadPart = (__int64)file->eoa;
-
-                /* Extend the file to make sure it's large enough.
-                 *
-                 * Since INVALID_SET_FILE_POINTER can technically be a valid return value
-                 * from SetFilePointer(), we also need to check GetLastError().
-                 */
-                dwPtrLow = SetFilePointer(file->hFile, li.LowPart, &li.HighPart, FILE_BEGIN);
-                if (INVALID_SET_FILE_POINTER == dwPtrLow) {
-                    dwError = GetLastError();
-                    if (dwError != NO_ERROR)
-                        HGOTO_ERROR(H5E_FILE, H5E_FILEOPEN, FAIL, "unable to set file pointer")
-                }
-
-                bError = SetEndOfFile(file->hFile);
-                if (0 == bError)
-                    HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
-#else  /* H5_HAVE_WIN32_API */
-                if (-1 == HDftruncate(file->fd, (HDoff_t)new_eof))
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
-#endif /* H5_HAVE_WIN32_API */
-
-            } /* end if */
+            if (closing && (file->fd >= 0) && file->backing_store)
+                if (H5FD__core_set_bstore_size(file, (haddr_t)new_eof) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to set size of backing store")
 
             /* Update the eof value */
             file->eof = new_eof;
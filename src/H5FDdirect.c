@@ -137,6 +137,12 @@ static herr_t  H5FD__direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id,
 static herr_t  H5FD__direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__direct_unlock(H5FD_t *_file);
+static herr_t  H5FD__direct_io(H5FD_direct_t *file, int op, haddr_t addr, size_t size, void *rbuf,
+                               const void *wbuf);
+static herr_t  H5FD__direct_io_block(H5FD_direct_t *file, int op, haddr_t block_addr, size_t off, size_t len,
+                                     void *rbuf, const void *wbuf, void *copy_buf);
+static herr_t  H5FD__direct_io_unaligned(H5FD_direct_t *file, int op, haddr_t addr, size_t size, void *rbuf,
+                                         const void *wbuf);
 
 static const H5FD_class_t H5FD_direct_g = {
     "direct",                   /* name                 */
@@ -826,6 +832,246 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_io
+ *
+ * Purpose:  Transfers SIZE bytes between the file at address ADDR and
+ *    RBUF (for reads, OP_READ) or WBUF (for writes, OP_WRITE),
+ *    being careful of interrupted system calls and partial
+ *    results.  When the file requires alignment, ADDR, SIZE and
+ *    the buffer must all be aligned.  A read past the end of the
+ *    file fills the rest of the buffer with zeros.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_io(H5FD_direct_t *file, int op, haddr_t addr, size_t size, void *rbuf, const void *wbuf)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert((OP_READ == op && rbuf) || (OP_WRITE == op && wbuf));
+
+    /* Seek to the correct location */
+    if ((addr != file->pos || op != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+
+    while (size > 0) {
+        do {
+            if (OP_WRITE == op)
+                nbytes = HDwrite(file->fd, wbuf, size);
+            else
+                nbytes = HDread(file->fd, rbuf, size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) { /* error */
+            if (OP_WRITE == op)
+                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            else
+                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        } /* end if */
+        if (0 == nbytes) {
+            HDassert(OP_READ == op);
+
+            /* end of file but not end of format address space */
+            HDmemset(rbuf, 0, size);
+            break;
+        } /* end if */
+        HDassert(nbytes > 0);
+        HDassert((size_t)nbytes <= size);
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
+        size -= (size_t)nbytes;
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
+        addr += (haddr_t)nbytes;
+        if (OP_WRITE == op)
+            wbuf = (const char *)wbuf + nbytes;
+        else {
+            rbuf = (char *)rbuf + nbytes;
+
+            /* A direct read which stops short of a block boundary has
+             * reached the end of the file, and can't be continued from
+             * the unaligned position anyway.
+             */
+            if (size > 0 && file->fa.must_align && ((size_t)nbytes % file->fa.fbsize)) {
+                HDmemset(rbuf, 0, size);
+                break;
+            } /* end if */
+        }     /* end else */
+    }         /* end while */
+
+    /* Update current position and eof */
+    file->pos = addr;
+    file->op  = op;
+    if (OP_WRITE == op && file->pos > file->eof)
+        file->eof = file->pos;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_io_block
+ *
+ * Purpose:  Transfers LEN bytes at offset OFF within the file block at
+ *    BLOCK_ADDR through the aligned bounce buffer COPY_BUF.  The
+ *    block is read first; for writes the user's data is laid over
+ *    it and the whole block written back.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_io_block(H5FD_direct_t *file, int op, haddr_t block_addr, size_t off, size_t len, void *rbuf,
+                      const void *wbuf, void *copy_buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(!(block_addr % file->fa.fbsize));
+    HDassert(off + len <= file->fa.fbsize);
+
+    if (H5FD__direct_io(file, OP_READ, block_addr, file->fa.fbsize, copy_buf, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read file block")
+
+    if (OP_READ == op)
+        H5MM_memcpy(rbuf, (unsigned char *)copy_buf + off, len);
+    else {
+        H5MM_memcpy((unsigned char *)copy_buf + off, wbuf, len);
+        if (H5FD__direct_io(file, OP_WRITE, block_addr, file->fa.fbsize, NULL, copy_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write file block")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_io_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_io_unaligned
+ *
+ * Purpose:  Transfers a request which isn't aligned for direct I/O.  The
+ *    request is split at the file block boundaries: the partial
+ *    blocks at either end go through a one-block bounce buffer,
+ *    while the whole blocks in between go straight to or from
+ *    the user's buffer when it's suitably aligned in memory.
+ *    Only when it isn't are the whole blocks copied, in pieces of
+ *    at most the copy buffer size.
+ *
+ * Return:  Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_io_unaligned(H5FD_direct_t *file, int op, haddr_t addr, size_t size, void *rbuf,
+                          const void *wbuf)
+{
+    size_t   fbsize   = file->fa.fbsize;
+    haddr_t  end      = addr + size;
+    haddr_t  mid_addr;        /* First block boundary at or after ADDR */
+    haddr_t  tail_addr;       /* Last block boundary at or before END */
+    hbool_t  mid_direct;      /* Whether the whole blocks can skip the copy buffer */
+    size_t   alloc_size;      /* Size of the copy buffer */
+    void *   copy_buf = NULL; /* Aligned copy buffer */
+    haddr_t  a;
+    size_t   buf_off;            /* Offset of the current piece in the user's buffer */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->fa.must_align);
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    mid_addr  = ((addr + fbsize - 1) / fbsize) * fbsize;
+    tail_addr = (end / fbsize) * fbsize;
+
+    /* Check whether the user's buffer is aligned where the whole blocks start */
+    if (mid_addr < tail_addr) {
+        const unsigned char *mid_buf =
+            (OP_READ == op ? (const unsigned char *)rbuf : (const unsigned char *)wbuf) + (mid_addr - addr);
+
+        mid_direct = ((size_t)mid_buf % file->fa.mboundary == 0);
+    } /* end if */
+    else
+        mid_direct = TRUE;
+
+    /* Allocate the copy buffer: one block for the partial blocks, and up to
+     * the maximal copy buffer size when the whole blocks need it too.
+     */
+    alloc_size = fbsize;
+    if (!mid_direct)
+        alloc_size = (size_t)MIN(file->fa.cbsize, tail_addr - mid_addr);
+    HDassert(!(alloc_size % fbsize));
+    if (HDposix_memalign(&copy_buf, file->fa.mboundary, alloc_size) != 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+
+    /* The whole request lies within a single block */
+    if (mid_addr > tail_addr) {
+        if (H5FD__direct_io_block(file, op, tail_addr, (size_t)(addr - tail_addr), size, rbuf, wbuf,
+                                  copy_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTOPERATE, FAIL, "unable to transfer partial block")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Partial block at the start */
+    if (addr < mid_addr)
+        if (H5FD__direct_io_block(file, op, mid_addr - fbsize, (size_t)(addr - (mid_addr - fbsize)),
+                                  (size_t)(mid_addr - addr), rbuf, wbuf, copy_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTOPERATE, FAIL, "unable to transfer partial block")
+
+    /* Whole blocks */
+    if (mid_addr < tail_addr) {
+        buf_off = (size_t)(mid_addr - addr);
+
+        if (mid_direct) {
+            if (H5FD__direct_io(file, op, mid_addr, (size_t)(tail_addr - mid_addr),
+                                rbuf ? (unsigned char *)rbuf + buf_off : NULL,
+                                wbuf ? (const unsigned char *)wbuf + buf_off : NULL) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTOPERATE, FAIL, "unable to transfer aligned blocks")
+        } /* end if */
+        else
+            for (a = mid_addr; a < tail_addr; a += alloc_size) {
+                size_t n = (size_t)MIN(alloc_size, tail_addr - a);
+
+                buf_off = (size_t)(a - addr);
+                if (OP_READ == op) {
+                    if (H5FD__direct_io(file, OP_READ, a, n, copy_buf, NULL) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read aligned blocks")
+                    H5MM_memcpy((unsigned char *)rbuf + buf_off, copy_buf, n);
+                } /* end if */
+                else {
+                    H5MM_memcpy(copy_buf, (const unsigned char *)wbuf + buf_off, n);
+                    if (H5FD__direct_io(file, OP_WRITE, a, n, NULL, copy_buf) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write aligned blocks")
+                } /* end else */
+            }     /* end for */
+    }             /* end if */
+
+    /* Partial block at the end */
+    if (tail_addr < end) {
+        buf_off = (size_t)(tail_addr - addr);
+        if (H5FD__direct_io_block(file, op, tail_addr, 0, (size_t)(end - tail_addr),
+                                  rbuf ? (unsigned char *)rbuf + buf_off : NULL,
+                                  wbuf ? (const unsigned char *)wbuf + buf_off : NULL, copy_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTOPERATE, FAIL, "unable to transfer partial block")
+    } /* end if */
+
+done:
+    /* Free with HDfree since it came from posix_memalign */
+    if (copy_buf)
+        HDfree(copy_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_io_unaligned() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_read
  *
@@ -847,18 +1093,8 @@ static herr_t
 H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
                   size_t size, void *buf /*out*/)
 {
-    H5FD_direct_t *file = (H5FD_direct_t *)_file;
-    ssize_t        nbytes;
-    hbool_t        _must_align = TRUE;
-    herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void *         copy_buf = NULL, *p2;
-    size_t         _boundary;
-    size_t         _fbsize;
-    size_t         _cbsize;
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to read when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the requested data */
+    H5FD_direct_t *file      = (H5FD_direct_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -871,134 +1107,20 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow")
 
-    /* If the system doesn't require data to be aligned, read the data in
-     * the same way as sec2 driver.
-     */
-    _must_align = file->fa.must_align;
-
-    /* Get the memory boundary for alignment, file system block size, and maximal
-     * copy buffer size.
-     */
-    _boundary = file->fa.mboundary;
-    _fbsize   = file->fa.fbsize;
-    _cbsize   = file->fa.cbsize;
-
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * read it directly from the file.  If not, read a bigger
-     * and aligned data first, then copy the data into memory buffer.
+    /* If the data is aligned or the system doesn't require data to be aligned,
+     * read it directly from the file, in the same way as the sec2 driver.
+     * Otherwise only the unaligned ends go through a copy buffer.
      */
-    if (!_must_align || ((addr % _fbsize == 0) && (size % _fbsize == 0) && ((size_t)buf % _boundary == 0))) {
-        /* Seek to the correct location */
-        if ((addr != file->pos || OP_READ != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-        /* Read the aligned data in file first, being careful of interrupted
-         * system calls and partial results. */
-        while (size > 0) {
-            do {
-                nbytes = HDread(file->fd, buf, size);
-            } while (-1 == nbytes && EINTR == errno);
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            if (0 == nbytes) {
-                /* end of file but not end of format address space */
-                HDmemset(buf, 0, size);
-                break;
-            }
-            HDassert(nbytes >= 0);
-            HDassert((size_t)nbytes <= size);
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
-            size -= (size_t)nbytes;
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
-            addr += (haddr_t)nbytes;
-            buf = (char *)buf + nbytes;
-        }
-    }
-    else {
-        /* Calculate where we will begin copying from the copy buffer */
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer. */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        HDassert(!(alloc_size % _fbsize));
-        if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
-
-        /* look for the aligned position for reading the data */
-        HDassert(!(((addr / _fbsize) * _fbsize) % _fbsize));
-        if (HDlseek(file->fd, (HDoff_t)((addr / _fbsize) * _fbsize), SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-        /*
-         * Read the aligned data in file into aligned buffer first, then copy the data
-         * into the final buffer.  If the data size is bigger than maximal copy buffer
-         * size, do the reading by segment (the outer while loop).  If not, do one step
-         * reading.
-         */
-        do {
-            /* Read the aligned data in file first.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE. */
-            HDmemset(copy_buf, 0, alloc_size);
-
-            /* Calculate how much data we have to read in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                read_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                read_size = alloc_size;
-
-            HDassert(!(read_size % _fbsize));
-            do {
-                nbytes = HDread(file->fd, copy_buf, read_size);
-            } while (-1 == nbytes && EINTR == errno);
-
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-
-            /* Copy the needed data from the copy buffer to the output
-             * buffer, and update copy_size.  If the copy buffer does not
-             * contain the rest of the data, just copy what's in the copy
-             * buffer and also update read_addr and copy_offset to read the
-             * next section of data. */
-            p2 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(buf, p2, copy_size);
-                buf       = (unsigned char *)buf + copy_size;
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(buf, p2, alloc_size - copy_offset);
-                buf = (unsigned char *)buf + alloc_size - copy_offset;
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-        } while (copy_size > 0);
-
-        /*Final step: update address*/
-        addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
-
-        if (copy_buf) {
-            /* Free with HDfree since it came from posix_memalign */
-            HDfree(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
-    }
-
-    /* Update current position */
-    file->pos = addr;
-    file->op  = OP_READ;
+    if (!file->fa.must_align || ((addr % file->fa.fbsize == 0) && (size % file->fa.fbsize == 0) &&
+                                 ((size_t)buf % file->fa.mboundary == 0))) {
+        if (H5FD__direct_io(file, OP_READ, addr, size, buf, NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+    } /* end if */
+    else if (H5FD__direct_io_unaligned(file, OP_READ, addr, size, buf, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unaligned file read failed")
 
 done:
     if (ret_value < 0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if (copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
@@ -1027,21 +1149,8 @@ static herr_t
 H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
                    size_t size, const void *buf)
 {
-    H5FD_direct_t *file = (H5FD_direct_t *)_file;
-    ssize_t        nbytes;
-    hbool_t        _must_align = TRUE;
-    herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void *         copy_buf = NULL, *p1;
-    const void *   p3;
-    size_t         _boundary;
-    size_t         _fbsize;
-    size_t         _cbsize;
-    haddr_t        write_addr;       /* Address to write copy buffer */
-    haddr_t        write_size;       /* Size to write from copy buffer */
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to write when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the data to write */
+    H5FD_direct_t *file      = (H5FD_direct_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -1054,180 +1163,22 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow")
 
-    /* If the system doesn't require data to be aligned, read the data in
-     * the same way as sec2 driver.
-     */
-    _must_align = file->fa.must_align;
-
-    /* Get the memory boundary for alignment, file system block size, and maximal
-     * copy buffer size.
-     */
-    _boundary = file->fa.mboundary;
-    _fbsize   = file->fa.fbsize;
-    _cbsize   = file->fa.cbsize;
-
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * write it directly to the file.  If not, read a bigger and aligned data
-     * first, update buffer with user data, then write the data out.
+    /* If the data is aligned or the system doesn't require data to be aligned,
+     * write it directly to the file, in the same way as the sec2 driver.
+     * Otherwise only the unaligned ends are read, updated with the user's
+     * data and written back through a copy buffer.  The extra data
+     * introduced by alignment is truncated in H5FD__direct_truncate.
      */
-    if (!_must_align || ((addr % _fbsize == 0) && (size % _fbsize == 0) && ((size_t)buf % _boundary == 0))) {
-        /* Seek to the correct location */
-        if ((addr != file->pos || OP_WRITE != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-        while (size > 0) {
-            do {
-                nbytes = HDwrite(file->fd, buf, size);
-            } while (-1 == nbytes && EINTR == errno);
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-            HDassert(nbytes > 0);
-            HDassert((size_t)nbytes <= size);
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
-            size -= (size_t)nbytes;
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
-            addr += (haddr_t)nbytes;
-            buf = (const char *)buf + nbytes;
-        }
-    }
-    else {
-        /* Calculate where we will begin reading from (on disk) and where we
-         * will begin copying from the copy buffer */
-        write_addr  = (addr / _fbsize) * _fbsize;
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer.
-         */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        HDassert(!(alloc_size % _fbsize));
-
-        if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
-
-        /* look for the right position for reading or writing the data */
-        if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-        p3 = buf;
-        do {
-            /* Calculate how much data we have to write in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                write_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                write_size = alloc_size;
-
-            /*
-             * Read the aligned data first if the aligned region doesn't fall
-             * entirely in the range to be written.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE.  Only read the entire section if
-             * both ends are misaligned, otherwise only read the block on the
-             * misaligned end.
-             */
-            HDmemset(copy_buf, 0, _fbsize);
-
-            if (copy_offset > 0) {
-                if ((write_addr + write_size) > (addr + size)) {
-                    HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                    read_size = write_size;
-                    p1        = copy_buf;
-                } /* end if */
-                else {
-                    read_size = _fbsize;
-                    p1        = copy_buf;
-                } /* end else */
-            }     /* end if */
-            else if ((write_addr + write_size) > (addr + size)) {
-                HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                read_size = _fbsize;
-                p1        = (unsigned char *)copy_buf + write_size - _fbsize;
-
-                /* Seek to the last block, for reading */
-                HDassert(!((write_addr + write_size - _fbsize) % _fbsize));
-                if (HDlseek(file->fd, (HDoff_t)(write_addr + write_size - _fbsize), SEEK_SET) < 0)
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-            } /* end if */
-            else
-                p1 = NULL;
-
-            if (p1) {
-                HDassert(!(read_size % _fbsize));
-                do {
-                    nbytes = HDread(file->fd, p1, read_size);
-                } while (-1 == nbytes && EINTR == errno);
-
-                if (-1 == nbytes) /* error */
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            } /* end if */
-
-            /* look for the right position and append or copy the data to be written to
-             * the aligned buffer.
-             * Consider all possible situations here: file address is not aligned on
-             * file block size; the end of data address is not aligned; the end of data
-             * address is aligned; data size is smaller or bigger than maximal copy size.
-             */
-            p1 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(p1, p3, copy_size);
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(p1, p3, alloc_size - copy_offset);
-                p3 = (const unsigned char *)p3 + (alloc_size - copy_offset);
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-
-            /*look for the aligned position for writing the data*/
-            HDassert(!(write_addr % _fbsize));
-            if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-            /*
-             * Write the data. It doesn't truncate the extra data introduced by
-             * alignment because that step is done in H5FD_direct_flush.
-             */
-            HDassert(!(write_size % _fbsize));
-            do {
-                nbytes = HDwrite(file->fd, copy_buf, write_size);
-            } while (-1 == nbytes && EINTR == errno);
-
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-
-            /* update the write address */
-            write_addr += write_size;
-        } while (copy_size > 0);
-
-        /*Update the address and size*/
-        addr = write_addr;
-        buf  = (const char *)buf + size;
-
-        if (copy_buf) {
-            /* Free with HDfree since it came from posix_memalign */
-            HDfree(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
-    }
-
-    /* Update current position and eof */
-    file->pos = addr;
-    file->op  = OP_WRITE;
-    if (file->pos > file->eof)
-        file->eof = file->pos;
+    if (!file->fa.must_align || ((addr % file->fa.fbsize == 0) && (size % file->fa.fbsize == 0) &&
+                                 ((size_t)buf % file->fa.mboundary == 0))) {
+        if (H5FD__direct_io(file, OP_WRITE, addr, size, NULL, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    } /* end if */
+    else if (H5FD__direct_io_unaligned(file, OP_WRITE, addr, size, NULL, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unaligned file write failed")
 
 done:
     if (ret_value < 0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if (copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
@@ -40,13 +40,74 @@
 #include "H5Fprivate.h"  /* File access                */
 #include "H5FDprivate.h" /* File drivers                */
 #include "H5FDfamily.h"  /* Family file driver             */
+#include "H5FDsec2.h"    /* Sec2 file driver               */
 #include "H5Iprivate.h"  /* IDs                      */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists            */
 
+/* The member threads call the member drivers' callbacks, which may push
+ * errors onto the error stack, so they are only used when the library keeps
+ * an error stack per thread.
+ */
+#ifdef H5_HAVE_THREADSAFE
+#define H5FD_FAMILY_THREADS
+#endif /* H5_HAVE_THREADSAFE */
+
 /* The size of the member name buffers */
 #define H5FD_FAM_MEMB_NAME_BUF_SIZE 4096
 
+/* Environment variable that sets the number of threads used to access
+ * members concurrently, its default and the largest value honored.  A value
+ * of 0 or 1 accesses the members one at a time from the application's
+ * thread.  Only used in a thread-safe library, and only when the members
+ * use the sec2 driver.
+ */
+#define H5FD_FAM_THREADS_ENV "HDF5_FAMILY_THREADS"
+#define H5FD_FAM_THREADS_DEF 1
+#define H5FD_FAM_THREADS_MAX 64
+
+#ifdef H5FD_FAMILY_THREADS
+/* Operations the member thread pool performs */
+typedef enum H5FD_family_op_t {
+    H5FD_FAMILY_OP_READ,     /* read part of a request from one member  */
+    H5FD_FAMILY_OP_WRITE,    /* write part of a request to one member   */
+    H5FD_FAMILY_OP_FLUSH,    /* flush one member                        */
+    H5FD_FAMILY_OP_TRUNCATE  /* truncate one member                     */
+} H5FD_family_op_t;
+
+/* One member's share of a request */
+typedef struct H5FD_family_job_t {
+    H5FD_t *         memb;   /* member file                          */
+    unsigned         idx;    /* index of the member in the family    */
+    H5FD_family_op_t op;     /* operation                            */
+    haddr_t          addr;   /* address in the member                */
+    size_t           size;   /* number of bytes                      */
+    void *           buf;    /* I/O buffer (const for writes)        */
+    herr_t           status; /* result of the member callback        */
+} H5FD_family_job_t;
+
+/* Thread pool for concurrent member I/O.  The application's thread hands a
+ * batch of jobs to the pool, works on the batch alongside the pool's
+ * threads, and returns once every job in the batch is done.
+ */
+typedef struct H5FD_family_pool_t {
+    H5TS_thread_t *     threads;   /* pool threads                                 */
+    unsigned            nthreads;  /* number of pool threads                       */
+    H5TS_mutex_simple_t mutex;     /* protects the fields below                    */
+    H5TS_cond_t         work_cond; /* signalled when a batch is posted or on stop  */
+    H5TS_cond_t         done_cond; /* signalled when the last job of a batch ends  */
+    H5FD_family_job_t * jobs;      /* current batch                                */
+    size_t              njobs;     /* number of jobs in the batch                  */
+    size_t              ajobs;     /* number of job slots allocated                */
+    size_t              next;      /* next job to hand out                         */
+    size_t              pending;   /* number of jobs not yet done                  */
+    hid_t               dxpl_id;   /* DXPL for the batch                           */
+    H5FD_mem_t          type;      /* memory type for the batch                    */
+    hbool_t             closing;   /* 'closing' flag for flushes and truncates     */
+    hbool_t             stop;      /* TRUE when the threads should exit            */
+} H5FD_family_pool_t;
+#endif /* H5FD_FAMILY_THREADS */
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_FAMILY_g = 0;
 
@@ -69,6 +130,12 @@ typedef struct H5FD_family_t {
     hbool_t repart_members; /* Whether to mark the superblock dirty
                              * when it is loaded, so that the family
                              * member sizes can be re-encoded       */
+
+    /* Concurrent member access */
+    unsigned nthreads; /* number of threads to use, 1 for none */
+#ifdef H5FD_FAMILY_THREADS
+    H5FD_family_pool_t *pool; /* thread pool, started on first use */
+#endif                        /* H5FD_FAMILY_THREADS */
 } H5FD_family_t;
 
 /* Driver-specific file access properties */
@@ -102,6 +169,22 @@ static herr_t  H5FD__family_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closi
 static herr_t  H5FD__family_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__family_unlock(H5FD_t *_file);
 
+/* Member thread pool routines */
+#ifdef H5FD_FAMILY_THREADS
+static void * H5FD__family_pool_thread(void *_pool);
+static void   H5FD__family_pool_work(H5FD_family_pool_t *pool);
+static herr_t H5FD__family_pool_start(H5FD_family_t *file);
+static hbool_t H5FD__family_pool_ready(H5FD_family_t *file);
+static herr_t H5FD__family_pool_reserve(H5FD_family_pool_t *pool, size_t njobs);
+static herr_t H5FD__family_pool_run(H5FD_family_pool_t *pool, size_t njobs, H5FD_mem_t type, hid_t dxpl_id,
+                                    hbool_t closing);
+static void   H5FD__family_pool_stop(H5FD_family_t *file);
+static herr_t H5FD__family_rw_members(H5FD_family_t *file, H5FD_family_op_t op, H5FD_mem_t type,
+                                      hid_t dxpl_id, haddr_t addr, size_t size, void *buf);
+static herr_t H5FD__family_all_members(H5FD_family_t *file, H5FD_family_op_t op, hid_t dxpl_id,
+                                       hbool_t closing);
+#endif /* H5FD_FAMILY_THREADS */
+
 /* The class struct */
 static const H5FD_class_t H5FD_family_g = {
     "family",                   /* name            */
@@ -644,6 +727,19 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     file->name  = H5MM_strdup(name);
     file->flags = flags;
 
+    /* Number of threads for concurrent member access */
+    file->nthreads = H5FD_FAM_THREADS_DEF;
+    {
+        const char *threads_env = HDgetenv(H5FD_FAM_THREADS_ENV);
+
+        if (threads_env && *threads_env)
+            file->nthreads = (unsigned)HDstrtoul(threads_env, NULL, 10);
+    }
+    if (0 == file->nthreads)
+        file->nthreads = 1;
+    else if (file->nthreads > H5FD_FAM_THREADS_MAX)
+        file->nthreads = H5FD_FAM_THREADS_MAX;
+
     /* Allocate space for the string buffers */
     if (NULL == (memb_name = (char *)H5MM_malloc(H5FD_FAM_MEMB_NAME_BUF_SIZE)))
         HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "unable to allocate member name")
@@ -692,6 +788,13 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
         file->nmembs++;
     }
 
+    /* The member threads call the member driver without the library's lock,
+     * which only the sec2 driver is known to cope with.  All the members use
+     * the same driver.
+     */
+    if (file->nthreads > 1 && file->memb[0]->driver_id != H5FD_SEC2)
+        file->nthreads = 1;
+
     /* If the file is reopened and there's only one member file existing, this file may be
      * smaller than the size specified through H5Pset_fapl_family().  Update the actual
      * member size.
@@ -761,6 +864,12 @@ H5FD__family_close(H5FD_t *_file)
 
     FUNC_ENTER_STATIC
 
+#ifdef H5FD_FAMILY_THREADS
+    /* Stop the member threads */
+    if (file->pool)
+        H5FD__family_pool_stop(file);
+#endif /* H5FD_FAMILY_THREADS */
+
     /* Close as many members as possible. Use private function here to avoid clearing
      * the error stack. We need the error message to indicate wrong member file size. */
     for (u = 0; u < file->nmembs; u++) {
@@ -1107,6 +1216,16 @@ H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+#ifdef H5FD_FAMILY_THREADS
+    /* Read from the members concurrently when the request spans several */
+    if (file->nthreads > 1 && size > file->memb_size - addr % file->memb_size &&
+        H5FD__family_pool_ready(file)) {
+        if (H5FD__family_rw_members(file, H5FD_FAMILY_OP_READ, type, dxpl_id, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_FAMILY_THREADS */
+
     /* Read from each member */
     while (size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1172,6 +1291,19 @@ H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+#ifdef H5FD_FAMILY_THREADS
+    /* Write to the members concurrently when the request spans several */
+    if (file->nthreads > 1 && size > file->memb_size - addr % file->memb_size &&
+        H5FD__family_pool_ready(file)) {
+        /* The buffer is only read from for writes */
+        H5_GCC_DIAG_OFF("cast-qual")
+        if (H5FD__family_rw_members(file, H5FD_FAMILY_OP_WRITE, type, dxpl_id, addr, size, (void *)buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+        H5_GCC_DIAG_ON("cast-qual")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_FAMILY_THREADS */
+
     /* Write to each member */
     while (size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1222,6 +1354,15 @@ H5FD__family_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
 
     FUNC_ENTER_STATIC
 
+#ifdef H5FD_FAMILY_THREADS
+    /* Flush the members concurrently */
+    if (file->nthreads > 1 && file->nmembs > 1 && H5FD__family_pool_ready(file)) {
+        if (H5FD__family_all_members(file, H5FD_FAMILY_OP_FLUSH, dxpl_id, closing) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to flush member files")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_FAMILY_THREADS */
+
     for (u = 0; u < file->nmembs; u++)
         if (file->memb[u] && H5FD_flush(file->memb[u], closing) < 0)
             nerrors++;
@@ -1256,12 +1397,21 @@ H5FD__family_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closi
 
     FUNC_ENTER_STATIC
 
+#ifdef H5FD_FAMILY_THREADS
+    /* Truncate the members concurrently */
+    if (file->nthreads > 1 && file->nmembs > 1 && H5FD__family_pool_ready(file)) {
+        if (H5FD__family_all_members(file, H5FD_FAMILY_OP_TRUNCATE, dxpl_id, closing) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to truncate member files")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_FAMILY_THREADS */
+
     for (u = 0; u < file->nmembs; u++)
         if (file->memb[u] && H5FD_truncate(file->memb[u], closing) < 0)
             nerrors++;
 
     if (nerrors)
-        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to flush member files")
+        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to truncate member files")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1343,3 +1493,455 @@ H5FD__family_unlock(H5FD_t *_file)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__family_unlock() */
+
+#ifdef H5FD_FAMILY_THREADS
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_thread
+ *
+ * Purpose:     Body of a member pool thread: works on each batch the
+ *              application's thread posts until told to stop.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__family_pool_thread(void *_pool)
+{
+    H5FD_family_pool_t *pool = (H5FD_family_pool_t *)_pool;
+
+    H5TS_mutex_lock_simple(&pool->mutex);
+    for (;;) {
+        while (!pool->stop && pool->next >= pool->njobs)
+            H5TS_cond_wait(&pool->work_cond, &pool->mutex);
+        if (pool->next >= pool->njobs)
+            break;
+        H5FD__family_pool_work(pool);
+    }
+    H5TS_mutex_unlock_simple(&pool->mutex);
+
+    return NULL;
+} /* end H5FD__family_pool_thread() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_work
+ *
+ * Purpose:     Takes jobs from the current batch and runs them until none
+ *              are left.  Called with the pool mutex held, which is
+ *              released while a job runs.
+ *
+ *              The member driver's callbacks are called directly rather
+ *              than through H5FD_read() and friends, which use library
+ *              state that belongs to the application's thread.  Each job
+ *              in a batch is for a different member, so no two threads
+ *              use the same member at once.  The pool is only used for
+ *              sec2 members, whose callbacks don't need the library's
+ *              lock, which the application's thread holds meanwhile.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__family_pool_work(H5FD_family_pool_t *pool)
+{
+    while (pool->next < pool->njobs) {
+        H5FD_family_job_t *job  = &pool->jobs[pool->next++];
+        H5FD_t *           memb = job->memb;
+        herr_t             status;
+
+        H5TS_mutex_unlock_simple(&pool->mutex);
+
+        switch (job->op) {
+            case H5FD_FAMILY_OP_READ:
+                status = (memb->cls->read)(memb, pool->type, pool->dxpl_id, job->addr + memb->base_addr,
+                                           job->size, job->buf);
+                break;
+
+            case H5FD_FAMILY_OP_WRITE:
+                status = (memb->cls->write)(memb, pool->type, pool->dxpl_id, job->addr + memb->base_addr,
+                                            job->size, (const void *)job->buf);
+                break;
+
+            case H5FD_FAMILY_OP_FLUSH:
+                status = memb->cls->flush ? (memb->cls->flush)(memb, pool->dxpl_id, pool->closing) : SUCCEED;
+                break;
+
+            case H5FD_FAMILY_OP_TRUNCATE:
+            default:
+                status =
+                    memb->cls->truncate ? (memb->cls->truncate)(memb, pool->dxpl_id, pool->closing) : SUCCEED;
+                break;
+        } /* end switch */
+
+        H5TS_mutex_lock_simple(&pool->mutex);
+        job->status = status;
+        if (0 == --pool->pending)
+            H5TS_cond_broadcast(&pool->done_cond);
+    } /* end while */
+} /* end H5FD__family_pool_work() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_start
+ *
+ * Purpose:     Creates the member thread pool.  The application's thread
+ *              takes part in every batch, so at most NTHREADS-1 threads
+ *              are started.  If fewer start, the pool makes do with them.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_pool_start(H5FD_family_t *file)
+{
+    H5FD_family_pool_t *pool         = NULL;
+    hbool_t             mutex_init   = FALSE;
+    hbool_t             work_cv_init = FALSE;
+    hbool_t             done_cv_init = FALSE;
+    unsigned            u;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->nthreads > 1);
+    HDassert(NULL == file->pool);
+
+    if (NULL == (pool = (H5FD_family_pool_t *)H5MM_calloc(sizeof(H5FD_family_pool_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate member thread pool")
+    if (NULL ==
+        (pool->threads = (H5TS_thread_t *)H5MM_malloc((file->nthreads - 1) * sizeof(H5TS_thread_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate member threads")
+    if (H5TS_mutex_init(&pool->mutex))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize member pool mutex")
+    mutex_init = TRUE;
+    if (H5TS_cond_init(&pool->work_cond))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize member pool condition")
+    work_cv_init = TRUE;
+    if (H5TS_cond_init(&pool->done_cond))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize member pool condition")
+    done_cv_init = TRUE;
+
+    /* Make do with the threads that start */
+    for (u = 0; u < file->nthreads - 1; u++) {
+        if (H5TS_thread_create(&pool->threads[pool->nthreads], H5FD__family_pool_thread, pool))
+            break;
+        pool->nthreads++;
+    } /* end for */
+    if (0 == pool->nthreads)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, FAIL, "can't start member threads")
+
+    file->pool = pool;
+
+done:
+    if (ret_value < 0 && pool) {
+        if (done_cv_init)
+            H5TS_cond_destroy(&pool->done_cond);
+        if (work_cv_init)
+            H5TS_cond_destroy(&pool->work_cond);
+        if (mutex_init)
+            H5TS_mutex_destroy(&pool->mutex);
+        H5MM_xfree(pool->threads);
+        H5MM_xfree(pool);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_pool_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_ready
+ *
+ * Purpose:     Starts the member thread pool on first use.  If it can't
+ *              be started, the file accesses its members one at a time
+ *              from then on.
+ *
+ * Return:      TRUE if the pool is running, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__family_pool_ready(H5FD_family_t *file)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(file->nthreads > 1);
+
+    if (NULL == file->pool && H5FD__family_pool_start(file) < 0) {
+        H5E_clear_stack(NULL);
+        file->nthreads = 1;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(NULL != file->pool)
+} /* end H5FD__family_pool_ready() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_reserve
+ *
+ * Purpose:     Makes room for NJOBS jobs in the pool's batch.  Only
+ *              called between batches, while the pool threads are idle.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_pool_reserve(H5FD_family_pool_t *pool, size_t njobs)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(pool);
+    HDassert(0 == pool->njobs);
+
+    if (njobs > pool->ajobs) {
+        size_t             n = MAX(njobs, 2 * pool->ajobs);
+        H5FD_family_job_t *x;
+
+        if (NULL == (x = (H5FD_family_job_t *)H5MM_realloc(pool->jobs, n * sizeof(H5FD_family_job_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to reallocate member jobs")
+        pool->jobs  = x;
+        pool->ajobs = n;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_pool_reserve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_run
+ *
+ * Purpose:     Runs the first NJOBS jobs in the pool's batch and waits
+ *              for all of them to finish.
+ *
+ *              The pool threads' errors stay on their own error stacks,
+ *              so an error naming the member is pushed here for each job
+ *              that failed.
+ *
+ * Return:      SUCCEED/FAIL, FAIL if any job failed
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_pool_run(H5FD_family_pool_t *pool, size_t njobs, H5FD_mem_t type, hid_t dxpl_id, hbool_t closing)
+{
+    size_t u;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(pool);
+    HDassert(njobs <= pool->ajobs);
+
+    H5TS_mutex_lock_simple(&pool->mutex);
+    pool->type    = type;
+    pool->dxpl_id = dxpl_id;
+    pool->closing = closing;
+    pool->njobs   = njobs;
+    pool->next    = 0;
+    pool->pending = njobs;
+    H5TS_cond_broadcast(&pool->work_cond);
+
+    /* Take a share of the work, then wait for the pool threads' shares */
+    H5FD__family_pool_work(pool);
+    while (pool->pending > 0)
+        H5TS_cond_wait(&pool->done_cond, &pool->mutex);
+
+    pool->njobs = 0;
+    pool->next  = 0;
+    H5TS_mutex_unlock_simple(&pool->mutex);
+
+    for (u = 0; u < njobs; u++) {
+        const H5FD_family_job_t *job = &pool->jobs[u];
+
+        if (job->status >= 0)
+            continue;
+        switch (job->op) {
+            case H5FD_FAMILY_OP_READ:
+                HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "read of %zu bytes at %llu from member %u failed",
+                            job->size, (unsigned long long)job->addr, job->idx)
+                break;
+
+            case H5FD_FAMILY_OP_WRITE:
+                HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write of %zu bytes at %llu to member %u failed",
+                            job->size, (unsigned long long)job->addr, job->idx)
+                break;
+
+            case H5FD_FAMILY_OP_FLUSH:
+                HDONE_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to flush member %u", job->idx)
+                break;
+
+            case H5FD_FAMILY_OP_TRUNCATE:
+            default:
+                HDONE_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to truncate member %u", job->idx)
+                break;
+        } /* end switch */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_pool_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_pool_stop
+ *
+ * Purpose:     Stops the member threads and releases the pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__family_pool_stop(H5FD_family_t *file)
+{
+    H5FD_family_pool_t *pool = file->pool;
+    unsigned            u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(pool);
+
+    H5TS_mutex_lock_simple(&pool->mutex);
+    pool->stop = TRUE;
+    H5TS_cond_broadcast(&pool->work_cond);
+    H5TS_mutex_unlock_simple(&pool->mutex);
+    for (u = 0; u < pool->nthreads; u++)
+        H5TS_wait_for_thread(pool->threads[u]);
+
+    H5TS_cond_destroy(&pool->done_cond);
+    H5TS_cond_destroy(&pool->work_cond);
+    H5TS_mutex_destroy(&pool->mutex);
+    H5MM_xfree(pool->jobs);
+    H5MM_xfree(pool->threads);
+    file->pool = H5MM_xfree(pool);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__family_pool_stop() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_rw_members
+ *
+ * Purpose:     Splits a read or write that spans several members into one
+ *              job per member and runs the jobs concurrently.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_rw_members(H5FD_family_t *file, H5FD_family_op_t op, H5FD_mem_t type, hid_t dxpl_id,
+                        haddr_t addr, size_t size, void *buf)
+{
+    unsigned char *p         = (unsigned char *)buf;
+    size_t         njobs     = 0;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(op == H5FD_FAMILY_OP_READ || op == H5FD_FAMILY_OP_WRITE);
+
+    HDassert(file->pool);
+    if (H5FD__family_pool_reserve(file->pool, (size_t)(size / file->memb_size) + 2) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate member jobs")
+
+    /* One job for each member the request touches, split as in the serial case */
+    while (size > 0) {
+        H5FD_family_job_t *job = &file->pool->jobs[njobs];
+        unsigned           u;
+        haddr_t            sub;
+        hsize_t            tempreq;
+        size_t             req;
+
+        H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
+
+        sub     = addr % file->memb_size;
+        tempreq = file->memb_size - sub;
+        if (tempreq > SIZET_MAX)
+            tempreq = SIZET_MAX;
+        req = MIN(size, (size_t)tempreq);
+
+        HDassert(u < file->nmembs);
+        HDassert(njobs < file->pool->ajobs);
+
+        /* The end-of-address check H5FD_read() and H5FD_write() would make */
+        if (op == H5FD_FAMILY_OP_WRITE || !(file->memb[u]->access_flags & H5F_ACC_SWMR_READ)) {
+            haddr_t eoa;
+
+            if (HADDR_UNDEF == (eoa = (file->memb[u]->cls->get_eoa)(file->memb[u], type)))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+            if ((sub + file->memb[u]->base_addr + req) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                            "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                            (unsigned long long)(sub + file->memb[u]->base_addr), (unsigned long long)req,
+                            (unsigned long long)eoa)
+        } /* end if */
+
+        job->memb   = file->memb[u];
+        job->idx    = u;
+        job->op     = op;
+        job->addr   = sub;
+        job->size   = req;
+        job->buf    = p;
+        job->status = SUCCEED;
+        njobs++;
+
+        addr += req;
+        p += req;
+        size -= req;
+    } /* end while */
+
+    if (H5FD__family_pool_run(file->pool, njobs, type, dxpl_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, op == H5FD_FAMILY_OP_READ ? H5E_READERROR : H5E_WRITEERROR, FAIL,
+                    "member file I/O failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_rw_members() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_all_members
+ *
+ * Purpose:     Flushes or truncates all members concurrently.
+ *
+ * Return:      SUCCEED/FAIL, with as many members done as possible
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_all_members(H5FD_family_t *file, H5FD_family_op_t op, hid_t dxpl_id, hbool_t closing)
+{
+    size_t   njobs = 0;
+    unsigned u;
+    herr_t   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(op == H5FD_FAMILY_OP_FLUSH || op == H5FD_FAMILY_OP_TRUNCATE);
+
+    HDassert(file->pool);
+    if (H5FD__family_pool_reserve(file->pool, file->nmembs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate member jobs")
+
+    for (u = 0; u < file->nmembs; u++)
+        if (file->memb[u]) {
+            H5FD_family_job_t *job = &file->pool->jobs[njobs++];
+
+            job->memb   = file->memb[u];
+            job->idx    = u;
+            job->op     = op;
+            job->addr   = 0;
+            job->size   = 0;
+            job->buf    = NULL;
+            job->status = SUCCEED;
+        } /* end if */
+
+    if (H5FD__family_pool_run(file->pool, njobs, H5FD_MEM_DEFAULT, dxpl_id, closing) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "member operation failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_all_members() */
+#endif /* H5FD_FAMILY_THREADS */
@@ -192,6 +192,62 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_get_mem_image
+ *
+ * Purpose:     Retrieve a pointer to SIZE bytes at ADDR in the memory
+ *              image of the file, for drivers which keep one (see
+ *              H5FD_FEAT_MEMORY_IMAGE).  The pointer remains valid
+ *              until the file is closed.
+ *
+ *              *IMAGE is set to NULL when the driver has no memory image,
+ *              the range isn't covered by it or the range extends past
+ *              the EOA; the caller should then fall back to H5FD_read.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_get_mem_image(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size,
+                   const void **image /*out*/)
+{
+    const H5FD_class_mem_t *cls;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(image);
+
+    *image = NULL;
+
+    if (0 == size || !(file->feature_flags & H5FD_FEAT_MEMORY_IMAGE))
+        HGOTO_DONE(SUCCEED)
+
+    /* Check against the EOA, as for reads */
+    if (!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        haddr_t eoa;
+
+        if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+
+        /* Let the caller's read report ranges past the EOA */
+        if ((addr + file->base_addr + size) > eoa)
+            HGOTO_DONE(SUCCEED)
+    }
+
+    /* Dispatch to driver */
+    cls = (const H5FD_class_mem_t *)(file->cls);
+    HDassert(cls->get_mem_image); /* All memory image drivers must implement this */
+    *image = (cls->get_mem_image)(file, addr + file->base_addr, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_get_mem_image() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_write
  *
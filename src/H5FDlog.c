@@ -49,6 +49,27 @@ typedef struct H5FD_log_fapl_t {
     size_t buf_size; /* Size of buffers for track flavor and number of times each byte is accessed */
 } H5FD_log_fapl_t;
 
+/* One request in the I/O trace ring buffer */
+typedef struct H5FD_log_trace_rec_t {
+    uint64_t start;   /* Start of the request, in ns since open */
+    uint64_t latency; /* Latency of the request, in ns          */
+    haddr_t  addr;    /* File address                           */
+    uint64_t size;    /* Size in bytes                          */
+    uint8_t  op;      /* H5FD_LOG_TRACE_READ or _WRITE          */
+    uint8_t  type;    /* H5FD_mem_t type                        */
+} H5FD_log_trace_rec_t;
+
+/* Running summary of the traced requests of one kind and memory type */
+typedef struct H5FD_log_trace_stats_t {
+    uint64_t count;                         /* Number of requests                        */
+    uint64_t bytes;                         /* Bytes transferred                         */
+    uint64_t small;                         /* Requests under H5FD_LOG_TRACE_SMALL_IO    */
+    uint64_t sequential;                    /* Requests continuing the previous one      */
+    uint64_t total_latency;                 /* Sum of latencies, in ns                   */
+    uint64_t max_latency;                   /* Longest latency, in ns                    */
+    uint64_t hist[H5FD_LOG_TRACE_NBUCKETS]; /* Latency histogram, log2 buckets of ns     */
+} H5FD_log_trace_stats_t;
+
 /* Define strings for the different file memory types
  * These are defined in the H5F_mem_t enum from H5Fpublic.h
  * Note that H5FD_MEM_NOLIST is not listed here since it has
@@ -132,6 +153,13 @@ typedef struct H5FD_log_t {
     size_t             iosize;              /* Size of I/O information buffers                  */
     FILE *             logfp;               /* Log file pointer                                 */
     H5FD_log_fapl_t    fa;                  /* Driver-specific file access properties           */
+
+    /* Fields for the I/O trace */
+    H5FD_log_trace_rec_t * trace;                           /* Ring buffer of the latest requests */
+    uint64_t               trace_count;                     /* Number of requests traced          */
+    double                 trace_t0;                        /* Time the file was opened           */
+    haddr_t                trace_next[2];                   /* End of the last read and write     */
+    H5FD_log_trace_stats_t trace_stats[2][H5FD_MEM_NTYPES]; /* Summary per kind and memory type   */
 } H5FD_log_t;
 
 /*
@@ -178,6 +206,11 @@ static herr_t  H5FD__log_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
 static herr_t  H5FD__log_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__log_unlock(H5FD_t *_file);
 
+/* I/O trace routines */
+static void   H5FD__log_trace_add(H5FD_log_t *file, unsigned op, H5FD_mem_t type, haddr_t addr, size_t size,
+                                  double start);
+static herr_t H5FD__log_trace_dump(H5FD_log_t *file);
+
 static const H5FD_class_t H5FD_log_g = {
     "log",                   /* name			*/
     MAXADDR,                 /* maxaddr		*/
@@ -604,6 +637,16 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
             HDassert(file->flavor);
         } /* end if */
 
+        /* Allocate the ring buffer for the I/O trace */
+        if (file->fa.flags & H5FD_LOG_TRACE) {
+            if (NULL == (file->trace = (H5FD_log_trace_rec_t *)H5MM_malloc(H5FD_LOG_TRACE_NRECORDS *
+                                                                            sizeof(H5FD_log_trace_rec_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate I/O trace buffer")
+            file->trace_t0      = H5_get_time();
+            file->trace_next[0] = HADDR_UNDEF;
+            file->trace_next[1] = HADDR_UNDEF;
+        } /* end if */
+
         /* Set the log file pointer */
         if (fa->logfile)
             file->logfp = HDfopen(fa->logfile, "w");
@@ -654,9 +697,11 @@ done:
     if (NULL == ret_value) {
         if (fd >= 0)
             HDclose(fd);
-        if (file)
-            file = H5FL_FREE(H5FD_log_t, file);
-    } /* end if */
+        if (file) {
+            file->trace = (H5FD_log_trace_rec_t *)H5MM_xfree(file->trace);
+            file        = H5FL_FREE(H5FD_log_t, file);
+        } /* end if */
+    }     /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_open() */
@@ -795,6 +840,13 @@ H5FD__log_close(H5FD_t *_file)
                       last_addr, (addr - 1), (unsigned long)(addr - last_addr), flavors[last_val]);
         } /* end if */
 
+        /* Dump the I/O trace */
+        if (file->fa.flags & H5FD_LOG_TRACE) {
+            if (H5FD__log_trace_dump(file) < 0)
+                HDONE_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write I/O trace")
+            file->trace = (H5FD_log_trace_rec_t *)H5MM_xfree(file->trace);
+        } /* end if */
+
         /* Free the logging information */
         if (file->fa.flags & H5FD_LOG_FILE_WRITE)
             file->nwrite = (unsigned char *)H5MM_xfree(file->nwrite);
@@ -1177,8 +1229,9 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
     H5FD_log_t *  file       = (H5FD_log_t *)_file;
     size_t        orig_size  = size; /* Save the original size for later */
     haddr_t       orig_addr  = addr;
-    H5_timer_t    read_timer = {{0}, {0}, {0}, FALSE}; /* Timer for read operation */
-    H5_timevals_t read_times;                          /* Elapsed time for read operation */
+    H5_timer_t    read_timer  = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, FALSE}; /* Timer */
+    H5_timevals_t read_times;        /* Elapsed time for read operation */
+    double        trace_start = 0.0; /* Start of the request, for the I/O trace */
 #ifndef H5_HAVE_PREADWRITE
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
@@ -1252,6 +1305,10 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
     }     /* end if */
 #endif    /* H5_HAVE_PREADWRITE */
 
+    /* Start timing the request for the I/O trace */
+    if (file->fa.flags & H5FD_LOG_TRACE)
+        trace_start = H5_get_time();
+
     /* Start timer for read operation */
     if (file->fa.flags & H5FD_LOG_TIME_READ) {
         H5_timer_init(&read_timer);
@@ -1322,6 +1379,10 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
     if (file->fa.flags & H5FD_LOG_TIME_READ)
         H5_timer_stop(&read_timer);
 
+    /* Record the request in the I/O trace */
+    if (file->fa.flags & H5FD_LOG_TRACE)
+        H5FD__log_trace_add(file, H5FD_LOG_TRACE_READ, type, orig_addr, orig_size, trace_start);
+
     /* Add to the number of reads, when tracking that */
     if (file->fa.flags & H5FD_LOG_NUM_READ)
         file->total_read_ops++;
@@ -1391,8 +1452,9 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     H5FD_log_t *  file        = (H5FD_log_t *)_file;
     size_t        orig_size   = size; /* Save the original size for later */
     haddr_t       orig_addr   = addr;
-    H5_timer_t    write_timer = {{0}, {0}, {0}, FALSE}; /* Timer for write operation */
-    H5_timevals_t write_times;                          /* Elapsed time for write operation */
+    H5_timer_t    write_timer = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, FALSE}; /* Timer */
+    H5_timevals_t write_times;       /* Elapsed time for write operation */
+    double        trace_start = 0.0; /* Start of the request, for the I/O trace */
 #ifndef H5_HAVE_PREADWRITE
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
@@ -1474,6 +1536,10 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     }     /* end if */
 #endif    /* H5_HAVE_PREADWRITE */
 
+    /* Start timing the request for the I/O trace */
+    if (file->fa.flags & H5FD_LOG_TRACE)
+        trace_start = H5_get_time();
+
     /* Start timer for write operation */
     if (file->fa.flags & H5FD_LOG_TIME_WRITE) {
         H5_timer_init(&write_timer);
@@ -1537,6 +1603,10 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     if (file->fa.flags & H5FD_LOG_TIME_WRITE)
         H5_timer_stop(&write_timer);
 
+    /* Record the request in the I/O trace */
+    if (file->fa.flags & H5FD_LOG_TRACE)
+        H5FD__log_trace_add(file, H5FD_LOG_TRACE_WRITE, type, orig_addr, orig_size, trace_start);
+
     /* Add to the number of writes, when tracking that */
     if (file->fa.flags & H5FD_LOG_NUM_WRITE)
         file->total_write_ops++;
@@ -1772,3 +1842,174 @@ H5FD__log_unlock(H5FD_t *_file)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_add
+ *
+ * Purpose:     Records a completed read or write, which started at time
+ *              START, in the I/O trace ring buffer and summary.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__log_trace_add(H5FD_log_t *file, unsigned op, H5FD_mem_t type, haddr_t addr, size_t size, double start)
+{
+    H5FD_log_trace_rec_t *  rec;
+    H5FD_log_trace_stats_t *stats;
+    double                  elapsed;
+    uint64_t                latency;
+    uint64_t                v;
+    unsigned                bucket = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(file->trace);
+    HDassert(op == H5FD_LOG_TRACE_READ || op == H5FD_LOG_TRACE_WRITE);
+
+    if (type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        type = H5FD_MEM_DEFAULT;
+
+    elapsed = H5_get_time() - start;
+    latency = elapsed > 0.0 ? (uint64_t)(elapsed * 1.0e9) : 0;
+    for (v = latency; v > 1 && bucket < H5FD_LOG_TRACE_NBUCKETS - 1; v >>= 1)
+        bucket++;
+
+    /* Update the summary */
+    stats = &file->trace_stats[op][type];
+    stats->count++;
+    stats->bytes += size;
+    if (size < H5FD_LOG_TRACE_SMALL_IO)
+        stats->small++;
+    if (addr == file->trace_next[op])
+        stats->sequential++;
+    stats->total_latency += latency;
+    if (latency > stats->max_latency)
+        stats->max_latency = latency;
+    stats->hist[bucket]++;
+    file->trace_next[op] = addr + size;
+
+    /* Record the request, overwriting the oldest once the ring is full */
+    rec          = &file->trace[file->trace_count % H5FD_LOG_TRACE_NRECORDS];
+    rec->start   = start > file->trace_t0 ? (uint64_t)((start - file->trace_t0) * 1.0e9) : 0;
+    rec->latency = latency;
+    rec->addr    = addr;
+    rec->size    = size;
+    rec->op      = (uint8_t)op;
+    rec->type    = (uint8_t)type;
+    file->trace_count++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__log_trace_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace_dump
+ *
+ * Purpose:     Writes the I/O trace summary to the log file as JSON, and
+ *              the requests in the ring buffer to "<logfile>.trace" in
+ *              the binary layout described in H5FDlog.h.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_trace_dump(H5FD_log_t *file)
+{
+    static const char *op_names[2] = {"read", "write"};
+    uint64_t           nrecs       = MIN(file->trace_count, H5FD_LOG_TRACE_NRECORDS);
+    uint64_t           first       = file->trace_count - nrecs;
+    char *             trace_name  = NULL;
+    FILE *             trace_fp    = NULL;
+    const char *       c;
+    unsigned           op;
+    uint64_t           u;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->trace);
+    HDassert(file->logfp);
+
+    /* Summary */
+    HDfprintf(file->logfp, "{\"file\": \"");
+    for (c = file->filename; *c; c++) {
+        if ('"' == *c || '\\' == *c)
+            HDfputc('\\', file->logfp);
+        HDfputc(*c, file->logfp);
+    }
+    HDfprintf(file->logfp, "\", \"requests\": %" PRIu64 ", \"dropped\": %" PRIu64 ", \"elapsed_s\": %f",
+              file->trace_count, first, H5_get_time() - file->trace_t0);
+    HDfprintf(file->logfp, ", \"small_io_bytes\": %d", H5FD_LOG_TRACE_SMALL_IO);
+    for (op = 0; op < 2; op++) {
+        hbool_t first_type = TRUE;
+        int     type;
+
+        HDfprintf(file->logfp, ",\n \"%s\": {", op_names[op]);
+        for (type = H5FD_MEM_DEFAULT; type < H5FD_MEM_NTYPES; type++) {
+            const H5FD_log_trace_stats_t *stats = &file->trace_stats[op][type];
+            unsigned                      bucket;
+
+            if (0 == stats->count)
+                continue;
+
+            HDfprintf(file->logfp,
+                      "%s\n  \"%s\": {\"count\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"small\": %" PRIu64
+                      ", \"sequential\": %" PRIu64 ", \"latency_ns_total\": %" PRIu64
+                      ", \"latency_ns_max\": %" PRIu64 ", \"histogram\": [",
+                      first_type ? "" : ",", flavors[type], stats->count, stats->bytes, stats->small,
+                      stats->sequential, stats->total_latency, stats->max_latency);
+            for (bucket = 0; bucket < H5FD_LOG_TRACE_NBUCKETS; bucket++)
+                HDfprintf(file->logfp, "%s%" PRIu64, bucket ? ", " : "", stats->hist[bucket]);
+            HDfprintf(file->logfp, "]}");
+            first_type = FALSE;
+        }
+        HDfprintf(file->logfp, "}");
+    }
+    HDfprintf(file->logfp, "}\n");
+
+    /* The requests themselves, when there is a log file to name them after */
+    if (file->fa.logfile) {
+        uint8_t  header[H5FD_LOG_TRACE_HEADER_SIZE];
+        uint8_t  record[H5FD_LOG_TRACE_RECORD_SIZE];
+        uint8_t *p;
+        size_t   name_len = HDstrlen(file->fa.logfile) + sizeof(".trace");
+
+        if (NULL == (trace_name = (char *)H5MM_malloc(name_len)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate trace file name")
+        HDsnprintf(trace_name, name_len, "%s.trace", file->fa.logfile);
+        if (NULL == (trace_fp = HDfopen(trace_name, "wb")))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to create trace file")
+
+        H5MM_memcpy(header, H5FD_LOG_TRACE_MAGIC, 8);
+        p = header + 8;
+        UINT64ENCODE(p, nrecs);
+        UINT64ENCODE(p, first);
+        if (1 != HDfwrite(header, sizeof(header), 1, trace_fp))
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write trace file")
+
+        for (u = first; u < file->trace_count; u++) {
+            const H5FD_log_trace_rec_t *rec = &file->trace[u % H5FD_LOG_TRACE_NRECORDS];
+
+            p = record;
+            UINT64ENCODE(p, rec->start);
+            UINT64ENCODE(p, rec->latency);
+            UINT64ENCODE(p, rec->addr);
+            UINT64ENCODE(p, rec->size);
+            *p++ = rec->op;
+            *p++ = rec->type;
+            if (1 != HDfwrite(record, sizeof(record), 1, trace_fp))
+                HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write trace file")
+        }
+    }
+
+done:
+    if (trace_fp && HDfclose(trace_fp) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close trace file")
+    H5MM_xfree(trace_name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_trace_dump() */
@@ -60,6 +60,39 @@
 #define H5FD_LOG_ALL                                                                                         \
     (H5FD_LOG_FREE | H5FD_LOG_ALLOC | H5FD_LOG_TIME_IO | H5FD_LOG_NUM_IO | H5FD_LOG_FLAVOR |                 \
      H5FD_LOG_FILE_IO | H5FD_LOG_LOC_IO | H5FD_LOG_META_IO)
+/* Flag for recording every read and write in a binary trace, summarized as
+ * JSON latency histograms in the log file when the file is closed.  Cheap
+ * enough to leave on, so not part of H5FD_LOG_ALL.
+ */
+#define H5FD_LOG_TRACE 0x00100000
+
+/* The trace keeps the most recent H5FD_LOG_TRACE_NRECORDS requests in a ring
+ * buffer and writes them at close to "<logfile>.trace" (only when a log file
+ * is named).  All integers in the trace are little-endian:
+ *
+ *  header:  "H5FDTRC1"    magic
+ *           uint64        number of records that follow
+ *           uint64        number of earlier requests dropped from the ring
+ *  record:  uint64        start of the request, in ns since the file was opened
+ *           uint64        latency, in ns
+ *           uint64        file address
+ *           uint64        size, in bytes
+ *           uint8         H5FD_LOG_TRACE_READ or H5FD_LOG_TRACE_WRITE
+ *           uint8         H5FD_mem_t type
+ *
+ * The summary counts requests smaller than H5FD_LOG_TRACE_SMALL_IO bytes as
+ * small, and those starting where the previous request of the same kind
+ * ended as sequential.  Histogram bucket i counts latencies of [2^i, 2^(i+1))
+ * ns, with the last bucket also counting anything longer.
+ */
+#define H5FD_LOG_TRACE_NRECORDS    (64 * 1024)
+#define H5FD_LOG_TRACE_MAGIC       "H5FDTRC1"
+#define H5FD_LOG_TRACE_HEADER_SIZE 24
+#define H5FD_LOG_TRACE_RECORD_SIZE 34
+#define H5FD_LOG_TRACE_READ        0
+#define H5FD_LOG_TRACE_WRITE       1
+#define H5FD_LOG_TRACE_SMALL_IO    4096
+#define H5FD_LOG_TRACE_NBUCKETS    32
 
 #ifdef __cplusplus
 extern "C" {
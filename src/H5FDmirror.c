@@ -36,13 +36,18 @@ static hid_t H5FD_MIRROR_g = 0;
 
 /* Virtual file structure for a Mirror Driver */
 typedef struct H5FD_mirror_t {
-    H5FD_t             pub;     /* Public stuff, must be first            */
-    H5FD_mirror_fapl_t fa;      /* Configuration structure                */
-    haddr_t            eoa;     /* End of allocated region                */
-    haddr_t            eof;     /* End of file; current file size         */
-    int                sock_fd; /* Handle of socket to remote operator    */
-    H5FD_mirror_xmit_t xmit;    /* Primary communication header           */
-    uint32_t           xmit_i;  /* Counter of transmission sent and rec'd */
+    H5FD_t             pub;          /* Public stuff, must be first            */
+    H5FD_mirror_fapl_t fa;           /* Configuration structure                */
+    haddr_t            eoa;          /* End of allocated region                */
+    haddr_t            eof;          /* End of file; current file size         */
+    int                sock_fd;      /* Handle of socket to remote operator    */
+    H5FD_mirror_xmit_t xmit;         /* Primary communication header           */
+    uint32_t           xmit_i;       /* Counter of transmission sent and rec'd */
+    unsigned char *    batch_buf;    /* BATCH xmit being assembled: header,    */
+                                     /* then entries and their data            */
+    size_t             batch_size;   /* Bytes of entries and data in batch_buf */
+    uint32_t           batch_count;  /* Number of entries in batch_buf         */
+    unsigned           acks_pending; /* BATCH xmits sent but not acknowledged  */
 } H5FD_mirror_t;
 
 /*
@@ -149,6 +154,7 @@ static haddr_t H5FD__mirror_get_eof(const H5FD_t *_file, H5FD_mem_t type);
 static H5FD_t *H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
 static herr_t  H5FD__mirror_close(H5FD_t *_file);
 static herr_t  H5FD__mirror_query(const H5FD_t *_file, unsigned long *flags);
+static herr_t  H5FD__mirror_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                   const void *buf);
 static herr_t  H5FD__mirror_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
@@ -157,7 +163,13 @@ static herr_t  H5FD__mirror_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closi
 static herr_t  H5FD__mirror_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__mirror_unlock(H5FD_t *_file);
 
+static herr_t H5FD__mirror_xmit_send(H5FD_mirror_t *file, const void *buf, size_t size);
+static herr_t H5FD__mirror_read_reply(H5FD_mirror_t *file, uint32_t xmit_count);
 static herr_t H5FD__mirror_verify_reply(H5FD_mirror_t *file);
+static herr_t H5FD__mirror_batch_send(H5FD_mirror_t *file, const void *data, size_t size);
+static herr_t H5FD__mirror_batch_add(H5FD_mirror_t *file, uint8_t op, H5FD_mem_t type, haddr_t addr,
+                                     size_t size, const void *buf);
+static herr_t H5FD__mirror_sync(H5FD_mirror_t *file);
 
 static const H5FD_class_t H5FD_mirror_g = {
     "mirror",               /* name                 */
@@ -187,7 +199,7 @@ static const H5FD_class_t H5FD_mirror_g = {
     NULL,                   /* get_handle           */
     H5FD__mirror_read,      /* read                 */
     H5FD__mirror_write,     /* write                */
-    NULL,                   /* flush                */
+    H5FD__mirror_flush,     /* flush                */
     H5FD__mirror_truncate,  /* truncate             */
     H5FD__mirror_lock,      /* lock                 */
     H5FD__mirror_unlock,    /* unlock               */
@@ -524,6 +536,71 @@ H5FD__mirror_xmit_encode_uint8(unsigned char *dest, uint8_t v)
     return 1;
 } /* end H5FD__mirror_xmit_encode_uint8() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_decode_batch
+ *
+ * Purpose:     Extract a mirror_xmit_batch_t from the bytes-buffer.
+ *
+ *              Fields will be lifted from the buffer and stored in the
+ *              target structure, using in the correct location (different
+ *              systems may insert different padding between components) and
+ *              word order (Big- vs Little-Endian).
+ *
+ *              The programmer must ensure that the received buffer holds
+ *              at least the expected size of data.
+ *
+ *              The resulting structure should be sanity-checked with
+ *              H5FD_mirror_xmit_is_batch() before use.
+ *
+ * Return:      The number of bytes consumed from the buffer.
+ * ---------------------------------------------------------------------------
+ */
+size_t
+H5FD_mirror_xmit_decode_batch(H5FD_mirror_xmit_batch_t *out, const unsigned char *buf)
+{
+    size_t n_eaten = 0;
+
+    LOG_OP_CALL(__func__);
+
+    HDassert(out && buf);
+
+    n_eaten += H5FD_mirror_xmit_decode_header(&(out->pub), buf);
+    n_eaten += H5FD__mirror_xmit_decode_uint32(&(out->count), &buf[n_eaten]);
+    n_eaten += H5FD__mirror_xmit_decode_uint64(&(out->size), &buf[n_eaten]);
+    HDassert(n_eaten == H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    return n_eaten;
+} /* end H5FD_mirror_xmit_decode_batch() */
+
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_decode_batch_entry
+ *
+ * Purpose:     Extract a mirror_batch_entry_t from the bytes-buffer.
+ *
+ *              The programmer must ensure that the received buffer holds
+ *              at least the expected size of data.
+ *
+ * Return:      The number of bytes consumed from the buffer.
+ * ---------------------------------------------------------------------------
+ */
+size_t
+H5FD_mirror_xmit_decode_batch_entry(H5FD_mirror_batch_entry_t *out, const unsigned char *buf)
+{
+    size_t n_eaten = 0;
+
+    LOG_OP_CALL(__func__);
+
+    HDassert(out && buf);
+
+    n_eaten += H5FD__mirror_xmit_decode_uint8(&(out->op), &buf[n_eaten]);
+    n_eaten += H5FD__mirror_xmit_decode_uint8(&(out->type), &buf[n_eaten]);
+    n_eaten += H5FD__mirror_xmit_decode_uint64(&(out->offset), &buf[n_eaten]);
+    n_eaten += H5FD__mirror_xmit_decode_uint64(&(out->size), &buf[n_eaten]);
+    HDassert(n_eaten == H5FD_MIRROR_BATCH_ENTRY_SIZE);
+
+    return n_eaten;
+} /* end H5FD_mirror_xmit_decode_batch_entry() */
+
 /* ---------------------------------------------------------------------------
  * Function:    H5FD_mirror_xmit_decode_header
  *
@@ -748,6 +825,66 @@ H5FD_mirror_xmit_decode_write(H5FD_mirror_xmit_write_t *out, const unsigned char
     return n_eaten;
 } /* end H5FD_mirror_xmit_decode_write() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_encode_batch
+ *
+ * Purpose:     Encode a mirror_xmit_batch_t to the bytes-buffer.
+ *
+ *              Fields will be packed into the buffer in a predictable manner,
+ *              any numbers stored in "network" (Big-Endian) word order.
+ *
+ *              The programmer must ensure that the destination buffer is
+ *              large enough to hold the expected data.
+ *
+ * Return:      The number of bytes written to the buffer.
+ * ---------------------------------------------------------------------------
+ */
+size_t
+H5FD_mirror_xmit_encode_batch(unsigned char *dest, const H5FD_mirror_xmit_batch_t *x)
+{
+    size_t n_writ = 0;
+
+    LOG_OP_CALL(__func__);
+
+    HDassert(dest && x);
+
+    n_writ += H5FD_mirror_xmit_encode_header(dest, (const H5FD_mirror_xmit_t *)&(x->pub));
+    n_writ += H5FD__mirror_xmit_encode_uint32(&dest[n_writ], x->count);
+    n_writ += H5FD__mirror_xmit_encode_uint64(&dest[n_writ], x->size);
+    HDassert(n_writ == H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    return n_writ;
+} /* end H5FD_mirror_xmit_encode_batch() */
+
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_encode_batch_entry
+ *
+ * Purpose:     Encode a mirror_batch_entry_t to the bytes-buffer.
+ *
+ *              The programmer must ensure that the destination buffer is
+ *              large enough to hold the expected data.
+ *
+ * Return:      The number of bytes written to the buffer.
+ * ---------------------------------------------------------------------------
+ */
+size_t
+H5FD_mirror_xmit_encode_batch_entry(unsigned char *dest, const H5FD_mirror_batch_entry_t *x)
+{
+    size_t n_writ = 0;
+
+    LOG_OP_CALL(__func__);
+
+    HDassert(dest && x);
+
+    n_writ += H5FD__mirror_xmit_encode_uint8(&dest[n_writ], x->op);
+    n_writ += H5FD__mirror_xmit_encode_uint8(&dest[n_writ], x->type);
+    n_writ += H5FD__mirror_xmit_encode_uint64(&dest[n_writ], x->offset);
+    n_writ += H5FD__mirror_xmit_encode_uint64(&dest[n_writ], x->size);
+    HDassert(n_writ == H5FD_MIRROR_BATCH_ENTRY_SIZE);
+
+    return n_writ;
+} /* end H5FD_mirror_xmit_encode_batch_entry() */
+
 /* ---------------------------------------------------------------------------
  * Function:    H5FD_mirror_xmit_encode_header
  *
@@ -944,6 +1081,29 @@ H5FD_mirror_xmit_encode_write(unsigned char *dest, const H5FD_mirror_xmit_write_
     return n_writ;
 } /* end H5FD_mirror_xmit_encode_write() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    H5FD_mirror_xmit_is_batch
+ *
+ * Purpose:     Verify that a mirror_xmit_batch_t is a valid BATCH xmit.
+ *
+ *              Checks header validity and op code.
+ *
+ * Return:      TRUE if valid; else FALSE.
+ * ---------------------------------------------------------------------------
+ */
+H5_ATTR_PURE hbool_t
+H5FD_mirror_xmit_is_batch(const H5FD_mirror_xmit_batch_t *xmit)
+{
+    LOG_OP_CALL(__func__);
+
+    HDassert(xmit);
+
+    if ((TRUE == H5FD_mirror_xmit_is_xmit(&(xmit->pub))) && (H5FD_MIRROR_OP_BATCH == xmit->pub.op))
+        return TRUE;
+
+    return FALSE;
+} /* end H5FD_mirror_xmit_is_batch() */
+
 /* ---------------------------------------------------------------------------
  * Function:    H5FD_mirror_xmit_is_close
  *
@@ -1107,10 +1267,49 @@ H5FD_mirror_xmit_is_xmit(const H5FD_mirror_xmit_t *xmit)
 } /* end H5FD_mirror_xmit_is_xmit() */
 
 /* ----------------------------------------------------------------------------
- * Function:    H5FD__mirror_verify_reply
+ * Function:    H5FD__mirror_xmit_send
+ *
+ * Purpose:     Write SIZE bytes from BUF to the socket, retrying partial
+ *              and interrupted writes.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_xmit_send(H5FD_mirror_t *file, const void *buf, size_t size)
+{
+    const unsigned char *p         = (const unsigned char *)buf;
+    herr_t               ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->sock_fd >= 0);
+    HDassert(buf || size == 0);
+
+    while (size > 0) {
+        ssize_t bytes_wrote;
+
+        bytes_wrote = HDwrite(file->sock_fd, p, size);
+        if (bytes_wrote < 0) {
+            if (EINTR == errno)
+                continue;
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit: %s", HDstrerror(errno));
+        }
+
+        p += bytes_wrote;
+        size -= (size_t)bytes_wrote;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_xmit_send() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_read_reply
  *
  * Purpose:     Wait for and read reply data from remote processes.
- *              Sanity-check that a reply is well-formed and valid.
+ *              Sanity-check that a reply is well-formed, valid, and answers
+ *              the transmission numbered XMIT_COUNT.
  *              If all checks pass, inspect the reply contents and handle
  *              reported error, if not an OK reply.
  *
@@ -1118,11 +1317,11 @@ H5FD_mirror_xmit_is_xmit(const H5FD_mirror_xmit_t *xmit)
  * ----------------------------------------------------------------------------
  */
 static herr_t
-H5FD__mirror_verify_reply(H5FD_mirror_t *file)
+H5FD__mirror_read_reply(H5FD_mirror_t *file, uint32_t xmit_count)
 {
     unsigned char *                 xmit_buf = NULL;
     struct H5FD_mirror_xmit_reply_t reply;
-    ssize_t                         read_ret  = 0;
+    size_t                          nread     = 0;
     herr_t                          ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -1135,13 +1334,23 @@ H5FD__mirror_verify_reply(H5FD_mirror_t *file)
     if (NULL == xmit_buf)
         HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate xmit buffer");
 
-    read_ret = HDread(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_REPLY_SIZE);
-    if (read_ret < 0)
-        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read reply");
-    if (read_ret != H5FD_MIRROR_XMIT_REPLY_SIZE)
-        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unexpected read size");
+    /* Replies to pipelined batches may arrive split or back to back; read
+     * exactly one.
+     */
+    while (nread < H5FD_MIRROR_XMIT_REPLY_SIZE) {
+        ssize_t read_ret = HDread(file->sock_fd, xmit_buf + nread, H5FD_MIRROR_XMIT_REPLY_SIZE - nread);
+
+        if (read_ret < 0) {
+            if (EINTR == errno)
+                continue;
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read reply");
+        }
+        if (read_ret == 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unexpected read size");
+        nread += (size_t)read_ret;
+    }
 
-    LOG_XMIT_BYTES("reply", xmit_buf, read_ret);
+    LOG_XMIT_BYTES("reply", xmit_buf, nread);
 
     if (H5FD_mirror_xmit_decode_reply(&reply, xmit_buf) != H5FD_MIRROR_XMIT_REPLY_SIZE)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "unable to decode reply xmit");
@@ -1151,7 +1360,7 @@ H5FD__mirror_verify_reply(H5FD_mirror_t *file)
 
     if (reply.pub.session_token != file->xmit.session_token)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "wrong session");
-    if (reply.pub.xmit_count != (file->xmit_i)++)
+    if (reply.pub.xmit_count != xmit_count)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "xmit out of sync");
     if (reply.status != H5FD_MIRROR_STATUS_OK)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "%s", (const char *)(reply.message));
@@ -1160,9 +1369,184 @@ done:
     if (xmit_buf)
         xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
 
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_read_reply() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_verify_reply
+ *
+ * Purpose:     Wait for and verify the reply to the transmission just sent.
+ *              No BATCH xmits may be awaiting acknowledgement.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_verify_reply(H5FD_mirror_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(0 == file->acks_pending);
+
+    if (H5FD__mirror_read_reply(file, (file->xmit_i)++) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
+
+done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* end H5FD__mirror_verify_reply() */
 
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_batch_send
+ *
+ * Purpose:     Transmit the batch assembled in the file's batch buffer as a
+ *              BATCH xmit, followed by SIZE bytes of DATA belonging to its
+ *              last entry, if any.
+ *
+ *              Does not wait for the batch to be acknowledged, unless the
+ *              window of unacknowledged batches is full, in which case the
+ *              oldest acknowledgement is awaited first.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_batch_send(H5FD_mirror_t *file, const void *data, size_t size)
+{
+    H5FD_mirror_xmit_batch_t xmit_batch;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file && file->batch_buf);
+    HDassert(file->batch_count > 0);
+
+    if (file->acks_pending >= H5FD_MIRROR_BATCH_WINDOW) {
+        if (H5FD__mirror_read_reply(file, file->xmit_i - file->acks_pending) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid batch acknowledgement");
+        file->acks_pending--;
+    }
+
+    file->xmit.xmit_count = (file->xmit_i)++;
+    file->xmit.op         = H5FD_MIRROR_OP_BATCH;
+
+    xmit_batch.pub   = file->xmit;
+    xmit_batch.count = file->batch_count;
+    xmit_batch.size  = (uint64_t)(file->batch_size + size);
+
+    /* The header goes in the space reserved for it at the front */
+    if (H5FD_mirror_xmit_encode_batch(file->batch_buf, &xmit_batch) != H5FD_MIRROR_XMIT_BATCH_SIZE)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode batch");
+
+    LOG_XMIT_BYTES("batch", file->batch_buf, H5FD_MIRROR_XMIT_BATCH_SIZE);
+
+    if (H5FD__mirror_xmit_send(file, file->batch_buf, H5FD_MIRROR_XMIT_BATCH_SIZE + file->batch_size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit batch");
+    if (size > 0 && H5FD__mirror_xmit_send(file, data, size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit data");
+
+    file->acks_pending++;
+    file->batch_size  = 0;
+    file->batch_count = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_batch_send() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_batch_add
+ *
+ * Purpose:     Add a WRITE (of SIZE bytes from BUF at ADDR) or SET_EOA (to
+ *              ADDR) entry to the batch being assembled, sending the batch
+ *              first if there is no room for it.
+ *
+ *              A write too large for the batch buffer is sent at once in a
+ *              batch of its own, straight from BUF.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_batch_add(H5FD_mirror_t *file, uint8_t op, H5FD_mem_t type, haddr_t addr, size_t size,
+                       const void *buf)
+{
+    H5FD_mirror_batch_entry_t entry;
+    const size_t              room      = H5FD_MIRROR_BATCH_BUFFER_MAX - H5FD_MIRROR_XMIT_BATCH_SIZE;
+    herr_t                    ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->batch_buf);
+    HDassert(H5FD_MIRROR_OP_WRITE == op || H5FD_MIRROR_OP_SET_EOA == op);
+    HDassert(buf || size == 0);
+
+    if (file->batch_count > 0 && file->batch_size + H5FD_MIRROR_BATCH_ENTRY_SIZE + size > room)
+        if (H5FD__mirror_batch_send(file, NULL, 0) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to send batch");
+
+    entry.op     = op;
+    entry.type   = (uint8_t)type;
+    entry.offset = (uint64_t)addr;
+    entry.size   = (uint64_t)size;
+
+    if (H5FD_mirror_xmit_encode_batch_entry(file->batch_buf + H5FD_MIRROR_XMIT_BATCH_SIZE + file->batch_size,
+                                            &entry) != H5FD_MIRROR_BATCH_ENTRY_SIZE)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode batch entry");
+    file->batch_size += H5FD_MIRROR_BATCH_ENTRY_SIZE;
+    file->batch_count++;
+
+    if (H5FD_MIRROR_BATCH_ENTRY_SIZE + size > room) {
+        /* Batch is otherwise empty: send the data without copying it */
+        if (H5FD__mirror_batch_send(file, buf, size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to send batch");
+    }
+    else if (size > 0) {
+        H5MM_memcpy(file->batch_buf + H5FD_MIRROR_XMIT_BATCH_SIZE + file->batch_size, buf, size);
+        file->batch_size += size;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_batch_add() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_sync
+ *
+ * Purpose:     Send any batch being assembled and wait for every outstanding
+ *              batch to be acknowledged, so that all writes so far have been
+ *              performed by the Writer.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_sync(H5FD_mirror_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    LOG_OP_CALL(FUNC);
+
+    HDassert(file);
+
+    if (file->batch_count > 0 && H5FD__mirror_batch_send(file, NULL, 0) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to send batch");
+
+    while (file->acks_pending > 0) {
+        if (H5FD__mirror_read_reply(file, file->xmit_i - file->acks_pending) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid batch acknowledgement");
+        file->acks_pending--;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5FD__mirror_sync() */
+
 /* -------------------------------------------------------------------------
  * Function:    H5FD__mirror_fapl_get
  *
@@ -1418,6 +1802,9 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     file->sock_fd = live_socket;
     file->xmit_i  = 0;
 
+    if (NULL == (file->batch_buf = (unsigned char *)H5MM_malloc(H5FD_MIRROR_BATCH_BUFFER_MAX)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate batch buffer");
+
     file->xmit.magic         = H5FD_MIRROR_XMIT_MAGIC;
     file->xmit.version       = H5FD_MIRROR_XMIT_CURR_VERSION;
     file->xmit.xmit_count    = file->xmit_i++;
@@ -1454,8 +1841,10 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
 
 done:
     if (NULL == ret_value) {
-        if (file)
+        if (file) {
+            H5MM_xfree(file->batch_buf);
             file = H5FL_FREE(H5FD_mirror_t, file);
+        }
         if (live_socket >= 0 && HDclose(live_socket) < 0)
             HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "can't close socket");
     }
@@ -1499,6 +1888,9 @@ H5FD__mirror_close(H5FD_t *_file)
     HDassert(file);
     HDassert(file->sock_fd >= 0);
 
+    if (H5FD__mirror_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete outstanding writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_CLOSE;
 
@@ -1544,6 +1936,7 @@ done:
                 HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close socket");
     } /* end if error */
 
+    H5MM_xfree(file->batch_buf);
     file = H5FL_FREE(H5FD_mirror_t, file); /* always release resources */
 
     if (xmit_buf)
@@ -1616,16 +2009,16 @@ H5FD__mirror_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
  *              called shortly after an existing HDF5 file is opened in order
  *              to tell the driver where the end of the HDF5 data is located.
  *
+ *              The new EOA is added to the current batch for the Writer.
+ *
  * Return:      SUCCEED / FAIL
  *-------------------------------------------------------------------------
  */
 static herr_t
 H5FD__mirror_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 {
-    H5FD_mirror_xmit_eoa_t xmit_eoa;
-    unsigned char *        xmit_buf  = NULL;
-    H5FD_mirror_t *        file      = (H5FD_mirror_t *)_file;
-    herr_t                 ret_value = SUCCEED;
+    H5FD_mirror_t *file      = (H5FD_mirror_t *)_file;
+    herr_t         ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
 
@@ -1635,32 +2028,10 @@ H5FD__mirror_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 
     file->eoa = addr; /* local copy */
 
-    file->xmit.xmit_count = (file->xmit_i)++;
-    file->xmit.op         = H5FD_MIRROR_OP_SET_EOA;
-
-    xmit_eoa.pub      = file->xmit;
-    xmit_eoa.type     = (uint8_t)type;
-    xmit_eoa.eoa_addr = (uint64_t)addr;
-
-    xmit_buf = H5FL_BLK_MALLOC(xmit, H5FD_MIRROR_XMIT_BUFFER_MAX);
-    if (NULL == xmit_buf)
-        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate xmit buffer");
-
-    if (H5FD_mirror_xmit_encode_set_eoa(xmit_buf, &xmit_eoa) != H5FD_MIRROR_XMIT_EOA_SIZE)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode set-eoa");
-
-    LOG_XMIT_BYTES("set-eoa", xmit_buf, H5FD_MIRROR_XMIT_EOA_SIZE);
-
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_EOA_SIZE) < 0)
+    if (H5FD__mirror_batch_add(file, H5FD_MIRROR_OP_SET_EOA, type, addr, 0, NULL) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit set-eoa");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
-
 done:
-    if (xmit_buf)
-        xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__mirror_set_eoa() */
 
@@ -1717,12 +2088,10 @@ H5FD__mirror_read(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type,
  *              from buffer BUF according to data transfer properties in
  *              DXPL_ID.
  *
- *              Send metadata regarding the write (location, size) to the
- *              remote Writer, then separately transmits the data.
- *              Both transmission expect an OK reply from the Writer.
- *              This two-exchange approach incurs significant overhead,
- *              but is a simple and modular approach.
- *              Start optimizations here.
+ *              The write is added to the current batch for the Writer, and
+ *              reaches it when the batch fills or the file is flushed,
+ *              truncated or closed.  Failures on the Writer's side are
+ *              reported when the batch is acknowledged.
  *
  * Return:      SUCCEED/FAIL
  *-------------------------------------------------------------------------
@@ -1731,10 +2100,8 @@ static herr_t
 H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr, size_t size,
                    const void *buf)
 {
-    H5FD_mirror_xmit_write_t xmit_write;
-    unsigned char *          xmit_buf  = NULL;
-    H5FD_mirror_t *          file      = (H5FD_mirror_t *)_file;
-    herr_t                   ret_value = SUCCEED;
+    H5FD_mirror_t *file      = (H5FD_mirror_t *)_file;
+    herr_t         ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
 
@@ -1743,45 +2110,40 @@ H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
     HDassert(file);
     HDassert(buf);
 
-    file->xmit.xmit_count = (file->xmit_i)++;
-    file->xmit.op         = H5FD_MIRROR_OP_WRITE;
-
-    xmit_write.pub    = file->xmit;
-    xmit_write.size   = (uint64_t)size;
-    xmit_write.offset = (uint64_t)addr;
-    xmit_write.type   = (uint8_t)type;
-
-    xmit_buf = H5FL_BLK_MALLOC(xmit, H5FD_MIRROR_XMIT_BUFFER_MAX);
-    if (NULL == xmit_buf)
-        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate xmit buffer");
+    if (H5FD__mirror_batch_add(file, H5FD_MIRROR_OP_WRITE, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit write");
 
-    /* Notify Writer of incoming data to write. */
-    if (H5FD_mirror_xmit_encode_write(xmit_buf, &xmit_write) != H5FD_MIRROR_XMIT_WRITE_SIZE)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode write");
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_write() */
 
-    LOG_XMIT_BYTES("write", xmit_buf, H5FD_MIRROR_XMIT_WRITE_SIZE);
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mirror_flush
+ *
+ * Purpose:     Sends any pending writes to the Writer and waits until it
+ *              has performed all of them.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_mirror_t *file      = (H5FD_mirror_t *)_file;
+    herr_t         ret_value = SUCCEED;
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_WRITE_SIZE) < 0)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit write");
+    FUNC_ENTER_STATIC
 
-    /* Check that our write xmission was received */
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
+    LOG_OP_CALL(FUNC);
 
-    /* Send the data to be written */
-    if (HDwrite(file->sock_fd, buf, size) < 0)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit data");
+    HDassert(file);
 
-    /* Writer should reply that it got the data and is still okay/ready */
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
+    if (H5FD__mirror_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete outstanding writes");
 
 done:
-    if (xmit_buf)
-        xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
-
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FD__mirror_write() */
+} /* end H5FD__mirror_flush() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mirror_truncate
@@ -1803,6 +2165,9 @@ H5FD__mirror_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_AT
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete outstanding writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_TRUNCATE;
 
@@ -1851,6 +2216,9 @@ H5FD__mirror_lock(H5FD_t *_file, hbool_t rw)
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete outstanding writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_LOCK;
 
@@ -1898,6 +2266,9 @@ H5FD__mirror_unlock(H5FD_t *_file)
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_sync(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to complete outstanding writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_UNLOCK;
 
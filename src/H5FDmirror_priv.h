@@ -33,7 +33,17 @@ extern "C" {
  * steps by the Writer. */
 #define H5FD_MIRROR_DATA_BUFFER_MAX H5_GB /* 1 Gigabyte */
 
-#define H5FD_MIRROR_XMIT_CURR_VERSION 1
+/* Writes and EOA updates are collected by the VFD into a BATCH xmit of
+ * up to this many bytes of entries and data before being sent.  A larger
+ * write is sent alone in a batch of its own. */
+#define H5FD_MIRROR_BATCH_BUFFER_MAX (1024 * 1024)
+
+/* Number of BATCH xmits the VFD may send before waiting for the
+ * Writer to acknowledge the oldest one.  All outstanding batches are
+ * acknowledged before flush, truncate, lock, unlock and close complete. */
+#define H5FD_MIRROR_BATCH_WINDOW 16
+
+#define H5FD_MIRROR_XMIT_CURR_VERSION 2
 #define H5FD_MIRROR_XMIT_MAGIC        0x87F8005B
 
 #define H5FD_MIRROR_OP_OPEN     1
@@ -44,6 +54,7 @@ extern "C" {
 #define H5FD_MIRROR_OP_SET_EOA  6
 #define H5FD_MIRROR_OP_LOCK     7
 #define H5FD_MIRROR_OP_UNLOCK   8
+#define H5FD_MIRROR_OP_BATCH    9
 
 #define H5FD_MIRROR_STATUS_OK          0
 #define H5FD_MIRROR_STATUS_ERROR       1
@@ -65,11 +76,14 @@ extern "C" {
 #define H5FD_MIRROR_XMIT_OPEN_SIZE   (H5FD_MIRROR_XMIT_HEADER_SIZE + 20 + H5FD_MIRROR_XMIT_FILEPATH_MAX)
 #define H5FD_MIRROR_XMIT_REPLY_SIZE  (H5FD_MIRROR_XMIT_HEADER_SIZE + 4 + H5FD_MIRROR_STATUS_MESSAGE_MAX)
 #define H5FD_MIRROR_XMIT_WRITE_SIZE  (H5FD_MIRROR_XMIT_HEADER_SIZE + 17)
+#define H5FD_MIRROR_XMIT_BATCH_SIZE  (H5FD_MIRROR_XMIT_HEADER_SIZE + 12)
+#define H5FD_MIRROR_BATCH_ENTRY_SIZE 18
 
 /* Maximum length of any xmit. */
 #define H5FD_MIRROR_XMIT_BUFFER_MAX                                                                          \
-    MAX2(MAX3(H5FD_MIRROR_XMIT_HEADER_SIZE, H5FD_MIRROR_XMIT_EOA_SIZE, H5FD_MIRROR_XMIT_LOCK_SIZE),          \
-         MAX3(H5FD_MIRROR_XMIT_OPEN_SIZE, H5FD_MIRROR_XMIT_REPLY_SIZE, H5FD_MIRROR_XMIT_WRITE_SIZE))
+    MAX3(MAX3(H5FD_MIRROR_XMIT_HEADER_SIZE, H5FD_MIRROR_XMIT_EOA_SIZE, H5FD_MIRROR_XMIT_LOCK_SIZE),          \
+         MAX3(H5FD_MIRROR_XMIT_OPEN_SIZE, H5FD_MIRROR_XMIT_REPLY_SIZE, H5FD_MIRROR_XMIT_WRITE_SIZE),         \
+         H5FD_MIRROR_XMIT_BATCH_SIZE)
 
 /* ---------------------------------------------------------------------------
  * Structure:   H5FD_mirror_xmit_t
@@ -267,6 +281,65 @@ typedef struct H5FD_mirror_xmit_write_t {
     uint64_t           size;
 } H5FD_mirror_xmit_write_t;
 
+/* ---------------------------------------------------------------------------
+ * Structure:   H5FD_mirror_xmit_batch_t
+ *
+ * Structure containing the description of a batch of writes and EOA
+ * updates from the VFD sender.
+ *
+ * The batch is followed on the wire by `count` entries, each an encoded
+ * H5FD_mirror_batch_entry_t immediately followed by the data to write, if
+ * any.  The Writer performs the entries in order and then acknowledges the
+ * whole batch with a single reply, which carries the xmit_count of the batch.
+ * Acknowledging does not advance the session's xmit count; the VFD may send
+ * further batches before the acknowledgement arrives.
+ *
+ * `pub` (H5FD_mirror_xmit_t)
+ *      Common transmission header, containing session information.
+ *      Must be first.
+ *
+ * `count` (uint32_t)
+ *      Number of entries in the batch.
+ *
+ * `size` (uint64_t)
+ *      Total size of the entries and their data, in bytes.
+ *
+ * ---------------------------------------------------------------------------
+ */
+typedef struct H5FD_mirror_xmit_batch_t {
+    H5FD_mirror_xmit_t pub;
+    uint32_t           count;
+    uint64_t           size;
+} H5FD_mirror_xmit_batch_t;
+
+/* ---------------------------------------------------------------------------
+ * Structure:   H5FD_mirror_batch_entry_t
+ *
+ * One operation in a BATCH xmit.
+ *
+ * `op` (uint8_t)
+ *      H5FD_MIRROR_OP_WRITE or H5FD_MIRROR_OP_SET_EOA.
+ *
+ * `type` (uint8_t)
+ *      System-independent alias for H5F[D]_mem_t.
+ *
+ * `offset` (uint64_t)
+ *      Start location of a write in the file, or the new EOA.
+ *      (Natively 'haddr_t', always a 64-bit field)
+ *
+ * `size` (uint64_t)
+ *      Size of the data of a write, in bytes; zero for an EOA update.
+ *      (Natively 'size_t', accommodate the largest possible as 64-bits)
+ *
+ * ---------------------------------------------------------------------------
+ */
+typedef struct H5FD_mirror_batch_entry_t {
+    uint8_t  op;
+    uint8_t  type;
+    uint64_t offset;
+    uint64_t size;
+} H5FD_mirror_batch_entry_t;
+
 /* Encode/decode routines are required to "pack" the xmit data into a known
  * byte format for transmission over the wire.
  *
@@ -286,6 +359,8 @@ H5_DLL size_t H5FD__mirror_xmit_encode_uint32(unsigned char *dest, uint32_t v);
 H5_DLL size_t H5FD__mirror_xmit_encode_uint64(unsigned char *dest, uint64_t v);
 H5_DLL size_t H5FD__mirror_xmit_encode_uint8(unsigned char *dest, uint8_t v);
 
+H5_DLL size_t H5FD_mirror_xmit_decode_batch(H5FD_mirror_xmit_batch_t *out, const unsigned char *buf);
+H5_DLL size_t H5FD_mirror_xmit_decode_batch_entry(H5FD_mirror_batch_entry_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_header(H5FD_mirror_xmit_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_lock(H5FD_mirror_xmit_lock_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_open(H5FD_mirror_xmit_open_t *out, const unsigned char *buf);
@@ -293,6 +368,8 @@ H5_DLL size_t H5FD_mirror_xmit_decode_reply(H5FD_mirror_xmit_reply_t *out, const
 H5_DLL size_t H5FD_mirror_xmit_decode_set_eoa(H5FD_mirror_xmit_eoa_t *out, const unsigned char *buf);
 H5_DLL size_t H5FD_mirror_xmit_decode_write(H5FD_mirror_xmit_write_t *out, const unsigned char *buf);
 
+H5_DLL size_t H5FD_mirror_xmit_encode_batch(unsigned char *dest, const H5FD_mirror_xmit_batch_t *x);
+H5_DLL size_t H5FD_mirror_xmit_encode_batch_entry(unsigned char *dest, const H5FD_mirror_batch_entry_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_header(unsigned char *dest, const H5FD_mirror_xmit_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_lock(unsigned char *dest, const H5FD_mirror_xmit_lock_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_open(unsigned char *dest, const H5FD_mirror_xmit_open_t *x);
@@ -300,6 +377,7 @@ H5_DLL size_t H5FD_mirror_xmit_encode_reply(unsigned char *dest, const H5FD_mirr
 H5_DLL size_t H5FD_mirror_xmit_encode_set_eoa(unsigned char *dest, const H5FD_mirror_xmit_eoa_t *x);
 H5_DLL size_t H5FD_mirror_xmit_encode_write(unsigned char *dest, const H5FD_mirror_xmit_write_t *x);
 
+H5_DLL hbool_t H5FD_mirror_xmit_is_batch(const H5FD_mirror_xmit_batch_t *xmit);
 H5_DLL hbool_t H5FD_mirror_xmit_is_close(const H5FD_mirror_xmit_t *xmit);
 H5_DLL hbool_t H5FD_mirror_xmit_is_lock(const H5FD_mirror_xmit_lock_t *xmit);
 H5_DLL hbool_t H5FD_mirror_xmit_is_open(const H5FD_mirror_xmit_open_t *xmit);
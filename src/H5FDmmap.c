@@ -0,0 +1,882 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A read-only file driver which maps the whole file into memory
+ *          with mmap().  Reads are served by copying out of the mapping,
+ *          and since the mapping stays put until the file is closed the
+ *          driver also lends out pointers into it (H5FD_FEAT_MEMORY_IMAGE),
+ *          which lets the metadata cache deserialize entries and the
+ *          contiguous dataset code copy raw data straight from the page
+ *          cache, without an intermediate read buffer.
+ *
+ *          The driver watches the pattern of accesses and passes it on to
+ *          the kernel with posix_madvise(): long sequential runs get the
+ *          pages ahead of them prefetched, and scattered accesses turn
+ *          off the kernel's own read-ahead.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+#define H5F_FRIEND           /* Suppress error about including H5Fpkg            */
+#define H5FD_FRIEND          /* Suppress error about including H5FDpkg           */
+#define H5FD_TESTING         /* Suppress warning about H5FD testing funcs        */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fpkg.h"      /* File access              */
+#include "H5FDpkg.h"     /* File drivers             */
+#include "H5FDmmap.h"    /* Memory-mapped file driver */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+#include "H5VLprivate.h" /* Virtual Object Layer     */
+
+#ifdef H5_HAVE_MMAP
+
+#include <sys/mman.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_MMAP_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Bytes read sequentially before the driver starts prefetching ahead */
+#define H5FD_MMAP_SEQ_THRESHOLD (256 * 1024)
+
+/* Initial and maximum sizes of the prefetch window */
+#define H5FD_MMAP_RA_MIN (1024 * 1024)
+#define H5FD_MMAP_RA_MAX (16 * 1024 * 1024)
+
+/* Consecutive non-sequential accesses before read-ahead is turned off */
+#define H5FD_MMAP_RANDOM_THRESHOLD 32
+
+/* The description of a file belonging to this driver.  The whole file, as
+ * it was when opened, is mapped at 'base'; an empty file has no mapping.
+ * The remaining fields track the access pattern for the madvise() hints:
+ * 'last_end' is the end of the previous access, 'seq_bytes' the length of
+ * the current sequential run and 'nrandom' the number of non-sequential
+ * accesses in a row.  'ra_end' is the end of the region most recently
+ * advised as needed soon and 'ra_window' the size of the next one.
+ */
+typedef struct H5FD_mmap_t {
+    H5FD_t         pub;       /* public stuff, must be first      */
+    int            fd;        /* the filesystem file descriptor   */
+    haddr_t        eoa;       /* end of allocated region          */
+    haddr_t        eof;       /* end of file; current file size   */
+    unsigned char *base;      /* start of the mapping             */
+    size_t         map_size;  /* size of the mapping              */
+    size_t         page_size; /* system page size                 */
+    haddr_t        last_end;  /* end of the previous access       */
+    size_t         seq_bytes; /* bytes in the current sequential run */
+    unsigned       nrandom;   /* # of non-sequential accesses in a row */
+    int            advice;    /* current advice for the whole mapping */
+    haddr_t        ra_end;    /* end of the prefetched region     */
+    size_t         ra_window; /* size of the next prefetch window */
+    hbool_t        ignore_disabled_file_locks;
+    char           filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    dev_t          device;                          /* file device number   */
+    ino_t          inode;                           /* file i-node number   */
+} H5FD_mmap_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t      H5FD__mmap_term(void);
+static H5FD_t *    H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t      H5FD__mmap_close(H5FD_t *_file);
+static int         H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t      H5FD__mmap_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t     H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t      H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t     H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t      H5FD__mmap_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t      H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   void *buf);
+static herr_t      H5FD__mmap_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                    const void *buf);
+static herr_t      H5FD__mmap_lock(H5FD_t *_file, hbool_t rw);
+static herr_t      H5FD__mmap_unlock(H5FD_t *_file);
+static const void *H5FD__mmap_get_mem_image(H5FD_t *_file, haddr_t addr, size_t size);
+static void        H5FD__mmap_advise(H5FD_mmap_t *file, haddr_t addr, size_t size);
+
+static const H5FD_class_mem_t H5FD_mmap_g = {
+    {
+        /* Start of superclass information */
+        "mmap",                /* name                 */
+        MAXADDR,               /* maxaddr              */
+        H5F_CLOSE_WEAK,        /* fc_degree            */
+        H5FD__mmap_term,       /* terminate            */
+        NULL,                  /* sb_size              */
+        NULL,                  /* sb_encode            */
+        NULL,                  /* sb_decode            */
+        0,                     /* fapl_size            */
+        NULL,                  /* fapl_get             */
+        NULL,                  /* fapl_copy            */
+        NULL,                  /* fapl_free            */
+        0,                     /* dxpl_size            */
+        NULL,                  /* dxpl_copy            */
+        NULL,                  /* dxpl_free            */
+        H5FD__mmap_open,       /* open                 */
+        H5FD__mmap_close,      /* close                */
+        H5FD__mmap_cmp,        /* cmp                  */
+        H5FD__mmap_query,      /* query                */
+        NULL,                  /* get_type_map         */
+        NULL,                  /* alloc                */
+        NULL,                  /* free                 */
+        H5FD__mmap_get_eoa,    /* get_eoa              */
+        H5FD__mmap_set_eoa,    /* set_eoa              */
+        H5FD__mmap_get_eof,    /* get_eof              */
+        H5FD__mmap_get_handle, /* get_handle           */
+        H5FD__mmap_read,       /* read                 */
+        H5FD__mmap_write,      /* write                */
+        NULL,                  /* flush                */
+        NULL,                  /* truncate             */
+        H5FD__mmap_lock,       /* lock                 */
+        H5FD__mmap_unlock,     /* unlock               */
+        H5FD_FLMAP_DICHOTOMY   /* fl_map               */
+    },                         /* End of superclass information */
+    H5FD__mmap_get_mem_image   /* get_mem_image        */
+};
+
+/* Declare a free list to manage the H5FD_mmap_t struct */
+H5FL_DEFINE_STATIC(H5FD_mmap_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_mmap_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize mmap VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the mmap driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_mmap_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_MMAP_g))
+        H5FD_MMAP_g =
+            H5FD_register((const H5FD_class_t *)&H5FD_mmap_g, sizeof(H5FD_class_mem_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_MMAP_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__mmap_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_MMAP_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_mmap
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_MMAP
+ *              driver defined in this source file.  There are no driver
+ *              specific properties.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mmap(hid_t fapl_id)
+{
+    H5P_genplist_t *plist; /* Property list pointer */
+    herr_t          ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", fapl_id);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    ret_value = H5P_set_driver(plist, H5FD_MMAP, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_open
+ *
+ * Purpose:     Opens an existing HDF5 file read-only and maps it into
+ *              memory.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_mmap_t *   file = NULL; /* mmap VFD info            */
+    int             fd   = -1;   /* File descriptor          */
+    void *          base = NULL; /* Start of the mapping     */
+    h5_stat_t       sb;
+    H5P_genplist_t *plist;            /* Property list pointer */
+    H5FD_t *        ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+    if (flags & (H5F_ACC_RDWR | H5F_ACC_TRUNC | H5F_ACC_CREAT | H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "mmap driver only supports read-only access")
+
+    /* Open the file */
+    if ((fd = HDopen(name, O_RDONLY, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL,
+                    "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x", name,
+                    myerrno, HDstrerror(myerrno), flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+    if ((uint64_t)sb.st_size > (uint64_t)SIZE_MAX)
+        HGOTO_ERROR(H5E_FILE, H5E_OVERFLOW, NULL, "file is too large to map")
+
+    /* Map the whole file */
+    if (sb.st_size > 0)
+        if (MAP_FAILED == (base = HDmmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_SHARED, fd, (HDoff_t)0)))
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to map file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_mmap_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->base      = (unsigned char *)base;
+    file->map_size  = (size_t)sb.st_size;
+    file->page_size = (size_t)HDsysconf(_SC_PAGESIZE);
+    file->last_end  = HADDR_UNDEF;
+    file->advice    = POSIX_MADV_NORMAL;
+    file->ra_window = H5FD_MMAP_RA_MIN;
+    file->device    = sb.st_dev;
+    file->inode     = sb.st_ino;
+
+    /* Get the FAPL */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (base && MAP_FAILED != base)
+            HDmunmap(base, (size_t)sb.st_size);
+        if (fd >= 0)
+            HDclose(fd);
+        if (file)
+            file = H5FL_FREE(H5FD_mmap_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_close
+ *
+ * Purpose:     Unmaps and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_close(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Release the mapping */
+    if (file->base && HDmunmap(file->base, file->map_size) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to unmap file")
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_mmap_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_mmap_t *f1        = (const H5FD_mmap_t *)_f1;
+    const H5FD_mmap_t *f2        = (const H5FD_mmap_t *)_f2;
+    int                ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Metadata accumulation and data sieving are left off: both
+ *              would only add a copy on top of the one out of the mapping.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_MEMORY_IMAGE;        /* Lends out pointers into the file's memory image */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    }                                               /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__mmap_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              file when it was opened.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              filesystem file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__mmap_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD__mmap_get_handle
+ *
+ * Purpose:        Returns the file handle of mmap file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_advise
+ *
+ * Purpose:     Update the access pattern statistics with an access of
+ *              SIZE bytes at ADDR and pass any resulting hints on to the
+ *              kernel.
+ *
+ *              An access that starts where the previous one ended extends
+ *              the current sequential run.  Once a run is long enough,
+ *              the pages ahead of it are advised as needed soon, in a
+ *              window which doubles (up to a limit) each time the reads
+ *              catch up with it.  A string of non-sequential accesses
+ *              instead advises the whole mapping as randomly accessed,
+ *              which keeps the kernel from reading ahead pages that won't
+ *              be used.
+ *
+ *              The hints are advisory only, so failures are ignored.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__mmap_advise(H5FD_mmap_t *file, haddr_t addr, size_t size)
+{
+    haddr_t end = addr + size;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    /* Nothing to advise for an empty file */
+    if (file->base) {
+        if (addr == file->last_end) {
+            file->seq_bytes += size;
+            file->nrandom = 0;
+
+            /* Re-enable read-ahead once a sequential run shows up */
+            if (POSIX_MADV_RANDOM == file->advice && file->seq_bytes >= H5FD_MMAP_SEQ_THRESHOLD) {
+                (void)HDposix_madvise(file->base, file->map_size, POSIX_MADV_NORMAL);
+                file->advice = POSIX_MADV_NORMAL;
+            } /* end if */
+
+            /* Prefetch the next window once the reads get within half a
+             * window of the end of the previous one
+             */
+            if (file->seq_bytes >= H5FD_MMAP_SEQ_THRESHOLD && end < file->map_size &&
+                end + file->ra_window / 2 >= file->ra_end) {
+                haddr_t start = MAX(end, file->ra_end);
+
+                if (start < file->map_size) {
+                    size_t len     = MIN(file->ra_window, (size_t)(file->map_size - start));
+                    size_t aligned = (size_t)start & ~(file->page_size - 1);
+
+                    (void)HDposix_madvise(file->base + aligned, len + ((size_t)start - aligned),
+                                          POSIX_MADV_WILLNEED);
+                    file->ra_end    = start + len;
+                    file->ra_window = MIN(2 * file->ra_window, H5FD_MMAP_RA_MAX);
+                } /* end if */
+            }     /* end if */
+        }         /* end if */
+        else {
+            file->seq_bytes = size;
+            file->ra_end    = 0;
+            file->ra_window = H5FD_MMAP_RA_MIN;
+
+            if (++file->nrandom >= H5FD_MMAP_RANDOM_THRESHOLD && POSIX_MADV_RANDOM != file->advice) {
+                (void)HDposix_madvise(file->base, file->map_size, POSIX_MADV_RANDOM);
+                file->advice = POSIX_MADV_RANDOM;
+            } /* end if */
+        }     /* end else */
+
+        file->last_end = end;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__mmap_advise() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_mem_image
+ *
+ * Purpose:     Returns a pointer to SIZE bytes at ADDR in the mapping.
+ *
+ * Return:      Success:    Pointer into the mapping
+ *              Failure:    NULL, if the range isn't entirely mapped
+ *
+ *-------------------------------------------------------------------------
+ */
+static const void *
+H5FD__mmap_get_mem_image(H5FD_t *_file, haddr_t addr, size_t size)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    const void * ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file && file->pub.cls);
+
+    if (H5F_addr_defined(addr) && !REGION_OVERFLOW(addr, size) && (addr + size) <= file->map_size) {
+        H5FD__mmap_advise(file, addr, size);
+        ret_value = file->base + addr;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_get_mem_image() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_advice_test
+ *
+ * Purpose:     Retrieves the advice currently given to the kernel for the
+ *              whole mapping of the file FILE_ID, which must use the mmap
+ *              driver.
+ *
+ *              This function is only intended for use in the test code.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD__mmap_get_advice_test(hid_t file_id, int *advice)
+{
+    H5F_t *      f;                   /* File info */
+    H5FD_mmap_t *file;                /* Driver info */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    if (NULL == (f = (H5F_t *)H5VL_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file")
+    if (H5FD_MMAP_g != f->shared->lf->driver_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file doesn't use the mmap driver")
+    file = (H5FD_mmap_t *)f->shared->lf;
+
+    *advice = file->advice;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_get_advice_test() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF, copying them out of the mapping.  Bytes
+ *              past the end of the file are returned as zeros.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                size_t size, void *buf /*out*/)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    H5FD__mmap_advise(file, addr, size);
+
+    /* Copy the part of the request which is in the file */
+    if (addr < file->map_size) {
+        size_t nbytes = MIN(size, (size_t)(file->map_size - addr));
+
+        H5MM_memcpy(buf, file->base + addr, nbytes);
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    } /* end if */
+
+    /* End of file but not end of format address space */
+    if (size > 0)
+        HDmemset(buf, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_write
+ *
+ * Purpose:     Fails; the mmap driver is read-only.
+ *
+ * Return:      FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                 haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    herr_t ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "mmap driver is read-only")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    int          lock_flags;                  /* file locking flags       */
+    herr_t       ret_value = SUCCEED;         /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_unlock(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    herr_t       ret_value = SUCCEED;              /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_unlock() */
+
+#endif /* H5_HAVE_MMAP */
@@ -50,6 +50,29 @@ hbool_t H5FD_mpi_opt_types_g = TRUE;
  */
 static char H5FD_mpi_native_g[] = "native";
 
+/* Defaults for aggregated independent writes (see H5F_MPIO_AGGREGATE_KEY) */
+#define H5FD_MPIO_AGG_STRIPE_DEFAULT (1024 * 1024)
+#define H5FD_MPIO_AGG_BUFFER_DEFAULT (64 * 1024 * 1024)
+
+/* Largest single MPI write issued for aggregated data, which also bounds
+ * the buffer and the stripe size so the exchanges fit in int counts */
+#define H5FD_MPIO_AGG_WRITE_MAX (1024 * 1024 * 1024)
+
+/* Smallest stripe size and most writes held back by one process */
+#define H5FD_MPIO_AGG_STRIPE_MIN  4096
+#define H5FD_MPIO_AGG_MAX_EXTENTS (1024 * 1024)
+
+/*
+ * A raw data write held back for aggregation.  BUF_OFF locates the data in
+ * the buffer of held back writes; when exchanged with an aggregator it is
+ * relative to the data sent to that aggregator instead.
+ */
+typedef struct H5FD_mpio_agg_extent_t {
+    haddr_t addr;    /* File address of the write                    */
+    size_t  size;    /* Number of bytes written                      */
+    size_t  buf_off; /* Offset of the data in the buffer             */
+} H5FD_mpio_agg_extent_t;
+
 /*
  * The description of a file belonging to this driver.
  * The EOF value is only used just after the file is opened in order for the
@@ -67,6 +90,20 @@ typedef struct H5FD_mpio_t {
     haddr_t  eoa;       /* End-of-address marker                        */
     haddr_t  last_eoa;  /* Last known end-of-address marker             */
     haddr_t  local_eof; /* Local end-of-file address for each process   */
+
+    /* Aggregated independent writes (agg_count is 0 when disabled) */
+    int                     agg_count;     /* Number of aggregator processes               */
+    int *                   agg_ranks;     /* Ranks of the aggregators, in rank order      */
+    hsize_t                 agg_stripe;    /* Size of the file domains of the aggregators  */
+    size_t                  agg_buf_max;   /* Bytes held back before writing directly      */
+    H5FD_mpio_agg_extent_t *agg_extents;   /* Writes held back, in the order issued        */
+    size_t                  agg_nextents;  /* Number of writes held back                   */
+    size_t                  agg_nalloc;    /* Number of extents allocated                  */
+    unsigned char *         agg_buf;       /* Data of the writes held back                 */
+    size_t                  agg_buf_used;  /* Bytes of data held back                      */
+    size_t                  agg_buf_alloc; /* Bytes allocated for the data                 */
+    haddr_t                 agg_lo;        /* Lowest address held back                     */
+    haddr_t                 agg_hi;        /* First address past the highest held back     */
 } H5FD_mpio_t;
 
 /* Private Prototypes */
@@ -90,6 +127,14 @@ static int      H5FD__mpio_mpi_rank(const H5FD_t *_file);
 static int      H5FD__mpio_mpi_size(const H5FD_t *_file);
 static MPI_Comm H5FD__mpio_communicator(const H5FD_t *_file);
 
+/* Aggregated independent writes */
+static herr_t H5FD__mpio_agg_setup(H5FD_mpio_t *file);
+static herr_t H5FD__mpio_agg_hold(H5FD_mpio_t *file, haddr_t addr, size_t size, const void *buf);
+static herr_t H5FD__mpio_agg_write_at(H5FD_mpio_t *file, haddr_t addr, size_t size, const void *buf);
+static herr_t H5FD__mpio_agg_spill(H5FD_mpio_t *file);
+static herr_t H5FD__mpio_agg_drain(H5FD_mpio_t *file);
+static int    H5FD__mpio_agg_cmp_addr(const void *_e1, const void *_e2);
+
 /* The MPIO file driver information */
 static const H5FD_class_mpi_t H5FD_mpio_g = {
     {
@@ -852,6 +897,10 @@ H5FD__mpio_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t H5_ATTR
     file->eof       = H5FD_mpi_MPIOff_to_haddr(size);
     file->local_eof = file->eof;
 
+    /* Set up aggregated independent writes, if requested */
+    if (H5FD__mpio_agg_setup(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "can't set up aggregated independent writes")
+
     /* Set return value */
     ret_value = (H5FD_t *)file;
 
@@ -863,9 +912,11 @@ done:
             HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free MPI communicator")
         if (H5_mpi_info_free(&info) < 0)
             HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free MPI info object")
-        if (file)
+        if (file) {
+            H5MM_xfree(file->agg_ranks);
             H5MM_xfree(file);
-    } /* end if */
+        } /* end if */
+    }     /* end if */
 
 #ifdef H5FDmpio_DEBUG
     if (H5FD_mpio_Debug[(int)'t'])
@@ -905,6 +956,10 @@ H5FD__mpio_close(H5FD_t *_file)
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
+    /* Issue any writes still held back for aggregation */
+    if (file->agg_nextents > 0 && H5FD__mpio_agg_spill(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write data held back for aggregation")
+
     /* MPI_File_close sets argument to MPI_FILE_NULL */
     if (MPI_SUCCESS != (mpi_code = MPI_File_close(&(file->f) /*in,out*/)))
         HMPI_GOTO_ERROR(FAIL, "MPI_File_close failed", mpi_code)
@@ -912,6 +967,9 @@ H5FD__mpio_close(H5FD_t *_file)
     /* Clean up other stuff */
     H5_mpi_comm_free(&file->comm);
     H5_mpi_info_free(&file->info);
+    H5MM_xfree(file->agg_ranks);
+    H5MM_xfree(file->agg_extents);
+    H5MM_xfree(file->agg_buf);
     H5MM_xfree(file);
 
 done:
@@ -1164,6 +1222,15 @@ H5FD__mpio_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
             HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
 
+        /* Issue this process's writes held back for aggregation if the read
+         * could see them.  (A read through an MPI view may touch any address.)
+         */
+        if (file->agg_nextents > 0 &&
+            (xfer_mode == H5FD_MPIO_COLLECTIVE ||
+             (H5F_addr_lt(addr, file->agg_hi) && H5F_addr_gt(addr + size, file->agg_lo))))
+            if (H5FD__mpio_agg_spill(file) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write data held back for aggregation")
+
         /*
          * Set up for a fancy xfer using complex types, or single byte block. We
          * wouldn't need to rely on the use_view field if MPI semantics allowed
@@ -1385,6 +1452,35 @@ H5FD__mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, h
     if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
 
+    /* Hold back independent raw data writes for the aggregators, when
+     * enabled.  Any other raw data write is issued after the writes already
+     * held back, so this process's writes reach the file in the order issued.
+     */
+    if (file->agg_count > 0 && type == H5FD_MEM_DRAW) {
+        if (xfer_mode != H5FD_MPIO_COLLECTIVE && size <= file->agg_buf_max) {
+#ifdef H5FDmpio_DEBUG
+            if (H5FD_mpio_Debug[(int)'w'])
+                HDfprintf(stdout, "%s: holding write back for aggregation\n", FUNC);
+#endif
+            if (file->agg_buf_used + size > file->agg_buf_max ||
+                file->agg_nextents >= H5FD_MPIO_AGG_MAX_EXTENTS)
+                if (H5FD__mpio_agg_spill(file) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write data held back for aggregation")
+            if (H5FD__mpio_agg_hold(file, addr, size, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't hold write back for aggregation")
+
+            /* Track the EOF as if the data had been written (see below) */
+            file->eof = HADDR_UNDEF;
+            if (size && (addr + size) > file->local_eof)
+                file->local_eof = addr + size;
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+        else if (file->agg_nextents > 0)
+            if (H5FD__mpio_agg_spill(file) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write data held back for aggregation")
+    } /* end if */
+
     /*
      * Set up for a fancy xfer using complex types, or single byte block. We
      * wouldn't need to rely on the use_view field if MPI semantics allowed
@@ -1548,6 +1644,14 @@ H5FD__mpio_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
+    /* Issue any writes still held back for aggregation.  Not every process
+     * necessarily flushes here (e.g. when flushing a single object), so only
+     * this process's own writes can be issued; when the whole file is flushed
+     * or closed, truncate has already handed them to the aggregators.
+     */
+    if (file->agg_nextents > 0 && H5FD__mpio_agg_spill(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write data held back for aggregation")
+
     /* Only sync the file if we are not going to immediately close it */
     if (!closing)
         if (MPI_SUCCESS != (mpi_code = MPI_File_sync(file->f)))
@@ -1601,6 +1705,13 @@ H5FD__mpio_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
+    /* Every process reaches this point when the file is flushed or closed,
+     * so it is the synchronization point at which the writes held back for
+     * aggregation are handed to the aggregators and written.
+     */
+    if (file->agg_count > 0 && H5FD__mpio_agg_drain(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write aggregated data")
+
     if (!H5F_addr_eq(file->eoa, file->last_eoa)) {
         int        mpi_code; /* mpi return code */
         MPI_Offset size;
@@ -1750,4 +1861,624 @@ H5FD__mpio_communicator(const H5FD_t *_file)
     FUNC_LEAVE_NOAPI(file->comm)
 } /* end H5FD__mpio_communicator() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_agg_setup
+ *
+ * Purpose:     Sets up aggregated independent writes for a newly opened
+ *              file, if the H5F_MPIO_AGGREGATE_KEY info key or the
+ *              HDF5_MPIO_AGGREGATE environment variable asks for them.
+ *
+ *              Rank 0's settings are broadcast, so all processes agree on
+ *              whether to take part in the drain at truncate.  The
+ *              aggregators are spread evenly over the processes of each
+ *              node.  This is collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_agg_setup(H5FD_mpio_t *file)
+{
+    long     settings[3]; /* Aggregators per node, buffer bound and stripe size */
+    MPI_Comm node_comm = MPI_COMM_NULL;
+    int *    is_agg    = NULL; /* Whether each process is an aggregator */
+    int      node_rank, node_size;
+    int      per_node, stride, agg;
+    int      mpi_code;
+    int      i;
+    herr_t   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+
+    settings[0] = 0;
+    settings[1] = H5FD_MPIO_AGG_BUFFER_DEFAULT;
+    settings[2] = H5FD_MPIO_AGG_STRIPE_DEFAULT;
+
+    /* Only rank 0 reads the settings.  (Nothing may fail here, or the other
+     * processes would hang in the following broadcast.)
+     */
+    if (0 == file->mpi_rank) {
+        const char *s;
+
+        if (MPI_INFO_NULL != file->info) {
+            char value[64];
+            int  flag = 0;
+
+            if (MPI_SUCCESS == MPI_Info_get(file->info, H5F_MPIO_AGGREGATE_KEY, (int)sizeof(value) - 1,
+                                            value, &flag) &&
+                flag)
+                settings[0] = HDstrtol(value, NULL, 0);
+            if (MPI_SUCCESS == MPI_Info_get(file->info, H5F_MPIO_AGGREGATE_BUFFER_KEY,
+                                            (int)sizeof(value) - 1, value, &flag) &&
+                flag)
+                settings[1] = HDstrtol(value, NULL, 0);
+
+            /* Align the aggregators' file domains with the file system's
+             * stripes, when the application describes them
+             */
+            if (MPI_SUCCESS ==
+                    MPI_Info_get(file->info, "striping_unit", (int)sizeof(value) - 1, value, &flag) &&
+                flag)
+                settings[2] = HDstrtol(value, NULL, 0);
+        } /* end if */
+
+        s = HDgetenv("HDF5_MPIO_AGGREGATE");
+        if (s && HDisdigit(*s))
+            settings[0] = HDstrtol(s, NULL, 0);
+    } /* end if */
+    if (MPI_SUCCESS != (mpi_code = MPI_Bcast(settings, 3, MPI_LONG, 0, file->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+    if (settings[0] <= 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Find this process's place on its node */
+#if MPI_VERSION >= 3
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_split_type(file->comm, MPI_COMM_TYPE_SHARED, file->mpi_rank,
+                                                       MPI_INFO_NULL, &node_comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_split_type failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_rank(node_comm, &node_rank)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_rank failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_size(node_comm, &node_size)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_size failed", mpi_code)
+#else
+    /* Without MPI-3, treat all processes as sharing one node */
+    node_rank = file->mpi_rank;
+    node_size = file->mpi_size;
+#endif
+
+    /* Pick every stride'th process of the node, up to per_node of them */
+    per_node = (int)MIN(settings[0], (long)node_size);
+    stride   = node_size / per_node;
+    agg      = (0 == node_rank % stride && node_rank / stride < per_node);
+
+    /* Collect the ranks of all aggregators */
+    if (NULL == (is_agg = (int *)H5MM_malloc((size_t)file->mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate aggregator flags")
+    if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&agg, 1, MPI_INT, is_agg, 1, MPI_INT, file->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+    if (NULL == (file->agg_ranks = (int *)H5MM_malloc((size_t)file->mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate aggregator ranks")
+    for (i = 0; i < file->mpi_size; i++)
+        if (is_agg[i])
+            file->agg_ranks[file->agg_count++] = i;
+    HDassert(file->agg_count > 0);
+
+    /* Keep the stripes and the buffer within what one int-counted MPI write
+     * can describe
+     */
+    file->agg_stripe =
+        (hsize_t)MIN(MAX(settings[2], (long)H5FD_MPIO_AGG_STRIPE_MIN), (long)H5FD_MPIO_AGG_WRITE_MAX);
+    file->agg_buf_max = (size_t)MIN(MAX(settings[1], 0L), (long)H5FD_MPIO_AGG_WRITE_MAX);
+    file->agg_lo      = HADDR_MAX;
+    file->agg_hi      = 0;
+
+done:
+    if (MPI_COMM_NULL != node_comm)
+        MPI_Comm_free(&node_comm);
+    H5MM_xfree(is_agg);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_agg_setup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_agg_hold
+ *
+ * Purpose:     Holds back a raw data write for the aggregators, copying
+ *              its data.  The caller makes sure it fits in the buffer.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_agg_hold(H5FD_mpio_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_mpio_agg_extent_t *extent;
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->agg_buf_used + size <= file->agg_buf_max);
+
+    /* Make room for the extent and its data */
+    if (file->agg_nextents == file->agg_nalloc) {
+        size_t                  nalloc = MAX(64, 2 * file->agg_nalloc);
+        H5FD_mpio_agg_extent_t *extents;
+
+        if (NULL == (extents = (H5FD_mpio_agg_extent_t *)H5MM_realloc(
+                         file->agg_extents, nalloc * sizeof(H5FD_mpio_agg_extent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't grow aggregation extents")
+        file->agg_extents = extents;
+        file->agg_nalloc  = nalloc;
+    } /* end if */
+    if (file->agg_buf_used + size > file->agg_buf_alloc) {
+        size_t         alloc = MIN(MAX(64 * 1024, 2 * file->agg_buf_alloc), file->agg_buf_max);
+        unsigned char *agg_buf;
+
+        alloc = MAX(alloc, file->agg_buf_used + size);
+        if (NULL == (agg_buf = (unsigned char *)H5MM_realloc(file->agg_buf, alloc)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't grow aggregation buffer")
+        file->agg_buf       = agg_buf;
+        file->agg_buf_alloc = alloc;
+    } /* end if */
+
+    extent          = &file->agg_extents[file->agg_nextents++];
+    extent->addr    = addr;
+    extent->size    = size;
+    extent->buf_off = file->agg_buf_used;
+    H5MM_memcpy(file->agg_buf + file->agg_buf_used, buf, size);
+    file->agg_buf_used += size;
+
+    file->agg_lo = MIN(file->agg_lo, addr);
+    file->agg_hi = MAX(file->agg_hi, addr + size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_agg_hold() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_agg_write_at
+ *
+ * Purpose:     Writes a contiguous range of bytes with independent MPI
+ *              writes of at most H5FD_MPIO_AGG_WRITE_MAX bytes each.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_agg_write_at(H5FD_mpio_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    const unsigned char *p         = (const unsigned char *)buf;
+    herr_t               ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    while (size > 0) {
+        MPI_Offset mpi_off;
+        MPI_Status mpi_stat;
+        int        n = (int)MIN(size, H5FD_MPIO_AGG_WRITE_MAX);
+        int        bytes_written;
+        int        mpi_code;
+
+        /* Portably initialize MPI status variable */
+        HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+        if (H5FD_mpi_haddr_to_MPIOff(addr, &mpi_off) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from haddr to MPI off")
+        if (MPI_SUCCESS != (mpi_code = MPI_File_write_at(file->f, mpi_off, p, n, MPI_BYTE, &mpi_stat)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
+        if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&mpi_stat, MPI_BYTE, &bytes_written)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+        if (bytes_written != n)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+        addr += (haddr_t)n;
+        p += n;
+        size -= (size_t)n;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_agg_write_at() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_agg_spill
+ *
+ * Purpose:     Writes this process's held back writes directly, in the
+ *              order they were issued, for the cases that can't wait for
+ *              the next drain.  This is independent.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_agg_spill(H5FD_mpio_t *file)
+{
+    size_t u;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'w'])
+        HDfprintf(stdout, "%s: writing %zu held back writes directly\n", FUNC, file->agg_nextents);
+#endif
+
+    for (u = 0; u < file->agg_nextents; u++) {
+        const H5FD_mpio_agg_extent_t *extent = &file->agg_extents[u];
+
+        if (H5FD__mpio_agg_write_at(file, extent->addr, extent->size, file->agg_buf + extent->buf_off) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write held back data")
+    } /* end for */
+
+    file->agg_nextents = 0;
+    file->agg_buf_used = 0;
+    file->agg_lo       = HADDR_MAX;
+    file->agg_hi       = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_agg_spill() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_agg_cmp_addr
+ *
+ * Purpose:     Orders pointers to extents by file address, for qsort.
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mpio_agg_cmp_addr(const void *_e1, const void *_e2)
+{
+    const H5FD_mpio_agg_extent_t *e1 = *(const H5FD_mpio_agg_extent_t *const *)_e1;
+    const H5FD_mpio_agg_extent_t *e2 = *(const H5FD_mpio_agg_extent_t *const *)_e2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(e1->addr, e2->addr))
+} /* end H5FD__mpio_agg_cmp_addr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_agg_drain
+ *
+ * Purpose:     Hands the writes held back by all processes to the
+ *              aggregators, which merge and write them.  This is
+ *              collective.
+ *
+ *              The file is divided into stripes, and stripe S belongs to
+ *              aggregator S mod agg_count, so the aggregators write
+ *              disjoint, stripe-aligned domains and don't contend for
+ *              the file system's locks.  Writes are split at stripe
+ *              boundaries and exchanged with MPI_Alltoallv.  Each
+ *              aggregator merges the pieces it receives into contiguous
+ *              runs, copying them in the order received (by source rank,
+ *              then in the order the source issued them), and writes each
+ *              run with one MPI write.
+ *
+ *              To bound the aggregators' memory, the exchange proceeds
+ *              in rounds, each covering agg_buf_max bytes of file per
+ *              aggregator from the lowest address any process still holds
+ *              back.  A round too large for int-counted exchanges (e.g.
+ *              many processes writing the same bytes) is instead written
+ *              directly by each process.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_agg_drain(H5FD_mpio_t *file)
+{
+    H5FD_mpio_agg_extent_t * send_ext   = NULL; /* Pieces sent to the aggregators */
+    H5FD_mpio_agg_extent_t * recv_ext   = NULL; /* Pieces received by this aggregator */
+    H5FD_mpio_agg_extent_t **sorted     = NULL; /* Received pieces in address order */
+    H5FD_mpio_agg_extent_t * runs       = NULL; /* Runs merged from the received pieces */
+    size_t *                 run_of     = NULL; /* Run holding each received piece */
+    unsigned char *          send_data  = NULL;
+    unsigned char *          recv_data  = NULL;
+    unsigned char *          run_data   = NULL;
+    uint64_t *               counts     = NULL; /* Piece and byte counts, and packing cursors */
+    int *                    mpi_counts = NULL; /* Counts and displacements for the exchanges */
+    uint64_t                 window;            /* Bytes of file covered by one round */
+    uint64_t                 base      = 0;     /* Start of the part of the file not yet drained */
+    hbool_t                  drained   = FALSE;
+    int                      mpi_size  = file->mpi_size;
+    int                      mpi_code;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Entering, %zu writes held back\n", FUNC, file->agg_nextents);
+#endif
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->agg_count > 0);
+
+    if (NULL == (counts = (uint64_t *)H5MM_malloc(6 * (size_t)mpi_size * sizeof(uint64_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate aggregation counts")
+    if (NULL == (mpi_counts = (int *)H5MM_malloc(8 * (size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate aggregation counts")
+
+    window = (uint64_t)file->agg_stripe * (uint64_t)file->agg_count *
+             (uint64_t)MAX(1, file->agg_buf_max / file->agg_stripe);
+
+    for (;;) {
+        uint64_t *send_counts  = counts;                /* Pieces and bytes for each rank */
+        uint64_t *recv_counts  = counts + 2 * mpi_size; /* Pieces and bytes from each rank */
+        uint64_t *piece_cursor = counts + 4 * mpi_size;
+        uint64_t *byte_cursor  = counts + 5 * mpi_size;
+        int *     sext_counts  = mpi_counts;
+        int *     sext_displs  = mpi_counts + mpi_size;
+        int *     sdat_counts  = mpi_counts + 2 * mpi_size;
+        int *     sdat_displs  = mpi_counts + 3 * mpi_size;
+        int *     rext_counts  = mpi_counts + 4 * mpi_size;
+        int *     rext_displs  = mpi_counts + 5 * mpi_size;
+        int *     rdat_counts  = mpi_counts + 6 * mpi_size;
+        int *     rdat_displs  = mpi_counts + 7 * mpi_size;
+        uint64_t  next         = UINT64_MAX;
+        uint64_t  lo, hi;
+        uint64_t  send_pieces = 0, send_bytes = 0;
+        uint64_t  recv_pieces = 0, recv_bytes = 0;
+        int       too_big = 0;
+        int       pass, i;
+        size_t    u;
+
+        /* Find the lowest address from BASE on that any process holds back */
+        for (u = 0; u < file->agg_nextents; u++) {
+            const H5FD_mpio_agg_extent_t *extent = &file->agg_extents[u];
+
+            if (extent->addr + extent->size > base)
+                next = MIN(next, MAX(extent->addr, base));
+        } /* end for */
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_Allreduce(MPI_IN_PLACE, &next, 1, MPI_UINT64_T, MPI_MIN, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+        if (UINT64_MAX == next)
+            break;
+        drained = TRUE;
+
+        /* This round's window starts at the stripe holding that address */
+        lo   = next - next % file->agg_stripe;
+        hi   = lo + window;
+        base = hi;
+
+        /* Count, then pack, the pieces of the window for each aggregator */
+        HDmemset(counts, 0, 6 * (size_t)mpi_size * sizeof(uint64_t));
+        for (pass = 0; pass < 2; pass++) {
+            for (u = 0; u < file->agg_nextents; u++) {
+                const H5FD_mpio_agg_extent_t *extent = &file->agg_extents[u];
+                uint64_t                      addr   = MAX(extent->addr, lo);
+                uint64_t                      end    = MIN(extent->addr + extent->size, hi);
+
+                while (addr < end) {
+                    uint64_t stripe = addr / file->agg_stripe;
+                    uint64_t len    = MIN(end, (stripe + 1) * file->agg_stripe) - addr;
+                    int      dest   = file->agg_ranks[stripe % (uint64_t)file->agg_count];
+
+                    if (0 == pass) {
+                        send_counts[2 * dest]++;
+                        send_counts[2 * dest + 1] += len;
+                    } /* end if */
+                    else {
+                        H5FD_mpio_agg_extent_t *piece = &send_ext[piece_cursor[dest]++];
+
+                        piece->addr    = (haddr_t)addr;
+                        piece->size    = (size_t)len;
+                        piece->buf_off = (size_t)(byte_cursor[dest] - (uint64_t)sdat_displs[dest]);
+                        H5MM_memcpy(send_data + byte_cursor[dest],
+                                    file->agg_buf + extent->buf_off + (addr - extent->addr), (size_t)len);
+                        byte_cursor[dest] += len;
+                    } /* end else */
+                    addr += len;
+                } /* end while */
+            }     /* end for */
+
+            if (pass > 0)
+                break;
+
+            /* Tell the aggregators what is coming */
+            if (MPI_SUCCESS != (mpi_code = MPI_Alltoall(send_counts, 2, MPI_UINT64_T, recv_counts, 2,
+                                                        MPI_UINT64_T, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
+            for (i = 0; i < mpi_size; i++) {
+                send_pieces += send_counts[2 * i];
+                send_bytes += send_counts[2 * i + 1];
+                recv_pieces += recv_counts[2 * i];
+                recv_bytes += recv_counts[2 * i + 1];
+            } /* end for */
+
+            /* Fall back to direct writes if any process can't describe
+             * its part of the exchange with int counts
+             */
+            too_big = (send_pieces * sizeof(H5FD_mpio_agg_extent_t) > INT_MAX || send_bytes > INT_MAX ||
+                       recv_pieces * sizeof(H5FD_mpio_agg_extent_t) > INT_MAX || recv_bytes > INT_MAX);
+            if (MPI_SUCCESS !=
+                (mpi_code = MPI_Allreduce(MPI_IN_PLACE, &too_big, 1, MPI_INT, MPI_MAX, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+            if (too_big)
+                break;
+
+            /* Lay out the exchange */
+            send_pieces = send_bytes = recv_pieces = recv_bytes = 0;
+            for (i = 0; i < mpi_size; i++) {
+                sext_counts[i]  = (int)(send_counts[2 * i] * sizeof(H5FD_mpio_agg_extent_t));
+                sext_displs[i]  = (int)(send_pieces * sizeof(H5FD_mpio_agg_extent_t));
+                sdat_counts[i]  = (int)send_counts[2 * i + 1];
+                sdat_displs[i]  = (int)send_bytes;
+                rext_counts[i]  = (int)(recv_counts[2 * i] * sizeof(H5FD_mpio_agg_extent_t));
+                rext_displs[i]  = (int)(recv_pieces * sizeof(H5FD_mpio_agg_extent_t));
+                rdat_counts[i]  = (int)recv_counts[2 * i + 1];
+                rdat_displs[i]  = (int)recv_bytes;
+                piece_cursor[i] = send_pieces;
+                byte_cursor[i]  = send_bytes;
+
+                send_pieces += send_counts[2 * i];
+                send_bytes += send_counts[2 * i + 1];
+                recv_pieces += recv_counts[2 * i];
+                recv_bytes += recv_counts[2 * i + 1];
+            } /* end for */
+
+            if (send_pieces > 0) {
+                if (NULL == (send_ext = (H5FD_mpio_agg_extent_t *)H5MM_malloc(
+                                 (size_t)send_pieces * sizeof(H5FD_mpio_agg_extent_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate send buffer")
+                if (NULL == (send_data = (unsigned char *)H5MM_malloc((size_t)MAX(send_bytes, 1))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate send buffer")
+            } /* end if */
+            if (recv_pieces > 0) {
+                if (NULL == (recv_ext = (H5FD_mpio_agg_extent_t *)H5MM_malloc(
+                                 (size_t)recv_pieces * sizeof(H5FD_mpio_agg_extent_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate receive buffer")
+                if (NULL == (recv_data = (unsigned char *)H5MM_malloc((size_t)MAX(recv_bytes, 1))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate receive buffer")
+            } /* end if */
+        }     /* end for */
+
+        if (too_big) {
+#ifdef H5FDmpio_DEBUG
+            if (H5FD_mpio_Debug[(int)'w'])
+                HDfprintf(stdout, "%s: round too large to exchange, writing directly\n", FUNC);
+#endif
+            for (u = 0; u < file->agg_nextents; u++) {
+                const H5FD_mpio_agg_extent_t *extent = &file->agg_extents[u];
+                uint64_t                      addr   = MAX(extent->addr, lo);
+                uint64_t                      end    = MIN(extent->addr + extent->size, hi);
+
+                if (addr < end && H5FD__mpio_agg_write_at(file, (haddr_t)addr, (size_t)(end - addr),
+                                                          file->agg_buf + extent->buf_off +
+                                                              (addr - extent->addr)) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write held back data")
+            } /* end for */
+            continue;
+        } /* end if */
+
+        /* Exchange the pieces and their data */
+        if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_ext, sext_counts, sext_displs, MPI_BYTE, recv_ext,
+                                                     rext_counts, rext_displs, MPI_BYTE, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+        if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_data, sdat_counts, sdat_displs, MPI_BYTE, recv_data,
+                                                     rdat_counts, rdat_displs, MPI_BYTE, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+        send_ext  = (H5FD_mpio_agg_extent_t *)H5MM_xfree(send_ext);
+        send_data = (unsigned char *)H5MM_xfree(send_data);
+
+        /* Merge the pieces received into runs and write them */
+        if (recv_pieces > 0) {
+            size_t nrecv = (size_t)recv_pieces;
+            size_t nruns = 0;
+            size_t run_bytes;
+
+            /* Locate each piece's data in the whole receive buffer */
+            for (i = 0; i < mpi_size; i++) {
+                size_t first = (size_t)rext_displs[i] / sizeof(H5FD_mpio_agg_extent_t);
+                size_t n     = (size_t)rext_counts[i] / sizeof(H5FD_mpio_agg_extent_t);
+
+                for (u = first; u < first + n; u++)
+                    recv_ext[u].buf_off += (size_t)rdat_displs[i];
+            } /* end for */
+
+            if (NULL == (sorted = (H5FD_mpio_agg_extent_t **)H5MM_malloc(
+                             nrecv * sizeof(H5FD_mpio_agg_extent_t *))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate sorted pieces")
+            if (NULL ==
+                (runs = (H5FD_mpio_agg_extent_t *)H5MM_malloc(nrecv * sizeof(H5FD_mpio_agg_extent_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate runs")
+            if (NULL == (run_of = (size_t *)H5MM_malloc(nrecv * sizeof(size_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate runs")
+            for (u = 0; u < nrecv; u++)
+                sorted[u] = &recv_ext[u];
+            HDqsort(sorted, nrecv, sizeof(H5FD_mpio_agg_extent_t *), H5FD__mpio_agg_cmp_addr);
+
+            /* Overlapping and adjacent pieces join the same run */
+            for (u = 0; u < nrecv; u++) {
+                const H5FD_mpio_agg_extent_t *piece = sorted[u];
+
+                if (0 == nruns || piece->addr > runs[nruns - 1].addr + runs[nruns - 1].size) {
+                    runs[nruns].addr = piece->addr;
+                    runs[nruns].size = piece->size;
+                    nruns++;
+                } /* end if */
+                else if (piece->addr + piece->size > runs[nruns - 1].addr + runs[nruns - 1].size)
+                    runs[nruns - 1].size = (size_t)(piece->addr + piece->size - runs[nruns - 1].addr);
+                run_of[piece - recv_ext] = nruns - 1;
+            } /* end for */
+            for (u = 0, run_bytes = 0; u < nruns; u++) {
+                runs[u].buf_off = run_bytes;
+                run_bytes += runs[u].size;
+            } /* end for */
+
+            /* Copy the pieces in the order received, so later writes win */
+            if (NULL == (run_data = (unsigned char *)H5MM_malloc(run_bytes)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate run buffer")
+            for (u = 0; u < nrecv; u++) {
+                const H5FD_mpio_agg_extent_t *piece = &recv_ext[u];
+                const H5FD_mpio_agg_extent_t *run   = &runs[run_of[u]];
+
+                H5MM_memcpy(run_data + run->buf_off + (piece->addr - run->addr), recv_data + piece->buf_off,
+                            piece->size);
+            } /* end for */
+
+#ifdef H5FDmpio_DEBUG
+            if (H5FD_mpio_Debug[(int)'w'])
+                HDfprintf(stdout, "%s: writing %zu pieces as %zu runs\n", FUNC, nrecv, nruns);
+#endif
+            for (u = 0; u < nruns; u++)
+                if (H5FD__mpio_agg_write_at(file, runs[u].addr, runs[u].size, run_data + runs[u].buf_off) <
+                    0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write aggregated data")
+
+            recv_ext  = (H5FD_mpio_agg_extent_t *)H5MM_xfree(recv_ext);
+            recv_data = (unsigned char *)H5MM_xfree(recv_data);
+            sorted    = (H5FD_mpio_agg_extent_t **)H5MM_xfree(sorted);
+            runs      = (H5FD_mpio_agg_extent_t *)H5MM_xfree(runs);
+            run_of    = (size_t *)H5MM_xfree(run_of);
+            run_data  = (unsigned char *)H5MM_xfree(run_data);
+        } /* end if */
+    }     /* end for */
+
+    /* Don't let any process go on, e.g. to check the file's size, before
+     * the aggregators are done
+     */
+    if (drained)
+        if (MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
+
+    file->agg_nextents = 0;
+    file->agg_buf_used = 0;
+    file->agg_lo       = HADDR_MAX;
+    file->agg_hi       = 0;
+
+done:
+    H5MM_xfree(send_ext);
+    H5MM_xfree(send_data);
+    H5MM_xfree(recv_ext);
+    H5MM_xfree(recv_data);
+    H5MM_xfree(sorted);
+    H5MM_xfree(runs);
+    H5MM_xfree(run_of);
+    H5MM_xfree(run_data);
+    H5MM_xfree(counts);
+    H5MM_xfree(mpi_counts);
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Leaving\n", FUNC);
+#endif
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_agg_drain() */
+
 #endif /* H5_HAVE_PARALLEL */
@@ -28,6 +28,15 @@
 
 #include "hdf5.h"
 
+/* The member threads call the member drivers' callbacks, which may push
+ * errors onto the error stack, so they are only used when the library keeps
+ * an error stack per thread.
+ */
+#if defined(H5_HAVE_THREADSAFE) && defined(H5_HAVE_PTHREAD_H)
+#define H5FD_MULTI_THREADS
+#include <pthread.h>
+#endif /* H5_HAVE_THREADSAFE && H5_HAVE_PTHREAD_H */
+
 #ifndef FALSE
 #define FALSE 0
 #endif
@@ -65,6 +74,14 @@
 
 #define H5FD_MULT_MAX_FILE_NAME_LEN 1024
 
+/* Environment variable that sets the number of threads used to flush and
+ * truncate the members concurrently, and its default.  A value of 0 or 1
+ * does them one at a time from the application's thread.  Only used in a
+ * thread-safe library, and only when all the members use the sec2 driver.
+ */
+#define H5FD_MULTI_THREADS_ENV "HDF5_MULTI_THREADS"
+#define H5FD_MULTI_THREADS_DEF 1
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_MULTI_g = 0;
 
@@ -95,6 +112,10 @@ typedef struct H5FD_multi_t {
                                                    *with the EOAs for individual files        */
     unsigned flags;                               /*file open flags saved for debugging       */
     char *   name;                                /*name passed to H5Fopen or H5Fcreate       */
+    unsigned nthreads;                            /*threads for flushing/truncating members   */
+#ifdef H5FD_MULTI_THREADS
+    struct H5FD_multi_pool_t *pool; /*member threads, started on first use      */
+#endif                              /* H5FD_MULTI_THREADS */
 } H5FD_multi_t;
 
 /* Driver specific data transfer properties */
@@ -102,10 +123,46 @@ typedef struct H5FD_multi_dxpl_t {
     hid_t memb_dxpl[H5FD_MEM_NTYPES]; /*member data xfer properties*/
 } H5FD_multi_dxpl_t;
 
+#ifdef H5FD_MULTI_THREADS
+/* A flush or truncate of one member */
+typedef struct H5FD_multi_memb_op_t {
+    H5FD_t *memb;     /*member file                         */
+    int     truncate; /*TRUE to truncate, FALSE to flush    */
+    hid_t   dxpl_id;  /*data transfer properties            */
+    hbool_t closing;  /*'closing' flag of the operation     */
+    herr_t  status;   /*result of the member callback       */
+} H5FD_multi_memb_op_t;
+
+/* Threads that flush or truncate the members of one file.  The
+ * application's thread posts one operation per member, works on them
+ * alongside the pool's threads, and returns once they are all done.
+ */
+typedef struct H5FD_multi_pool_t {
+    pthread_t             threads[H5FD_MEM_NTYPES]; /*pool threads                             */
+    unsigned              nthreads;                 /*number of pool threads                   */
+    pthread_mutex_t       mutex;                    /*protects the fields below                */
+    pthread_cond_t        work_cond;                /*signalled when ops are posted or on stop */
+    pthread_cond_t        done_cond;                /*signalled when the last op ends          */
+    H5FD_multi_memb_op_t *ops;                      /*current operations                       */
+    size_t                nops;                     /*number of operations posted              */
+    size_t                next;                     /*next operation to hand out               */
+    size_t                pending;                  /*number of operations not yet done        */
+    int                   stop;                     /*TRUE when the threads should exit        */
+} H5FD_multi_pool_t;
+#endif /* H5FD_MULTI_THREADS */
+
 /* Private functions */
 static char *my_strdup(const char *s);
 static int   compute_next(H5FD_multi_t *file);
 static int   open_members(H5FD_multi_t *file);
+#ifdef H5FD_MULTI_THREADS
+static void  memb_op_run(H5FD_multi_memb_op_t *op);
+static void *memb_pool_thread(void *_pool);
+static void  memb_pool_work(H5FD_multi_pool_t *pool);
+static int   memb_pool_start(H5FD_multi_t *file, size_t nops);
+static void  memb_pool_stop(H5FD_multi_t *file);
+static int   memb_op_all(H5FD_multi_t *file, int truncate, hid_t dxpl_id, hbool_t closing);
+#endif /* H5FD_MULTI_THREADS */
 
 /* Callback prototypes */
 static herr_t  H5FD_multi_term(void);
@@ -1032,6 +1089,13 @@ H5FD_multi_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     file->fa.relax = fa->relax;
     file->flags    = flags;
     file->name     = my_strdup(name);
+    {
+        const char *threads_env = getenv(H5FD_MULTI_THREADS_ENV);
+
+        file->nthreads = H5FD_MULTI_THREADS_DEF;
+        if (threads_env && *threads_env)
+            file->nthreads = (unsigned)strtoul(threads_env, NULL, 10);
+    }
     if (close_fapl >= 0)
         if (H5Pclose(close_fapl) < 0)
             H5Epush_goto(func, H5E_ERR_CLS, H5E_FILE, H5E_CANTCLOSEOBJ, "can't close property list", error)
@@ -1048,6 +1112,20 @@ H5FD_multi_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     if (NULL == file->memb[m])
         goto error;
 
+#ifdef H5FD_MULTI_THREADS
+    /* The member threads call the member drivers without the library's lock,
+     * which only the sec2 driver is known to cope with.
+     */
+    if (file->nthreads > 1) {
+        ALL_MEMBERS(mt)
+        {
+            if (file->memb[mt] && file->memb[mt]->driver_id != H5FD_SEC2)
+                file->nthreads = 1;
+        }
+        END_MEMBERS;
+    }
+#endif /* H5FD_MULTI_THREADS */
+
     return (H5FD_t *)file;
 
 error:
@@ -1096,6 +1174,12 @@ H5FD_multi_close(H5FD_t *_file)
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
+#ifdef H5FD_MULTI_THREADS
+    /* Stop the member threads */
+    if (file->pool)
+        memb_pool_stop(file);
+#endif /* H5FD_MULTI_THREADS */
+
     /* Close as many members as possible */
     ALL_MEMBERS(mt)
     {
@@ -1745,16 +1829,21 @@ H5FD_multi_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     H5Eclear2(H5E_DEFAULT);
 
     /* Flush each file */
-    for (mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
-        if (file->memb[mt]) {
-            H5E_BEGIN_TRY
-            {
-                if (H5FDflush(file->memb[mt], dxpl_id, closing) < 0)
-                    nerrors++;
+#ifdef H5FD_MULTI_THREADS
+    if (file->nthreads > 1)
+        nerrors = memb_op_all(file, FALSE, dxpl_id, closing);
+    else
+#endif /* H5FD_MULTI_THREADS */
+        for (mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
+            if (file->memb[mt]) {
+                H5E_BEGIN_TRY
+                {
+                    if (H5FDflush(file->memb[mt], dxpl_id, closing) < 0)
+                        nerrors++;
+                }
+                H5E_END_TRY;
             }
-            H5E_END_TRY;
         }
-    }
     if (nerrors)
         H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "error flushing member files", -1)
 
@@ -1786,16 +1875,21 @@ H5FD_multi_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     H5Eclear2(H5E_DEFAULT);
 
     /* Truncate each file */
-    for (mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
-        if (file->memb[mt]) {
-            H5E_BEGIN_TRY
-            {
-                if (H5FDtruncate(file->memb[mt], dxpl_id, closing) < 0)
-                    nerrors++;
+#ifdef H5FD_MULTI_THREADS
+    if (file->nthreads > 1)
+        nerrors = memb_op_all(file, TRUE, dxpl_id, closing);
+    else
+#endif /* H5FD_MULTI_THREADS */
+        for (mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
+            if (file->memb[mt]) {
+                H5E_BEGIN_TRY
+                {
+                    if (H5FDtruncate(file->memb[mt], dxpl_id, closing) < 0)
+                        nerrors++;
+                }
+                H5E_END_TRY;
             }
-            H5E_END_TRY;
         }
-    }
     if (nerrors)
         H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "error truncating member files", -1)
 
@@ -2002,6 +2096,237 @@ open_members(H5FD_multi_t *file)
 }
 H5_GCC_DIAG_ON("format-nonliteral")
 
+#ifdef H5FD_MULTI_THREADS
+/*-------------------------------------------------------------------------
+ * Function:    memb_op_run
+ *
+ * Purpose:     Flushes or truncates one member file.
+ *
+ *              The member driver's callback is called directly rather
+ *              than through H5FDflush() or H5FDtruncate(): those are API
+ *              calls, and the application's thread is already inside one
+ *              while it waits for the pool's threads.  The pool is only
+ *              used for sec2 members, whose callbacks don't need the
+ *              library's lock.
+ *
+ * Return:      void, with the result in OP->status
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+memb_op_run(H5FD_multi_memb_op_t *op)
+{
+    H5FD_t *memb = op->memb;
+
+    op->status = 0;
+    if (op->truncate) {
+        if (memb->cls->truncate)
+            op->status = (memb->cls->truncate)(memb, op->dxpl_id, op->closing);
+    }
+    else {
+        if (memb->cls->flush)
+            op->status = (memb->cls->flush)(memb, op->dxpl_id, op->closing);
+    }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    memb_pool_thread
+ *
+ * Purpose:     Body of a member pool thread: works on the operations the
+ *              application's thread posts until told to stop.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+memb_pool_thread(void *_pool)
+{
+    H5FD_multi_pool_t *pool = (H5FD_multi_pool_t *)_pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        while (!pool->stop && pool->next >= pool->nops)
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        if (pool->next >= pool->nops)
+            break;
+        memb_pool_work(pool);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    memb_pool_work
+ *
+ * Purpose:     Takes posted operations and runs them until none are left.
+ *              Called with the pool mutex held, which is released while an
+ *              operation runs.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+memb_pool_work(H5FD_multi_pool_t *pool)
+{
+    while (pool->next < pool->nops) {
+        H5FD_multi_memb_op_t *op = &pool->ops[pool->next++];
+
+        pthread_mutex_unlock(&pool->mutex);
+        memb_op_run(op);
+        pthread_mutex_lock(&pool->mutex);
+        if (0 == --pool->pending)
+            pthread_cond_broadcast(&pool->done_cond);
+    }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    memb_pool_start
+ *
+ * Purpose:     Creates the member thread pool for a file with NOPS open
+ *              members.  The application's thread takes part in every
+ *              batch, so at most FILE->nthreads-1 threads are started, and
+ *              never more than there are other members.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+memb_pool_start(H5FD_multi_t *file, size_t nops)
+{
+    H5FD_multi_pool_t *pool;
+    unsigned           nthreads = file->nthreads - 1;
+    unsigned           u;
+
+    if (nthreads > nops - 1)
+        nthreads = (unsigned)(nops - 1);
+
+    if (NULL == (pool = (H5FD_multi_pool_t *)calloc((size_t)1, sizeof(H5FD_multi_pool_t))))
+        return -1;
+    if (pthread_mutex_init(&pool->mutex, NULL)) {
+        free(pool);
+        return -1;
+    }
+    if (pthread_cond_init(&pool->work_cond, NULL)) {
+        pthread_mutex_destroy(&pool->mutex);
+        free(pool);
+        return -1;
+    }
+    if (pthread_cond_init(&pool->done_cond, NULL)) {
+        pthread_cond_destroy(&pool->work_cond);
+        pthread_mutex_destroy(&pool->mutex);
+        free(pool);
+        return -1;
+    }
+
+    /* Make do with the threads that start */
+    for (u = 0; u < nthreads; u++) {
+        if (pthread_create(&pool->threads[pool->nthreads], NULL, memb_pool_thread, pool))
+            break;
+        pool->nthreads++;
+    }
+
+    file->pool = pool;
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    memb_pool_stop
+ *
+ * Purpose:     Stops the member threads and releases the pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+memb_pool_stop(H5FD_multi_t *file)
+{
+    H5FD_multi_pool_t *pool = file->pool;
+    unsigned           u;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = TRUE;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->mutex);
+    for (u = 0; u < pool->nthreads; u++)
+        pthread_join(pool->threads[u], NULL);
+
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool);
+    file->pool = NULL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    memb_op_all
+ *
+ * Purpose:     Flushes or truncates all member files, concurrently when
+ *              there is more than one.  The member threads are started on
+ *              first use and kept until the file is closed; if they can't
+ *              be started the members are done one at a time.
+ *
+ * Return:      The number of members that failed
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+memb_op_all(H5FD_multi_t *file, int truncate, hid_t dxpl_id, hbool_t closing)
+{
+    H5FD_multi_memb_op_t ops[H5FD_MEM_NTYPES];
+    size_t               nops = 0, u;
+    int                  nerrors = 0;
+    H5FD_mem_t           mt;
+
+    for (mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1))
+        if (file->memb[mt]) {
+            ops[nops].memb     = file->memb[mt];
+            ops[nops].truncate = truncate;
+            ops[nops].dxpl_id  = dxpl_id;
+            ops[nops].closing  = closing;
+            ops[nops].status   = 0;
+            nops++;
+        }
+
+    /* A single member gains nothing from the threads */
+    if (nops > 1 && (file->pool || memb_pool_start(file, nops) >= 0) && file->pool->nthreads > 0) {
+        H5FD_multi_pool_t *pool = file->pool;
+
+        pthread_mutex_lock(&pool->mutex);
+        pool->ops     = ops;
+        pool->nops    = nops;
+        pool->next    = 0;
+        pool->pending = nops;
+        pthread_cond_broadcast(&pool->work_cond);
+
+        /* Take a share of the work, then wait for the pool threads' shares */
+        memb_pool_work(pool);
+        while (pool->pending > 0)
+            pthread_cond_wait(&pool->done_cond, &pool->mutex);
+
+        pool->ops  = NULL;
+        pool->nops = 0;
+        pool->next = 0;
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    else
+        for (u = 0; u < nops; u++)
+            memb_op_run(&ops[u]);
+
+    for (u = 0; u < nops; u++)
+        if (ops[u].status < 0)
+            nerrors++;
+
+    return nerrors;
+}
+#endif /* H5FD_MULTI_THREADS */
+
 #ifdef _H5private_H
 /*
  * This is not related to the functionality of the driver code.
@@ -53,6 +53,9 @@ H5_DLL herr_t  H5FD__free_real(H5FD_t *file, H5FD_mem_t type, haddr_t addr, hsiz
 /* Testing functions */
 #ifdef H5FD_TESTING
 H5_DLL hbool_t H5FD__supports_swmr_test(const char *vfd_name);
+#ifdef H5_HAVE_MMAP
+H5_DLL herr_t H5FD__mmap_get_advice_test(hid_t file_id, int *advice);
+#endif /* H5_HAVE_MMAP */
 #endif /* H5FD_TESTING */
 
 #endif /* H5FDpkg_H */
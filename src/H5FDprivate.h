@@ -37,6 +37,16 @@
 /* Length of filename buffer */
 #define H5FD_MAX_FILENAME_LEN 1024
 
+/*
+ * Feature flag for drivers built into the library which keep the contents
+ * of the file at a stable location in memory while the file is open, so
+ * the library may read directly from that memory instead of copying it out
+ * with the 'read' callback.  Such drivers implement H5FD_class_mem_t.
+ * This isn't part of the public feature flags; it uses the topmost bit so
+ * that it won't collide with flags added to H5FDpublic.h later.
+ */
+#define H5FD_FEAT_MEMORY_IMAGE 0x80000000
+
 #ifdef H5_HAVE_PARALLEL
 /* ======== Temporary data transfer properties ======== */
 /* Definitions for memory MPI type property */
@@ -57,6 +67,15 @@ typedef struct H5FD_class_mpi_t {
 /* Library Private Typedefs */
 /****************************/
 
+/* Sub-class the H5FD_class_t to add a function for VFDs which keep the
+ * contents of the file in memory (see H5FD_FEAT_MEMORY_IMAGE)
+ */
+typedef struct H5FD_class_mem_t {
+    H5FD_class_t super; /* Superclass information & methods */
+    const void *(*get_mem_image)(H5FD_t *file, haddr_t addr,
+                                 size_t size); /* Get a pointer to part of the file in memory */
+} H5FD_class_mem_t;
+
 /* File operations */
 typedef enum {
     OP_UNKNOWN = 0, /* Unknown last file operation */
@@ -131,6 +150,8 @@ H5_DLL herr_t  H5FD_set_feature_flags(H5FD_t *file, unsigned long feature_flags)
 H5_DLL herr_t  H5FD_get_fs_type_map(const H5FD_t *file, H5FD_mem_t *type_map);
 H5_DLL herr_t  H5FD_read(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/);
 H5_DLL herr_t  H5FD_write(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t  H5FD_get_mem_image(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size,
+                                  const void **image /*out*/);
 H5_DLL herr_t  H5FD_flush(H5FD_t *file, hbool_t closing);
 H5_DLL herr_t  H5FD_truncate(H5FD_t *file, hbool_t closing);
 H5_DLL herr_t  H5FD_lock(H5FD_t *file, hbool_t rw);
@@ -32,6 +32,8 @@
 #include "H5FLprivate.h" /* Free Lists               */
 #include "H5Iprivate.h"  /* IDs                      */
 #include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+#include "H5SLprivate.h" /* Skip lists               */
 #include "H5FDs3comms.h" /* S3 Communications        */
 
 #ifdef H5_HAVE_ROS3_VFD
@@ -48,6 +50,74 @@
  */
 static hid_t H5FD_ROS3_g = 0;
 
+/* Name of the file access property holding the block cache configuration
+ */
+#define H5FD_ROS3_CACHE_PROP_NAME "ros3_cache_prop"
+
+/***************************************************************************
+ *
+ * Structure: H5FD_ros3_cache_config_t
+ *
+ * Purpose:
+ *
+ *     Block cache configuration, stored in the file access property list by
+ *     H5Pset_fapl_ros3_cache().
+ *
+ * `block_size` (size_t)
+ *
+ *     Size of each cached block of the object.  Zero disables the cache.
+ *
+ * `nblocks` (size_t)
+ *
+ *     Most blocks kept in the cache.  Zero disables the cache.
+ *
+ * `prefetch_size` (size_t)
+ *
+ *     Bytes at the start of the object read into the cache on open.
+ *
+ ***************************************************************************/
+typedef struct H5FD_ros3_cache_config_t {
+    size_t block_size;
+    size_t nblocks;
+    size_t prefetch_size;
+} H5FD_ros3_cache_config_t;
+
+/***************************************************************************
+ *
+ * Structure: H5FD_ros3_block_t
+ *
+ * Purpose:
+ *
+ *     A cached block of the object.  Blocks are indexed by address in a skip
+ *     list, and kept in a doubly-linked list in order of use, most recently
+ *     used first.
+ *
+ * `addr` (haddr_t)
+ *
+ *     Address of the block in the object, a multiple of the block size.
+ *
+ * `len` (size_t)
+ *
+ *     Bytes in the block, less than the block size only at the end of the
+ *     object.
+ *
+ * `buf` (unsigned char *)
+ *
+ *     The block's data.
+ *
+ * `prev`, `next` (H5FD_ros3_block_t *)
+ *
+ *     Neighbors in the list of blocks in order of use.
+ *
+ ***************************************************************************/
+typedef struct H5FD_ros3_block_t {
+    haddr_t                   addr;
+    size_t                    len;
+    unsigned char *           buf;
+    struct H5FD_ros3_block_t *prev;
+    struct H5FD_ros3_block_t *next;
+} H5FD_ros3_block_t;
+
 #if ROS3_STATS
 
 /* arbitrarily large value, such that any reasonable size read will be "less"
@@ -166,6 +236,19 @@ typedef struct {
  *     Responsible for communicating with remote host and presenting file
  *     contents as indistinguishable from a file on the local filesystem.
  *
+ * `cache_config` (H5FD_ros3_cache_config_t)
+ *
+ *     Block cache configuration from the FAPL.
+ *
+ * `cache` (H5SL_t *)
+ *
+ *     Cached blocks of the object, indexed by address.  NULL when the cache
+ *     is disabled.
+ *
+ * `cache_head`, `cache_tail` (H5FD_ros3_block_t *)
+ *
+ *     Most and least recently used cached blocks.
+ *
  * *** present only if ROS3_SATS is flagged to enable stats collection ***
  *
  * `meta` (ros3_statsbin[])
@@ -190,10 +273,14 @@ typedef struct {
  *
  ***************************************************************************/
 typedef struct H5FD_ros3_t {
-    H5FD_t           pub;
-    H5FD_ros3_fapl_t fa;
-    haddr_t          eoa;
-    s3r_t *          s3r_handle;
+    H5FD_t                   pub;
+    H5FD_ros3_fapl_t         fa;
+    haddr_t                  eoa;
+    s3r_t *                  s3r_handle;
+    H5FD_ros3_cache_config_t cache_config;
+    H5SL_t *                 cache;
+    H5FD_ros3_block_t *      cache_head;
+    H5FD_ros3_block_t *      cache_tail;
 #if ROS3_STATS
     ros3_statsbin meta[ROS3_STATS_BIN_COUNT + 1];
     ros3_statsbin raw[ROS3_STATS_BIN_COUNT + 1];
@@ -233,6 +320,12 @@ static herr_t  H5FD__ros3_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, h
 static herr_t  H5FD__ros3_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 
 static herr_t H5FD__ros3_validate_config(const H5FD_ros3_fapl_t *fa);
+static herr_t H5FD__ros3_get_cache_config(H5P_genplist_t *plist, H5FD_ros3_cache_config_t *config);
+
+static void   H5FD__ros3_cache_touch(H5FD_ros3_t *file, H5FD_ros3_block_t *block);
+static herr_t H5FD__ros3_cache_insert(H5FD_ros3_t *file, haddr_t addr, const unsigned char *buf, size_t len);
+static herr_t H5FD__ros3_cache_read(H5FD_ros3_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t H5FD__ros3_cache_dest(H5FD_ros3_t *file);
 
 static const H5FD_class_t H5FD_ros3_g = {
     "ros3",                   /* name                 */
@@ -272,6 +365,9 @@ static const H5FD_class_t H5FD_ros3_g = {
 /* Declare a free list to manage the H5FD_ros3_t struct */
 H5FL_DEFINE_STATIC(H5FD_ros3_t);
 
+/* Declare a free list to manage the H5FD_ros3_block_t struct */
+H5FL_DEFINE_STATIC(H5FD_ros3_block_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
  *
@@ -504,6 +600,130 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_fapl_ros3() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_ros3_cache
+ *
+ * Purpose:     Configure the block cache of the ros3 driver.  Reads are
+ *              served from a least-recently-used cache of up to NBLOCKS
+ *              blocks of BLOCK_SIZE bytes, and the first PREFETCH_SIZE
+ *              bytes of the object are read into it when the file is
+ *              opened.  A zero BLOCK_SIZE or NBLOCKS disables the cache.
+ *
+ *              The setting is independent of H5Pset_fapl_ros3(), and can
+ *              be made before or after it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_ros3_cache(hid_t fapl_id, size_t block_size, size_t nblocks, size_t prefetch_size)
+{
+    H5P_genplist_t *         plist = NULL; /* Property list pointer */
+    H5FD_ros3_cache_config_t config;
+    htri_t                   exists;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "izzz", fapl_id, block_size, nblocks, prefetch_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    config.block_size    = block_size;
+    config.nblocks       = nblocks;
+    config.prefetch_size = prefetch_size;
+
+    if ((exists = H5P_exist_plist(plist, H5FD_ROS3_CACHE_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "failed to check if property exists in plist")
+    if (exists) {
+        if (H5P_set(plist, H5FD_ROS3_CACHE_PROP_NAME, &config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+    }
+    else if (H5P_insert(plist, H5FD_ROS3_CACHE_PROP_NAME, sizeof(H5FD_ros3_cache_config_t), &config, NULL,
+                        NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "unable to register property in plist")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_ros3_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_ros3_cache
+ *
+ * Purpose:     Returns the block cache configuration of the ros3 driver
+ *              set by H5Pset_fapl_ros3_cache(), or the defaults if it
+ *              wasn't called.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_ros3_cache(hid_t fapl_id, size_t *block_size /*out*/, size_t *nblocks /*out*/,
+                       size_t *prefetch_size /*out*/)
+{
+    H5P_genplist_t *         plist = NULL; /* Property list pointer */
+    H5FD_ros3_cache_config_t config;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, block_size, nblocks, prefetch_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    if (H5FD__ros3_get_cache_config(plist, &config) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get block cache configuration")
+
+    if (block_size)
+        *block_size = config.block_size;
+    if (nblocks)
+        *nblocks = config.nblocks;
+    if (prefetch_size)
+        *prefetch_size = config.prefetch_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_ros3_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_get_cache_config
+ *
+ * Purpose:     Retrieves the block cache configuration from a file access
+ *              property list, falling back to the defaults.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_get_cache_config(H5P_genplist_t *plist, H5FD_ros3_cache_config_t *config)
+{
+    htri_t exists;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(plist);
+    HDassert(config);
+
+    if ((exists = H5P_exist_plist(plist, H5FD_ROS3_CACHE_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "failed to check if property exists in plist")
+    if (exists) {
+        if (H5P_get(plist, H5FD_ROS3_CACHE_PROP_NAME, config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+    }
+    else {
+        config->block_size    = H5FD_ROS3_CACHE_BLOCK_SIZE_DEF;
+        config->nblocks       = H5FD_ROS3_CACHE_NBLOCKS_DEF;
+        config->prefetch_size = H5FD_ROS3_CACHE_PREFETCH_SIZE_DEF;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_get_cache_config() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__ros3_fapl_get
  *
@@ -704,6 +924,7 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     unsigned char    signing_key[SHA256_DIGEST_LENGTH];
     s3r_t *          handle = NULL;
     H5FD_ros3_fapl_t fa;
+    H5P_genplist_t * plist     = NULL;
     H5FD_t *         ret_value = NULL;
 
     FUNC_ENTER_STATIC
@@ -727,6 +948,8 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
 
     if (FAIL == H5Pget_fapl_ros3(fapl_id, &fa))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "can't get property list")
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
 
     if (CURLE_OK != curl_global_init(CURL_GLOBAL_DEFAULT))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to initialize curl global (placeholder flags)")
@@ -768,6 +991,23 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     file->s3r_handle = handle;
     H5MM_memcpy(&(file->fa), &fa, sizeof(H5FD_ros3_fapl_t));
 
+    /* Set up the block cache, and read the start of the object into it,
+     * where the superblock and root group usually are.
+     */
+    if (H5FD__ros3_get_cache_config(plist, &file->cache_config) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get block cache configuration")
+    if (file->cache_config.block_size > 0 && file->cache_config.nblocks > 0) {
+        size_t prefetch_size;
+
+        if (NULL == (file->cache = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, NULL, "can't create block cache")
+
+        prefetch_size = MIN(file->cache_config.prefetch_size, H5FD_s3comms_s3r_get_filesize(handle));
+        prefetch_size = MIN(prefetch_size, file->cache_config.block_size * file->cache_config.nblocks);
+        if (prefetch_size > 0 && H5FD__ros3_cache_read(file, (haddr_t)0, prefetch_size, NULL) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, NULL, "unable to prefetch start of file")
+    }
+
 #if ROS3_STATS
     if (FAIL == ros3_reset_stats(file))
         HGOTO_ERROR(H5E_INTERNAL, H5E_UNINITIALIZED, NULL, "unable to reset file statistics")
@@ -780,8 +1020,11 @@ done:
         if (handle != NULL)
             if (FAIL == H5FD_s3comms_s3r_close(handle))
                 HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "unable to close s3 file handle")
-        if (file != NULL)
+        if (file != NULL) {
+            if (file->cache && H5FD__ros3_cache_dest(file) < 0)
+                HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to release block cache")
             file = H5FL_FREE(H5FD_ros3_t, file);
+        }
         curl_global_cleanup(); /* early cleanup because open failed */
     }                          /* end if null return value (error) */
 
@@ -1112,6 +1355,10 @@ H5FD__ros3_close(H5FD_t H5_ATTR_UNUSED *_file)
         HGOTO_ERROR(H5E_INTERNAL, H5E_ERROR, FAIL, "problem while writing file statistics")
 #endif /* ROS3_STATS */
 
+    /* Release the block cache */
+    if (file->cache && H5FD__ros3_cache_dest(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to release block cache")
+
     /* Release the file info */
     file = H5FL_FREE(H5FD_ros3_t, file);
 
@@ -1424,6 +1671,289 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__ros3_get_handle() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_cache_touch
+ *
+ * Purpose:     Moves a cached block to the most recently used end of the
+ *              cache list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__ros3_cache_touch(H5FD_ros3_t *file, H5FD_ros3_block_t *block)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(block);
+
+    if (file->cache_head != block) {
+        /* Unlink */
+        block->prev->next = block->next;
+        if (block->next)
+            block->next->prev = block->prev;
+        else
+            file->cache_tail = block->prev;
+
+        /* Link at head */
+        block->prev            = NULL;
+        block->next            = file->cache_head;
+        file->cache_head->prev = block;
+        file->cache_head       = block;
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__ros3_cache_touch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_cache_insert
+ *
+ * Purpose:     Copies LEN bytes of the object at ADDR from BUF into a new
+ *              block at the most recently used end of the cache, evicting
+ *              least recently used blocks to keep within the configured
+ *              number of blocks.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_cache_insert(H5FD_ros3_t *file, haddr_t addr, const unsigned char *buf, size_t len)
+{
+    H5FD_ros3_block_t *block     = NULL;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->cache);
+    HDassert(buf);
+
+    /* Evict from the least recently used end */
+    while (file->cache_tail && H5SL_count(file->cache) >= file->cache_config.nblocks) {
+        H5FD_ros3_block_t *victim = file->cache_tail;
+
+        if (NULL == H5SL_remove(file->cache, &victim->addr))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTREMOVE, FAIL, "can't remove block from cache")
+        file->cache_tail = victim->prev;
+        if (file->cache_tail)
+            file->cache_tail->next = NULL;
+        else
+            file->cache_head = NULL;
+
+        H5MM_xfree(victim->buf);
+        victim = H5FL_FREE(H5FD_ros3_block_t, victim);
+    }
+
+    if (NULL == (block = H5FL_CALLOC(H5FD_ros3_block_t)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate cache block")
+    if (NULL == (block->buf = (unsigned char *)H5MM_malloc(len)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate cache block buffer")
+    block->addr = addr;
+    block->len  = len;
+    H5MM_memcpy(block->buf, buf, len);
+
+    if (H5SL_insert(file->cache, block, &block->addr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "can't insert block into cache")
+
+    block->next = file->cache_head;
+    if (file->cache_head)
+        file->cache_head->prev = block;
+    else
+        file->cache_tail = block;
+    file->cache_head = block;
+
+done:
+    if (ret_value < 0 && block) {
+        H5MM_xfree(block->buf);
+        block = H5FL_FREE(H5FD_ros3_block_t, block);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_cache_read
+ *
+ * Purpose:     Reads SIZE bytes of the object at ADDR into BUF through the
+ *              block cache.
+ *
+ *              Blocks of the range that aren't cached are coalesced into
+ *              runs of adjacent blocks, and each run is fetched with one
+ *              range request.  When there is more than one run, the
+ *              requests are issued concurrently.  Ranges larger than the
+ *              whole cache are read directly and not cached.
+ *
+ *              BUF may be NULL to only bring the range into the cache.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_cache_read(H5FD_ros3_t *file, haddr_t addr, size_t size, void *buf)
+{
+    size_t             block_size = file->cache_config.block_size;
+    size_t             filesize;
+    haddr_t            first, last, blk;
+    haddr_t *          run_offsets = NULL; /* Address of each run of missing blocks */
+    size_t *           run_lens    = NULL; /* Length of each run of missing blocks  */
+    void **            run_dests   = NULL; /* Where each run is read into          */
+    size_t             nruns       = 0;
+    unsigned char *    fetched     = NULL; /* Missing blocks, back to back          */
+    size_t             nfetched    = 0;
+    hbool_t            in_run      = FALSE;
+    size_t             u;
+    H5FD_ros3_block_t *block;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->cache);
+    HDassert(block_size > 0);
+
+    if (size == 0)
+        HGOTO_DONE(SUCCEED)
+
+    filesize = H5FD_s3comms_s3r_get_filesize(file->s3r_handle);
+    first    = addr / block_size;
+    last     = (addr + size - 1) / block_size;
+
+    /* Too large to cache: read straight through */
+    if ((last - first + 1) > file->cache_config.nblocks) {
+        if (buf && H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+        HGOTO_DONE(SUCCEED)
+    }
+
+    if (NULL == (run_offsets = (haddr_t *)H5MM_malloc((size_t)(last - first + 1) * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate run addresses")
+    if (NULL == (run_lens = (size_t *)H5MM_malloc((size_t)(last - first + 1) * sizeof(size_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate run lengths")
+    if (NULL == (run_dests = (void **)H5MM_malloc((size_t)(last - first + 1) * sizeof(void *))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate run buffers")
+
+    /* Touch the cached blocks of the range and coalesce the missing ones */
+    for (blk = first; blk <= last; blk++) {
+        haddr_t blk_addr = blk * block_size;
+        size_t  blk_len  = (size_t)MIN((haddr_t)block_size, filesize - blk_addr);
+
+        if (NULL != (block = (H5FD_ros3_block_t *)H5SL_search(file->cache, &blk_addr))) {
+            H5FD__ros3_cache_touch(file, block);
+            in_run = FALSE;
+        }
+        else if (in_run)
+            run_lens[nruns - 1] += blk_len;
+        else {
+            run_offsets[nruns] = blk_addr;
+            run_lens[nruns]    = blk_len;
+            nruns++;
+            in_run = TRUE;
+        }
+    }
+
+    if (nruns > 0) {
+        size_t total = 0;
+
+        for (u = 0; u < nruns; u++)
+            total += run_lens[u];
+        if (NULL == (fetched = (unsigned char *)H5MM_malloc(total)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "can't allocate read buffer")
+        for (u = 0; u < nruns; u++) {
+            run_dests[u] = fetched + nfetched;
+            nfetched += run_lens[u];
+        }
+
+        if (nruns == 1) {
+            if (H5FD_s3comms_s3r_read(file->s3r_handle, run_offsets[0], run_lens[0], fetched) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+        }
+        else if (H5FD_s3comms_s3r_read_multi(file->s3r_handle, nruns, run_offsets, run_lens, run_dests) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute parallel reads")
+
+        /* Split the runs into blocks.  The blocks of this range are at the
+         * head of the list, so eviction only takes other blocks.
+         */
+        for (u = 0; u < nruns; u++) {
+            const unsigned char *src = (const unsigned char *)run_dests[u];
+            haddr_t              blk_addr;
+
+            for (blk_addr = run_offsets[u]; blk_addr < run_offsets[u] + run_lens[u]; blk_addr += block_size) {
+                size_t blk_len = (size_t)MIN((haddr_t)block_size, run_offsets[u] + run_lens[u] - blk_addr);
+
+                if (H5FD__ros3_cache_insert(file, blk_addr, src, blk_len) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "can't cache block")
+                src += blk_len;
+            }
+        }
+    }
+
+    /* Copy the range out of the cache */
+    if (buf) {
+        unsigned char *dst = (unsigned char *)buf;
+
+        for (blk = first; blk <= last; blk++) {
+            haddr_t blk_addr = blk * block_size;
+            haddr_t start    = MAX(addr, blk_addr);
+            haddr_t end      = MIN(addr + size, blk_addr + block_size);
+
+            if (NULL == (block = (H5FD_ros3_block_t *)H5SL_search(file->cache, &blk_addr)))
+                HGOTO_ERROR(H5E_VFL, H5E_NOTFOUND, FAIL, "block missing from cache")
+            HDassert(end - blk_addr <= block->len);
+            H5MM_memcpy(dst + (start - addr), block->buf + (start - blk_addr), (size_t)(end - start));
+        }
+    }
+
+done:
+    H5MM_xfree(fetched);
+    H5MM_xfree(run_dests);
+    H5MM_xfree(run_lens);
+    H5MM_xfree(run_offsets);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_cache_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_cache_dest
+ *
+ * Purpose:     Releases the block cache.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_cache_dest(H5FD_ros3_t *file)
+{
+    H5FD_ros3_block_t *block;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->cache);
+
+    block = file->cache_head;
+    while (block) {
+        H5FD_ros3_block_t *next = block->next;
+
+        H5MM_xfree(block->buf);
+        block = H5FL_FREE(H5FD_ros3_block_t, block);
+        block = next;
+    }
+    file->cache_head = file->cache_tail = NULL;
+
+    if (H5SL_close(file->cache) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEOBJ, FAIL, "can't close block cache")
+    file->cache = NULL;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_cache_dest() */
+
 /*-------------------------------------------------------------------------
  *
  * Function: H5FD__ros3_read()
@@ -1474,7 +2004,11 @@ H5FD__ros3_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if ((addr > filesize) || ((addr + size) > filesize))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "range exceeds file address")
 
-    if (H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) == FAIL)
+    if (file->cache) {
+        if (H5FD__ros3_cache_read(file, addr, size, buf) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read through block cache")
+    }
+    else if (H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) == FAIL)
         HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
 
 #if ROS3_STATS
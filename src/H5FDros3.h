@@ -85,6 +85,15 @@ typedef struct H5FD_ros3_fapl_t {
     char    secret_key[H5FD_ROS3_MAX_SECRET_KEY_LEN + 1];
 } H5FD_ros3_fapl_t;
 
+/* Default block cache configuration, used unless H5Pset_fapl_ros3_cache()
+ * is called on the file access property list.  Reads are served from a
+ * least-recently-used cache of fixed-size blocks of the object, and the
+ * first `prefetch_size` bytes are fetched into it when the file is opened.
+ */
+#define H5FD_ROS3_CACHE_BLOCK_SIZE_DEF    (256 * 1024)
+#define H5FD_ROS3_CACHE_NBLOCKS_DEF       64
+#define H5FD_ROS3_CACHE_PREFETCH_SIZE_DEF (1024 * 1024)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -92,6 +101,9 @@ extern "C" {
 H5_DLL hid_t  H5FD_ros3_init(void);
 H5_DLL herr_t H5Pget_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa_out);
 H5_DLL herr_t H5Pset_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa);
+H5_DLL herr_t H5Pset_fapl_ros3_cache(hid_t fapl_id, size_t block_size, size_t nblocks, size_t prefetch_size);
+H5_DLL herr_t H5Pget_fapl_ros3_cache(hid_t fapl_id, size_t *block_size /*out*/, size_t *nblocks /*out*/,
+                                     size_t *prefetch_size /*out*/);
 
 #ifdef __cplusplus
 }
@@ -67,6 +67,9 @@
  */
 #define S3COMMS_MAX_RANGE_STRING_SIZE 128
 
+/* Most range requests `H5FD_s3comms_s3r_read_multi()` keeps in flight */
+#define S3COMMS_MAX_PARALLEL_REQUESTS 8
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -1163,50 +1166,30 @@ done:
 
 /*----------------------------------------------------------------------------
  *
- * Function: H5FD_s3comms_s3r_read()
+ * Function: H5FD__s3comms_s3r_set_range()
  *
  * Purpose:
  *
- *     Read file pointed to by request handle, writing specified
- *     `offset` .. `offset + len` bytes to buffer `dest`.
- *
- *     If `len` is 0, reads entirety of file starting at `offset`.
- *     If `offset` and `len` are both 0, reads entire file.
- *
- *     If `offset` or `offset+len` is greater than the file size, read is
- *     aborted and returns `FAIL`.
- *
- *     Uses configured "curl easy handle" to perform request.
- *
- *     In event of error, buffer should remain unaltered.
- *
- *     If handle is set to authorize a request, creates a new (temporary)
- *     HTTP Request object (hrb_t) for generating requisite headers,
- *     which is then translated to a `curl slist` and set in the curl handle
- *     for the request.
- *
- *     `dest` _may_ be NULL, but no body data will be recorded.
+ *     Set up curl handle `curlh` to request bytes `offset` .. `offset + len`
+ *     of the object behind request handle `handle`, with the same rules for
+ *     `offset` and `len` as `H5FD_s3comms_s3r_read()`.
  *
- *     - In general practice, NULL should never be passed in as `dest`.
- *     - NULL `dest` passed in by internal function `s3r_getsize()`, in
- *       conjunction with CURLOPT_NOBODY to preempt transmission of file data
- *       from server.
+ *     If the handle is set to authorize requests, the signed headers are
+ *     set in the curl handle and the list holding them is passed back in
+ *     `*curlheaders`.  The caller must free it with `curl_slist_free_all()`
+ *     once the request is performed.  Otherwise `*curlheaders` is NULL.
  *
  * Return:
  *
  *     - SUCCESS: `SUCCEED`
  *     - FAILURE: `FAIL`
  *
- * Programmer: Jacob Smith
- *             2017-08-22
- *
  *----------------------------------------------------------------------------
  */
-herr_t
-H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
+static herr_t
+H5FD__s3comms_s3r_set_range(s3r_t *handle, CURL *curlh, haddr_t offset, size_t len,
+                            struct curl_slist **curlheaders_out)
 {
-    CURL *             curlh         = NULL;
-    CURLcode           p_status      = CURLE_OK;
     struct curl_slist *curlheaders   = NULL;
     hrb_node_t *       headers       = NULL;
     hrb_node_t *       node          = NULL;
@@ -1215,49 +1198,13 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
     hrb_t *            request       = NULL;
     int                ret           = 0; /* working variable to check  */
                                           /* return value of HDsnprintf  */
-    struct s3r_datastruct *sds       = NULL;
-    herr_t                 ret_value = SUCCEED;
-
-    FUNC_ENTER_NOAPI_NOINIT
-
-#if S3COMMS_DEBUG
-    HDfprintf(stdout, "called H5FD_s3comms_s3r_read.\n");
-#endif
-
-    /**************************************
-     * ABSOLUTELY NECESSARY SANITY-CHECKS *
-     **************************************/
-
-    if (handle == NULL)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle cannot be null.");
-    if (handle->magic != S3COMMS_S3R_MAGIC)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has invalid magic.");
-    if (handle->curlhandle == NULL)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) curlhandle.")
-    if (handle->purl == NULL)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) url.")
-    HDassert(handle->purl->magic == S3COMMS_PARSED_URL_MAGIC);
-    if (offset > handle->filesize || (len + offset) > handle->filesize)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to read past EoF")
-
-    curlh = handle->curlhandle;
-
-    /*********************
-     * PREPARE WRITEDATA *
-     *********************/
+    herr_t ret_value = SUCCEED;
 
-    if (dest != NULL) {
-        sds = (struct s3r_datastruct *)H5MM_malloc(sizeof(struct s3r_datastruct));
-        if (sds == NULL)
-            HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructure.");
+    FUNC_ENTER_STATIC
 
-        sds->magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
-        sds->data  = (char *)dest;
-        sds->size  = 0;
-        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, sds))
-            HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
-                        "error while setting CURL option (CURLOPT_WRITEDATA).");
-    }
+    HDassert(handle);
+    HDassert(curlh);
+    HDassert(curlheaders_out);
 
     /*********************
      * FORMAT HTTP RANGE *
@@ -1439,6 +1386,125 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
                         "error while setting CURL option (CURLOPT_HTTPHEADER).");
     } /* end if should authenticate (info provided) */
 
+    *curlheaders_out = curlheaders;
+    curlheaders      = NULL;
+
+done:
+    if (curlheaders != NULL)
+        curl_slist_free_all(curlheaders);
+    if (rangebytesstr != NULL)
+        H5MM_xfree(rangebytesstr);
+    if (request != NULL) {
+        while (headers != NULL)
+            if (FAIL == H5FD_s3comms_hrb_node_set(&headers, headers->name, NULL))
+                HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header node")
+        HDassert(NULL == headers);
+        if (FAIL == H5FD_s3comms_hrb_destroy(&request))
+            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header request structure")
+        HDassert(NULL == request);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* H5FD__s3comms_s3r_set_range */
+
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD_s3comms_s3r_read()
+ *
+ * Purpose:
+ *
+ *     Read file pointed to by request handle, writing specified
+ *     `offset` .. `offset + len` bytes to buffer `dest`.
+ *
+ *     If `len` is 0, reads entirety of file starting at `offset`.
+ *     If `offset` and `len` are both 0, reads entire file.
+ *
+ *     If `offset` or `offset+len` is greater than the file size, read is
+ *     aborted and returns `FAIL`.
+ *
+ *     Uses configured "curl easy handle" to perform request.
+ *
+ *     In event of error, buffer should remain unaltered.
+ *
+ *     If handle is set to authorize a request, creates a new (temporary)
+ *     HTTP Request object (hrb_t) for generating requisite headers,
+ *     which is then translated to a `curl slist` and set in the curl handle
+ *     for the request.
+ *
+ *     `dest` _may_ be NULL, but no body data will be recorded.
+ *
+ *     - In general practice, NULL should never be passed in as `dest`.
+ *     - NULL `dest` passed in by internal function `s3r_getsize()`, in
+ *       conjunction with CURLOPT_NOBODY to preempt transmission of file data
+ *       from server.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *
+ * Programmer: Jacob Smith
+ *             2017-08-22
+ *
+ *----------------------------------------------------------------------------
+ */
+herr_t
+H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
+{
+    CURL *                 curlh       = NULL;
+    CURLcode               p_status    = CURLE_OK;
+    struct curl_slist *    curlheaders = NULL;
+    struct s3r_datastruct *sds         = NULL;
+    herr_t                 ret_value   = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#if S3COMMS_DEBUG
+    HDfprintf(stdout, "called H5FD_s3comms_s3r_read.\n");
+#endif
+
+    /**************************************
+     * ABSOLUTELY NECESSARY SANITY-CHECKS *
+     **************************************/
+
+    if (handle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle cannot be null.");
+    if (handle->magic != S3COMMS_S3R_MAGIC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has invalid magic.");
+    if (handle->curlhandle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) curlhandle.")
+    if (handle->purl == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) url.")
+    HDassert(handle->purl->magic == S3COMMS_PARSED_URL_MAGIC);
+    if (offset > handle->filesize || (len + offset) > handle->filesize)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to read past EoF")
+
+    curlh = handle->curlhandle;
+
+    /*********************
+     * PREPARE WRITEDATA *
+     *********************/
+
+    if (dest != NULL) {
+        sds = (struct s3r_datastruct *)H5MM_malloc(sizeof(struct s3r_datastruct));
+        if (sds == NULL)
+            HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructure.");
+
+        sds->magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
+        sds->data  = (char *)dest;
+        sds->size  = 0;
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, sds))
+            HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
+                        "error while setting CURL option (CURLOPT_WRITEDATA).");
+    }
+
+    /*******************************
+     * FORMAT RANGE, SIGN REQUEST *
+     *******************************/
+
+    if (FAIL == H5FD__s3comms_s3r_set_range(handle, curlh, offset, len, &curlheaders))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to set up range request");
+
     /*******************
      * PERFORM REQUEST *
      *******************/
@@ -1498,23 +1564,10 @@ done:
         curl_slist_free_all(curlheaders);
         curlheaders = NULL;
     }
-    if (rangebytesstr != NULL) {
-        H5MM_xfree(rangebytesstr);
-        rangebytesstr = NULL;
-    }
     if (sds != NULL) {
         H5MM_xfree(sds);
         sds = NULL;
     }
-    if (request != NULL) {
-        while (headers != NULL)
-            if (FAIL == H5FD_s3comms_hrb_node_set(&headers, headers->name, NULL))
-                HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header node")
-        HDassert(NULL == headers);
-        if (FAIL == H5FD_s3comms_hrb_destroy(&request))
-            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header request structure")
-        HDassert(NULL == request);
-    }
 
     if (curlh != NULL) {
         /* clear any Range */
@@ -1529,6 +1582,161 @@ done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* H5FD_s3comms_s3r_read */
 
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD_s3comms_s3r_read_multi()
+ *
+ * Purpose:
+ *
+ *     Read `count` ranges of the file pointed to by request handle, writing
+ *     `offsets[i]` .. `offsets[i] + lens[i]` bytes to buffer `dests[i]`.
+ *
+ *     The ranges are requested in parallel, up to
+ *     S3COMMS_MAX_PARALLEL_REQUESTS at a time, each through its own copy of
+ *     the handle's "curl easy handle" driven by one "curl multi handle".
+ *     Each request is authorized as in `H5FD_s3comms_s3r_read()`.
+ *
+ *     Every range must be non-empty and lie within the file.
+ *
+ *     In event of error, the contents of the buffers are undefined.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *
+ *----------------------------------------------------------------------------
+ */
+herr_t
+H5FD_s3comms_s3r_read_multi(s3r_t *handle, size_t count, const haddr_t *offsets, const size_t *lens,
+                            void **dests)
+{
+    CURLM *                curlm       = NULL;
+    CURL **                curlhs      = NULL;
+    struct curl_slist **   curlheaders = NULL;
+    struct s3r_datastruct *sds         = NULL;
+    CURLMsg *              msg         = NULL;
+    int                    running     = 0;
+    int                    msgs_left   = 0;
+    size_t                 u           = 0;
+    herr_t                 ret_value   = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#if S3COMMS_DEBUG
+    HDfprintf(stdout, "called H5FD_s3comms_s3r_read_multi.\n");
+#endif
+
+    /**************************************
+     * ABSOLUTELY NECESSARY SANITY-CHECKS *
+     **************************************/
+
+    if (handle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle cannot be null.");
+    if (handle->magic != S3COMMS_S3R_MAGIC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has invalid magic.");
+    if (handle->curlhandle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) curlhandle.")
+    if (handle->purl == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) url.")
+    HDassert(handle->purl->magic == S3COMMS_PARSED_URL_MAGIC);
+    for (u = 0; u < count; u++) {
+        if (dests[u] == NULL)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "destination buffer cannot be null.");
+        if (lens[u] == 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "range cannot be empty.");
+        if (offsets[u] > handle->filesize || (lens[u] + offsets[u]) > handle->filesize)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to read past EoF")
+    }
+
+    if (count == 0)
+        HGOTO_DONE(SUCCEED);
+
+    /*******************
+     * PREPARE REQUESTS *
+     *******************/
+
+    if (NULL == (curlhs = (CURL **)H5MM_calloc(count * sizeof(CURL *))))
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc curl handle array.");
+    if (NULL == (curlheaders = (struct curl_slist **)H5MM_calloc(count * sizeof(struct curl_slist *))))
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc curl header array.");
+    if (NULL == (sds = (struct s3r_datastruct *)H5MM_calloc(count * sizeof(struct s3r_datastruct))))
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructures.");
+
+    if (NULL == (curlm = curl_multi_init()))
+        HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "unable to initialize curl multi handle");
+    if (CURLM_OK !=
+        curl_multi_setopt(curlm, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)S3COMMS_MAX_PARALLEL_REQUESTS))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
+                    "error while setting CURL option (CURLMOPT_MAX_TOTAL_CONNECTIONS).");
+
+    for (u = 0; u < count; u++) {
+        /* Each copy keeps the options set on open, e.g. the URL */
+        if (NULL == (curlhs[u] = curl_easy_duphandle(handle->curlhandle)))
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "unable to copy curl handle");
+
+        sds[u].magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
+        sds[u].data  = (char *)dests[u];
+        sds[u].size  = 0;
+        if (CURLE_OK != curl_easy_setopt(curlhs[u], CURLOPT_WRITEDATA, &sds[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
+                        "error while setting CURL option (CURLOPT_WRITEDATA).");
+
+        if (FAIL == H5FD__s3comms_s3r_set_range(handle, curlhs[u], offsets[u], lens[u], &curlheaders[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to set up range request");
+
+        if (CURLM_OK != curl_multi_add_handle(curlm, curlhs[u]))
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "unable to add request to curl multi handle");
+    }
+
+    /*********************
+     * PERFORM REQUESTS *
+     *********************/
+
+    do {
+        if (CURLM_OK != curl_multi_perform(curlm, &running))
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "curl cannot perform requests")
+        if (running > 0 && CURLM_OK != curl_multi_wait(curlm, NULL, 0, 1000, NULL))
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "error while waiting on curl requests")
+    } while (running > 0);
+
+    while (NULL != (msg = curl_multi_info_read(curlm, &msgs_left)))
+        if (msg->msg == CURLMSG_DONE && msg->data.result != CURLE_OK)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "curl cannot perform request: %s",
+                        curl_easy_strerror(msg->data.result))
+
+    for (u = 0; u < count; u++)
+        if (sds[u].size != lens[u])
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "short read of range %llu: %llu of %llu bytes",
+                        (unsigned long long)offsets[u], (unsigned long long)sds[u].size,
+                        (unsigned long long)lens[u])
+
+done:
+    /* clean any malloc'd resources
+     */
+    if (curlhs != NULL) {
+        for (u = 0; u < count; u++)
+            if (curlhs[u] != NULL) {
+                if (curlm != NULL)
+                    (void)curl_multi_remove_handle(curlm, curlhs[u]);
+                curl_easy_cleanup(curlhs[u]);
+            }
+        H5MM_xfree(curlhs);
+    }
+    if (curlm != NULL)
+        (void)curl_multi_cleanup(curlm);
+    if (curlheaders != NULL) {
+        for (u = 0; u < count; u++)
+            if (curlheaders[u] != NULL)
+                curl_slist_free_all(curlheaders[u]);
+        H5MM_xfree(curlheaders);
+    }
+    if (sds != NULL)
+        H5MM_xfree(sds);
+
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* H5FD_s3comms_s3r_read_multi */
+
 /****************************************************************************
  * MISCELLANEOUS FUNCTIONS
  ****************************************************************************/
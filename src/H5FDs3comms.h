@@ -518,6 +518,9 @@ H5_DLL s3r_t *H5FD_s3comms_s3r_open(const char url[], const char region[], const
 
 H5_DLL herr_t H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest);
 
+H5_DLL herr_t H5FD_s3comms_s3r_read_multi(s3r_t *handle, size_t count, const haddr_t *offsets,
+                                          const size_t *lens, void **dests);
+
 /*********************************
  * DECLARATION OF OTHER ROUTINES *
  *********************************/
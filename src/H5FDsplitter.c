@@ -23,12 +23,21 @@
 #include "H5Eprivate.h"   /* Error handling           */
 #include "H5Fprivate.h"   /* File access              */
 #include "H5FDprivate.h"  /* File drivers             */
+#include "H5FDsec2.h"     /* Sec2 file driver         */
 #include "H5FDsplitter.h" /* Splitter file driver     */
 #include "H5FLprivate.h"  /* Free Lists               */
 #include "H5Iprivate.h"   /* IDs                      */
 #include "H5MMprivate.h"  /* Memory management        */
 #include "H5Pprivate.h"   /* Property lists           */
 
+/* The background W/O thread calls the W/O driver's callbacks, which may push
+ * errors onto the error stack, so it is only available when the library
+ * keeps an error stack per thread.
+ */
+#ifdef H5_HAVE_THREADSAFE
+#define H5FD_SPLITTER_WO_THREAD
+#endif /* H5_HAVE_THREADSAFE */
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SPLITTER_g = 0;
 
@@ -41,14 +50,50 @@ typedef struct H5FD_splitter_fapl_t {
     hbool_t ignore_wo_errs;                            /* TRUE to ignore errors on the W/O channel */
 } H5FD_splitter_fapl_t;
 
+/* Name of the file access property holding the W/O queue configuration */
+#define H5FD_SPLITTER_WO_QUEUE_PROP_NAME "splitter_wo_queue_prop"
+
+#ifdef H5FD_SPLITTER_WO_THREAD
+/* A write or EOA change waiting in the W/O queue.  The write data follows
+ * the struct.  Allocated by the caller's thread and freed by the background
+ * thread, so uses the C library allocator directly.
+ */
+typedef struct H5FD_splitter_wo_op_t {
+    struct H5FD_splitter_wo_op_t *next;    /* next operation in the queue              */
+    H5FD_mem_t                    type;    /* memory type of the operation             */
+    haddr_t                       addr;    /* address of the write, or the new EOA     */
+    size_t                        size;    /* size of the write, 0 for an EOA change   */
+    hbool_t                       set_eoa; /* TRUE to set the EOA instead of writing   */
+} H5FD_splitter_wo_op_t;
+
+/* The W/O queue and the background thread servicing it.  The fields after
+ * the mutex are shared with the thread and only used while holding it.
+ */
+typedef struct H5FD_splitter_wo_q_t {
+    H5TS_thread_t          thread;    /* background thread writing the W/O file          */
+    H5TS_mutex_simple_t    mutex;     /* protects the fields below                       */
+    H5TS_cond_t            work_cond; /* signalled when a write is queued or on stop     */
+    H5TS_cond_t            done_cond; /* signalled when a queued write completes         */
+    H5FD_splitter_wo_op_t *head;      /* oldest write, in progress while the queue is non-empty */
+    H5FD_splitter_wo_op_t *tail;      /* newest write                                    */
+    size_t                 nbytes;    /* bytes of write data in the queue                */
+    hbool_t                stop;      /* TRUE to stop the thread once the queue is empty */
+    hbool_t                failed;    /* TRUE if a write failed since the last check     */
+} H5FD_splitter_wo_q_t;
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
 /* The information of this splitter */
 typedef struct H5FD_splitter_t {
-    H5FD_t               pub;     /* public stuff, must be first    */
-    unsigned             version; /* version of the H5FD_splitter_vfd_config_t structure used */
-    H5FD_splitter_fapl_t fa;      /* driver-specific file access properties */
-    H5FD_t *             rw_file; /* pointer of R/W channel */
-    H5FD_t *             wo_file; /* pointer of W/O channel */
-    FILE *               logfp;   /* Log file pointer */
+    H5FD_t                   pub;       /* public stuff, must be first    */
+    unsigned                 version;   /* version of the H5FD_splitter_vfd_config_t structure used */
+    H5FD_splitter_fapl_t     fa;        /* driver-specific file access properties */
+    H5FD_t *                 rw_file;   /* pointer of R/W channel */
+    H5FD_t *                 wo_file;   /* pointer of W/O channel */
+    FILE *                   logfp;     /* Log file pointer */
+    H5FD_splitter_wo_queue_t wo_config; /* W/O queue configuration */
+#ifdef H5FD_SPLITTER_WO_THREAD
+    H5FD_splitter_wo_q_t *wo_queue; /* W/O queue, NULL when W/O writes are synchronous */
+#endif                              /* H5FD_SPLITTER_WO_THREAD */
 } H5FD_splitter_t;
 
 /*
@@ -102,6 +147,18 @@ typedef struct H5FD_splitter_t {
 static herr_t H5FD__splitter_log_error(const H5FD_splitter_t *file, const char *atfunc, const char *msg);
 static int    H5FD__copy_plist(hid_t fapl_id, hid_t *id_out_ptr);
 
+/* W/O queue routines */
+static herr_t H5FD__splitter_get_wo_config(H5P_genplist_t *plist, H5FD_splitter_wo_queue_t *config);
+#ifdef H5FD_SPLITTER_WO_THREAD
+static void * H5FD__splitter_wo_thread(void *_file);
+static herr_t H5FD__splitter_wo_start(H5FD_splitter_t *file);
+static herr_t H5FD__splitter_wo_enqueue(H5FD_splitter_t *file, H5FD_mem_t type, haddr_t addr, size_t size,
+                                        const void *buf);
+static herr_t H5FD__splitter_wo_sync(H5FD_splitter_t *file, hbool_t wait);
+static herr_t H5FD__splitter_wo_set_eoa(H5FD_splitter_t *file, H5FD_mem_t type, haddr_t addr);
+static herr_t H5FD__splitter_wo_stop(H5FD_splitter_t *file);
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
 /* Prototypes */
 static herr_t  H5FD__splitter_term(void);
 static hsize_t H5FD__splitter_sb_size(H5FD_t *_file);
@@ -425,6 +482,426 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_fapl_splitter() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_splitter_wo_queue
+ *
+ * Purpose:     Sets how the splitter driver services its W/O channel.  At
+ *              the H5FD_SPLITTER_WO_FLUSH and H5FD_SPLITTER_WO_ASYNC
+ *              durability levels, W/O writes are copied into a queue of
+ *              up to QUEUE_SIZE bytes and written by a background thread,
+ *              so that write latency is that of the R/W channel alone.
+ *              The background thread only supports the sec2 driver on
+ *              the W/O channel, which is checked when the file is opened.
+ *
+ *              The setting is independent of H5Pset_fapl_splitter(), and
+ *              can be made before or after it.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_splitter_wo_queue(hid_t fapl_id, const H5FD_splitter_wo_queue_t *config)
+{
+    H5P_genplist_t *         plist_ptr = NULL;
+    H5FD_splitter_wo_queue_t new_config;
+    htri_t                   exists;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*#", fapl_id, config);
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    if (NULL == (plist_ptr = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (NULL == config)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "config pointer is null")
+    if (config->durability != H5FD_SPLITTER_WO_SYNC && config->durability != H5FD_SPLITTER_WO_FLUSH &&
+        config->durability != H5FD_SPLITTER_WO_ASYNC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid W/O durability level")
+    if (0 == config->queue_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "W/O queue size must be positive")
+#ifndef H5FD_SPLITTER_WO_THREAD
+    if (config->durability != H5FD_SPLITTER_WO_SYNC)
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "background W/O writes need a thread-safe library")
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
+    new_config = *config;
+
+    if ((exists = H5P_exist_plist(plist_ptr, H5FD_SPLITTER_WO_QUEUE_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "failed to check if property exists in plist")
+    if (exists) {
+        if (H5P_set(plist_ptr, H5FD_SPLITTER_WO_QUEUE_PROP_NAME, &new_config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+    }
+    else if (H5P_insert(plist_ptr, H5FD_SPLITTER_WO_QUEUE_PROP_NAME, sizeof(H5FD_splitter_wo_queue_t),
+                        &new_config, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "unable to register property in plist")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_splitter_wo_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_splitter_wo_queue
+ *
+ * Purpose:     Returns the W/O queue configuration set by
+ *              H5Pset_fapl_splitter_wo_queue(), or the default
+ *              (synchronous W/O writes) if it wasn't called.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_splitter_wo_queue(hid_t fapl_id, H5FD_splitter_wo_queue_t *config /*out*/)
+{
+    H5P_genplist_t *plist_ptr = NULL;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, config);
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    if (NULL == (plist_ptr = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (NULL == config)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "config pointer is null")
+
+    if (H5FD__splitter_get_wo_config(plist_ptr, config) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get W/O queue configuration")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_splitter_wo_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_get_wo_config
+ *
+ * Purpose:     Retrieves the W/O queue configuration from a file access
+ *              property list, falling back to the default.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_get_wo_config(H5P_genplist_t *plist, H5FD_splitter_wo_queue_t *config)
+{
+    htri_t exists;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(plist);
+    HDassert(config);
+
+    if ((exists = H5P_exist_plist(plist, H5FD_SPLITTER_WO_QUEUE_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "failed to check if property exists in plist")
+    if (exists) {
+        if (H5P_get(plist, H5FD_SPLITTER_WO_QUEUE_PROP_NAME, config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+    }
+    else {
+        config->durability = H5FD_SPLITTER_WO_SYNC;
+        config->queue_size = H5FD_SPLITTER_WO_QUEUE_SIZE_DEF;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_get_wo_config() */
+
+#ifdef H5FD_SPLITTER_WO_THREAD
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wo_thread
+ *
+ * Purpose:     Body of the background thread: writes the queued data to
+ *              the W/O file and applies the queued EOA changes, in order,
+ *              until told to stop.
+ *
+ *              The W/O driver's callbacks are called directly rather than
+ *              through H5FD_write() and H5FD_set_eoa(), which use library
+ *              state that belongs to the application's thread.  While the
+ *              queue is running, only this thread calls into the W/O
+ *              driver; the application's thread empties the queue before
+ *              flushing, truncating, locking or closing it.
+ *
+ *              This thread can't take the library's lock, which the
+ *              application's thread holds while it waits for the queue,
+ *              so the W/O driver must not use any other library state.
+ *              Only the sec2 driver is known not to, and the queue is
+ *              only started for it.
+ *
+ * Return:      NULL
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__splitter_wo_thread(void *_file)
+{
+    H5FD_splitter_t *     file  = (H5FD_splitter_t *)_file;
+    H5FD_splitter_wo_q_t *queue = file->wo_queue;
+    H5FD_t *              wo    = file->wo_file;
+
+    H5TS_mutex_lock_simple(&queue->mutex);
+    for (;;) {
+        H5FD_splitter_wo_op_t *op;
+        herr_t                 status;
+
+        while (NULL == queue->head && !queue->stop)
+            H5TS_cond_wait(&queue->work_cond, &queue->mutex);
+        if (NULL == queue->head)
+            break;
+
+        /* Leave the write at the head of the queue until it is done, so that
+         * waiting for an empty queue also waits for it.
+         */
+        op = queue->head;
+        H5TS_mutex_unlock_simple(&queue->mutex);
+
+        if (op->set_eoa)
+            status = (wo->cls->set_eoa)(wo, op->type, op->addr + wo->base_addr);
+        else
+            status = (wo->cls->write)(wo, op->type, H5P_DATASET_XFER_DEFAULT, op->addr + wo->base_addr,
+                                      op->size, (const void *)(op + 1));
+
+        H5TS_mutex_lock_simple(&queue->mutex);
+        if (status < 0)
+            queue->failed = TRUE;
+        if (NULL == (queue->head = op->next))
+            queue->tail = NULL;
+        queue->nbytes -= op->size;
+        HDfree(op);
+        H5TS_cond_broadcast(&queue->done_cond);
+    }
+    H5TS_mutex_unlock_simple(&queue->mutex);
+
+    return NULL;
+} /* end H5FD__splitter_wo_thread() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wo_start
+ *
+ * Purpose:     Creates the W/O queue and starts its background thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wo_start(H5FD_splitter_t *file)
+{
+    H5FD_splitter_wo_q_t *queue        = NULL;
+    hbool_t               mutex_init   = FALSE;
+    hbool_t               work_cv_init = FALSE;
+    hbool_t               done_cv_init = FALSE;
+    herr_t                ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(file);
+    HDassert(file->wo_file);
+    HDassert(NULL == file->wo_queue);
+
+    if (NULL == (queue = (H5FD_splitter_wo_q_t *)H5MM_calloc(sizeof(H5FD_splitter_wo_q_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate W/O queue")
+    if (H5TS_mutex_init(&queue->mutex))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize W/O queue mutex")
+    mutex_init = TRUE;
+    if (H5TS_cond_init(&queue->work_cond))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize W/O queue condition")
+    work_cv_init = TRUE;
+    if (H5TS_cond_init(&queue->done_cond))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize W/O queue condition")
+    done_cv_init = TRUE;
+
+    file->wo_queue = queue;
+    if (H5TS_thread_create(&queue->thread, H5FD__splitter_wo_thread, file)) {
+        file->wo_queue = NULL;
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, FAIL, "can't start W/O thread")
+    }
+
+done:
+    if (ret_value < 0 && queue) {
+        if (done_cv_init)
+            H5TS_cond_destroy(&queue->done_cond);
+        if (work_cv_init)
+            H5TS_cond_destroy(&queue->work_cond);
+        if (mutex_init)
+            H5TS_mutex_destroy(&queue->mutex);
+        H5MM_xfree(queue);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wo_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wo_enqueue
+ *
+ * Purpose:     Copies a write into the W/O queue, first waiting for room
+ *              if the queue is full.  A NULL BUF queues setting the W/O
+ *              file's EOA to ADDR instead.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wo_enqueue(H5FD_splitter_t *file, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_splitter_wo_q_t * queue     = file->wo_queue;
+    H5FD_splitter_wo_op_t *op        = NULL;
+    herr_t                 ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(queue);
+
+    if (NULL == (op = (H5FD_splitter_wo_op_t *)HDmalloc(sizeof(H5FD_splitter_wo_op_t) + size)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate W/O write")
+    op->next    = NULL;
+    op->type    = type;
+    op->addr    = addr;
+    op->size    = size;
+    op->set_eoa = (NULL == buf);
+    if (buf)
+        H5MM_memcpy(op + 1, buf, size);
+
+    H5TS_mutex_lock_simple(&queue->mutex);
+
+    /* A write larger than the whole queue goes in once the queue is empty */
+    while (queue->nbytes > 0 && queue->nbytes + size > file->wo_config.queue_size)
+        H5TS_cond_wait(&queue->done_cond, &queue->mutex);
+
+    if (queue->tail)
+        queue->tail->next = op;
+    else
+        queue->head = op;
+    queue->tail = op;
+    queue->nbytes += size;
+    H5TS_cond_signal(&queue->work_cond);
+
+    H5TS_mutex_unlock_simple(&queue->mutex);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wo_enqueue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wo_sync
+ *
+ * Purpose:     Reports whether any queued W/O write has failed since the
+ *              last call, after waiting for the queue to empty if WAIT is
+ *              TRUE.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wo_sync(H5FD_splitter_t *file, hbool_t wait)
+{
+    H5FD_splitter_wo_q_t *queue = file->wo_queue;
+    hbool_t               failed;
+    herr_t                ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(queue);
+
+    H5TS_mutex_lock_simple(&queue->mutex);
+    if (wait)
+        while (queue->head)
+            H5TS_cond_wait(&queue->done_cond, &queue->mutex);
+    failed        = queue->failed;
+    queue->failed = FALSE;
+    H5TS_mutex_unlock_simple(&queue->mutex);
+
+    if (failed)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "background write to W/O file failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wo_sync() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wo_set_eoa
+ *
+ * Purpose:     Queues setting the W/O file's EOA to ADDR behind the writes
+ *              already in the queue.  Like queued writes, a failure is
+ *              reported by the next flush.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wo_set_eoa(H5FD_splitter_t *file, H5FD_mem_t type, haddr_t addr)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(file->wo_queue);
+
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get EOA for R/W file")
+    if (H5FD__splitter_wo_enqueue(file, type, addr, 0, NULL) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "unable to queue EOA change for W/O file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wo_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wo_stop
+ *
+ * Purpose:     Writes out the W/O queue, stops the background thread and
+ *              releases the queue.
+ *
+ * Return:      SUCCEED/FAIL, FAIL if any queued write failed since the
+ *              last check.  The queue is released either way.
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wo_stop(H5FD_splitter_t *file)
+{
+    H5FD_splitter_wo_q_t *queue = file->wo_queue;
+    hbool_t               failed;
+    herr_t                ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(queue);
+
+    H5TS_mutex_lock_simple(&queue->mutex);
+    queue->stop = TRUE;
+    H5TS_cond_signal(&queue->work_cond);
+    H5TS_mutex_unlock_simple(&queue->mutex);
+
+    H5TS_wait_for_thread(queue->thread);
+    HDassert(NULL == queue->head);
+    failed = queue->failed;
+
+    H5TS_cond_destroy(&queue->done_cond);
+    H5TS_cond_destroy(&queue->work_cond);
+    H5TS_mutex_destroy(&queue->mutex);
+    file->wo_queue = H5MM_xfree(queue);
+
+    if (failed)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "background write to W/O file failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wo_stop() */
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__splitter_flush
  *
@@ -437,6 +914,7 @@ static herr_t
 H5FD__splitter_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
 {
     H5FD_splitter_t *file      = (H5FD_splitter_t *)_file;
+    hbool_t          wo_idle   = TRUE;    /* Whether the W/O file may be flushed */
     herr_t           ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -446,7 +924,20 @@ H5FD__splitter_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closin
     /* Public API for dxpl "context" */
     if (H5FDflush(file->rw_file, dxpl_id, closing) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush R/W file")
-    if (H5FDflush(file->wo_file, dxpl_id, closing) < 0)
+
+#ifdef H5FD_SPLITTER_WO_THREAD
+    /* Wait for the queued W/O writes, unless they may run behind until the
+     * file is closed.  Either way, report any of them that failed.
+     */
+    if (file->wo_queue) {
+        wo_idle = closing || H5FD_SPLITTER_WO_FLUSH == file->wo_config.durability;
+        if (H5FD__splitter_wo_sync(file, wo_idle) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                                   "background write to W/O file failed")
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
+    if (wo_idle && H5FDflush(file->wo_file, dxpl_id, closing) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush W/O file")
 
 done:
@@ -525,6 +1016,13 @@ H5FD__splitter_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr
     /* Public API for dxpl "context" */
     if (H5FDwrite(file->rw_file, type, dxpl_id, addr, size, buf) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "R/W file write failed")
+#ifdef H5FD_SPLITTER_WO_THREAD
+    if (file->wo_queue) {
+        if (H5FD__splitter_wo_enqueue(file, type, addr, size, buf) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "unable to queue W/O write")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
     if (H5FDwrite(file->wo_file, type, dxpl_id, addr, size, buf) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write W/O file")
 
@@ -717,6 +1215,18 @@ H5FD__splitter_open(const char *name, unsigned flags, hid_t splitter_fapl_id, ha
     if (!file_ptr->wo_file)
         H5FD_SPLITTER_WO_ERROR(file_ptr, FUNC, H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to open W/O file")
 
+    /* Start servicing the W/O channel in the background, if asked to */
+    if (H5FD__splitter_get_wo_config(plist_ptr, &file_ptr->wo_config) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get W/O queue configuration")
+#ifdef H5FD_SPLITTER_WO_THREAD
+    if (file_ptr->wo_file && H5FD_SPLITTER_WO_SYNC != file_ptr->wo_config.durability) {
+        if (file_ptr->wo_file->driver_id != H5FD_SEC2)
+            HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, NULL, "background W/O writes need the sec2 W/O driver")
+        if (H5FD__splitter_wo_start(file_ptr) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "can't start W/O queue")
+    } /* end if */
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
     ret_value = (H5FD_t *)file_ptr;
 
 done:
@@ -752,6 +1262,7 @@ static herr_t
 H5FD__splitter_close(H5FD_t *_file)
 {
     H5FD_splitter_t *file      = (H5FD_splitter_t *)_file;
+    hbool_t          wo_failed = FALSE; /* Whether to report a failed background W/O write */
     herr_t           ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -761,6 +1272,16 @@ H5FD__splitter_close(H5FD_t *_file)
     /* Sanity check */
     HDassert(file);
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    /* Finish the queued W/O writes.  A failure is reported once the files
+     * are closed, so that they aren't left open.
+     */
+    if (file->wo_queue && H5FD__splitter_wo_stop(file) < 0) {
+        H5FD__splitter_log_error(file, FUNC, "background write to W/O file failed");
+        wo_failed = !file->fa.ignore_wo_errs;
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
     if (H5I_dec_ref(file->fa.rw_fapl_id) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_ARGS, FAIL, "can't close R/W FAPL")
     if (H5I_dec_ref(file->fa.wo_fapl_id) < 0)
@@ -782,6 +1303,9 @@ H5FD__splitter_close(H5FD_t *_file)
     file = H5FL_FREE(H5FD_splitter_t, file);
     file = NULL;
 
+    if (wo_failed)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "background write to W/O file failed")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__splitter_close() */
@@ -847,6 +1371,13 @@ H5FD__splitter_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t ad
     if (H5FD_set_eoa(file->rw_file, type, addr) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "H5FDset_eoa failed for R/W file")
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    if (file->wo_queue) {
+        if (H5FD__splitter_wo_set_eoa(file, type, addr) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTSET, FAIL, "unable to set EOA for W/O file")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
     if (H5FD_set_eoa(file->wo_file, type, addr) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTSET, FAIL, "unable to set EOA for W/O file")
 
@@ -912,6 +1443,19 @@ H5FD__splitter_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     if (H5FDtruncate(file->rw_file, dxpl_id, closing) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate R/W file")
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    /* The library truncates on every flush, so a W/O file whose writes may
+     * run behind is only truncated when it is closed.
+     */
+    if (file->wo_queue) {
+        if (!closing && H5FD_SPLITTER_WO_ASYNC == file->wo_config.durability)
+            HGOTO_DONE(SUCCEED)
+        if (H5FD__splitter_wo_sync(file, TRUE) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                                   "background write to W/O file failed")
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
+
     if (H5FDtruncate(file->wo_file, dxpl_id, closing) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate W/O file")
 
@@ -1098,6 +1642,11 @@ H5FD__splitter_lock(H5FD_t *_file, hbool_t rw)
     if (H5FD_lock(file->rw_file, rw) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock R/W file")
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    if (file->wo_queue && H5FD__splitter_wo_sync(file, TRUE) < 0)
+        H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                               "background write to W/O file failed")
+#endif /* H5FD_SPLITTER_WO_THREAD */
     if (file->wo_file != NULL)
         if (H5FD_lock(file->wo_file, rw) < 0)
             H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock W/O file")
@@ -1132,6 +1681,11 @@ H5FD__splitter_unlock(H5FD_t *_file)
     if (H5FD_unlock(file->rw_file) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock R/W file")
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    if (file->wo_queue && H5FD__splitter_wo_sync(file, TRUE) < 0)
+        H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                               "background write to W/O file failed")
+#endif /* H5FD_SPLITTER_WO_THREAD */
     if (file->wo_file != NULL)
         if (H5FD_unlock(file->wo_file) < 0)
             HGOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock W/O file")
@@ -1204,6 +1758,15 @@ H5FD__splitter_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, hsize_t size
     if ((ret_value = H5FDalloc(file->rw_file, type, dxpl_id, size)) == HADDR_UNDEF)
         HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, HADDR_UNDEF, "unable to allocate for R/W file")
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    /* The W/O file mirrors the R/W file's space, so queue its new EOA */
+    if (file->wo_queue) {
+        if (H5FD__splitter_wo_set_eoa(file, type, H5FD_get_eoa(file->rw_file, type)) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, HADDR_UNDEF,
+                                   "unable to alloc for W/O file")
+        HGOTO_DONE(ret_value)
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
     if (H5FDalloc(file->wo_file, type, dxpl_id, size) == HADDR_UNDEF)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, HADDR_UNDEF, "unable to alloc for W/O file")
 
@@ -1266,6 +1829,13 @@ H5FD__splitter_free(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     if (H5FDfree(file->rw_file, type, dxpl_id, addr, size) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free for R/W file")
 
+#ifdef H5FD_SPLITTER_WO_THREAD
+    if (file->wo_queue) {
+        if (H5FD__splitter_wo_set_eoa(file, type, H5FD_get_eoa(file->rw_file, type)) < 0)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, FAIL, "unable to free for W/O file")
+        HGOTO_DONE(SUCCEED)
+    }
+#endif /* H5FD_SPLITTER_WO_THREAD */
     if (H5FDfree(file->wo_file, type, dxpl_id, addr, size) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTINIT, FAIL, "unable to free for W/O file")
 
@@ -84,12 +84,67 @@ typedef struct H5FD_splitter_vfd_config_t {
     hbool_t      ignore_wo_errs;
 } H5FD_splitter_vfd_config_t;
 
+/* ----------------------------------------------------------------------------
+ * Enum:        H5FD_splitter_wo_durability_t
+ *
+ * How far behind the Read/Write channel the Write-Only channel may fall.
+ *
+ * H5FD_SPLITTER_WO_SYNC
+ *      Each write reaches the Write-Only channel before it returns.  This is
+ *      the default.
+ *
+ * H5FD_SPLITTER_WO_FLUSH
+ *      Writes are queued for a background thread, and every flush waits for
+ *      the queue to empty and then flushes the Write-Only channel.
+ *
+ * H5FD_SPLITTER_WO_ASYNC
+ *      Writes are queued for a background thread, and only closing the file
+ *      waits for the queue to empty.
+ *
+ * With either queued level, a failure on the Write-Only channel is reported
+ * by the next flush, truncate or close, subject to ignore_wo_errs.  The
+ * queued levels are only available in a thread-safe library, and opening a
+ * file with them fails unless the Write-Only channel uses the sec2 driver.
+ * ----------------------------------------------------------------------------
+ */
+typedef enum H5FD_splitter_wo_durability_t {
+    H5FD_SPLITTER_WO_SYNC = 0,
+    H5FD_SPLITTER_WO_FLUSH,
+    H5FD_SPLITTER_WO_ASYNC
+} H5FD_splitter_wo_durability_t;
+
+/* ----------------------------------------------------------------------------
+ * Structure:   H5FD_splitter_wo_queue_t
+ *
+ * Configuration of the Write-Only channel's background queue, set with
+ * H5Pset_fapl_splitter_wo_queue().
+ *
+ * durability (H5FD_splitter_wo_durability_t)
+ *      See above.
+ *
+ * queue_size (size_t)
+ *      Most bytes of write data held in the queue.  A write that would
+ *      overflow it waits for the background thread to catch up; a single
+ *      write larger than the queue waits for it to empty.  Must be non-zero.
+ *
+ * ----------------------------------------------------------------------------
+ */
+typedef struct H5FD_splitter_wo_queue_t {
+    H5FD_splitter_wo_durability_t durability;
+    size_t                        queue_size;
+} H5FD_splitter_wo_queue_t;
+
+/* Default Write-Only queue size */
+#define H5FD_SPLITTER_WO_QUEUE_SIZE_DEF (64 * 1024 * 1024)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 H5_DLL hid_t  H5FD_splitter_init(void);
 H5_DLL herr_t H5Pset_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config_ptr);
 H5_DLL herr_t H5Pget_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config_ptr);
+H5_DLL herr_t H5Pset_fapl_splitter_wo_queue(hid_t fapl_id, const H5FD_splitter_wo_queue_t *config);
+H5_DLL herr_t H5Pget_fapl_splitter_wo_queue(hid_t fapl_id, H5FD_splitter_wo_queue_t *config /*out*/);
 
 #ifdef __cplusplus
 }
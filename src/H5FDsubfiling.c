@@ -0,0 +1,1769 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     The subfiling driver stripes the address space of one
+ *              logical HDF5 file over several ordinary files ("subfiles"),
+ *              typically one per node or per I/O aggregator, so that ranks
+ *              writing one shared file no longer contend on the locks of a
+ *              single file-system object.
+ *
+ *              The name given to H5Fcreate()/H5Fopen() is a small text
+ *              configuration record holding the stripe size and the
+ *              subfile names; see H5FDsubfiling.h for the layout.  Rank 0
+ *              creates or reads the record and broadcasts it, then every
+ *              rank opens the subfiles and reads and writes the stripes it
+ *              needs directly with pread()/pwrite().  Collective transfers
+ *              use the memory and file MPI datatypes that the library sets
+ *              up for MPI-IO, flattened into (offset, length) lists.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions                    */
+#include "H5CXprivate.h" /* API Contexts                         */
+#include "H5Eprivate.h"  /* Error handling                       */
+#include "H5Fprivate.h"  /* File access                          */
+#include "H5FDprivate.h" /* File drivers                         */
+#include "H5FDmpi.h"     /* MPI-based file drivers               */
+#include "H5Iprivate.h"  /* IDs                                  */
+#include "H5MMprivate.h" /* Memory management                    */
+#include "H5Pprivate.h"  /* Property lists                       */
+
+#include "H5FDsubfiling_priv.h" /* Configuration records shared with h5fuse */
+
+#ifdef H5_HAVE_PARALLEL
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_SUBFILING_g = 0;
+
+/*
+ * The description of a file belonging to this driver.  As with the MPI-IO
+ * driver, the EOF is only kept up to date until the first write; the
+ * library only needs it just after the file is opened.
+ */
+typedef struct H5FD_subfiling_t {
+    H5FD_t                pub;       /* Public stuff, must be first                  */
+    H5FD_subfiling_fapl_t fa;        /* Layout of this file                          */
+    int *                 fds;       /* Subfile descriptors                          */
+    hbool_t *             dirty;     /* Subfiles written since the last flush        */
+    MPI_Comm              comm;      /* MPI Communicator                             */
+    MPI_Info              info;      /* MPI info object                              */
+    int                   mpi_rank;  /* This process's rank                          */
+    int                   mpi_size;  /* Total number of processes                    */
+    haddr_t               eof;       /* End-of-file marker                           */
+    haddr_t               eoa;       /* End-of-address marker                        */
+    haddr_t               last_eoa;  /* Last known end-of-address marker             */
+    haddr_t               local_eof; /* Local end-of-file address for each process   */
+} H5FD_subfiling_t;
+
+/* One contiguous piece of a flattened MPI datatype */
+typedef struct H5FD_subfiling_blk_t {
+    MPI_Aint off; /* Displacement of the piece from the start of the type */
+    MPI_Aint len; /* Length of the piece in bytes                         */
+} H5FD_subfiling_blk_t;
+
+/* An MPI datatype flattened into its pieces, in type map order */
+typedef struct H5FD_subfiling_flat_t {
+    size_t                nblks;  /* Number of pieces          */
+    size_t                nalloc; /* Number of pieces allocated */
+    H5FD_subfiling_blk_t *blks;   /* The pieces                */
+} H5FD_subfiling_flat_t;
+
+/* Private Prototypes */
+static char * H5FD__subfiling_make_config(const char *name, const H5FD_subfiling_fapl_t *fa);
+static herr_t H5FD__subfiling_setup(const char *name, unsigned flags, const H5FD_subfiling_fapl_t *fa,
+                                    char **config, haddr_t *eof);
+static herr_t H5FD__subfiling_io(H5FD_subfiling_t *file, hbool_t do_write, haddr_t addr, size_t size,
+                                 void *buf);
+static herr_t H5FD__subfiling_flatten(MPI_Datatype type, H5FD_subfiling_flat_t *flat);
+static herr_t H5FD__subfiling_xfer_types(H5FD_subfiling_t *file, hbool_t do_write, haddr_t addr, int count,
+                                         MPI_Datatype buf_type, MPI_Datatype file_type, void *buf);
+
+/* Callbacks */
+static herr_t   H5FD__subfiling_term(void);
+static void *   H5FD__subfiling_fapl_get(H5FD_t *_file);
+static H5FD_t * H5FD__subfiling_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t   H5FD__subfiling_close(H5FD_t *_file);
+static herr_t   H5FD__subfiling_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t  H5FD__subfiling_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t   H5FD__subfiling_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t  H5FD__subfiling_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t   H5FD__subfiling_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t   H5FD__subfiling_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                     void *buf);
+static herr_t   H5FD__subfiling_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                      const void *buf);
+static herr_t   H5FD__subfiling_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t   H5FD__subfiling_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static int      H5FD__subfiling_mpi_rank(const H5FD_t *_file);
+static int      H5FD__subfiling_mpi_size(const H5FD_t *_file);
+static MPI_Comm H5FD__subfiling_communicator(const H5FD_t *_file);
+
+/* The subfiling file driver information */
+static const H5FD_class_mpi_t H5FD_subfiling_g = {
+    {
+        /* Start of superclass information */
+        "subfiling",                   /*name			*/
+        HADDR_MAX,                     /*maxaddr		*/
+        H5F_CLOSE_SEMI,                /*fc_degree		*/
+        H5FD__subfiling_term,          /*terminate             */
+        NULL,                          /*sb_size		*/
+        NULL,                          /*sb_encode		*/
+        NULL,                          /*sb_decode		*/
+        sizeof(H5FD_subfiling_fapl_t), /*fapl_size		*/
+        H5FD__subfiling_fapl_get,      /*fapl_get		*/
+        NULL,                          /*fapl_copy		*/
+        NULL,                          /*fapl_free		*/
+        0,                             /*dxpl_size		*/
+        NULL,                          /*dxpl_copy		*/
+        NULL,                          /*dxpl_free		*/
+        H5FD__subfiling_open,          /*open			*/
+        H5FD__subfiling_close,         /*close			*/
+        NULL,                          /*cmp			*/
+        H5FD__subfiling_query,         /*query			*/
+        NULL,                          /*get_type_map		*/
+        NULL,                          /*alloc			*/
+        NULL,                          /*free			*/
+        H5FD__subfiling_get_eoa,       /*get_eoa		*/
+        H5FD__subfiling_set_eoa,       /*set_eoa		*/
+        H5FD__subfiling_get_eof,       /*get_eof		*/
+        H5FD__subfiling_get_handle,    /*get_handle            */
+        H5FD__subfiling_read,          /*read			*/
+        H5FD__subfiling_write,         /*write			*/
+        H5FD__subfiling_flush,         /*flush			*/
+        H5FD__subfiling_truncate,      /*truncate		*/
+        NULL,                          /*lock                  */
+        NULL,                          /*unlock                */
+        H5FD_FLMAP_DICHOTOMY           /*fl_map                */
+    },                                 /* End of superclass information */
+    H5FD__subfiling_mpi_rank,          /*get_rank              */
+    H5FD__subfiling_mpi_size,          /*get_size              */
+    H5FD__subfiling_communicator       /*get_comm              */
+};
+
+/*--------------------------------------------------------------------------
+NAME
+   H5FD__init_package -- Initialize interface-specific information
+
+USAGE
+    herr_t H5FD__init_package()
+
+RETURNS
+    SUCCEED/FAIL
+
+DESCRIPTION
+    Initializes any interface-specific data or routines.  (Just calls
+    H5FD_subfiling_init currently).
+
+--------------------------------------------------------------------------*/
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (H5FD_subfiling_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize subfiling VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_subfiling_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the subfiling driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_subfiling_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_SUBFILING_g))
+        H5FD_SUBFILING_g =
+            H5FD_register((const H5FD_class_t *)&H5FD_subfiling_g, sizeof(H5FD_class_mpi_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_SUBFILING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_subfiling_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     Non-negative on success or negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_SUBFILING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__subfiling_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_subfiling
+ *
+ * Purpose:     Modify the file access property list to use the subfiling
+ *              driver.  COMM and INFO are duplicated as for
+ *              H5Pset_fapl_mpio(); FA, which may be NULL for the defaults,
+ *              gives the layout used when a file is created.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_subfiling(hid_t fapl_id, MPI_Comm comm, MPI_Info info, const H5FD_subfiling_fapl_t *fa)
+{
+    H5FD_subfiling_fapl_t def_fa;
+    H5P_genplist_t *      plist; /* Property list pointer */
+    herr_t                ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iMcMi*#", fapl_id, comm, info, fa);
+
+    /* Check arguments */
+    if (fapl_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list")
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if (MPI_COMM_NULL == comm)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "MPI_COMM_NULL is not a valid communicator")
+    if (NULL == fa) {
+        HDmemset(&def_fa, 0, sizeof(def_fa));
+        def_fa.magic   = H5FD_SUBFILING_FAPL_MAGIC;
+        def_fa.version = H5FD_SUBFILING_CURR_FAPL_VERSION;
+        fa             = &def_fa;
+    }
+    if (H5FD_SUBFILING_FAPL_MAGIC != fa->magic)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid subfiling configuration (magic number mismatch)")
+    if (H5FD_SUBFILING_CURR_FAPL_VERSION != fa->version)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unsupported subfiling configuration version")
+    if (fa->stripe_count < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe count can't be negative")
+
+    /* Set the MPI communicator and info object */
+    if (H5P_set(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, &comm) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set MPI communicator")
+    if (H5P_set(plist, H5F_ACS_MPI_PARAMS_INFO_NAME, &info) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set MPI info object")
+
+    ret_value = H5P_set_driver(plist, H5FD_SUBFILING, fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_subfiling() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_subfiling
+ *
+ * Purpose:     Returns duplicates of the communicator and info object and
+ *              a copy of the layout stored by H5Pset_fapl_subfiling().  It
+ *              is the responsibility of the application to free the
+ *              returned communicator and info object.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_subfiling(hid_t fapl_id, MPI_Comm *comm /*out*/, MPI_Info *info /*out*/,
+                      H5FD_subfiling_fapl_t *fa_out /*out*/)
+{
+    const H5FD_subfiling_fapl_t *fa;
+    H5P_genplist_t *             plist;               /* Property list pointer */
+    herr_t                       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, comm, info, fa_out);
+
+    /* Set comm and info in case we have problems */
+    if (comm)
+        *comm = MPI_COMM_NULL;
+    if (info)
+        *info = MPI_INFO_NULL;
+
+    /* Check arguments */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_SUBFILING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "VFL driver is not subfiling")
+    if (NULL == (fa = (const H5FD_subfiling_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if (fa_out)
+        H5MM_memcpy(fa_out, fa, sizeof(H5FD_subfiling_fapl_t));
+
+    /* Get the MPI communicator and info object */
+    if (comm)
+        if (H5P_get(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, comm) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI communicator")
+    if (info)
+        if (H5P_get(plist, H5F_ACS_MPI_PARAMS_INFO_NAME, info) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI info object")
+
+done:
+    /* Clean up anything duplicated on errors. The free calls will set
+     * the output values to MPI_COMM|INFO_NULL.
+     */
+    if (ret_value != SUCCEED) {
+        if (comm)
+            if (H5_mpi_comm_free(comm) < 0)
+                HDONE_ERROR(H5E_PLIST, H5E_CANTFREE, FAIL, "unable to free MPI communicator")
+        if (info)
+            if (H5_mpi_info_free(info) < 0)
+                HDONE_ERROR(H5E_PLIST, H5E_CANTFREE, FAIL, "unable to free MPI info object")
+    }
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_subfiling() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_fapl_get
+ *
+ * Purpose:     Returns the layout of an open file, so that
+ *              H5Fget_access_plist() reports the stripe size and count
+ *              actually in use.
+ *
+ * Return:      Success:    Pointer to a new H5FD_subfiling_fapl_t
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__subfiling_fapl_get(H5FD_t *_file)
+{
+    H5FD_subfiling_t *     file      = (H5FD_subfiling_t *)_file;
+    H5FD_subfiling_fapl_t *fa        = NULL;
+    void *                 ret_value = NULL;
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (fa = (H5FD_subfiling_fapl_t *)H5MM_malloc(sizeof(H5FD_subfiling_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    H5MM_memcpy(fa, &file->fa, sizeof(H5FD_subfiling_fapl_t));
+
+    ret_value = fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_make_config
+ *
+ * Purpose:     Builds the text of the configuration record for a file
+ *              called NAME with layout FA.  The subfile names are stored
+ *              without a directory, relative to the record.
+ *
+ * Return:      Success:    The record, which the caller must free
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static char *
+H5FD__subfiling_make_config(const char *name, const H5FD_subfiling_fapl_t *fa)
+{
+    const char *base;
+    char *      config = NULL;
+    size_t      alloc, len;
+    int         i;
+    char *      ret_value = NULL;
+
+    FUNC_ENTER_STATIC
+
+    base  = HDstrrchr(name, '/') ? HDstrrchr(name, '/') + 1 : name;
+    alloc = 256 + (size_t)fa->stripe_count * (HDstrlen(base) + 64);
+    if (NULL == (config = (char *)H5MM_malloc(alloc)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    len = (size_t)HDsnprintf(config, alloc, "%s\nversion %d\nstripe_size %" PRIuHSIZE "\nstripe_count %d\n",
+                             H5FD_SUBFILING_CONFIG_MAGIC, H5FD_SUBFILING_CONFIG_VERSION, fa->stripe_size,
+                             (int)fa->stripe_count);
+    for (i = 0; i < fa->stripe_count; i++) {
+        len += (size_t)HDsnprintf(config + len, alloc - len, "subfile %d ", i);
+        len += (size_t)HDsnprintf(config + len, alloc - len, H5FD_SUBFILING_NAME_FORMAT, base, i,
+                                  (int)fa->stripe_count);
+        len += (size_t)HDsnprintf(config + len, alloc - len, "\n");
+    }
+    HDassert(len < alloc);
+
+    ret_value = config;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_make_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_setup
+ *
+ * Purpose:     Rank 0's part of opening a file: applies the create,
+ *              truncate and exclusive flags to the configuration record
+ *              and the subfiles, then returns the record in effect and the
+ *              logical EOF derived from the subfile sizes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_setup(const char *name, unsigned flags, const H5FD_subfiling_fapl_t *fa, char **config,
+                      haddr_t *eof)
+{
+    H5FD_subfiling_fapl_t old_fa;
+    h5_stat_t             sb;
+    char **               names  = NULL;
+    char *                buf    = NULL;
+    FILE *                fp     = NULL;
+    hbool_t               exists = FALSE;
+    int                   fd     = -1;
+    int                   i;
+    herr_t                ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    *config = NULL;
+    *eof    = 0;
+    HDmemset(&old_fa, 0, sizeof(old_fa));
+
+    exists = (0 == HDstat(name, &sb));
+    if (exists && (flags & H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, FAIL, "file exists")
+    if (!exists && !(flags & H5F_ACC_CREAT))
+        HGOTO_ERROR(H5E_FILE, H5E_NOTFOUND, FAIL, "file doesn't exist")
+
+    if (exists && (flags & H5F_ACC_TRUNC)) {
+        /* Whatever is there gets replaced, but remember its subfiles */
+        H5E_BEGIN_TRY
+        {
+            if (NULL != (buf = H5FD__subfiling_read_config(name)))
+                H5FD__subfiling_parse_config(name, buf, &old_fa, &names);
+        }
+        H5E_END_TRY;
+    }
+    else if (exists) {
+        if (NULL == (buf = H5FD__subfiling_read_config(name)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to read subfiling configuration")
+        if (H5FD__subfiling_parse_config(name, buf, &old_fa, &names) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "unable to decode subfiling configuration")
+    }
+
+    if (!exists || (flags & H5F_ACC_TRUNC)) {
+        size_t len;
+
+        /* Drop the old subfiles, which may be laid out differently */
+        for (i = 0; names && i < old_fa.stripe_count; i++)
+            HDremove(names[i]);
+        H5FD__subfiling_free_names(names, old_fa.stripe_count);
+        names = NULL;
+        H5MM_xfree(buf);
+
+        if (NULL == (buf = H5FD__subfiling_make_config(name, fa)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to build subfiling configuration")
+        if (NULL == (fp = HDfopen(name, "w")))
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTCREATE, FAIL, "unable to create subfiling configuration")
+        len = HDstrlen(buf);
+        if (len != HDfwrite(buf, 1, len, fp))
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write subfiling configuration")
+        if (0 != HDfclose(fp)) {
+            fp = NULL;
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write subfiling configuration")
+        }
+        fp = NULL;
+
+        if (H5FD__subfiling_parse_config(name, buf, &old_fa, &names) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "unable to decode subfiling configuration")
+        for (i = 0; i < old_fa.stripe_count; i++) {
+            if ((fd = HDopen(names[i], O_RDWR | O_CREAT | O_TRUNC, H5_POSIX_CREATE_MODE_RW)) < 0)
+                HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTCREATE, FAIL, "unable to create subfile")
+            HDclose(fd);
+            fd = -1;
+        }
+    }
+    else {
+        /* The logical EOF is the furthest stripe byte held by any subfile */
+        for (i = 0; i < old_fa.stripe_count; i++) {
+            hsize_t ss = old_fa.stripe_size;
+            hsize_t last;
+
+            if (HDstat(names[i], &sb) < 0)
+                HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to stat subfile")
+            if (0 == sb.st_size)
+                continue;
+            last = (hsize_t)sb.st_size - 1;
+            last = ((last / ss) * (hsize_t)old_fa.stripe_count + (hsize_t)i) * ss + last % ss + 1;
+            *eof = MAX(*eof, (haddr_t)last);
+        }
+    }
+
+    *config = buf;
+    buf     = NULL;
+
+done:
+    if (fp)
+        HDfclose(fp);
+    if (fd >= 0)
+        HDclose(fd);
+    H5FD__subfiling_free_names(names, old_fa.stripe_count);
+    H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_setup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_open
+ *
+ * Purpose:     Opens a subfiled file.  This is collective: rank 0 checks
+ *              or creates the configuration record and the subfiles and
+ *              broadcasts the record, then every rank opens the subfiles.
+ *
+ * Return:      Success:    A new file pointer
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__subfiling_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t H5_ATTR_UNUSED maxaddr)
+{
+    H5FD_subfiling_t *           file = NULL;
+    const H5FD_subfiling_fapl_t *user_fa;
+    H5FD_subfiling_fapl_t        fa;
+    H5P_genplist_t *             plist; /* Property list pointer */
+    MPI_Comm                     comm   = MPI_COMM_NULL;
+    MPI_Info                     info   = MPI_INFO_NULL;
+    char *                       config = NULL;
+    char **                      names  = NULL;
+    const char *                 s;
+    haddr_t                      eof = 0;
+    long long                    hdr[2]; /* Status or record length, and logical EOF */
+    int                          mpi_rank, mpi_size;
+    int                          mpi_code; /* MPI return code */
+    int                          ok, all_ok;
+    int                          i;
+    H5FD_t *                     ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Get a pointer to the fapl */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+
+    /* Get the MPI communicator and info object from the property list */
+    if (H5P_get(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, &comm) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get MPI communicator")
+    if (H5P_get(plist, H5F_ACS_MPI_PARAMS_INFO_NAME, &info) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get MPI info object")
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_rank(comm, &mpi_rank)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Comm_rank failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_size(comm, &mpi_size)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Comm_size failed", mpi_code)
+
+    /* Work out the layout to use if the file is created */
+    HDmemset(&fa, 0, sizeof(fa));
+    fa.magic   = H5FD_SUBFILING_FAPL_MAGIC;
+    fa.version = H5FD_SUBFILING_CURR_FAPL_VERSION;
+    if (NULL != (user_fa = (const H5FD_subfiling_fapl_t *)H5P_peek_driver_info(plist))) {
+        fa.stripe_size  = user_fa->stripe_size;
+        fa.stripe_count = user_fa->stripe_count;
+    }
+    if (0 == fa.stripe_size && NULL != (s = HDgetenv(H5FD_SUBFILING_STRIPE_SIZE_ENV)))
+        fa.stripe_size = (hsize_t)HDstrtoull(s, NULL, 0);
+    if (0 == fa.stripe_size)
+        fa.stripe_size = H5FD_SUBFILING_DEFAULT_STRIPE_SIZE;
+    if (0 == fa.stripe_count && NULL != (s = HDgetenv(H5FD_SUBFILING_STRIPE_COUNT_ENV)))
+        fa.stripe_count = (int32_t)HDstrtol(s, NULL, 0);
+    if (fa.stripe_count <= 0) {
+        /* One subfile per node: count the ranks that lead a node */
+#if MPI_VERSION >= 3
+        MPI_Comm node_comm = MPI_COMM_NULL;
+        int      node_rank;
+        int      leader;
+
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm)))
+            HMPI_GOTO_ERROR(NULL, "MPI_Comm_split_type failed", mpi_code)
+        mpi_code = MPI_Comm_rank(node_comm, &node_rank);
+        MPI_Comm_free(&node_comm);
+        if (MPI_SUCCESS != mpi_code)
+            HMPI_GOTO_ERROR(NULL, "MPI_Comm_rank failed", mpi_code)
+        leader = (0 == node_rank);
+        if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&leader, &fa.stripe_count, 1, MPI_INT, MPI_SUM, comm)))
+            HMPI_GOTO_ERROR(NULL, "MPI_Allreduce failed", mpi_code)
+#else
+        fa.stripe_count = 1;
+#endif
+    }
+
+    /* Rank 0 sets up the record and the subfiles; a failure there is
+     * broadcast as a negative length so that no rank is left waiting.
+     */
+    if (0 == mpi_rank) {
+        if (H5FD__subfiling_setup(name, flags, &fa, &config, &eof) < 0)
+            hdr[0] = -1;
+        else
+            hdr[0] = (long long)HDstrlen(config) + 1;
+        hdr[1] = (long long)eof;
+    }
+    if (MPI_SUCCESS != (mpi_code = MPI_Bcast(hdr, 2, MPI_LONG_LONG, 0, comm)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
+    if (hdr[0] < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open subfiling configuration")
+    if (0 != mpi_rank && NULL == (config = (char *)H5MM_malloc((size_t)hdr[0])))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    if (MPI_SUCCESS != (mpi_code = MPI_Bcast(config, (int)hdr[0], MPI_CHAR, 0, comm)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
+    eof = (haddr_t)hdr[1];
+
+    /* Build the return value and initialize it */
+    if (NULL == (file = (H5FD_subfiling_t *)H5MM_calloc(sizeof(H5FD_subfiling_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    file->comm     = comm;
+    file->info     = info;
+    file->mpi_rank = mpi_rank;
+    file->mpi_size = mpi_size;
+    comm           = MPI_COMM_NULL;
+    info           = MPI_INFO_NULL;
+
+    /* Every rank opens every subfile.  Agree on success before going on,
+     * since a rank that failed can't take part in the library's collective
+     * operations on the file.
+     */
+    ok = (H5FD__subfiling_parse_config(name, config, &file->fa, &names) >= 0);
+    if (ok && NULL == (file->fds = (int *)H5MM_malloc((size_t)file->fa.stripe_count * sizeof(int))))
+        ok = 0;
+    for (i = 0; ok && i < file->fa.stripe_count; i++)
+        file->fds[i] = -1;
+    if (ok && NULL == (file->dirty = (hbool_t *)H5MM_calloc((size_t)file->fa.stripe_count * sizeof(hbool_t))))
+        ok = 0;
+    for (i = 0; ok && i < file->fa.stripe_count; i++)
+        if ((file->fds[i] = HDopen(names[i], (flags & H5F_ACC_RDWR) ? O_RDWR : O_RDONLY)) < 0)
+            ok = 0;
+    if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&ok, &all_ok, 1, MPI_INT, MPI_MIN, file->comm)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Allreduce failed", mpi_code)
+    if (!all_ok)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open subfiles")
+
+    /* Set the size of the file (from library's perspective) */
+    file->eof       = eof;
+    file->local_eof = eof;
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    /* (The names can only have been decoded into a file that exists) */
+    if (names)
+        H5FD__subfiling_free_names(names, file->fa.stripe_count);
+    if (NULL == ret_value) {
+        if (file) {
+            for (i = 0; file->fds && i < file->fa.stripe_count; i++)
+                if (file->fds[i] >= 0)
+                    HDclose(file->fds[i]);
+            H5MM_xfree(file->fds);
+            H5MM_xfree(file->dirty);
+            H5_mpi_comm_free(&file->comm);
+            H5_mpi_info_free(&file->info);
+            H5MM_xfree(file);
+        }
+        if (H5_mpi_comm_free(&comm) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free MPI communicator")
+        if (H5_mpi_info_free(&info) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free MPI info object")
+    }
+    H5MM_xfree(config);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_close
+ *
+ * Purpose:     Closes a file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_close(H5FD_t *_file)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+    int               i;
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    for (i = 0; i < file->fa.stripe_count; i++)
+        if (HDclose(file->fds[i]) < 0)
+            HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close subfile")
+
+    /* Clean up other stuff */
+    H5_mpi_comm_free(&file->comm);
+    H5_mpi_info_free(&file->info);
+    H5MM_xfree(file->fds);
+    H5MM_xfree(file->dirty);
+    H5MM_xfree(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations              */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations      */
+        *flags |= H5FD_FEAT_HAS_MPI;             /* This driver uses MPI                              */
+        *flags |= H5FD_FEAT_ALLOCATE_EARLY;      /* Allocate space early instead of late              */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__subfiling_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file.
+ *
+ * Return:      The end-of-address marker
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__subfiling_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__subfiling_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__subfiling_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_get_eof
+ *
+ * Purpose:     Gets the end-of-file marker for the file, i.e. the end of
+ *              the last stripe byte stored in any subfile.  As with the
+ *              MPI-IO driver this is HADDR_UNDEF once the file has been
+ *              written to.
+ *
+ * Return:      The end-of-file marker
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__subfiling_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__subfiling_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_get_handle
+ *
+ * Purpose:     Returns a pointer to the array of subfile descriptors.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_subfiling_t *file      = (H5FD_subfiling_t *)_file;
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = file->fds;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_io
+ *
+ * Purpose:     Transfers SIZE contiguous bytes at logical address ADDR,
+ *              one stripe piece at a time.  Reads past the end of a
+ *              subfile return zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_io(H5FD_subfiling_t *file, hbool_t do_write, haddr_t addr, size_t size, void *buf)
+{
+    hsize_t ss        = file->fa.stripe_size;
+    hsize_t nsub      = (hsize_t)file->fa.stripe_count;
+    herr_t  ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    while (size > 0) {
+        hsize_t stripe = addr / ss;
+        hsize_t within = addr % ss;
+        int     sub    = (int)(stripe % nsub);
+        HDoff_t offset = (HDoff_t)((stripe / nsub) * ss + within);
+        size_t  piece  = (size_t)MIN((hsize_t)size, ss - within);
+
+        while (piece > 0) {
+            h5_posix_io_t     bytes_in = (h5_posix_io_t)MIN(piece, H5_POSIX_MAX_IO_BYTES);
+            h5_posix_io_ret_t nbytes   = -1;
+
+            do {
+                if (do_write)
+                    nbytes = HDpwrite(file->fds[sub], buf, bytes_in, offset);
+                else
+                    nbytes = HDpread(file->fds[sub], buf, bytes_in, offset);
+            } while (-1 == nbytes && EINTR == errno);
+
+            if (-1 == nbytes) {
+                int myerrno = errno;
+
+                HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                            "subfile I/O failed: addr = %llu, size = %llu, subfile = %d, errno = %d, "
+                            "error message = '%s'",
+                            (unsigned long long)addr, (unsigned long long)piece, sub, myerrno,
+                            HDstrerror(myerrno))
+            }
+            if (0 == nbytes) {
+                /* End of the subfile, but not of the logical address space */
+                HDassert(!do_write);
+                HDmemset(buf, 0, piece);
+                nbytes = (h5_posix_io_ret_t)piece;
+            }
+
+            if (do_write) {
+                file->dirty[sub] = TRUE;
+                file->local_eof  = MAX(file->local_eof, addr + (haddr_t)nbytes);
+            }
+            piece -= (size_t)nbytes;
+            size -= (size_t)nbytes;
+            addr += (haddr_t)nbytes;
+            offset += (HDoff_t)nbytes;
+            buf = (char *)buf + nbytes;
+        }
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_flat_add
+ *
+ * Purpose:     Appends a piece to a flattened type, merging it into the
+ *              previous piece when the two are adjacent.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_flat_add(H5FD_subfiling_flat_t *flat, MPI_Aint off, MPI_Aint len)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (0 == len)
+        HGOTO_DONE(SUCCEED)
+
+    if (flat->nblks > 0 && flat->blks[flat->nblks - 1].off + flat->blks[flat->nblks - 1].len == off)
+        flat->blks[flat->nblks - 1].len += len;
+    else {
+        if (flat->nblks == flat->nalloc) {
+            size_t                nalloc = MAX(16, 2 * flat->nalloc);
+            H5FD_subfiling_blk_t *blks;
+
+            if (NULL == (blks = (H5FD_subfiling_blk_t *)H5MM_realloc(
+                             flat->blks, nalloc * sizeof(H5FD_subfiling_blk_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+            flat->blks   = blks;
+            flat->nalloc = nalloc;
+        }
+        flat->blks[flat->nblks].off = off;
+        flat->blks[flat->nblks].len = len;
+        flat->nblks++;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_flat_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_flat_copies
+ *
+ * Purpose:     Appends COUNT copies of the flattened type CHILD, STRIDE
+ *              bytes apart and starting at DISP, to FLAT.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_flat_copies(H5FD_subfiling_flat_t *flat, const H5FD_subfiling_flat_t *child, MPI_Aint disp,
+                            MPI_Aint count, MPI_Aint stride)
+{
+    MPI_Aint c;
+    size_t   u;
+    herr_t   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* A dense child repeats into a single piece */
+    if (1 == child->nblks && child->blks[0].len == stride) {
+        if (H5FD__subfiling_flat_add(flat, disp + child->blks[0].off, count * stride) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+    }
+    else
+        for (c = 0; c < count; c++)
+            for (u = 0; u < child->nblks; u++)
+                if (H5FD__subfiling_flat_add(flat, disp + c * stride + child->blks[u].off,
+                                             child->blks[u].len) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_flat_copies() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_flatten
+ *
+ * Purpose:     Flattens an MPI datatype into its contiguous pieces, in
+ *              type map order, by walking its construction with
+ *              MPI_Type_get_envelope()/MPI_Type_get_contents().  Handles
+ *              the constructors the library uses to describe selections.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_flatten(MPI_Datatype type, H5FD_subfiling_flat_t *flat)
+{
+    H5FD_subfiling_flat_t child;
+    MPI_Datatype *        types = NULL;
+    MPI_Aint *            aints = NULL;
+    int *                 ints  = NULL;
+    int                   nints, naints, ntypes, combiner;
+    int                   mpi_code; /* MPI return code */
+    int                   i, n;
+    herr_t                ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDmemset(&child, 0, sizeof(child));
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_envelope(type, &nints, &naints, &ntypes, &combiner)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_envelope failed", mpi_code)
+
+    if (MPI_COMBINER_NAMED == combiner) {
+        int size;
+
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_size(type, &size)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_size failed", mpi_code)
+        if (H5FD__subfiling_flat_add(flat, 0, (MPI_Aint)size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+        HGOTO_DONE(SUCCEED)
+    }
+
+    if (NULL == (ints = (int *)H5MM_malloc((size_t)(nints + 1) * sizeof(int))) ||
+        NULL == (aints = (MPI_Aint *)H5MM_malloc((size_t)(naints + 1) * sizeof(MPI_Aint))) ||
+        NULL == (types = (MPI_Datatype *)H5MM_malloc((size_t)(ntypes + 1) * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_contents(type, nints, naints, ntypes, ints, aints, types)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_contents failed", mpi_code)
+
+    /* Every constructor but struct repeats a single child type */
+    for (i = 0; i < ntypes; i++) {
+        MPI_Aint lb, extent;
+
+        if (MPI_COMBINER_STRUCT == combiner || 0 == i) {
+            child.nblks = 0;
+            if (H5FD__subfiling_flatten(types[i], &child) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+        }
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(types[i], &lb, &extent)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+
+        switch (combiner) {
+            case MPI_COMBINER_DUP:
+            case MPI_COMBINER_RESIZED:
+                /* Only the extent changes, which the caller takes from TYPE */
+                if (H5FD__subfiling_flat_copies(flat, &child, 0, 1, extent) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_CONTIGUOUS:
+                if (H5FD__subfiling_flat_copies(flat, &child, 0, ints[0], extent) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_VECTOR:
+            case MPI_COMBINER_HVECTOR:
+                for (n = 0; n < ints[0]; n++) {
+                    MPI_Aint stride =
+                        (MPI_COMBINER_VECTOR == combiner) ? (MPI_Aint)ints[2] * extent : aints[0];
+
+                    if (H5FD__subfiling_flat_copies(flat, &child, n * stride, ints[1], extent) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                }
+                break;
+
+            case MPI_COMBINER_INDEXED:
+                for (n = 0; n < ints[0]; n++)
+                    if (H5FD__subfiling_flat_copies(flat, &child, ints[1 + ints[0] + n] * extent, ints[1 + n],
+                                                    extent) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_HINDEXED:
+                for (n = 0; n < ints[0]; n++)
+                    if (H5FD__subfiling_flat_copies(flat, &child, aints[n], ints[1 + n], extent) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_INDEXED_BLOCK:
+                for (n = 0; n < ints[0]; n++)
+                    if (H5FD__subfiling_flat_copies(flat, &child, ints[2 + n] * extent, ints[1], extent) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+
+#if MPI_VERSION >= 3
+            case MPI_COMBINER_HINDEXED_BLOCK:
+                for (n = 0; n < ints[0]; n++)
+                    if (H5FD__subfiling_flat_copies(flat, &child, aints[n], ints[1], extent) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+#endif
+
+            case MPI_COMBINER_STRUCT:
+                if (H5FD__subfiling_flat_copies(flat, &child, aints[i], ints[1 + i], extent) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatype")
+                break;
+
+            default:
+                HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "unsupported MPI datatype constructor")
+        }
+
+        if (MPI_COMBINER_STRUCT != combiner)
+            break;
+    }
+
+done:
+    /* Free the child types that MPI_Type_get_contents() made */
+    if (types)
+        for (i = 0; i < ntypes; i++) {
+            int ci, ca, ct, comb;
+
+            if (MPI_SUCCESS == MPI_Type_get_envelope(types[i], &ci, &ca, &ct, &comb) &&
+                MPI_COMBINER_NAMED != comb)
+                MPI_Type_free(&types[i]);
+        }
+    H5MM_xfree(child.blks);
+    H5MM_xfree(types);
+    H5MM_xfree(aints);
+    H5MM_xfree(ints);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_flatten() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_xfer_types
+ *
+ * Purpose:     Carries out the transfer that MPI-IO would do with a file
+ *              view of FILE_TYPE at ADDR and COUNT elements of BUF_TYPE in
+ *              memory: both types are flattened and walked together, and
+ *              each run that is contiguous on both sides, merged across
+ *              adjacent pieces and repetitions, becomes one stripe-aware
+ *              transfer.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_xfer_types(H5FD_subfiling_t *file, hbool_t do_write, haddr_t addr, int count,
+                           MPI_Datatype buf_type, MPI_Datatype file_type, void *buf)
+{
+    H5FD_subfiling_flat_t mem, disk;
+    MPI_Aint              mem_lb, mem_extent, disk_lb, disk_extent;
+    MPI_Aint              mem_rep = 0, disk_rep = 0; /* Repetitions of each type consumed */
+    MPI_Aint              mem_done = 0, disk_done = 0;
+    MPI_Aint              run_moff = 0, run_doff = 0, run_len = 0; /* Pending run of merged pieces */
+    size_t                mi = 0, di = 0;
+    MPI_Aint              type_size;
+    MPI_Aint              total;
+    int                   size_i;
+    int                   mpi_code; /* MPI return code */
+    herr_t                ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDmemset(&mem, 0, sizeof(mem));
+    HDmemset(&disk, 0, sizeof(disk));
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_size(buf_type, &size_i)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_size failed", mpi_code)
+    type_size = (MPI_Aint)size_i;
+    if (0 == (total = type_size * count))
+        HGOTO_DONE(SUCCEED)
+
+    if (H5FD__subfiling_flatten(buf_type, &mem) < 0 || H5FD__subfiling_flatten(file_type, &disk) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't flatten MPI datatypes")
+    if (0 == mem.nblks || 0 == disk.nblks)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "empty MPI datatype for a non-empty transfer")
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(buf_type, &mem_lb, &mem_extent)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(file_type, &disk_lb, &disk_extent)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+
+    /* A dense type (such as MPI_BYTE, which the library uses for
+     * contiguous selections) repeats into one piece, so walk it as a
+     * single block instead of one block per repetition.
+     */
+    if (1 == mem.nblks && mem.blks[0].len == mem_extent)
+        mem.blks[0].len = total;
+    if (1 == disk.nblks && disk.blks[0].len == disk_extent)
+        disk.blks[0].len = total;
+
+    /* Contiguous on both sides: a single transfer */
+    if (mem.blks[0].len >= total && disk.blks[0].len >= total) {
+        if (H5FD__subfiling_io(file, do_write, addr + (haddr_t)disk.blks[0].off, (size_t)total,
+                               (char *)buf + mem.blks[0].off) < 0)
+            HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "subfile I/O failed")
+        HGOTO_DONE(SUCCEED)
+    }
+
+    while (total > 0) {
+        const H5FD_subfiling_blk_t *mblk = &mem.blks[mi];
+        const H5FD_subfiling_blk_t *dblk = &disk.blks[di];
+        MPI_Aint                    n    = MIN3(mblk->len - mem_done, dblk->len - disk_done, total);
+        MPI_Aint                    moff = mem_rep * mem_extent + mblk->off + mem_done;
+        MPI_Aint                    doff = disk_rep * disk_extent + dblk->off + disk_done;
+
+        /* Merge runs that are adjacent in both memory and the file, and
+         * transfer the previous run when this one doesn't continue it.
+         */
+        if (run_len > 0 && run_moff + run_len == moff && run_doff + run_len == doff)
+            run_len += n;
+        else {
+            if (run_len > 0 && H5FD__subfiling_io(file, do_write, addr + (haddr_t)run_doff, (size_t)run_len,
+                                                  (char *)buf + run_moff) < 0)
+                HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "subfile I/O failed")
+            run_moff = moff;
+            run_doff = doff;
+            run_len  = n;
+        }
+        total -= n;
+
+        /* Advance both sides, wrapping around to the next repetition */
+        if ((mem_done += n) == mblk->len) {
+            mem_done = 0;
+            if (++mi == mem.nblks) {
+                mi = 0;
+                mem_rep++;
+            }
+        }
+        if ((disk_done += n) == dblk->len) {
+            disk_done = 0;
+            if (++di == disk.nblks) {
+                di = 0;
+                disk_rep++;
+            }
+        }
+    }
+
+    /* Transfer the last run */
+    if (run_len > 0 && H5FD__subfiling_io(file, do_write, addr + (haddr_t)run_doff, (size_t)run_len,
+                                          (char *)buf + run_moff) < 0)
+        HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "subfile I/O failed")
+
+done:
+    H5MM_xfree(mem.blks);
+    H5MM_xfree(disk.blks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_xfer_types() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address
+ *              ADDR into buffer BUF, honoring the collective datatypes
+ *              and the read-on-rank-0-and-broadcast setting from the API
+ *              context as the MPI-IO driver does.  Reading past the end of
+ *              the subfiles returns zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                     size_t size, void *buf /*out*/)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+    H5FD_mpio_xfer_t  xfer_mode = H5FD_MPIO_INDEPENDENT; /* I/O transfer mode */
+    int               mpi_code;                          /* MPI return code */
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+    HDassert(buf);
+
+    /* Only look for MPI views for raw data transfers */
+    if (type == H5FD_MEM_DRAW)
+        if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+
+    if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+        MPI_Datatype buf_type, file_type;
+        int          size_i = (int)size;
+
+        if ((size_t)size_i != size)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from size to size_i")
+        if (H5CX_get_mpi_coll_datatypes(&buf_type, &file_type) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O datatypes")
+
+        if (H5CX_get_mpio_rank0_bcast()) {
+            /* Read on rank 0 and broadcast to the other ranks.  The status
+             * goes out first so that a failed read doesn't hang anyone.
+             */
+            int status = 0;
+
+            if (0 == file->mpi_rank)
+                if (H5FD__subfiling_xfer_types(file, FALSE, addr, size_i, buf_type, file_type, buf) < 0)
+                    status = -1;
+            if (MPI_SUCCESS != (mpi_code = MPI_Bcast(&status, 1, MPI_INT, 0, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+            if (status < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            if (MPI_SUCCESS != (mpi_code = MPI_Bcast(buf, size_i, buf_type, 0, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        }
+        else if (H5FD__subfiling_xfer_types(file, FALSE, addr, size_i, buf_type, file_type, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+    }
+    else if (H5FD__subfiling_io(file, FALSE, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF, using the collective datatypes from the
+ *              API context when the transfer is collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                      haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+    H5FD_mpio_xfer_t  xfer_mode; /* I/O transfer mode */
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+    HDassert(buf);
+
+    /* Verify that no data is written when between MPI_Barrier()s during file flush */
+    HDassert(!H5CX_get_mpi_file_flushing());
+
+    /* Get the transfer mode from the API context */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+
+    H5_GCC_DIAG_OFF("cast-qual")
+    if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+        MPI_Datatype buf_type, file_type;
+        int          size_i = (int)size;
+
+        if ((size_t)size_i != size)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from size to size_i")
+        if (H5CX_get_mpi_coll_datatypes(&buf_type, &file_type) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O datatypes")
+        if (H5FD__subfiling_xfer_types(file, TRUE, addr, size_i, buf_type, file_type, (void *)buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    }
+    else if (H5FD__subfiling_io(file, TRUE, addr, size, (void *)buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    H5_GCC_DIAG_ON("cast-qual")
+
+    /* As with the MPI-IO driver, the EOF is unknown until it is reduced
+     * over all processes; H5FD__subfiling_io() keeps the local value.
+     */
+    file->eof = HADDR_UNDEF;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_flush
+ *
+ * Purpose:     Makes sure that the subfiles this process wrote are on
+ *              disk.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+    int               i;
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    /* Only sync the subfiles if we are not going to immediately close them */
+    if (!closing)
+        for (i = 0; i < file->fa.stripe_count; i++)
+            if (file->dirty[i]) {
+                if (HDfsync(file->fds[i]) < 0)
+                    HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to sync subfile")
+                file->dirty[i] = FALSE;
+            }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_truncate
+ *
+ * Purpose:     Makes the logical file's size match its allocated size by
+ *              setting every subfile to the size its stripes of the EOA
+ *              need.  This is collective and, as in the MPI-IO driver, is
+ *              skipped when the EOA hasn't changed since the last call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_subfiling_t *file      = (H5FD_subfiling_t *)_file;
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    if (!H5F_addr_eq(file->eoa, file->last_eoa)) {
+        int mpi_code; /* mpi return code */
+        int status = 0;
+
+        /* Wait for all writes to finish, unless the file flush has just
+         * gone through a barrier (see H5FD__mpio_truncate).
+         */
+        if (!H5CX_get_mpi_file_flushing())
+            if (MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
+
+        /* Rank 0 sizes the subfiles; the broadcast of its status keeps the
+         * other ranks from writing until it is done.
+         */
+        if (0 == file->mpi_rank) {
+            hsize_t ss   = file->fa.stripe_size;
+            hsize_t nsub = (hsize_t)file->fa.stripe_count;
+            hsize_t rows = file->eoa / (ss * nsub);
+            hsize_t rem  = file->eoa - rows * ss * nsub;
+            int     i;
+
+            for (i = 0; i < file->fa.stripe_count && 0 == status; i++) {
+                hsize_t   start  = (hsize_t)i * ss;
+                hsize_t   needed = rows * ss + (rem > start ? MIN(rem - start, ss) : 0);
+                h5_stat_t sb;
+
+                if (HDfstat(file->fds[i], &sb) < 0)
+                    status = -1;
+                else if ((hsize_t)sb.st_size != needed && HDftruncate(file->fds[i], (HDoff_t)needed) < 0)
+                    status = -1;
+            }
+        }
+        if (MPI_SUCCESS != (mpi_code = MPI_Bcast(&status, 1, MPI_INT, 0, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        if (status < 0)
+            HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend subfiles")
+
+        /* Update the 'last' eoa value */
+        file->last_eoa = file->eoa;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_mpi_rank
+ *
+ * Purpose:     Returns the MPI rank for a process
+ *
+ * Return:      Success: non-negative
+ *              Failure: negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__subfiling_mpi_rank(const H5FD_t *_file)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->mpi_rank)
+} /* end H5FD__subfiling_mpi_rank() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_mpi_size
+ *
+ * Purpose:     Returns the number of MPI processes
+ *
+ * Return:      Success: non-negative
+ *              Failure: negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__subfiling_mpi_size(const H5FD_t *_file)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->mpi_size)
+} /* end H5FD__subfiling_mpi_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_communicator
+ *
+ * Purpose:     Returns the MPI communicator for the file.
+ *
+ * Return:      Success:    The communicator
+ *              Failure:    Can't fail
+ *
+ *-------------------------------------------------------------------------
+ */
+static MPI_Comm
+H5FD__subfiling_communicator(const H5FD_t *_file)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->comm)
+} /* end H5FD__subfiling_communicator() */
+
+#endif /* H5_HAVE_PARALLEL */
+
+/* The configuration record code is shared with h5fuse, so it is built
+ * whether or not the library is parallel.
+ */
+
+/* Longest line of a configuration record */
+#define H5FD_SUBFILING_LINE_MAX 4096
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_free_names
+ *
+ * Purpose:     Frees an array of COUNT subfile names.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FD__subfiling_free_names(char **names, int count)
+{
+    int i;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (names) {
+        for (i = 0; i < count; i++)
+            H5MM_xfree(names[i]);
+        H5MM_xfree(names);
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__subfiling_free_names() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_read_config
+ *
+ * Purpose:     Reads the whole configuration record NAME into memory.
+ *
+ * Return:      Success:    The record, which the caller must free
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+char *
+H5FD__subfiling_read_config(const char *name)
+{
+    FILE * fp     = NULL;
+    char * config = NULL;
+    size_t alloc  = 1024;
+    size_t len    = 0;
+    size_t nread;
+    char * ret_value = NULL;
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (fp = HDfopen(name, "r")))
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open subfiling configuration")
+    if (NULL == (config = (char *)H5MM_malloc(alloc)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    while ((nread = HDfread(config + len, 1, alloc - len - 1, fp)) > 0) {
+        len += nread;
+        if (len + 1 == alloc) {
+            char *tmp;
+
+            if (NULL == (tmp = (char *)H5MM_realloc(config, alloc * 2)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+            config = tmp;
+            alloc *= 2;
+        }
+    }
+    if (HDferror(fp))
+        HGOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "unable to read subfiling configuration")
+    config[len] = '\0';
+
+    ret_value = config;
+
+done:
+    if (fp)
+        HDfclose(fp);
+    if (NULL == ret_value)
+        H5MM_xfree(config);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_read_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_parse_config
+ *
+ * Purpose:     Decodes the configuration record CONFIG of the file NAME
+ *              into FA and, if SUBFILE_NAMES is not NULL, an array of
+ *              subfile paths resolved against the record's directory.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD__subfiling_parse_config(const char *name, const char *config, H5FD_subfiling_fapl_t *fa,
+                             char ***subfile_names)
+{
+    char        line[H5FD_SUBFILING_LINE_MAX];
+    const char *p = config;
+    const char *slash;
+    char **     names = NULL;
+    size_t      dir_len;
+    int         version = -1;
+    int         nnames  = 0;
+    int         lineno  = 0;
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    HDmemset(fa, 0, sizeof(*fa));
+    fa->magic   = H5FD_SUBFILING_FAPL_MAGIC;
+    fa->version = H5FD_SUBFILING_CURR_FAPL_VERSION;
+
+    slash   = HDstrrchr(name, '/');
+    dir_len = slash ? (size_t)(slash - name) + 1 : 0;
+
+    while (*p) {
+        const char *end = HDstrchr(p, '\n');
+        size_t      len = end ? (size_t)(end - p) : HDstrlen(p);
+
+        if (len >= sizeof(line))
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "subfiling configuration line too long")
+        H5MM_memcpy(line, p, len);
+        line[len] = '\0';
+        p += len + (end ? 1 : 0);
+
+        if (0 == lineno++) {
+            if (HDstrcmp(line, H5FD_SUBFILING_CONFIG_MAGIC) != 0)
+                HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "not a subfiling configuration record")
+        }
+        else if (!HDstrncmp(line, "version ", 8))
+            version = (int)HDstrtol(line + 8, NULL, 10);
+        else if (!HDstrncmp(line, "stripe_size ", 12))
+            fa->stripe_size = (hsize_t)HDstrtoull(line + 12, NULL, 10);
+        else if (!HDstrncmp(line, "stripe_count ", 13)) {
+            fa->stripe_count = (int32_t)HDstrtol(line + 13, NULL, 10);
+            if (fa->stripe_count <= 0 || names)
+                HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "bad stripe count in subfiling configuration")
+            if (subfile_names &&
+                NULL == (names = (char **)H5MM_calloc((size_t)fa->stripe_count * sizeof(char *))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        }
+        else if (!HDstrncmp(line, "subfile ", 8)) {
+            char *rest;
+            long  idx = HDstrtol(line + 8, &rest, 10);
+
+            if (idx < 0 || idx >= fa->stripe_count || ' ' != *rest || '\0' == rest[1])
+                HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "bad subfile entry in subfiling configuration")
+            rest++;
+            if (names) {
+                size_t rest_len = HDstrlen(rest);
+
+                if (names[idx])
+                    HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "duplicate subfile in subfiling configuration")
+                if (NULL == (names[idx] = (char *)H5MM_malloc(dir_len + rest_len + 1)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+                /* Names are relative to the record, unless absolute */
+                if ('/' == rest[0]) {
+                    H5MM_memcpy(names[idx], rest, rest_len + 1);
+                }
+                else {
+                    H5MM_memcpy(names[idx], name, dir_len);
+                    H5MM_memcpy(names[idx] + dir_len, rest, rest_len + 1);
+                }
+            }
+            nnames++;
+        }
+        else if ('\0' != line[0] && '#' != line[0])
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "unknown entry in subfiling configuration")
+    }
+
+    if (H5FD_SUBFILING_CONFIG_VERSION != version)
+        HGOTO_ERROR(H5E_FILE, H5E_VERSION, FAIL, "unsupported subfiling configuration version")
+    if (0 == fa->stripe_size)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "bad stripe size in subfiling configuration")
+    if (nnames != fa->stripe_count)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "subfiling configuration doesn't list every subfile")
+
+    if (subfile_names) {
+        *subfile_names = names;
+        names          = NULL;
+    }
+
+done:
+    if (names)
+        H5FD__subfiling_free_names(names, fa->stripe_count);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_parse_config() */
@@ -0,0 +1,98 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the subfiling driver.
+ */
+#ifndef H5FDsubfiling_H
+#define H5FDsubfiling_H
+
+/* Macros */
+
+#ifdef H5_HAVE_PARALLEL
+#define H5FD_SUBFILING (H5FD_subfiling_init())
+#else
+#define H5FD_SUBFILING (H5I_INVALID_HID)
+#endif /* H5_HAVE_PARALLEL */
+
+/*
+ * Layout of a subfiled file.  The name passed to H5Fcreate() or H5Fopen()
+ * is a small text configuration record that lists the stripe size and the
+ * subfiles, which live next to it and are named with
+ * H5FD_SUBFILING_NAME_FORMAT (config name, subfile index, subfile count).
+ *
+ * The logical address space is cut into stripes of stripe_size bytes and
+ * dealt round-robin over the subfiles: logical address A lies in stripe
+ * S = A / stripe_size, which is stored in subfile S % stripe_count at
+ * offset (S / stripe_count) * stripe_size + A % stripe_size.
+ *
+ * These definitions do not need MPI, so serial tools (h5fuse) can use
+ * them to reassemble the logical file.
+ */
+#define H5FD_SUBFILING_CONFIG_MAGIC   "HDF5 subfiling configuration"
+#define H5FD_SUBFILING_CONFIG_VERSION 1
+#define H5FD_SUBFILING_NAME_FORMAT    "%s.subfile_%d_of_%d"
+
+/* Defaults, and environment variables that override them */
+#define H5FD_SUBFILING_DEFAULT_STRIPE_SIZE (32 * 1024 * 1024)
+#define H5FD_SUBFILING_STRIPE_SIZE_ENV     "HDF5_SUBFILING_STRIPE_SIZE"
+#define H5FD_SUBFILING_STRIPE_COUNT_ENV    "HDF5_SUBFILING_STRIPE_COUNT"
+
+/* ---------------------------------------------------------------------------
+ * Structure:   H5FD_subfiling_fapl_t
+ *
+ * Layout requested when a file is created with the subfiling driver.  An
+ * existing file always keeps the layout stored in its configuration record.
+ *
+ * `magic` (uint32_t)
+ *      Must equal H5FD_SUBFILING_FAPL_MAGIC.
+ *
+ * `version` (uint32_t)
+ *      Must equal H5FD_SUBFILING_CURR_FAPL_VERSION.
+ *
+ * `stripe_size` (hsize_t)
+ *      Bytes per stripe.  0 selects H5FD_SUBFILING_STRIPE_SIZE_ENV or
+ *      H5FD_SUBFILING_DEFAULT_STRIPE_SIZE.
+ *
+ * `stripe_count` (int32_t)
+ *      Number of subfiles, e.g. one per I/O aggregator.  0 selects
+ *      H5FD_SUBFILING_STRIPE_COUNT_ENV or, if that is not set, one subfile
+ *      per node of the communicator.
+ * ---------------------------------------------------------------------------
+ */
+#define H5FD_SUBFILING_FAPL_MAGIC        0x53554246
+#define H5FD_SUBFILING_CURR_FAPL_VERSION 1
+typedef struct H5FD_subfiling_fapl_t {
+    uint32_t magic;
+    uint32_t version;
+    hsize_t  stripe_size;
+    int32_t  stripe_count;
+} H5FD_subfiling_fapl_t;
+
+#ifdef H5_HAVE_PARALLEL
+
+/* Function prototypes */
+#ifdef __cplusplus
+extern "C" {
+#endif
+H5_DLL hid_t  H5FD_subfiling_init(void);
+H5_DLL herr_t H5Pset_fapl_subfiling(hid_t fapl_id, MPI_Comm comm, MPI_Info info,
+                                    const H5FD_subfiling_fapl_t *fa);
+H5_DLL herr_t H5Pget_fapl_subfiling(hid_t fapl_id, MPI_Comm *comm /*out*/, MPI_Info *info /*out*/,
+                                    H5FD_subfiling_fapl_t *fa_out /*out*/);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_PARALLEL */
+
+#endif /* H5FDsubfiling_H */
@@ -0,0 +1,35 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Shared definitions for the subfiling VFD and the h5fuse tool.
+ *          The configuration record routines don't need MPI and are built
+ *          in serial libraries too.
+ */
+
+#ifndef H5FDsubfiling_priv_H
+#define H5FDsubfiling_priv_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL char * H5FD__subfiling_read_config(const char *name);
+H5_DLL herr_t H5FD__subfiling_parse_config(const char *name, const char *config, H5FD_subfiling_fapl_t *fa,
+                                           char ***subfile_names);
+H5_DLL void   H5FD__subfiling_free_names(char **names, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5FDsubfiling_priv_H */
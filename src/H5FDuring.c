@@ -0,0 +1,1413 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring file driver.  Each read or write request is
+ *          split into blocks of a configurable size and the blocks are
+ *          submitted to the kernel together through an io_uring
+ *          submission queue, keeping up to 'queue_depth' of them in
+ *          flight at once.  Optionally the file is opened with O_DIRECT,
+ *          in which case the transfers go through aligned bounce buffers
+ *          that are registered with the ring once when the file is opened.
+ *
+ *          The driver talks to the kernel through the raw io_uring system
+ *          calls so that it has no dependency beyond the kernel headers.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDuring.h"   /* io_uring file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_URING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_URING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Largest block that fits in the 32-bit length of a submission queue entry */
+#define H5FD_URING_BLOCK_SIZE_MAX ((size_t)1 << 30)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_uring_fapl_t {
+    unsigned queue_depth; /* Maximum number of requests in flight     */
+    size_t   block_size;  /* Size of each request submitted           */
+    hbool_t  use_direct;  /* Whether to open the file with O_DIRECT   */
+} H5FD_uring_fapl_t;
+
+/* An io_uring instance, with its submission and completion rings mapped
+ * into our address space.  The 'sq_*' and 'cq_*' pointers point into the
+ * shared ring memory and are updated concurrently by the kernel.
+ */
+typedef struct H5FD_uring_ring_t {
+    int                  fd;            /* io_uring file descriptor              */
+    unsigned             sq_entries;    /* Number of submission queue entries    */
+    unsigned *           sq_head;       /* Submission queue head (kernel)        */
+    unsigned *           sq_tail;       /* Submission queue tail (us)            */
+    unsigned *           sq_mask;       /* Submission queue index mask           */
+    unsigned *           sq_array;      /* Submission queue index array          */
+    unsigned *           cq_head;       /* Completion queue head (us)            */
+    unsigned *           cq_tail;       /* Completion queue tail (kernel)        */
+    unsigned *           cq_mask;       /* Completion queue index mask           */
+    struct io_uring_sqe *sqes;          /* Submission queue entries              */
+    struct io_uring_cqe *cqes;          /* Completion queue entries              */
+    void *               sq_map;        /* Mapping of the submission ring        */
+    size_t               sq_map_size;   /* Size of the submission ring mapping   */
+    void *               cq_map;        /* Mapping of the completion ring        */
+    size_t               cq_map_size;   /* Size of the completion ring mapping   */
+    size_t               sqes_map_size; /* Size of the submission entry mapping  */
+} H5FD_uring_ring_t;
+
+/* One block transfer in flight.  A transfer which completes short is
+ * resubmitted for the remainder, so 'done' tracks the progress.
+ */
+typedef struct H5FD_uring_slot_t {
+    haddr_t        addr; /* File address of the block                 */
+    size_t         len;  /* Length of the block                       */
+    size_t         done; /* Bytes of the block transferred so far     */
+    unsigned char *mem;  /* Memory for the block                      */
+} H5FD_uring_slot_t;
+
+/* The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  With
+ * O_DIRECT the underlying file may be larger than 'eof', since the writes are
+ * rounded up to the alignment; the file is trimmed back when truncated.
+ */
+typedef struct H5FD_uring_t {
+    H5FD_t            pub; /* public stuff, must be first      */
+    int               fd;  /* the filesystem file descriptor   */
+    haddr_t           eoa; /* end of allocated region          */
+    haddr_t           eof; /* end of file; current file size   */
+    H5FD_uring_fapl_t fa;  /* file access properties           */
+    hbool_t           ignore_disabled_file_locks;
+    char              filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    dev_t             device;                          /* file device number   */
+    ino_t             inode;                           /* file i-node number   */
+
+    H5FD_uring_ring_t  ring;       /* the submission and completion rings           */
+    H5FD_uring_slot_t *slots;      /* one slot per request in flight                */
+    unsigned *         free_slots; /* stack of unused slot indices                  */
+    unsigned char *    bounce;     /* aligned bounce buffers for O_DIRECT, one block per slot */
+    hbool_t            fixed_bufs; /* whether the bounce buffers are registered     */
+} H5FD_uring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Round an address down or up to the O_DIRECT alignment */
+#define H5FD_URING_ALIGN_DOWN(A) ((A) & ~(haddr_t)(H5FD_URING_ALIGNMENT - 1))
+#define H5FD_URING_ALIGN_UP(A)   H5FD_URING_ALIGN_DOWN((A) + (H5FD_URING_ALIGNMENT - 1))
+
+/* Prototypes */
+static herr_t  H5FD__uring_term(void);
+static void *  H5FD__uring_fapl_get(H5FD_t *file);
+static void *  H5FD__uring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__uring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__uring_close(H5FD_t *_file);
+static int     H5FD__uring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__uring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__uring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__uring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__uring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__uring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__uring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                void *buf);
+static herr_t  H5FD__uring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                 const void *buf);
+static herr_t  H5FD__uring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__uring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__uring_unlock(H5FD_t *_file);
+
+/* Helper routines */
+static herr_t H5FD__uring_ring_init(H5FD_uring_ring_t *ring, unsigned entries);
+static void   H5FD__uring_ring_term(H5FD_uring_ring_t *ring);
+static herr_t H5FD__uring_free(H5FD_uring_t *file);
+static void   H5FD__uring_queue(H5FD_uring_t *file, hbool_t do_write, unsigned idx);
+static void   H5FD__uring_drain(H5FD_uring_t *file, unsigned outstanding);
+static herr_t H5FD__uring_io(H5FD_uring_t *file, hbool_t do_write, haddr_t addr, size_t size,
+                             unsigned char *rbuf, const unsigned char *wbuf);
+
+static const H5FD_class_t H5FD_uring_g = {
+    "uring",                   /* name                 */
+    MAXADDR,                   /* maxaddr              */
+    H5F_CLOSE_WEAK,            /* fc_degree            */
+    H5FD__uring_term,          /* terminate            */
+    NULL,                      /* sb_size              */
+    NULL,                      /* sb_encode            */
+    NULL,                      /* sb_decode            */
+    sizeof(H5FD_uring_fapl_t), /* fapl_size            */
+    H5FD__uring_fapl_get,      /* fapl_get             */
+    H5FD__uring_fapl_copy,     /* fapl_copy            */
+    NULL,                      /* fapl_free            */
+    0,                         /* dxpl_size            */
+    NULL,                      /* dxpl_copy            */
+    NULL,                      /* dxpl_free            */
+    H5FD__uring_open,          /* open                 */
+    H5FD__uring_close,         /* close                */
+    H5FD__uring_cmp,           /* cmp                  */
+    H5FD__uring_query,         /* query                */
+    NULL,                      /* get_type_map         */
+    NULL,                      /* alloc                */
+    NULL,                      /* free                 */
+    H5FD__uring_get_eoa,       /* get_eoa              */
+    H5FD__uring_set_eoa,       /* set_eoa              */
+    H5FD__uring_get_eof,       /* get_eof              */
+    H5FD__uring_get_handle,    /* get_handle           */
+    H5FD__uring_read,          /* read                 */
+    H5FD__uring_write,         /* write                */
+    NULL,                      /* flush                */
+    H5FD__uring_truncate,      /* truncate             */
+    H5FD__uring_lock,          /* lock                 */
+    H5FD__uring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY       /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_uring_t struct */
+H5FL_DEFINE_STATIC(H5FD_uring_t);
+
+/*--------------------------------------------------------------------------
+NAME
+   H5FD__init_package -- Initialize interface-specific information
+USAGE
+    herr_t H5FD__init_package()
+RETURNS
+    Non-negative on success/Negative on failure
+DESCRIPTION
+    Initializes any interface-specific data or routines.  (Just calls
+    H5FD_uring_init currently).
+
+--------------------------------------------------------------------------*/
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_uring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_uring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_uring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_URING_g))
+        H5FD_URING_g = H5FD_register(&H5FD_uring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_URING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_uring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__uring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     Non-negative on success or negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_URING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__uring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_uring
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_URING
+ *              driver defined in this source file.  QUEUE_DEPTH is the
+ *              maximum number of requests kept in flight, BLOCK_SIZE the
+ *              size of each request and USE_DIRECT whether the file is
+ *              opened with O_DIRECT.  Zero selects the default for
+ *              QUEUE_DEPTH and BLOCK_SIZE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_uring(hid_t fapl_id, unsigned queue_depth, size_t block_size, hbool_t use_direct)
+{
+    H5P_genplist_t *  plist; /* Property list pointer */
+    H5FD_uring_fapl_t fa;
+    herr_t            ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuzb", fapl_id, queue_depth, block_size, use_direct);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    HDmemset(&fa, 0, sizeof(H5FD_uring_fapl_t));
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_URING_QUEUE_DEPTH_DEF;
+    fa.block_size  = block_size ? block_size : H5FD_URING_BLOCK_SIZE_DEF;
+    fa.use_direct  = use_direct;
+
+    if (fa.block_size > H5FD_URING_BLOCK_SIZE_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size is too large")
+    if (fa.use_direct && (fa.block_size % H5FD_URING_ALIGNMENT) != 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size must be a multiple of the O_DIRECT alignment")
+
+    ret_value = H5P_set_driver(plist, H5FD_URING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_uring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_uring
+ *
+ * Purpose:     Returns information about the io_uring file access property
+ *              list through the function arguments.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_uring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *block_size /*out*/,
+                  hbool_t *use_direct /*out*/)
+{
+    H5P_genplist_t *         plist; /* Property list pointer */
+    const H5FD_uring_fapl_t *fa;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, queue_depth, block_size, use_direct);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_URING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_uring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+    if (block_size)
+        *block_size = fa->block_size;
+    if (use_direct)
+        *use_direct = fa->use_direct;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_uring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__uring_fapl_get(H5FD_t *_file)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    void *        ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__uring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__uring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_uring_fapl_t *old_fa    = (const H5FD_uring_fapl_t *)_old_fa;
+    H5FD_uring_fapl_t *      ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(old_fa);
+
+    if (NULL == (ret_value = (H5FD_uring_fapl_t *)H5MM_malloc(sizeof(H5FD_uring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    H5MM_memcpy(ret_value, old_fa, sizeof(H5FD_uring_fapl_t));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_ring_init
+ *
+ * Purpose:     Create an io_uring instance with at least ENTRIES submission
+ *              queue entries and map its rings into memory.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_ring_init(H5FD_uring_ring_t *ring, unsigned entries)
+{
+    struct io_uring_params p;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ring);
+    HDassert(entries > 0);
+
+    HDmemset(&p, 0, sizeof(p));
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &p)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to set up io_uring")
+
+    ring->sq_entries  = p.sq_entries;
+    ring->sq_map_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_map_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+
+    /* Newer kernels let both rings share one mapping */
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        ring->sq_map_size = ring->cq_map_size = MAX(ring->sq_map_size, ring->cq_map_size);
+
+    if (MAP_FAILED == (ring->sq_map = HDmmap(NULL, ring->sq_map_size, PROT_READ | PROT_WRITE,
+                                             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING))) {
+        ring->sq_map = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue")
+    }
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_map = ring->sq_map;
+    else if (MAP_FAILED == (ring->cq_map = HDmmap(NULL, ring->cq_map_size, PROT_READ | PROT_WRITE,
+                                                  MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING))) {
+        ring->cq_map = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion queue")
+    }
+    ring->sqes_map_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring->sqes = (struct io_uring_sqe *)HDmmap(NULL, ring->sqes_map_size,
+                                                                  PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                                                  ring->fd, IORING_OFF_SQES))) {
+        ring->sqes = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission entries")
+    }
+
+    ring->sq_head  = (unsigned *)((unsigned char *)ring->sq_map + p.sq_off.head);
+    ring->sq_tail  = (unsigned *)((unsigned char *)ring->sq_map + p.sq_off.tail);
+    ring->sq_mask  = (unsigned *)((unsigned char *)ring->sq_map + p.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((unsigned char *)ring->sq_map + p.sq_off.array);
+    ring->cq_head  = (unsigned *)((unsigned char *)ring->cq_map + p.cq_off.head);
+    ring->cq_tail  = (unsigned *)((unsigned char *)ring->cq_map + p.cq_off.tail);
+    ring->cq_mask  = (unsigned *)((unsigned char *)ring->cq_map + p.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe *)((unsigned char *)ring->cq_map + p.cq_off.cqes);
+
+done:
+    if (ret_value < 0)
+        H5FD__uring_ring_term(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_ring_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_ring_term
+ *
+ * Purpose:     Unmap the rings of an io_uring instance and close it.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__uring_ring_term(H5FD_uring_ring_t *ring)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ring);
+
+    if (ring->sqes)
+        HDmunmap(ring->sqes, ring->sqes_map_size);
+    if (ring->cq_map && ring->cq_map != ring->sq_map)
+        HDmunmap(ring->cq_map, ring->cq_map_size);
+    if (ring->sq_map)
+        HDmunmap(ring->sq_map, ring->sq_map_size);
+    if (ring->fd >= 0)
+        HDclose(ring->fd);
+
+    HDmemset(ring, 0, sizeof(H5FD_uring_ring_t));
+    ring->fd = -1;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__uring_ring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file and sets up the
+ *              io_uring instance used to access it.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__uring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_uring_t *           file = NULL; /* io_uring VFD info            */
+    int                      fd   = -1;   /* File descriptor              */
+    int                      o_flags;     /* Flags for open() call        */
+    h5_stat_t                sb;
+    H5P_genplist_t *         plist; /* Property list pointer */
+    const H5FD_uring_fapl_t *fa;
+    struct iovec *           iov = NULL;
+    unsigned                 u;
+    H5FD_t *                 ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_uring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+    if (fa->use_direct)
+        o_flags |= O_DIRECT;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    }
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_uring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->ring.fd = -1;
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_uring_fapl_t));
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set up the ring and the per-request bookkeeping */
+    if (H5FD__uring_ring_init(&file->ring, file->fa.queue_depth) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring instance")
+    if (NULL == (file->slots = (H5FD_uring_slot_t *)H5MM_calloc(file->fa.queue_depth *
+                                                                 sizeof(H5FD_uring_slot_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate request slots")
+    if (NULL == (file->free_slots = (unsigned *)H5MM_malloc(file->fa.queue_depth * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate request slots")
+
+    /* With O_DIRECT, set up one aligned bounce buffer per slot and try to
+     * register them with the kernel, so they are mapped once instead of on
+     * every request.  Registration counts against RLIMIT_MEMLOCK, so it is
+     * not an error if it fails; plain reads and writes are used instead.
+     */
+    if (file->fa.use_direct) {
+        /* NOTE: Use HDfree to release memory from HDposix_memalign */
+        if (HDposix_memalign((void **)&file->bounce, (size_t)H5FD_URING_ALIGNMENT,
+                             file->fa.queue_depth * file->fa.block_size) != 0) {
+            file->bounce = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "HDposix_memalign failed")
+        }
+
+        if (NULL == (iov = (struct iovec *)H5MM_malloc(file->fa.queue_depth * sizeof(struct iovec))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate I/O vector")
+        for (u = 0; u < file->fa.queue_depth; u++) {
+            iov[u].iov_base = file->bounce + (size_t)u * file->fa.block_size;
+            iov[u].iov_len  = file->fa.block_size;
+        }
+        file->fixed_bufs = (syscall(__NR_io_uring_register, file->ring.fd, IORING_REGISTER_BUFFERS, iov,
+                                    file->fa.queue_depth) == 0);
+    }
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    H5MM_xfree(iov);
+
+    if (NULL == ret_value) {
+        if (file)
+            H5FD__uring_free(file);
+        else if (fd >= 0)
+            HDclose(fd);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_free
+ *
+ * Purpose:     Releases the resources of a file struct, closing the file
+ *              descriptor if it is open.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_free(H5FD_uring_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Closing the ring also unregisters the buffers */
+    H5FD__uring_ring_term(&file->ring);
+    if (file->bounce)
+        HDfree(file->bounce);
+    H5MM_xfree(file->slots);
+    H5MM_xfree(file->free_slots);
+
+    if (file->fd >= 0 && HDclose(file->fd) < 0)
+        HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    file = H5FL_FREE(H5FD_uring_t, file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_close(H5FD_t *_file)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    if (H5FD__uring_free(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__uring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_uring_t *f1        = (const H5FD_uring_t *)_f1;
+    const H5FD_uring_t *f2        = (const H5FD_uring_t *)_f2;
+    int                 ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_query(const H5FD_t H5_ATTR_UNUSED *_f, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations    */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    }
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__uring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__uring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_uring_t *file = (const H5FD_uring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__uring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__uring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__uring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_uring_t *file = (const H5FD_uring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__uring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_get_handle
+ *
+ * Purpose:     Returns the file handle of io_uring file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_queue
+ *
+ * Purpose:     Place the remainder of the transfer in slot IDX on the
+ *              submission queue.  The entry is published to the kernel but
+ *              not submitted until the next io_uring_enter call.
+ *
+ *              The caller never has more than 'queue_depth' requests in
+ *              flight and the submission queue has at least that many
+ *              entries, so there is always room.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__uring_queue(H5FD_uring_t *file, hbool_t do_write, unsigned idx)
+{
+    H5FD_uring_ring_t *  ring = &file->ring;
+    H5FD_uring_slot_t *  slot = &file->slots[idx];
+    struct io_uring_sqe *sqe;
+    unsigned             tail, pos;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    tail = *ring->sq_tail;
+    HDassert(tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) < ring->sq_entries);
+    pos = tail & *ring->sq_mask;
+    sqe = &ring->sqes[pos];
+
+    HDmemset(sqe, 0, sizeof(*sqe));
+    sqe->fd        = file->fd;
+    sqe->off       = (__u64)(slot->addr + slot->done);
+    sqe->addr      = (__u64)(uintptr_t)(slot->mem + slot->done);
+    sqe->len       = (__u32)(slot->len - slot->done);
+    sqe->user_data = (__u64)idx;
+    if (file->fixed_bufs) {
+        sqe->opcode    = (__u8)(do_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED);
+        sqe->buf_index = (__u16)idx;
+    }
+    else
+        sqe->opcode = (__u8)(do_write ? IORING_OP_WRITE : IORING_OP_READ);
+
+    ring->sq_array[pos] = pos;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__uring_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_drain
+ *
+ * Purpose:     Empty the rings after a failed transfer.  Requests that were
+ *              queued but never submitted are taken back, and the routine
+ *              waits for the OUTSTANDING requests the kernel already has to
+ *              complete, discarding their results, so that no request is
+ *              left referring to the caller's buffer.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__uring_drain(H5FD_uring_t *file, unsigned outstanding)
+{
+    H5FD_uring_ring_t *ring = &file->ring;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Take back the queued requests the kernel hasn't consumed */
+    __atomic_store_n(ring->sq_tail, __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+
+    while (outstanding > 0) {
+        unsigned head = *ring->cq_head;
+        unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+        if (head == tail) {
+            long nsub;
+
+            /* Wait for at least one more completion */
+            do {
+                nsub = syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+            } while (nsub < 0 && EINTR == errno);
+
+            /* Nothing more can be done if the ring can't be waited on */
+            if (nsub < 0)
+                break;
+        }
+        else {
+            outstanding -= MIN(outstanding, tail - head);
+            __atomic_store_n(ring->cq_head, tail, __ATOMIC_RELEASE);
+        }
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__uring_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_io
+ *
+ * Purpose:     Transfer SIZE bytes at file address ADDR to RBUF (reads) or
+ *              from WBUF (writes).  The transfer is split into blocks of
+ *              the configured size which are queued together and kept in
+ *              flight up to the configured queue depth; each system call
+ *              both submits the newly queued blocks and waits for at least
+ *              one completion.
+ *
+ *              Reads past the end of the file are zero-filled.  Short
+ *              transfers are resubmitted for the remainder.
+ *
+ *              With O_DIRECT the transfer is widened to the alignment and
+ *              goes through the bounce buffers.  For writes whose ends are
+ *              not aligned, the partial head and tail blocks are read back
+ *              first so the bytes outside the request are preserved.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_io(H5FD_uring_t *file, hbool_t do_write, haddr_t addr, size_t size, unsigned char *rbuf,
+               const unsigned char *wbuf)
+{
+    H5FD_uring_ring_t *ring = &file->ring;
+    size_t             bs   = file->fa.block_size;
+    haddr_t            end  = addr + size;       /* End of the request */
+    haddr_t            start, stop;              /* Range actually transferred */
+    haddr_t            next;                     /* Next address to queue */
+    unsigned char *    head_blk = NULL;          /* Partial first block (O_DIRECT writes) */
+    unsigned char *    tail_blk = NULL;          /* Partial last block (O_DIRECT writes) */
+    unsigned           nfree    = 0;             /* Number of unused slots */
+    unsigned           inflight = 0;             /* Number of requests in flight */
+    unsigned           pending  = 0;             /* Number of requests queued but not submitted */
+    int                io_errno = 0;             /* First I/O error, if any */
+    herr_t             ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(size > 0);
+
+    if (file->fa.use_direct) {
+        start = H5FD_URING_ALIGN_DOWN(addr);
+        stop  = H5FD_URING_ALIGN_UP(end);
+    }
+    else {
+        start = addr;
+        stop  = end;
+    }
+
+    /* Read back the partial blocks at either end of an unaligned O_DIRECT write */
+    if (do_write && file->fa.use_direct && (start != addr || stop != end)) {
+        haddr_t last = stop - H5FD_URING_ALIGNMENT;
+
+        if (NULL == (head_blk = (unsigned char *)H5MM_malloc((size_t)H5FD_URING_ALIGNMENT)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate partial block")
+        if (start < file->eof) {
+            if (H5FD__uring_io(file, FALSE, start, (size_t)H5FD_URING_ALIGNMENT, head_blk, NULL) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read partial block")
+        }
+        else
+            HDmemset(head_blk, 0, (size_t)H5FD_URING_ALIGNMENT);
+
+        if (last == start)
+            tail_blk = head_blk;
+        else if (stop != end) {
+            if (NULL == (tail_blk = (unsigned char *)H5MM_malloc((size_t)H5FD_URING_ALIGNMENT)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate partial block")
+            if (last < file->eof) {
+                if (H5FD__uring_io(file, FALSE, last, (size_t)H5FD_URING_ALIGNMENT, tail_blk, NULL) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read partial block")
+            }
+            else
+                HDmemset(tail_blk, 0, (size_t)H5FD_URING_ALIGNMENT);
+        }
+    }
+
+    /* All slots start out free */
+    while (nfree < file->fa.queue_depth) {
+        file->free_slots[nfree] = nfree;
+        nfree++;
+    }
+
+    next = start;
+    while ((next < stop && 0 == io_errno) || inflight > 0) {
+        unsigned head, tail;
+        long     nsub;
+
+        /* Queue as many new blocks as there are free slots */
+        while (next < stop && 0 == io_errno && nfree > 0) {
+            unsigned           idx  = file->free_slots[--nfree];
+            H5FD_uring_slot_t *slot = &file->slots[idx];
+
+            slot->addr = next;
+            slot->len  = (size_t)MIN((haddr_t)bs, stop - next);
+            slot->done = 0;
+            if (file->fa.use_direct) {
+                slot->mem = file->bounce + (size_t)idx * bs;
+                if (do_write) {
+                    haddr_t lo = MAX(slot->addr, addr);
+                    haddr_t hi = MIN(slot->addr + slot->len, end);
+
+                    if (slot->addr < addr)
+                        H5MM_memcpy(slot->mem, head_blk, (size_t)(addr - slot->addr));
+                    H5MM_memcpy(slot->mem + (lo - slot->addr), wbuf + (lo - addr), (size_t)(hi - lo));
+                    if (slot->addr + slot->len > end)
+                        H5MM_memcpy(slot->mem + (end - slot->addr),
+                                    tail_blk + (end - (stop - H5FD_URING_ALIGNMENT)), (size_t)(stop - end));
+                }
+            }
+            else
+                /* Non-direct transfers go straight to or from the caller's buffer */
+                slot->mem = do_write ? (unsigned char *)(uintptr_t)(wbuf + (next - addr)) : rbuf + (next - addr);
+
+            H5FD__uring_queue(file, do_write, idx);
+            next += slot->len;
+            inflight++;
+            pending++;
+        }
+
+        /* Submit the queued blocks and wait for at least one to complete */
+        do {
+            nsub = syscall(__NR_io_uring_enter, ring->fd, pending, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        } while (nsub < 0 && EINTR == errno);
+        if (nsub < 0) {
+            int enter_errno = errno;
+
+            /* Don't return while requests on the caller's buffer are in flight */
+            H5FD__uring_drain(file, inflight - pending);
+            errno = enter_errno;
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "io_uring_enter failed")
+        }
+        pending -= (unsigned)nsub;
+
+        /* Reap the completions */
+        head = *ring->cq_head;
+        tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            struct io_uring_cqe *cqe  = &ring->cqes[head & *ring->cq_mask];
+            unsigned             idx  = (unsigned)cqe->user_data;
+            H5FD_uring_slot_t *  slot = &file->slots[idx];
+            int                  res  = cqe->res;
+
+            head++;
+
+            if (res < 0) {
+                if (-EINTR == res || -EAGAIN == res) {
+                    H5FD__uring_queue(file, do_write, idx);
+                    pending++;
+                    continue;
+                }
+                if (0 == io_errno)
+                    io_errno = -res;
+                slot->done = slot->len;
+            }
+            else if (0 == res) {
+                /* End of file: reads are zero-filled, writes can't progress */
+                if (do_write) {
+                    if (0 == io_errno)
+                        io_errno = EIO;
+                }
+                else
+                    HDmemset(slot->mem + slot->done, 0, slot->len - slot->done);
+                slot->done = slot->len;
+            }
+            else {
+                slot->done += (size_t)res;
+
+                /* A short O_DIRECT read that ends off the alignment reached the
+                 * end of the file; the remainder can't be resubmitted as is.
+                 */
+                if (!do_write && file->fa.use_direct && slot->done < slot->len &&
+                    (slot->done % H5FD_URING_ALIGNMENT) != 0) {
+                    HDmemset(slot->mem + slot->done, 0, slot->len - slot->done);
+                    slot->done = slot->len;
+                }
+            }
+
+            if (slot->done < slot->len) {
+                /* Short transfer, resubmit the remainder */
+                H5FD__uring_queue(file, do_write, idx);
+                pending++;
+            }
+            else {
+                if (!do_write && file->fa.use_direct && 0 == io_errno) {
+                    haddr_t lo = MAX(slot->addr, addr);
+                    haddr_t hi = MIN(slot->addr + slot->len, end);
+
+                    H5MM_memcpy(rbuf + (lo - addr), slot->mem + (lo - slot->addr), (size_t)(hi - lo));
+                }
+                file->free_slots[nfree++] = idx;
+                inflight--;
+            }
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    if (io_errno) {
+        errno = io_errno;
+        HSYS_GOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "io_uring transfer failed")
+    }
+
+done:
+    if (tail_blk && tail_blk != head_blk)
+        H5MM_xfree(tail_blk);
+    H5MM_xfree(head_blk);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                 size_t size, void *buf /*out*/)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Reads entirely past the end of the file need no I/O */
+    if (addr >= file->eof)
+        HDmemset(buf, 0, size);
+    else if (H5FD__uring_io(file, FALSE, addr, size, (unsigned char *)buf, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                    "file read failed: file name = '%s', file descriptor = %d, addr = %llu, size = %llu",
+                    file->filename, file->fd, (unsigned long long)addr, (unsigned long long)size)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                  size_t size, const void *buf)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    if (H5FD__uring_io(file, TRUE, addr, size, NULL, (const unsigned char *)buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                    "file write failed: file name = '%s', file descriptor = %d, addr = %llu, size = %llu",
+                    file->filename, file->fd, (unsigned long long)addr, (unsigned long long)size)
+
+    /* Update the end of file */
+    if (addr + size > file->eof)
+        file->eof = addr + size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-allocation.  With O_DIRECT this also trims the
+ *              padding left by writes rounded up to the alignment.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (file->eoa != file->eof || file->fa.use_direct) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *              The lock type to apply depends on the parameter "rw":
+ *                  TRUE--opens for write: an exclusive lock
+ *                  FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_uring_t *file = (H5FD_uring_t *)_file; /* VFD file struct      */
+    int           lock_flags;                   /* file locking flags   */
+    herr_t        ret_value = SUCCEED;          /* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__uring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__uring_unlock(H5FD_t *_file)
+{
+    H5FD_uring_t *file      = (H5FD_uring_t *)_file; /* VFD file struct          */
+    herr_t        ret_value = SUCCEED;               /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__uring_unlock() */
+
+#endif /* H5_HAVE_URING */
@@ -0,0 +1,50 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the Linux io_uring driver.
+ */
+#ifndef H5FDuring_H
+#define H5FDuring_H
+
+#ifdef H5_HAVE_URING
+#define H5FD_URING (H5FD_uring_init())
+#else
+#define H5FD_URING (H5I_INVALID_HID)
+#endif /* H5_HAVE_URING */
+
+#ifdef H5_HAVE_URING
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default values for the submission queue depth and the size of each I/O
+ * request submitted.  Application can set these values through the function
+ * H5Pset_fapl_uring. */
+#define H5FD_URING_QUEUE_DEPTH_DEF 32
+#define H5FD_URING_BLOCK_SIZE_DEF  (1024 * 1024)
+
+/* Alignment of file offsets, sizes and memory for O_DIRECT I/O */
+#define H5FD_URING_ALIGNMENT 4096
+
+H5_DLL hid_t  H5FD_uring_init(void);
+H5_DLL herr_t H5Pset_fapl_uring(hid_t fapl_id, unsigned queue_depth, size_t block_size, hbool_t use_direct);
+H5_DLL herr_t H5Pget_fapl_uring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *block_size /*out*/,
+                                hbool_t *use_direct /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_URING */
+
+#endif
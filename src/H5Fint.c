@@ -34,6 +34,7 @@
 #include "H5MFprivate.h" /* File memory management                   */
 #include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
+#include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5SMprivate.h" /* Shared Object Header Messages            */
 #include "H5Tprivate.h"  /* Datatypes                                */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -431,6 +432,8 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set collective metadata read flag")
     if (H5P_set(new_plist, H5F_ACS_COLL_MD_WRITE_FLAG_NAME, &(f->shared->coll_md_write)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set collective metadata read flag")
+    if (H5P_set(new_plist, H5F_ACS_MPIO_ARENA_SIZE_NAME, &(f->shared->raw_arena_size)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set raw data arena size")
     if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
         MPI_Comm mpi_comm;
         MPI_Info mpi_info;
@@ -1223,6 +1226,10 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get collective metadata read flag")
         if (H5P_get(plist, H5F_ACS_COLL_MD_WRITE_FLAG_NAME, &(f->shared->coll_md_write)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get collective metadata write flag")
+        if (H5P_get(plist, H5F_ACS_MPIO_ARENA_SIZE_NAME, &(f->shared->raw_arena_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get raw data arena size")
+        f->shared->raw_arena_addr = HADDR_UNDEF;
+        f->shared->raw_arena_end  = HADDR_UNDEF;
 #endif /* H5_HAVE_PARALLEL */
         if (H5P_get(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, &(f->shared->mdc_initCacheImageCfg)) <
             0)
@@ -1586,6 +1593,16 @@ H5F__dest(H5F_t *f, hbool_t flush)
                 HDONE_ERROR(H5E_FILE, H5E_CANTDEC, FAIL, "can't close VOL connector ID")
         f->shared->vol_cls = NULL;
 
+#ifdef H5_HAVE_PARALLEL
+        /* Release the MPI datatypes built for hyperslab selections */
+        if (f->shared->mpio_type_cache) {
+            if (H5S_mpio_type_cache_destroy(f->shared->mpio_type_cache) < 0)
+                /* Push error, but keep going*/
+                HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to release MPI datatype cache")
+            f->shared->mpio_type_cache = NULL;
+        } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
         /* Close the file */
         if (H5FD_close(f->shared->lf) < 0)
             /* Push error, but keep going*/
@@ -2153,6 +2170,15 @@ H5F__flush_phase1(H5F_t *f)
         /* Push error, but keep going*/
         HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush dataset cache")
 
+#ifdef H5_HAVE_PARALLEL
+    /* Give back what the processes didn't use of their raw data arenas, unless
+     * datasets that place chunks there are still open
+     */
+    if ((f->shared->closing || 0 == f->shared->raw_arena_nusers) && H5MF_arena_release(f) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't release raw data arenas")
+#endif /* H5_HAVE_PARALLEL */
+
     /* Release any space allocated to space aggregators, so that the eoa value
      *  corresponds to the end of the space written to in the file.
      */
@@ -151,6 +151,54 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_block_borrow
+ *
+ * Purpose:	Retrieves a pointer to SIZE bytes at ADDR in the memory
+ *		image of the file, for file drivers which keep one.  The
+ *		pointer may be read from in place of a H5F_shared_block_read
+ *		call until the file is closed.  The address is relative to
+ *		the base address for the file.
+ *
+ *		Only files opened read-only can lend out their image,
+ *		since otherwise the page buffer or metadata accumulator
+ *		could hold changes which haven't reached the driver yet.
+ *
+ * Return:	Non-negative on success/Negative on failure.  *IMAGE is
+ *		NULL if the data must be read with H5F_shared_block_read.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_block_borrow(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                        const void **image /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(image);
+    HDassert(H5F_addr_defined(addr));
+
+    *image = NULL;
+
+    if (f_sh->flags & H5F_ACC_RDWR)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5F_addr_le(f_sh->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    /* Treat global heap as raw data */
+    if (H5FD_get_mem_image(f_sh->lf, (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type, addr, size, image) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to get file memory image")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_block_borrow() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_shared_block_write
  *
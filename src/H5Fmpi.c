@@ -36,6 +36,7 @@
 #include "H5Fpkg.h"      /* File access				*/
 #include "H5FDprivate.h" /* File drivers				*/
 #include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5Sprivate.h"  /* Dataspaces				*/
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
 
@@ -241,7 +242,7 @@ H5F_set_mpi_atomicity(H5F_t *file, hbool_t flag)
     HDassert(file);
 
     /* Check VFD */
-    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI))
+    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) || H5FD_MPIO != H5F_DRIVER_ID(file))
         HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
                     "incorrect VFL driver, does not support MPI atomicity mode");
 
@@ -310,7 +311,7 @@ H5F_get_mpi_atomicity(H5F_t *file, hbool_t *flag)
     HDassert(flag);
 
     /* Check VFD */
-    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI))
+    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) || H5FD_MPIO != H5F_DRIVER_ID(file))
         HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
                     "incorrect VFL driver, does not support MPI atomicity mode");
 
@@ -407,12 +408,19 @@ H5F_mpi_retrieve_comm(hid_t loc_id, hid_t acspl_id, MPI_Comm *mpi_comm)
     }
     /* otherwise, this is from H5Fopen or H5Fcreate and has to be collective */
     else {
-        H5P_genplist_t *plist; /* Property list pointer */
+        H5P_genplist_t *    plist;            /* Property list pointer */
+        const H5FD_class_t *driver;           /* File driver */
+        unsigned long       driver_flags = 0; /* File driver feature flags */
 
         if (NULL == (plist = H5P_object_verify(acspl_id, H5P_FILE_ACCESS)))
             HGOTO_ERROR(H5E_FILE, H5E_BADTYPE, FAIL, "not a file access list")
 
-        if (H5FD_MPIO == H5P_peek_driver(plist))
+        /* Any MPI-based driver (MPI-IO, subfiling) */
+        if (NULL == (driver = H5FD_get_class(H5P_peek_driver(plist))))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get file driver class")
+        if (H5FD_driver_query(driver, &driver_flags) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't query file driver")
+        if (driver_flags & H5FD_FEAT_HAS_MPI)
             if (H5P_peek(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, mpi_comm) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get MPI communicator")
     }
@@ -420,4 +428,34 @@ H5F_mpi_retrieve_comm(hid_t loc_id, hid_t acspl_id, MPI_Comm *mpi_comm)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_mpi_retrieve_comm */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_get_mpio_type_cache
+ *
+ * Purpose:     Retrieves the cache of MPI datatypes built for hyperslab
+ *              selections in the file, creating it on first use.
+ *
+ * Return:      Success:        Pointer to the datatype cache
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5S_mpio_type_cache_t *
+H5F_get_mpio_type_cache(const H5F_t *f)
+{
+    H5S_mpio_type_cache_t *ret_value = NULL;
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    HDassert(f && f->shared);
+
+    if (NULL == f->shared->mpio_type_cache)
+        if (NULL == (f->shared->mpio_type_cache = H5S_mpio_type_cache_create()))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTCREATE, NULL, "can't create MPI datatype cache")
+
+    ret_value = f->shared->mpio_type_cache;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_get_mpio_type_cache() */
 #endif /* H5_HAVE_PARALLEL */
@@ -362,7 +362,12 @@ struct H5F_shared_t {
 #ifdef H5_HAVE_PARALLEL
     H5P_coll_md_read_flag_t coll_md_read;  /* Do all metadata reads collectively */
     hbool_t                 coll_md_write; /* Do all metadata writes collectively */
-#endif                                     /* H5_HAVE_PARALLEL */
+    struct H5S_mpio_type_cache_t *mpio_type_cache; /* MPI datatypes built for hyperslab selections */
+    hsize_t  raw_arena_size;   /* Size of each process's raw data arena (0 if arenas aren't used) */
+    haddr_t  raw_arena_addr;   /* Next free address in this process's raw data arena */
+    haddr_t  raw_arena_end;    /* End of this process's raw data arena */
+    unsigned raw_arena_nusers; /* # of open datasets placing chunks in the raw data arenas */
+#endif                         /* H5_HAVE_PARALLEL */
 };
 
 /*
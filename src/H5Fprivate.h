@@ -618,6 +618,7 @@ typedef struct H5F_t H5F_t;
 #ifdef H5_HAVE_PARALLEL
 #define H5F_ACS_MPI_PARAMS_COMM_NAME "mpi_params_comm" /* the MPI communicator */
 #define H5F_ACS_MPI_PARAMS_INFO_NAME "mpi_params_info" /* the MPI info struct */
+#define H5F_ACS_MPIO_ARENA_SIZE_NAME "mpio_arena_size" /* size of each process's raw data arena */
 #endif                                                 /* H5_HAVE_PARALLEL */
 
 /* ======================== File Mount properties ====================*/
@@ -759,6 +760,7 @@ struct H5O_loc_t;
 struct H5HG_heap_t;
 struct H5VL_class_t;
 struct H5P_genplist_t;
+struct H5S_mpio_type_cache_t;
 
 /* Forward declarations for anonymous H5F objects */
 
@@ -917,6 +919,8 @@ H5_DLL herr_t  H5F_flush_mounts(H5F_t *f);
 H5_DLL herr_t H5F_shared_block_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                     void *buf /*out*/);
 H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/);
+H5_DLL herr_t H5F_shared_block_borrow(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                                      const void **image /*out*/);
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                      const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
@@ -963,6 +967,7 @@ H5_DLL int      H5F_mpi_get_size(const H5F_t *f);
 H5_DLL herr_t   H5F_mpi_retrieve_comm(hid_t loc_id, hid_t acspl_id, MPI_Comm *mpi_comm);
 H5_DLL herr_t   H5F_get_mpi_atomicity(H5F_t *file, hbool_t *flag);
 H5_DLL herr_t   H5F_set_mpi_atomicity(H5F_t *file, hbool_t flag);
+H5_DLL struct H5S_mpio_type_cache_t *H5F_get_mpio_type_cache(const H5F_t *f);
 #endif /* H5_HAVE_PARALLEL */
 
 /* External file cache routines */
@@ -98,6 +98,23 @@
  * desired flags.
  */
 #define H5F_MPIO_DEBUG_KEY "H5F_mpio_debug_key"
+
+/*
+ * Use this constant string as the MPI_Info key to have the MPI-IO driver
+ * aggregate independent raw data writes.  The value is the number of
+ * aggregator processes per node, as a decimal string.  Writes are held back
+ * and handed to the aggregators, which issue them as large stripe-aligned
+ * writes when the file is next flushed or closed.  The HDF5_MPIO_AGGREGATE
+ * environment variable overrides this setting.
+ */
+#define H5F_MPIO_AGGREGATE_KEY "H5F_mpio_aggregate"
+
+/*
+ * Use this constant string as the MPI_Info key to bound, in bytes, the raw
+ * data a process holds back for aggregation.  Writes that would exceed the
+ * bound are issued directly instead.
+ */
+#define H5F_MPIO_AGGREGATE_BUFFER_KEY "H5F_mpio_aggregate_buffer"
 #endif /* H5_HAVE_PARALLEL */
 
 /**
@@ -74,6 +74,15 @@ typedef struct {
     void *          op_data;       /* Application's op data */
 } H5G_iter_visit_ud_t;
 
+#ifdef H5_HAVE_PARALLEL
+/* User data for opening a group by name in a bulk collective metadata read */
+typedef struct {
+    const H5G_loc_t *loc;  /* Location to open the group from */
+    const char *     name; /* Name of the group */
+    H5G_t *          grp;  /* Group opened */
+} H5G_open_name_ud_t;
+#endif /* H5_HAVE_PARALLEL */
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -85,6 +94,9 @@ typedef struct {
 static herr_t H5G__open_oid(H5G_t *grp);
 static herr_t H5G__visit_cb(const H5O_link_t *lnk, void *_udata);
 static herr_t H5G__close_cb(H5VL_object_t *grp_vol_obj, void **request);
+#ifdef H5_HAVE_PARALLEL
+static herr_t H5G__open_name_cb(void *_udata);
+#endif /* H5_HAVE_PARALLEL */
 
 /*********************/
 /* Package Variables */
@@ -440,6 +452,22 @@ H5G__open_name(const H5G_loc_t *loc, const char *name)
     HDassert(loc);
     HDassert(name);
 
+#ifdef H5_HAVE_PARALLEL
+    {
+        H5G_open_name_ud_t udata;             /* User data for bulk read */
+        hbool_t            bulk_read = FALSE; /* Whether the group was opened with a bulk read */
+
+        /* Open the group with the metadata read collectively broadcast in bulk, if possible */
+        udata.loc  = loc;
+        udata.name = name;
+        udata.grp  = NULL;
+        if (H5AC_coll_bulk_read(loc->oloc->file, H5G__open_name_cb, &udata, &bulk_read) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "unable to open group")
+        if (bulk_read)
+            HGOTO_DONE(udata.grp)
+    }
+#endif /* H5_HAVE_PARALLEL */
+
     /* Set up opened group location to fill in */
     grp_loc.oloc = &grp_oloc;
     grp_loc.path = &grp_path;
@@ -471,6 +499,34 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__open_name() */
 
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__open_name_cb
+ *
+ * Purpose:	Opens a group by name, as the operation of a bulk
+ *		collective metadata read.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__open_name_cb(void *_udata)
+{
+    H5G_open_name_ud_t *udata     = (H5G_open_name_ud_t *)_udata;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (udata->grp = H5G__open_name(udata->loc, udata->name)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open group")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__open_name_cb() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function:	H5G_open
  *
@@ -171,6 +171,17 @@ H5G__traverse_ud(const H5G_loc_t *grp_loc /*in,out*/, const H5O_link_t *lnk, H5G
     HDassert(lnk->type >= H5L_TYPE_UD_MIN);
     HDassert(obj_loc);
 
+#ifdef H5_HAVE_PARALLEL
+    /* User-defined link callbacks (e.g. external links, which open files)
+     * may be collective, which process 0 can't do by itself while recording
+     * a bulk collective metadata read.  Failing makes all processes redo the
+     * operation together.
+     */
+    if (H5C_coll_bulk_read_recording())
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL,
+                    "can't traverse user-defined link during a bulk collective read")
+#endif /* H5_HAVE_PARALLEL */
+
     /* Get the link class for this type of link. */
     if (NULL == (link_class = H5L_find_class(lnk->type)))
         HGOTO_ERROR(H5E_SYM, H5E_NOTREGISTERED, FAIL, "unable to get UD link class")
@@ -29,10 +29,11 @@
 /***********/
 /* Headers */
 /***********/
-#include "H5private.h"  /* Generic Functions			*/
-#include "H5Eprivate.h" /* Error handling		  	*/
-#include "H5Fpkg.h"     /* File access				*/
-#include "H5MFpkg.h"    /* File memory management		*/
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Fpkg.h"      /* File access				*/
+#include "H5MFpkg.h"     /* File memory management		*/
+#include "H5MMprivate.h" /* Memory management			*/
 
 /****************/
 /* Local Macros */
@@ -55,6 +56,9 @@ static haddr_t H5MF__aggr_alloc(H5F_t *f, H5F_blk_aggr_t *aggr, H5F_blk_aggr_t *
                                 hsize_t size);
 static herr_t  H5MF__aggr_reset(H5F_t *f, H5F_blk_aggr_t *aggr);
 static htri_t  H5MF__aggr_can_shrink_eoa(H5F_t *f, H5FD_mem_t type, H5F_blk_aggr_t *aggr);
+#ifdef H5_HAVE_PARALLEL
+static herr_t H5MF__arena_reset(H5F_t *f, hbool_t reserve);
+#endif /* H5_HAVE_PARALLEL */
 
 /*********************/
 /* Package Variables */
@@ -930,3 +934,361 @@ done:
 done:
         FUNC_LEAVE_NOAPI(ret_value)
     } /* end H5MF__aggrs_try_shrink_eoa() */
+
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_enabled
+ *
+ * Purpose:     Check if the processes sharing the file carve raw data
+ *              out of per-process arenas.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5MF_arena_enabled(const H5F_t *f)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->raw_arena_size > 0 && (H5F_INTENT(f) & H5F_ACC_RDWR) &&
+                     H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+} /* end H5MF_arena_enabled() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_size
+ *
+ * Purpose:     Get the size of each process's raw data arena, rounded up
+ *              to the file's alignment.  This is the largest block that
+ *              can be allocated from an arena.
+ *
+ * Return:      Size of each arena (0 if arenas aren't used)
+ *
+ *-------------------------------------------------------------------------
+ */
+hsize_t
+H5MF_arena_size(const H5F_t *f)
+{
+    hsize_t arena_size; /* Size of each arena */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Keep each process's arena aligned like the block holding them */
+    arena_size = f->shared->raw_arena_size;
+    if (f->shared->alignment > 1 && (arena_size % f->shared->alignment))
+        arena_size += f->shared->alignment - (arena_size % f->shared->alignment);
+
+    FUNC_LEAVE_NOAPI(arena_size)
+} /* end H5MF_arena_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_attach
+ *
+ * Purpose:     Register a dataset that places chunks in the processes'
+ *              raw data arenas, reserving the arenas if they aren't
+ *              already.
+ *
+ *              Collective, like creating or opening the dataset.  As all
+ *              processes reserve and release their arenas together, they
+ *              all agree on whether communication is needed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_arena_attach(H5F_t *f)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5MF_arena_enabled(f));
+
+    if (!H5F_addr_defined(f->shared->raw_arena_addr))
+        if (H5MF__arena_reset(f, TRUE) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reserve raw data arenas")
+    f->shared->raw_arena_nusers++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_arena_attach() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_detach
+ *
+ * Purpose:     Unregister a dataset that placed chunks in the processes'
+ *              raw data arenas.  The arenas are kept until the file is
+ *              flushed or closed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5MF_arena_detach(H5F_t *f)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->raw_arena_nusers > 0);
+
+    f->shared->raw_arena_nusers--;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5MF_arena_detach() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_refill
+ *
+ * Purpose:     Reserve a new raw data arena for each process that has
+ *              used up half of its current one (or doesn't have one yet).
+ *              The unused parts of the old arenas are released; the other
+ *              processes keep theirs.
+ *
+ *              This is collective: all processes reserve one block in the
+ *              same order, so the file's free space information stays the
+ *              same everywhere.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_arena_refill(H5F_t *f)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* (Don't bother when the arenas are about to be released for good) */
+    if (H5MF_arena_enabled(f) && !f->shared->closing)
+        if (H5MF__arena_reset(f, TRUE) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reserve raw data arenas")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_arena_refill() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_release
+ *
+ * Purpose:     Release the unused parts of all processes' raw data arenas.
+ *              Collective.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_arena_release(H5F_t *f)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* (Arenas are reserved collectively, so either all processes have one or none do) */
+    if (H5F_addr_defined(f->shared->raw_arena_addr))
+        if (H5MF__arena_reset(f, FALSE) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't release raw data arenas")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_arena_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_fits
+ *
+ * Purpose:     Check if NBLOCKS blocks of SIZE bytes each can still be
+ *              allocated from this process's raw data arena, without
+ *              allocating them.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5MF_arena_fits(const H5F_t *f, size_t nblocks, hsize_t size)
+{
+    haddr_t addr;              /* Next free address in the arena */
+    hsize_t stride = size;     /* Space taken by each block after the first */
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    if (0 == nblocks)
+        HGOTO_DONE(TRUE)
+
+    if (H5F_addr_defined(addr = f->shared->raw_arena_addr)) {
+        /* Same alignment as H5MF_arena_alloc() */
+        if (f->shared->alignment > 1 && size >= f->shared->threshold) {
+            if (addr % f->shared->alignment)
+                addr += f->shared->alignment - (addr % f->shared->alignment);
+            if (stride % f->shared->alignment)
+                stride += f->shared->alignment - (stride % f->shared->alignment);
+        } /* end if */
+
+        if (H5F_addr_le(addr, f->shared->raw_arena_end) &&
+            (f->shared->raw_arena_end - addr) / stride >= (hsize_t)(nblocks - 1) &&
+            H5F_addr_le(addr + stride * (hsize_t)(nblocks - 1) + size, f->shared->raw_arena_end))
+            ret_value = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_arena_fits() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_arena_alloc
+ *
+ * Purpose:     Allocate SIZE bytes of raw data from this process's arena,
+ *              without communicating with the other processes.
+ *
+ *              The space is already accounted for in the file, so the
+ *              caller only has to publish what it stores there at the
+ *              next collective operation.
+ *
+ * Return:      Success:    The file address of the new space
+ *              Failure:    HADDR_UNDEF, if there's no arena or it is too
+ *                          full for the request
+ *
+ *-------------------------------------------------------------------------
+ */
+haddr_t
+H5MF_arena_alloc(H5F_t *f, hsize_t size)
+{
+    haddr_t addr;                    /* Address of the new space */
+    haddr_t ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(size > 0);
+
+    if (H5F_addr_defined(addr = f->shared->raw_arena_addr)) {
+        /* Keep the file's alignment for blocks that would otherwise be aligned */
+        if (f->shared->alignment > 1 && size >= f->shared->threshold && (addr % f->shared->alignment))
+            addr += f->shared->alignment - (addr % f->shared->alignment);
+
+        if (H5F_addr_le(addr + size, f->shared->raw_arena_end)) {
+            f->shared->raw_arena_addr = addr + size;
+            ret_value                 = addr;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_arena_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__arena_reset
+ *
+ * Purpose:     Exchange the state of all processes' raw data arenas, so
+ *              that every process knows which ones need replacing.  When
+ *              RESERVE is set, those are the arenas of the processes that
+ *              are running low: their unused parts are released and new
+ *              arenas for them are carved out of one block.  Otherwise
+ *              the unused parts of all arenas are released.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5MF__arena_reset(H5F_t *f, hbool_t reserve)
+{
+    MPI_Comm comm;                /* File's communicator */
+    int      mpi_rank, mpi_size;  /* This process's rank & # of processes */
+    int      mpi_code;            /* MPI return code */
+    haddr_t  local[2];            /* This process's arena: next free address and end */
+    haddr_t *all = NULL;          /* Arenas of all processes */
+    hsize_t  arena_size;          /* Size of each arena */
+    hsize_t  nlow = 0;            /* # of processes needing a new arena */
+    hsize_t  slot = 0;            /* This process's arena in the new block */
+    hbool_t  low  = FALSE;        /* Whether this process needs a new arena */
+    haddr_t  block;               /* Block holding the new arenas */
+    int      u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    arena_size = H5MF_arena_size(f);
+
+    if (MPI_COMM_NULL == (comm = H5F_mpi_get_comm(f)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_MPI, FAIL, "can't retrieve MPI communicator")
+    if ((mpi_rank = H5F_mpi_get_rank(f)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_MPI, FAIL, "can't retrieve MPI rank")
+    if ((mpi_size = H5F_mpi_get_size(f)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_MPI, FAIL, "can't retrieve MPI size")
+
+    if (NULL == (all = (haddr_t *)H5MM_malloc(2 * (size_t)mpi_size * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate arena information")
+    local[0] = f->shared->raw_arena_addr;
+    local[1] = f->shared->raw_arena_end;
+    if (MPI_SUCCESS != (mpi_code = MPI_Allgather(local, (int)sizeof(local), MPI_BYTE, all,
+                                                 (int)sizeof(local), MPI_BYTE, comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+
+    /* Release the unused parts of the arenas being replaced, in the same order everywhere */
+    for (u = 0; u < mpi_size; u++)
+        if (!reserve || !H5F_addr_defined(all[2 * u]) || (all[2 * u + 1] - all[2 * u]) < arena_size / 2) {
+            if (H5F_addr_defined(all[2 * u]) && H5F_addr_lt(all[2 * u], all[2 * u + 1]))
+                if (H5MF_xfree(f, H5FD_MEM_DRAW, all[2 * u], all[2 * u + 1] - all[2 * u]) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't release unused arena space")
+            if (u == mpi_rank) {
+                low  = TRUE;
+                slot = nlow;
+            } /* end if */
+            nlow++;
+        } /* end if */
+    if (low) {
+        f->shared->raw_arena_addr = HADDR_UNDEF;
+        f->shared->raw_arena_end  = HADDR_UNDEF;
+    } /* end if */
+
+    if (reserve && nlow > 0) {
+        if (HADDR_UNDEF == (block = H5MF_alloc(f, H5FD_MEM_DRAW, arena_size * nlow)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate raw data arenas")
+        if (low) {
+            f->shared->raw_arena_addr = block + arena_size * slot;
+            f->shared->raw_arena_end  = f->shared->raw_arena_addr + arena_size;
+        } /* end if */
+    }     /* end if */
+
+done:
+    H5MM_xfree(all);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__arena_reset() */
+#endif /* H5_HAVE_PARALLEL */
@@ -64,6 +64,18 @@ H5_DLL haddr_t H5MF_alloc_tmp(H5F_t *f, hsize_t size);
 /* 'block aggregator' routines */
 H5_DLL herr_t H5MF_free_aggrs(H5F_t *f);
 
+#ifdef H5_HAVE_PARALLEL
+/* Per-process raw data arena routines */
+H5_DLL hbool_t H5MF_arena_enabled(const H5F_t *f);
+H5_DLL hsize_t H5MF_arena_size(const H5F_t *f);
+H5_DLL herr_t  H5MF_arena_attach(H5F_t *f);
+H5_DLL void    H5MF_arena_detach(H5F_t *f);
+H5_DLL herr_t  H5MF_arena_refill(H5F_t *f);
+H5_DLL herr_t  H5MF_arena_release(H5F_t *f);
+H5_DLL hbool_t H5MF_arena_fits(const H5F_t *f, size_t nblocks, hsize_t size);
+H5_DLL haddr_t H5MF_arena_alloc(H5F_t *f, hsize_t size);
+#endif /* H5_HAVE_PARALLEL */
+
 /* Free space manager settling routines */
 H5_DLL herr_t H5MF_settle_raw_data_fsm(H5F_t *f, hbool_t *fsm_settled);
 H5_DLL herr_t H5MF_settle_meta_data_fsm(H5F_t *f, hbool_t *fsm_settled);
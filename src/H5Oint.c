@@ -62,6 +62,16 @@ typedef struct {
     unsigned       fields;    /* Selection of object info */
 } H5O_iter_visit_ud_t;
 
+#ifdef H5_HAVE_PARALLEL
+/* User data for opening an object by name in a bulk collective metadata read */
+typedef struct {
+    const H5G_loc_t *loc;         /* Location to open the object from */
+    const char *     name;        /* Name of the object */
+    H5I_type_t *     opened_type; /* Type of the object opened */
+    void *           obj;         /* Object opened */
+} H5O_open_name_ud_t;
+#endif /* H5_HAVE_PARALLEL */
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -77,6 +87,9 @@ static herr_t H5O__free_visit_visited(void *item, void *key, void *operator_data
 static herr_t H5O__visit_cb(hid_t group, const char *name, const H5L_info2_t *linfo, void *_udata);
 static const H5O_obj_class_t *H5O__obj_class_real(const H5O_t *oh);
 static herr_t                 H5O__reset_info2(H5O_info2_t *oinfo);
+#ifdef H5_HAVE_PARALLEL
+static herr_t H5O__open_name_cb(void *_udata);
+#endif /* H5_HAVE_PARALLEL */
 
 /*********************/
 /* Package Variables */
@@ -612,6 +625,23 @@ H5O_open_name(const H5G_loc_t *loc, const char *name, H5I_type_t *opened_type)
     HDassert(loc);
     HDassert(name && *name);
 
+#ifdef H5_HAVE_PARALLEL
+    {
+        H5O_open_name_ud_t udata;             /* User data for bulk read */
+        hbool_t            bulk_read = FALSE; /* Whether the object was opened with a bulk read */
+
+        /* Open the object with the metadata read collectively broadcast in bulk, if possible */
+        udata.loc         = loc;
+        udata.name        = name;
+        udata.opened_type = opened_type;
+        udata.obj         = NULL;
+        if (H5AC_coll_bulk_read(loc->oloc->file, H5O__open_name_cb, &udata, &bulk_read) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTOPENOBJ, NULL, "unable to open object")
+        if (bulk_read)
+            HGOTO_DONE(udata.obj)
+    }
+#endif /* H5_HAVE_PARALLEL */
+
     /* Set up opened group location to fill in */
     obj_loc.oloc = &obj_oloc;
     obj_loc.path = &obj_path;
@@ -634,6 +664,34 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_open_name() */
 
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__open_name_cb
+ *
+ * Purpose:     Opens an object by name, as the operation of a bulk
+ *              collective metadata read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__open_name_cb(void *_udata)
+{
+    H5O_open_name_ud_t *udata     = (H5O_open_name_ud_t *)_udata;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (udata->obj = H5O_open_name(udata->loc, udata->name, udata->opened_type)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTOPENOBJ, FAIL, "unable to open object")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__open_name_cb() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__open_by_idx
  *
@@ -130,6 +130,12 @@
 /* Definitions for cause of broken collective io property */
 #define H5D_MPIO_NO_COLLECTIVE_CAUSE_SIZE sizeof(uint32_t)
 #define H5D_MPIO_NO_COLLECTIVE_CAUSE_DEF  H5D_MPIO_COLLECTIVE
+/* Definitions for MPI datatype construction time property */
+#define H5D_MPIO_TYPE_CONSTRUCT_TIME_SIZE sizeof(double)
+#define H5D_MPIO_TYPE_CONSTRUCT_TIME_DEF  0.0
+/* Definitions for MPI datatype cache hits property */
+#define H5D_MPIO_TYPE_CACHE_HITS_SIZE sizeof(unsigned)
+#define H5D_MPIO_TYPE_CACHE_HITS_DEF  0
 
 /* Definitions for EDC property */
 #define H5D_XFER_EDC_SIZE sizeof(H5Z_EDC_t)
@@ -258,6 +264,8 @@ static const H5D_mpio_actual_chunk_opt_mode_t H5D_def_mpio_actual_chunk_opt_mode
 static const H5D_mpio_actual_io_mode_t      H5D_def_mpio_actual_io_mode_g = H5D_MPIO_ACTUAL_IO_MODE_DEF;
 static const H5D_mpio_no_collective_cause_t H5D_def_mpio_no_collective_cause_g =
     H5D_MPIO_NO_COLLECTIVE_CAUSE_DEF;
+static const double   H5D_def_mpio_type_construct_time_g = H5D_MPIO_TYPE_CONSTRUCT_TIME_DEF;
+static const unsigned H5D_def_mpio_type_cache_hits_g     = H5D_MPIO_TYPE_CACHE_HITS_DEF;
 static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;       /* Default value for EDC property */
 static const H5Z_cb_t  H5D_def_filter_cb_g  = H5D_XFER_FILTER_CB_DEF; /* Default value for filter callback */
 static const H5T_conv_cb_t H5D_def_conv_cb_g =
@@ -396,6 +404,20 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the time spent building MPI datatypes for selections */
+    /* (Note: this property should not have an encode/decode callback) */
+    if (H5P__register_real(pclass, H5D_MPIO_TYPE_CONSTRUCT_TIME_NAME, H5D_MPIO_TYPE_CONSTRUCT_TIME_SIZE,
+                           &H5D_def_mpio_type_construct_time_g, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the number of MPI datatypes found in the file's datatype cache */
+    /* (Note: this property should not have an encode/decode callback) */
+    if (H5P__register_real(pclass, H5D_MPIO_TYPE_CACHE_HITS_NAME, H5D_MPIO_TYPE_CACHE_HITS_SIZE,
+                           &H5D_def_mpio_type_cache_hits_g, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the EDC property */
     if (H5P__register_real(pclass, H5D_XFER_EDC_NAME, H5D_XFER_EDC_SIZE, &H5D_def_enable_edc_g, NULL, NULL,
                            NULL, H5D_XFER_EDC_ENC, H5D_XFER_EDC_DEC, NULL, NULL, NULL, NULL) < 0)
@@ -2038,6 +2060,43 @@ H5Pget_mpio_no_collective_cause(hid_t plist_id, uint32_t *local_no_collective_ca
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_mpio_no_collective_cause() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_mpio_type_construct_info
+ *
+ * Purpose:	Retrieves the time spent building MPI datatypes for the
+ *		selections of the last parallel I/O operation, and how many
+ *		of those datatypes were reused from the file's datatype
+ *		cache instead of being built.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mpio_type_construct_info(hid_t plist_id, double *construct_time /*out*/, unsigned *cache_hits /*out*/)
+{
+    H5P_genplist_t *plist;
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, construct_time, cache_hits);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if (construct_time)
+        if (H5P_get(plist, H5D_MPIO_TYPE_CONSTRUCT_TIME_NAME, construct_time) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get construction time")
+    if (cache_hits)
+        if (H5P_get(plist, H5D_MPIO_TYPE_CACHE_HITS_NAME, cache_hits) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get cache hits")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mpio_type_construct_info() */
 #endif /* H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
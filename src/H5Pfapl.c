@@ -253,6 +253,11 @@
 #define H5F_ACS_MPI_PARAMS_INFO_COPY  H5P__facc_mpi_info_copy
 #define H5F_ACS_MPI_PARAMS_INFO_CMP   H5P__facc_mpi_info_cmp
 #define H5F_ACS_MPI_PARAMS_INFO_CLOSE H5P__facc_mpi_info_close
+/* Definition for the size of each process's raw data arena */
+#define H5F_ACS_MPIO_ARENA_SIZE_SIZE sizeof(hsize_t)
+#define H5F_ACS_MPIO_ARENA_SIZE_DEF  0
+#define H5F_ACS_MPIO_ARENA_SIZE_ENC  H5P__encode_hsize_t
+#define H5F_ACS_MPIO_ARENA_SIZE_DEC  H5P__decode_hsize_t
 #endif /* H5_HAVE_PARALLEL */
 /* Definitions for the initial metadata cache image configuration */
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_SIZE sizeof(H5AC_cache_image_config_t)
@@ -493,6 +498,8 @@ static const hbool_t H5F_def_coll_md_write_flag_g =
     H5F_ACS_COLL_MD_WRITE_FLAG_DEF; /* Default setting for the collective metedata write flag */
 static const MPI_Comm H5F_def_mpi_params_comm_g = H5F_ACS_MPI_PARAMS_COMM_DEF; /* Default MPI communicator */
 static const MPI_Info H5F_def_mpi_params_info_g = H5F_ACS_MPI_PARAMS_INFO_DEF; /* Default MPI info struct */
+static const hsize_t H5F_def_mpio_arena_size_g =
+    H5F_ACS_MPIO_ARENA_SIZE_DEF; /* Default size of each process's raw data arena */
 #endif                                                                         /* H5_HAVE_PARALLEL */
 static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g =
     H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_DEF; /* Default metadata cache image settings */
@@ -753,6 +760,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_MPI_PARAMS_INFO_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of each process's raw data arena */
+    if (H5P__register_real(pclass, H5F_ACS_MPIO_ARENA_SIZE_NAME, H5F_ACS_MPIO_ARENA_SIZE_SIZE,
+                           &H5F_def_mpio_arena_size_g, NULL, NULL, NULL, H5F_ACS_MPIO_ARENA_SIZE_ENC,
+                           H5F_ACS_MPIO_ARENA_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 #endif /* H5_HAVE_PARALLEL */
 
     /* Register the initial metadata cache image configuration */
@@ -5401,6 +5414,90 @@ H5Pget_coll_metadata_write(hid_t plist_id, hbool_t *is_collective /*out*/)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_coll_metadata_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mpio_arena_size
+ *
+ * Purpose:     Sets the size of the raw data arena reserved for each
+ *              process when a file is created or opened for writing with
+ *              an MPI-based driver.  Space for chunks first written with
+ *              independent I/O is then taken from the writing process's
+ *              arena without communicating, and the chunks are added to
+ *              the dataset's index at the next collective operation on
+ *              the dataset (collective I/O, flush, close or extent change).
+ *
+ *              Each chunk must fit in one arena: creating or opening a
+ *              dataset whose chunks are larger than SIZE fails.  Between
+ *              two collective operations on a dataset, a process can only
+ *              write new chunks into what is left of its arena; an
+ *              independent write that needs more fails before writing
+ *              anything.  At each collective operation, the processes
+ *              that have used up half of their arena get a new one.
+ *
+ *              The arenas are reserved when the first dataset using them
+ *              is created or opened, and their unused parts are released
+ *              when the file is closed, or flushed while no such dataset
+ *              is open.
+ *
+ *              Zero (the default) disables the arenas, in which case the
+ *              space for datasets in parallel files is allocated when
+ *              they are created.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mpio_arena_size(hid_t fapl_id, hsize_t size)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ih", fapl_id, size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_MPIO_ARENA_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set raw data arena size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mpio_arena_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mpio_arena_size
+ *
+ * Purpose:     Returns the size of each process's raw data arena.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mpio_arena_size(hid_t fapl_id, hsize_t *size /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (size)
+        if (H5P_get(plist, H5F_ACS_MPIO_ARENA_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get raw data arena size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mpio_arena_size() */
 #endif /* H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -3949,6 +3949,8 @@ H5_DLL herr_t H5Pset_coll_metadata_write(hid_t plist_id, hbool_t is_collective);
 H5_DLL herr_t H5Pget_coll_metadata_write(hid_t plist_id, hbool_t *is_collective);
 H5_DLL herr_t H5Pget_mpi_params(hid_t fapl_id, MPI_Comm *comm, MPI_Info *info);
 H5_DLL herr_t H5Pset_mpi_params(hid_t fapl_id, MPI_Comm comm, MPI_Info info);
+H5_DLL herr_t H5Pset_mpio_arena_size(hid_t fapl_id, hsize_t size);
+H5_DLL herr_t H5Pget_mpio_arena_size(hid_t fapl_id, hsize_t *size);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr);
 H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per,
@@ -5826,6 +5828,37 @@ H5_DLL herr_t H5Pget_mpio_actual_chunk_opt_mode(hid_t
 H5_DLL herr_t H5Pget_mpio_actual_io_mode(hid_t plist_id, H5D_mpio_actual_io_mode_t *actual_io_mode);
 H5_DLL herr_t H5Pget_mpio_no_collective_cause(hid_t plist_id, uint32_t *local_no_collective_cause,
                                               uint32_t *global_no_collective_cause);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves MPI datatype construction statistics for the last
+ *        parallel I/O operation
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] construct_time Time spent building MPI datatypes, in seconds
+ * \param[out] cache_hits     Number of MPI datatypes reused from the file's
+ *                            datatype cache
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_mpio_type_construct_info() retrieves the time spent
+ *          building MPI derived datatypes for the dataspace selections of
+ *          the last parallel I/O operation performed with the dataset
+ *          transfer property list \p plist_id, and how many of those
+ *          datatypes were found in the file's datatype cache instead of
+ *          being built.
+ *
+ *          Each open file caches the MPI datatypes built for hyperslab
+ *          selections, so repeated transfers of the same selections reuse
+ *          them. Datatypes for "all", "none" and point selections are not
+ *          cached.
+ *
+ *          Either \p construct_time or \p cache_hits may be NULL.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_mpio_type_construct_info(hid_t plist_id, double *construct_time, unsigned *cache_hits);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Link creation property list (LCPL) routines */
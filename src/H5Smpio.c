@@ -28,6 +28,7 @@
 /* Headers */
 /***********/
 #include "H5private.h"   /* Generic Functions			*/
+#include "H5CXprivate.h" /* API Contexts                         */
 #include "H5Dprivate.h"  /* Datasets				*/
 #include "H5Eprivate.h"  /* Error handling		  	*/
 #include "H5FLprivate.h" /* Free Lists				*/
@@ -42,6 +43,19 @@
 /****************/
 #define H5S_MPIO_INITIAL_ALLOC_COUNT 256
 
+/* Number of MPI datatypes held in a file's datatype cache */
+#define H5S_MPIO_TYPE_CACHE_NSLOTS 32
+
+/* Initial size of the buffer used to build a selection's cache key */
+#define H5S_MPIO_TYPE_KEY_INITIAL_ALLOC 256
+
+/* Tags recorded in a selection's cache key */
+#define H5S_MPIO_TYPE_KEY_REGULAR   ((uint8_t)'G') /* Regular hyperslab */
+#define H5S_MPIO_TYPE_KEY_SPANS     ((uint8_t)'S') /* Span tree hyperslab */
+#define H5S_MPIO_TYPE_KEY_NEW_NODE  ((uint8_t)'N') /* First visit to a span tree node */
+#define H5S_MPIO_TYPE_KEY_SEEN_NODE ((uint8_t)'R') /* Span tree node shared with an earlier one */
+#define H5S_MPIO_TYPE_KEY_LEAF      ((uint8_t)'L') /* Span without a lower dimension */
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -62,6 +76,28 @@ typedef struct H5S_mpio_mpitype_list_t {
     H5S_mpio_mpitype_node_t *tail; /* Pointer to tail of list */
 } H5S_mpio_mpitype_list_t;
 
+/* Buffer holding the key which identifies a selection in the datatype cache */
+typedef struct H5S_mpio_type_key_t {
+    uint8_t *buf;   /* Key bytes */
+    size_t   len;   /* Number of bytes used */
+    size_t   alloc; /* Number of bytes allocated */
+} H5S_mpio_type_key_t;
+
+/* MPI datatype held in the datatype cache */
+typedef struct H5S_mpio_type_cache_ent_t {
+    uint32_t     hash;    /* Hash of the key */
+    size_t       key_len; /* Size of the key, in bytes */
+    uint8_t *    key;     /* Key identifying the selection & element size */
+    MPI_Datatype type;    /* MPI datatype constructed for the selection */
+    int          count;   /* How many objects of the type in the selection */
+} H5S_mpio_type_cache_ent_t;
+
+/* Least-recently-used cache of MPI datatypes constructed for selections (typedef'd in H5Sprivate.h) */
+struct H5S_mpio_type_cache_t {
+    unsigned                  nused;                             /* Number of entries in use */
+    H5S_mpio_type_cache_ent_t ent[H5S_MPIO_TYPE_CACHE_NSLOTS]; /* Entries, most recently used first */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -83,6 +119,15 @@ static herr_t H5S__release_datatype(H5S_mpio_mpitype_list_t *type_list);
 static herr_t H5S__obtain_datatype(H5S_hyper_span_info_t *spans, const hsize_t *down, size_t elmt_size,
                                    const MPI_Datatype *elmt_type, MPI_Datatype *span_type,
                                    H5S_mpio_mpitype_list_t *type_list, unsigned op_info_i, uint64_t op_gen);
+static herr_t H5S__mpio_type_key_append(H5S_mpio_type_key_t *key, const void *data, size_t size);
+static herr_t H5S__mpio_type_key_spans(H5S_mpio_type_key_t *key, H5S_hyper_span_info_t *spans,
+                                       hsize_t *next_id, uint64_t op_gen);
+static herr_t H5S__mpio_type_key_build(const H5S_t *space, size_t elmt_size, H5S_mpio_type_key_t *key);
+static htri_t H5S__mpio_type_cache_lookup(H5S_mpio_type_cache_t *cache, uint32_t hash,
+                                          const H5S_mpio_type_key_t *key, MPI_Datatype *new_type,
+                                          int *count);
+static herr_t H5S__mpio_type_cache_insert(H5S_mpio_type_cache_t *cache, uint32_t hash,
+                                          H5S_mpio_type_key_t *key, MPI_Datatype type, int count);
 
 /*****************************/
 /* Library Private Variables */
@@ -95,6 +140,9 @@ static herr_t H5S__obtain_datatype(H5S_hyper_span_info_t *spans, const hsize_t *
 /* Declare a free list to manage the H5S_mpio_mpitype_node_t struct */
 H5FL_DEFINE_STATIC(H5S_mpio_mpitype_node_t);
 
+/* Declare a free list to manage the H5S_mpio_type_cache_t struct */
+H5FL_DEFINE_STATIC(H5S_mpio_type_cache_t);
+
 /*-------------------------------------------------------------------------
  * Function:	H5S__mpio_all_type
  *
@@ -1347,12 +1395,364 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__obtain_datatype() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5S__mpio_type_key_append
+ *
+ * Purpose:	Append bytes to a datatype cache key, growing its buffer
+ *		as needed.
+ *
+ * Return:	Non-negative on success, negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__mpio_type_key_append(H5S_mpio_type_key_t *key, const void *data, size_t size)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(key);
+    HDassert(data);
+
+    /* Make room for the new bytes */
+    if (key->len + size > key->alloc) {
+        size_t   new_alloc = MAX(key->alloc, H5S_MPIO_TYPE_KEY_INITIAL_ALLOC);
+        uint8_t *new_buf;
+
+        while (key->len + size > new_alloc)
+            new_alloc *= 2;
+        if (NULL == (new_buf = (uint8_t *)H5MM_realloc(key->buf, new_alloc)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't grow datatype cache key")
+        key->buf   = new_buf;
+        key->alloc = new_alloc;
+    } /* end if */
+
+    H5MM_memcpy(key->buf + key->len, data, size);
+    key->len += size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__mpio_type_key_append() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S__mpio_type_key_spans
+ *
+ * Purpose:	Append a span tree to a datatype cache key.
+ *
+ *		Span tree nodes shared between several spans are recorded
+ *		once, and referred to by the order in which they were first
+ *		visited afterwards, so the key grows with the size of the
+ *		span tree and not with the number of blocks it describes.
+ *
+ * Return:	Non-negative on success, negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__mpio_type_key_spans(H5S_mpio_type_key_t *key, H5S_hyper_span_info_t *spans, hsize_t *next_id,
+                         uint64_t op_gen)
+{
+    H5S_hyper_span_t *span;                /* Current span in list */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(key);
+    HDassert(spans);
+    HDassert(next_id);
+
+    /* Check if we've already visited this span tree */
+    if (spans->op_info[0].op_gen == op_gen) {
+        uint8_t tag = H5S_MPIO_TYPE_KEY_SEEN_NODE;
+
+        if (H5S__mpio_type_key_append(key, &tag, sizeof(tag)) < 0 ||
+            H5S__mpio_type_key_append(key, &spans->op_info[0].u.nblocks, sizeof(hsize_t)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span tree to cache key")
+    } /* end if */
+    else {
+        uint8_t tag = H5S_MPIO_TYPE_KEY_NEW_NODE;
+
+        if (H5S__mpio_type_key_append(key, &tag, sizeof(tag)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span tree to cache key")
+
+        /* Record each span, then the spans in the lower dimensions */
+        for (span = spans->head; span; span = span->next) {
+            if (H5S__mpio_type_key_append(key, &span->low, sizeof(hsize_t)) < 0 ||
+                H5S__mpio_type_key_append(key, &span->high, sizeof(hsize_t)) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span to cache key")
+            if (span->down) {
+                if (H5S__mpio_type_key_spans(key, span->down, next_id, op_gen) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span tree to cache key")
+            } /* end if */
+            else {
+                tag = H5S_MPIO_TYPE_KEY_LEAF;
+                if (H5S__mpio_type_key_append(key, &tag, sizeof(tag)) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span to cache key")
+            } /* end else */
+        }     /* end for */
+
+        /* Terminate the list of spans */
+        tag = H5S_MPIO_TYPE_KEY_NEW_NODE;
+        if (H5S__mpio_type_key_append(key, &tag, sizeof(tag)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span tree to cache key")
+
+        /* Remember that we've visited this span tree */
+        spans->op_info[0].op_gen    = op_gen;
+        spans->op_info[0].u.nblocks = (*next_id)++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__mpio_type_key_spans() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S__mpio_type_key_build
+ *
+ * Purpose:	Build the key identifying a hyperslab selection and element
+ *		size in the datatype cache.
+ *
+ *		The key holds everything the MPI datatype for the selection
+ *		is built from: the element size, the "big I/O" threshold,
+ *		the dataspace extent, the selection offset and either the
+ *		regular hyperslab parameters or the span tree.
+ *
+ * Return:	Non-negative on success, negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__mpio_type_key_build(const H5S_t *space, size_t elmt_size, H5S_mpio_type_key_t *key)
+{
+    hsize_t bigio_count;         /* Transition point to create derived type */
+    uint8_t tag;                 /* Kind of hyperslab selection */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS);
+    HDassert(key);
+
+    bigio_count = H5_mpi_get_bigio_count();
+    if (H5S__mpio_type_key_append(key, &elmt_size, sizeof(elmt_size)) < 0 ||
+        H5S__mpio_type_key_append(key, &bigio_count, sizeof(bigio_count)) < 0 ||
+        H5S__mpio_type_key_append(key, &space->extent.rank, sizeof(space->extent.rank)) < 0 ||
+        H5S__mpio_type_key_append(key, space->extent.size, space->extent.rank * sizeof(hsize_t)) < 0 ||
+        H5S__mpio_type_key_append(key, space->select.offset, space->extent.rank * sizeof(hssize_t)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append extent to cache key")
+
+    if (H5S_SELECT_IS_REGULAR(space) == TRUE) {
+        tag = H5S_MPIO_TYPE_KEY_REGULAR;
+        if (H5S__mpio_type_key_append(key, &tag, sizeof(tag)) < 0 ||
+            H5S__mpio_type_key_append(key, space->select.sel_info.hslab->diminfo.opt,
+                                      space->extent.rank * sizeof(H5S_hyper_dim_t)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append hyperslab to cache key")
+    } /* end if */
+    else {
+        hsize_t next_id = 0; /* Number of span tree nodes visited */
+
+        HDassert(space->select.sel_info.hslab->span_lst);
+
+        tag = H5S_MPIO_TYPE_KEY_SPANS;
+        if (H5S__mpio_type_key_append(key, &tag, sizeof(tag)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append hyperslab to cache key")
+        if (H5S__mpio_type_key_spans(key, space->select.sel_info.hslab->span_lst, &next_id,
+                                     H5S__hyper_get_op_gen()) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append span tree to cache key")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__mpio_type_key_build() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S__mpio_type_cache_lookup
+ *
+ * Purpose:	Look for the MPI datatype for a selection in the datatype
+ *		cache, making it the most recently used entry when found.
+ *
+ * Return:	TRUE/FALSE on success, negative on failure.
+ *
+ * Outputs:	*new_type	  a duplicate of the cached MPI type, which
+ *				  the caller must free
+ *		*count		  how many objects of the new_type in selection
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5S__mpio_type_cache_lookup(H5S_mpio_type_cache_t *cache, uint32_t hash, const H5S_mpio_type_key_t *key,
+                            MPI_Datatype *new_type, int *count)
+{
+    unsigned u;                 /* Local index variable */
+    int      mpi_code;          /* MPI return code */
+    htri_t   ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(cache);
+    HDassert(key);
+
+    for (u = 0; u < cache->nused; u++)
+        if (cache->ent[u].hash == hash && cache->ent[u].key_len == key->len &&
+            0 == HDmemcmp(cache->ent[u].key, key->buf, key->len)) {
+            H5S_mpio_type_cache_ent_t ent = cache->ent[u]; /* Copy of entry found */
+
+            /* Hand out a duplicate, so the caller frees its type as usual */
+            if (MPI_SUCCESS != (mpi_code = MPI_Type_dup(ent.type, new_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_dup failed", mpi_code)
+            *count = ent.count;
+
+            /* Move the entry to the front of the list */
+            HDmemmove(&cache->ent[1], &cache->ent[0], u * sizeof(H5S_mpio_type_cache_ent_t));
+            cache->ent[0] = ent;
+
+            HGOTO_DONE(TRUE)
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__mpio_type_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S__mpio_type_cache_insert
+ *
+ * Purpose:	Add the MPI datatype constructed for a selection to the
+ *		datatype cache, evicting the least recently used entry if
+ *		the cache is full.
+ *
+ *		The cache keeps its own duplicate of the type and takes
+ *		ownership of the key's buffer.
+ *
+ * Return:	Non-negative on success, negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__mpio_type_cache_insert(H5S_mpio_type_cache_t *cache, uint32_t hash, H5S_mpio_type_key_t *key,
+                            MPI_Datatype type, int count)
+{
+    MPI_Datatype cache_type;          /* Cache's copy of the type */
+    int          mpi_code;            /* MPI return code */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(cache);
+    HDassert(key);
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_dup(type, &cache_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_dup failed", mpi_code)
+
+    /* Evict the least recently used entry, if the cache is full */
+    if (cache->nused == H5S_MPIO_TYPE_CACHE_NSLOTS) {
+        H5S_mpio_type_cache_ent_t *ent = &cache->ent[H5S_MPIO_TYPE_CACHE_NSLOTS - 1];
+
+        ent->key = (uint8_t *)H5MM_xfree(ent->key);
+        cache->nused--;
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_free(&ent->type))) {
+            MPI_Type_free(&cache_type);
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        } /* end if */
+    }     /* end if */
+
+    /* Add the new entry to the front of the list */
+    HDmemmove(&cache->ent[1], &cache->ent[0], cache->nused * sizeof(H5S_mpio_type_cache_ent_t));
+    cache->ent[0].hash    = hash;
+    cache->ent[0].key_len = key->len;
+    cache->ent[0].key     = key->buf;
+    cache->ent[0].type    = cache_type;
+    cache->ent[0].count   = count;
+    cache->nused++;
+
+    /* The cache owns the key's buffer now */
+    key->buf   = NULL;
+    key->len   = 0;
+    key->alloc = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__mpio_type_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S_mpio_type_cache_create
+ *
+ * Purpose:	Create an empty cache of the MPI datatypes constructed for
+ *		hyperslab selections.
+ *
+ * Return:	Success:	Pointer to the new cache
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5S_mpio_type_cache_t *
+H5S_mpio_type_cache_create(void)
+{
+    H5S_mpio_type_cache_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    if (NULL == (ret_value = H5FL_CALLOC(H5S_mpio_type_cache_t)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate MPI datatype cache")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_mpio_type_cache_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5S_mpio_type_cache_destroy
+ *
+ * Purpose:	Release the MPI datatypes held in a datatype cache and the
+ *		cache itself.
+ *
+ * Return:	Non-negative on success, negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5S_mpio_type_cache_destroy(H5S_mpio_type_cache_t *cache)
+{
+    int      mpi_finalized = 0;   /* Whether MPI has been finalized */
+    unsigned u;                   /* Local index variable */
+    int      mpi_code;            /* MPI return code */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(cache);
+
+    /* MPI objects can't be released once MPI is shut down */
+    if (MPI_SUCCESS != (mpi_code = MPI_Finalized(&mpi_finalized)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Finalized failed", mpi_code)
+
+    for (u = 0; u < cache->nused; u++) {
+        if (!mpi_finalized)
+            if (MPI_SUCCESS != (mpi_code = MPI_Type_free(&cache->ent[u].type)))
+                HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+        H5MM_xfree(cache->ent[u].key);
+    } /* end for */
+    cache = H5FL_FREE(H5S_mpio_type_cache_t, cache);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_mpio_type_cache_destroy() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5S_mpio_space_type
  *
  * Purpose:	Translate an HDF5 dataspace selection into an MPI type.
  *		Currently handle only hyperslab and "all" selections.
  *
+ *		When TYPE_CACHE is not NULL, the MPI types for hyperslab
+ *		selections are kept in it and reused by later calls with
+ *		the same selection and element size.
+ *
  * Return:	Non-negative on success, negative on failure.
  *
  * Outputs:	*new_type	  the MPI type corresponding to the selection
@@ -1365,10 +1765,15 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5S_mpio_space_type(const H5S_t *space, size_t elmt_size, MPI_Datatype *new_type, int *count,
-                    hbool_t *is_derived_type, hbool_t do_permute, hsize_t **permute_map, hbool_t *is_permuted)
+H5S_mpio_space_type(const H5S_t *space, size_t elmt_size, H5S_mpio_type_cache_t *type_cache,
+                    MPI_Datatype *new_type, int *count, hbool_t *is_derived_type, hbool_t do_permute,
+                    hsize_t **permute_map, hbool_t *is_permuted)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5S_mpio_type_key_t key       = {NULL, 0, 0}; /* Key for the selection in the datatype cache */
+    uint32_t            key_hash  = 0;            /* Hash of the key */
+    unsigned            hits      = 0;            /* Whether the datatype cache held the type */
+    double              start_time;               /* Time construction started */
+    herr_t              ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
 
@@ -1376,6 +1781,29 @@ H5S_mpio_space_type(const H5S_t *space, size_t elmt_size, MPI_Datatype *new_type
     HDassert(space);
     HDassert(elmt_size);
 
+    start_time = H5_get_time();
+
+    /* Hyperslab selections which aren't permuted are looked up in the
+     * datatype cache, so repeated transfers with the same selection (e.g.
+     * writing each time step of a fixed decomposition) skip constructing,
+     * committing and freeing the MPI datatype.
+     */
+    if (type_cache && FALSE == *is_permuted && H5S_GET_EXTENT_TYPE(space) == H5S_SIMPLE &&
+        H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS) {
+        htri_t found; /* Whether the datatype was cached */
+
+        if (H5S__mpio_type_key_build(space, elmt_size, &key) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTENCODE, FAIL, "can't build datatype cache key")
+        key_hash = H5_checksum_lookup3(key.buf, key.len, 0);
+        if ((found = H5S__mpio_type_cache_lookup(type_cache, key_hash, &key, new_type, count)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't look up cached MPI datatype")
+        if (found) {
+            *is_derived_type = TRUE;
+            hits             = 1;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    }     /* end if */
+
     /* Create MPI type based on the kind of selection */
     switch (H5S_GET_EXTENT_TYPE(space)) {
         case H5S_NULL:
@@ -1462,7 +1890,17 @@ H5S_mpio_space_type(const H5S_t *space, size_t elmt_size, MPI_Datatype *new_type
             break;
     } /* end switch */
 
+    /* Remember the datatype for later transfers with the same selection */
+    if (key.buf && *is_derived_type)
+        if (H5S__mpio_type_cache_insert(type_cache, key_hash, &key, *new_type, *count) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't cache MPI datatype")
+
 done:
+    H5MM_xfree(key.buf);
+
+    /* Report the time spent and the datatype cache use to the application */
+    H5CX_add_mpio_type_stats(H5_get_time() - start_time, hits);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_mpio_space_type() */
 
@@ -36,6 +36,9 @@ typedef struct H5S_pnt_node_t        H5S_pnt_node_t;
 typedef struct H5S_pnt_list_t        H5S_pnt_list_t;
 typedef struct H5S_hyper_span_t      H5S_hyper_span_t;
 typedef struct H5S_hyper_span_info_t H5S_hyper_span_info_t;
+#ifdef H5_HAVE_PARALLEL
+typedef struct H5S_mpio_type_cache_t H5S_mpio_type_cache_t;
+#endif /* H5_HAVE_PARALLEL */
 
 /* Information about one dimension in a hyperslab selection */
 typedef struct H5S_hyper_dim_t {
@@ -302,9 +305,11 @@ H5_DLL herr_t H5S_select_iter_release(H5S_sel_iter_t *sel_iter);
 H5_DLL herr_t H5S_sel_iter_close(H5S_sel_iter_t *sel_iter);
 
 #ifdef H5_HAVE_PARALLEL
-H5_DLL herr_t H5S_mpio_space_type(const H5S_t *space, size_t elmt_size,
+H5_DLL herr_t H5S_mpio_space_type(const H5S_t *space, size_t elmt_size, H5S_mpio_type_cache_t *type_cache,
                                   /* out: */ MPI_Datatype *new_type, int *count, hbool_t *is_derived_type,
                                   hbool_t do_permute, hsize_t **permute_map, hbool_t *is_permuted);
+H5_DLL H5S_mpio_type_cache_t *H5S_mpio_type_cache_create(void);
+H5_DLL herr_t                 H5S_mpio_type_cache_destroy(H5S_mpio_type_cache_t *cache);
 #endif /* H5_HAVE_PARALLEL */
 
 #endif /* H5Sprivate_H */
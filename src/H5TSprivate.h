@@ -38,11 +38,12 @@ typedef struct H5TS_mutex_struct {
 } H5TS_mutex_t;
 
 /* Portability wrappers around Windows Threads types */
-typedef CRITICAL_SECTION H5TS_mutex_simple_t;
-typedef HANDLE           H5TS_thread_t;
-typedef HANDLE           H5TS_attr_t;
-typedef DWORD            H5TS_key_t;
-typedef INIT_ONCE        H5TS_once_t;
+typedef CRITICAL_SECTION   H5TS_mutex_simple_t;
+typedef HANDLE             H5TS_thread_t;
+typedef HANDLE             H5TS_attr_t;
+typedef DWORD              H5TS_key_t;
+typedef INIT_ONCE          H5TS_once_t;
+typedef CONDITION_VARIABLE H5TS_cond_t;
 
 /* Defines */
 /* not used on windows side, but need to be defined to something */
@@ -57,9 +58,17 @@ typedef INIT_ONCE        H5TS_once_t;
 #define H5TS_attr_setscope(attr_ptr, scope)     0
 #define H5TS_attr_destroy(attr_ptr)             0
 #define H5TS_wait_for_thread(thread)            WaitForSingleObject(thread, INFINITE)
-#define H5TS_mutex_init(mutex)                  InitializeCriticalSection(mutex)
+#define H5TS_mutex_init(mutex)                  (InitializeCriticalSection(mutex), 0)
+#define H5TS_mutex_destroy(mutex)               DeleteCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex)           EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex)         LeaveCriticalSection(mutex)
+#define H5TS_cond_init(cond)                    (InitializeConditionVariable(cond), 0)
+#define H5TS_cond_destroy(cond)                 ((void)(cond))
+#define H5TS_cond_wait(cond, mutex)             SleepConditionVariableCS(cond, mutex, INFINITE)
+#define H5TS_cond_signal(cond)                  WakeConditionVariable(cond)
+#define H5TS_cond_broadcast(cond)               WakeAllConditionVariable(cond)
+#define H5TS_thread_create(thread, func, udata)                                                              \
+    (NULL == (*(thread) = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)(func), (udata), 0, NULL)))
 
 /* Functions called from DllMain */
 H5_DLL BOOL CALLBACK H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex);
@@ -90,6 +99,7 @@ typedef pthread_attr_t  H5TS_attr_t;
 typedef pthread_mutex_t H5TS_mutex_simple_t;
 typedef pthread_key_t   H5TS_key_t;
 typedef pthread_once_t  H5TS_once_t;
+typedef pthread_cond_t  H5TS_cond_t;
 
 /* Scope Definitions */
 #define H5TS_SCOPE_SYSTEM                       PTHREAD_SCOPE_SYSTEM
@@ -104,8 +114,15 @@ typedef pthread_once_t  H5TS_once_t;
 #define H5TS_attr_destroy(attr_ptr)             pthread_attr_destroy(attr_ptr)
 #define H5TS_wait_for_thread(thread)            pthread_join(thread, NULL)
 #define H5TS_mutex_init(mutex)                  pthread_mutex_init(mutex, NULL)
+#define H5TS_mutex_destroy(mutex)               pthread_mutex_destroy(mutex)
 #define H5TS_mutex_lock_simple(mutex)           pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex)         pthread_mutex_unlock(mutex)
+#define H5TS_cond_init(cond)                    pthread_cond_init(cond, NULL)
+#define H5TS_cond_destroy(cond)                 pthread_cond_destroy(cond)
+#define H5TS_cond_wait(cond, mutex)             pthread_cond_wait(cond, mutex)
+#define H5TS_cond_signal(cond)                  pthread_cond_signal(cond)
+#define H5TS_cond_broadcast(cond)               pthread_cond_broadcast(cond)
+#define H5TS_thread_create(thread, func, udata) pthread_create(thread, NULL, func, udata)
 
 /* Pthread-only routines */
 H5_DLL uint64_t H5TS_thread_id(void);
@@ -573,6 +573,26 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI: { /* H5Dwrite_chunks */
+            size_t          count      = HDva_arg(arguments, size_t);
+            const uint32_t *filters    = HDva_arg(arguments, const uint32_t *);
+            const hsize_t **offsets    = HDva_arg(arguments, const hsize_t **);
+            const size_t *  data_sizes = HDva_arg(arguments, const size_t *);
+            const void **   bufs       = HDva_arg(arguments, const void **);
+
+            /* Check arguments */
+            if (NULL == dset->oloc.file)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            /* Write chunks */
+            if (H5D__chunk_direct_write_multi(dset, count, filters, offsets, data_sizes, bufs) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+            break;
+        }
+
         case H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE: { /* H5Dvlen_get_buf_size */
             hid_t    type_id  = HDva_arg(arguments, hid_t);
             hid_t    space_id = HDva_arg(arguments, hid_t);
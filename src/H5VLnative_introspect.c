@@ -95,6 +95,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     break;
 
                 case H5VL_NATIVE_DATASET_CHUNK_WRITE:
+                case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI:
                     *flags |= H5VL_OPT_QUERY_WRITE_DATA;
                     break;
 
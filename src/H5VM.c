@@ -36,12 +36,115 @@ static void H5VM__stride_optimize1(unsigned *np /*in,out*/, hsize_t *elmt_size /
                                    const hsize_t *size, hsize_t *stride1);
 static void H5VM__stride_optimize2(unsigned *np /*in,out*/, hsize_t *elmt_size /*in,out*/,
                                    const hsize_t *size, hsize_t *stride1, hsize_t *stride2);
+static H5_INLINE void H5VM__memcpy_seq(unsigned char *dst, const unsigned char *src, size_t len);
+static void H5VM__stride_copy_run(uint8_t *dst, hssize_t dst_stride, const uint8_t *src, hssize_t src_stride,
+                                  size_t elmt_size, hsize_t count);
 #ifdef LATER
 static void H5VM__stride_copy2(hsize_t nelmts, hsize_t elmt_size, unsigned dst_n, const hsize_t *dst_size,
                                const ssize_t *dst_stride, void *_dst, unsigned src_n, const hsize_t *src_size,
                                const ssize_t *src_stride, const void *_src);
 #endif /* LATER */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5VM__memcpy_seq
+ *
+ * Purpose:	Copies one sequence of LEN bytes from SRC to DST.  Sequences
+ *		the size of common datatypes are copied with fixed-size
+ *		copies that the compiler expands inline, which matters when
+ *		the sequences are single elements (e.g. a column of a 2-D
+ *		array or one field of a compound).
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE void
+H5VM__memcpy_seq(unsigned char *dst, const unsigned char *src, size_t len)
+{
+    switch (len) {
+        case 1:
+            *dst = *src;
+            break;
+
+        case 2:
+            HDmemcpy(dst, src, 2);
+            break;
+
+        case 4:
+            HDmemcpy(dst, src, 4);
+            break;
+
+        case 8:
+            HDmemcpy(dst, src, 8);
+            break;
+
+        case 16:
+            HDmemcpy(dst, src, 16);
+            break;
+
+        default:
+            H5MM_memcpy(dst, src, len);
+            break;
+    } /* end switch */
+} /* end H5VM__memcpy_seq() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5VM__stride_copy_run
+ *
+ * Purpose:	Copies COUNT elements of ELMT_SIZE bytes from SRC to DST,
+ *		advancing SRC by SRC_STRIDE and DST by DST_STRIDE bytes
+ *		after each element.  This is the innermost dimension of the
+ *		stride copy routines; the element size is dispatched once
+ *		for the whole run so that common sizes get a tight loop of
+ *		fixed-size copies.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5VM__stride_copy_run(uint8_t *dst, hssize_t dst_stride, const uint8_t *src, hssize_t src_stride,
+                      size_t elmt_size, hsize_t count)
+{
+    hsize_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (elmt_size) {
+        case 1:
+            for (u = 0; u < count; u++, dst += dst_stride, src += src_stride)
+                *dst = *src;
+            break;
+
+        case 2:
+            for (u = 0; u < count; u++, dst += dst_stride, src += src_stride)
+                HDmemcpy(dst, src, 2);
+            break;
+
+        case 4:
+            for (u = 0; u < count; u++, dst += dst_stride, src += src_stride)
+                HDmemcpy(dst, src, 4);
+            break;
+
+        case 8:
+            for (u = 0; u < count; u++, dst += dst_stride, src += src_stride)
+                HDmemcpy(dst, src, 8);
+            break;
+
+        case 16:
+            for (u = 0; u < count; u++, dst += dst_stride, src += src_stride)
+                HDmemcpy(dst, src, 16);
+            break;
+
+        default:
+            for (u = 0; u < count; u++, dst += dst_stride, src += src_stride)
+                H5MM_memcpy(dst, src, elmt_size); /*lint !e671 The elmt_size will be OK */
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5VM__stride_copy_run() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5VM__stride_optimize1
  *
@@ -678,14 +781,17 @@ H5VM_stride_copy(unsigned n, hsize_t elmt_size, const hsize_t *size, const hsize
     if (n) {
         H5VM_vector_cpy(n, idx, size);
         nelmts = H5VM_vector_reduce_product(n, size);
-        for (i = 0; i < nelmts; i++) {
+        H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
+        for (i = 0; i < nelmts; i += size[n - 1]) {
 
-            /* Copy an element */
-            H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
-            H5MM_memcpy(dst, src, (size_t)elmt_size); /*lint !e671 The elmt_size will be OK */
+            /* Copy a run of elements along the fastest changing dimension */
+            H5VM__stride_copy_run(dst, (hssize_t)dst_stride[n - 1], src, (hssize_t)src_stride[n - 1],
+                                  (size_t)elmt_size, size[n - 1]);
+            src += size[n - 1] * src_stride[n - 1];
+            dst += size[n - 1] * dst_stride[n - 1];
 
-            /* Decrement indices and advance pointers */
-            for (j = (int)(n - 1), carry = TRUE; j >= 0 && carry; --j) {
+            /* Decrement indices of the slower dimensions and advance pointers */
+            for (j = (int)(n - 2), carry = TRUE; j >= 0 && carry; --j) {
                 src += src_stride[j];
                 dst += dst_stride[j];
 
@@ -744,14 +850,17 @@ H5VM_stride_copy_s(unsigned n, hsize_t elmt_size, const hsize_t *size, const hss
     if (n) {
         H5VM_vector_cpy(n, idx, size);
         nelmts = H5VM_vector_reduce_product(n, size);
-        for (i = 0; i < nelmts; i++) {
+        H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
+        for (i = 0; i < nelmts; i += size[n - 1]) {
 
-            /* Copy an element */
-            H5_CHECK_OVERFLOW(elmt_size, hsize_t, size_t);
-            H5MM_memcpy(dst, src, (size_t)elmt_size); /*lint !e671 The elmt_size will be OK */
+            /* Copy a run of elements along the fastest changing dimension */
+            H5VM__stride_copy_run(dst, dst_stride[n - 1], src, src_stride[n - 1], (size_t)elmt_size,
+                                  size[n - 1]);
+            src += (hssize_t)size[n - 1] * src_stride[n - 1];
+            dst += (hssize_t)size[n - 1] * dst_stride[n - 1];
 
-            /* Decrement indices and advance pointers */
-            for (j = (int)(n - 1), carry = TRUE; j >= 0 && carry; --j) {
+            /* Decrement indices of the slower dimensions and advance pointers */
+            for (j = (int)(n - 2), carry = TRUE; j >= 0 && carry; --j) {
                 src += src_stride[j];
                 dst += dst_stride[j];
 
@@ -1536,7 +1645,7 @@ src_smaller:
         acc_len = 0;
         do {
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_src_len);
+            H5VM__memcpy_seq(dst, src, tmp_src_len);
 
             /* Accumulate number of bytes copied */
             acc_len += tmp_src_len;
@@ -1579,7 +1688,7 @@ dst_smaller:
         acc_len = 0;
         do {
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
+            H5VM__memcpy_seq(dst, src, tmp_dst_len);
 
             /* Accumulate number of bytes copied */
             acc_len += tmp_dst_len;
@@ -1622,7 +1731,7 @@ equal:
         acc_len = 0;
         do {
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
+            H5VM__memcpy_seq(dst, src, tmp_dst_len);
 
             /* Accumulate number of bytes copied */
             acc_len += tmp_dst_len;
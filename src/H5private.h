@@ -954,6 +954,9 @@ H5_DLL H5_ATTR_CONST int Nflock(int fd, int operation);
 #ifndef HDfstat
 #define HDfstat(F, B) fstat(F, B)
 #endif /* HDfstat */
+#ifndef HDfsync
+#define HDfsync(F) fsync(F)
+#endif /* HDfsync */
 #ifndef HDlstat
 #define HDlstat(S, B) lstat(S, B)
 #endif /* HDlstat */
@@ -1203,9 +1206,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmktime
 #define HDmktime(T) mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+#define HDmmap(A, L, P, F, D, O) mmap(A, L, P, F, D, O)
+#endif /* HDmmap */
 #ifndef HDmodf
 #define HDmodf(X, Y) modf(X, Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+#define HDmunmap(A, L) munmap(A, L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
 #define HDnanosleep(N, O) nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1239,6 +1248,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpowf
 #define HDpowf(X, Y) powf(X, Y)
 #endif /* HDpowf */
+#ifndef HDposix_madvise
+#define HDposix_madvise(A, L, V) posix_madvise(A, L, V)
+#endif /* HDposix_madvise */
 #ifndef HDpread
 #define HDpread(F, B, C, O) pread(F, B, C, O)
 #endif /* HDpread */
@@ -3484,6 +3484,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
 
+                                case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -85,6 +85,7 @@ typedef __int64         h5_stat_size_t;
 #define HDfdopen(N, S) _fdopen(N, S)
 #define HDfileno(F)    _fileno(F)
 #define HDfstat(F, B)  _fstati64(F, B)
+#define HDfsync(F)     _commit(F)
 #define HDisatty(F)    _isatty(F)
 
 #define HDgetcwd(S, Z)     _getcwd(S, Z)
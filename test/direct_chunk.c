@@ -58,6 +58,16 @@
 #define OVERWRITE_CHUNK_NY  2
 #define OVERWRITE_VALUE     42
 
+/* Constants for the batched direct write test */
+#define MULTI_FILE     "direct_chunk_multi.h5"
+#define MULTI_DSET1    "multi_fixed"
+#define MULTI_DSET2    "multi_shuffle_extendible"
+#define MULTI_NX       48
+#define MULTI_NY       64
+#define MULTI_CHUNK_NX 1
+#define MULTI_CHUNK_NY 2
+#define MULTI_NCHUNKS  ((MULTI_NX / MULTI_CHUNK_NX) * (MULTI_NY / MULTI_CHUNK_NY))
+
 /* Test configurations */
 #define CONFIG_LATEST       0x01
 #define CONFIG_REOPEN_FILE  0x02
@@ -477,6 +487,215 @@ error:
     return 1;
 } /* end test_direct_chunk_overwrite_data() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_chunk_write_multi
+ *
+ * Purpose:     Test writing a batch of chunks with H5Dwrite_chunks, into
+ *              a dataset with fixed dimensions and into an extendible one
+ *              whose chunks skip their (shuffle) filter.  There are enough
+ *              chunks for a fixed array index to be paged.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunk_write_multi(hbool_t latest)
+{
+    hid_t           fid         = H5I_INVALID_HID; /* File ID */
+    hid_t           fapl        = H5I_INVALID_HID; /* File access property list ID */
+    hid_t           sid         = H5I_INVALID_HID; /* Dataspace ID */
+    hid_t           did         = H5I_INVALID_HID; /* Dataset ID */
+    hid_t           dcpl        = H5I_INVALID_HID; /* Dataset creation property list */
+    hsize_t         dims[2]     = {MULTI_NX, MULTI_NY};
+    hsize_t         max_dims[2] = {H5S_UNLIMITED, MULTI_NY};
+    hsize_t         chunk[2]    = {MULTI_CHUNK_NX, MULTI_CHUNK_NY};
+    int *           wdata       = NULL; /* Write buffer */
+    int *           rdata       = NULL; /* Read buffer */
+    hsize_t *       offset_buf  = NULL; /* Chunk offsets */
+    const hsize_t **offsets     = NULL; /* Pointers to chunk offsets */
+    const void **   bufs        = NULL; /* Pointers to chunk data */
+    uint32_t *      filters     = NULL; /* Chunk filter masks */
+    size_t *        sizes       = NULL; /* Chunk sizes */
+    size_t          chunk_size  = MULTI_CHUNK_NX * MULTI_CHUNK_NY * sizeof(int);
+    herr_t          status;
+    unsigned        d;
+    size_t          u;
+
+    if (latest) {
+        TESTING("batched H5Dwrite_chunks (latest format)");
+    }
+    else {
+        TESTING("batched H5Dwrite_chunks");
+    }
+
+    /* Allocate buffers */
+    if (NULL == (wdata = (int *)HDmalloc(MULTI_NX * MULTI_NY * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rdata = (int *)HDmalloc(MULTI_NX * MULTI_NY * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (offset_buf = (hsize_t *)HDmalloc(MULTI_NCHUNKS * 2 * sizeof(hsize_t))))
+        TEST_ERROR
+    if (NULL == (offsets = (const hsize_t **)HDmalloc(MULTI_NCHUNKS * sizeof(hsize_t *))))
+        TEST_ERROR
+    if (NULL == (bufs = (const void **)HDmalloc(MULTI_NCHUNKS * sizeof(void *))))
+        TEST_ERROR
+    if (NULL == (filters = (uint32_t *)HDmalloc(MULTI_NCHUNKS * sizeof(uint32_t))))
+        TEST_ERROR
+    if (NULL == (sizes = (size_t *)HDmalloc(MULTI_NCHUNKS * sizeof(size_t))))
+        TEST_ERROR
+
+    /* Initialize data.  Since each chunk is one row segment, the data for a
+     * chunk is contiguous in the write buffer.
+     */
+    for (u = 0; u < MULTI_NX * MULTI_NY; u++)
+        wdata[u] = (int)u;
+
+    /* Set up the chunks, in reverse order */
+    for (u = 0; u < MULTI_NCHUNKS; u++) {
+        size_t chunk_idx = MULTI_NCHUNKS - 1 - u;
+
+        offset_buf[2 * u]     = (hsize_t)(chunk_idx / (MULTI_NY / MULTI_CHUNK_NY)) * MULTI_CHUNK_NX;
+        offset_buf[2 * u + 1] = (hsize_t)(chunk_idx % (MULTI_NY / MULTI_CHUNK_NY)) * MULTI_CHUNK_NY;
+        offsets[u]            = &offset_buf[2 * u];
+        bufs[u]               = &wdata[offset_buf[2 * u] * MULTI_NY + offset_buf[2 * u + 1]];
+        sizes[u]              = chunk_size;
+    } /* end for */
+
+    /* Create a new file */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (latest)
+        if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+            FAIL_STACK_ERROR
+    if ((fid = H5Fcreate(MULTI_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    for (d = 0; d < 2; d++) {
+        hbool_t filtered = (hbool_t)(d == 1);
+
+        /* Create the dataset */
+        if ((sid = H5Screate_simple(2, dims, filtered ? max_dims : NULL)) < 0)
+            FAIL_STACK_ERROR
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+            FAIL_STACK_ERROR
+        if (filtered && H5Pset_shuffle(dcpl) < 0)
+            FAIL_STACK_ERROR
+        if ((did = H5Dcreate2(fid, filtered ? MULTI_DSET2 : MULTI_DSET1, H5T_NATIVE_INT, sid, H5P_DEFAULT,
+                              dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Skip the shuffle filter for the filtered dataset's chunks */
+        for (u = 0; u < MULTI_NCHUNKS; u++)
+            filters[u] = filtered ? 0x1 : 0;
+
+        /* Write all the chunks at once */
+        if (H5Dwrite_chunks(did, H5P_DEFAULT, MULTI_NCHUNKS, filters, offsets, sizes, bufs) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the data back and check it */
+        HDmemset(rdata, 0, MULTI_NX * MULTI_NY * sizeof(int));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < MULTI_NX * MULTI_NY; u++)
+            if (rdata[u] != wdata[u]) {
+                HDprintf("    dataset %u: rdata[%zu] = %d, expected %d\n", d, u, rdata[u], wdata[u]);
+                TEST_ERROR
+            } /* end if */
+
+        /* Overwrite the first two chunks with the last two chunks' data */
+        bufs[MULTI_NCHUNKS - 1] = &wdata[(MULTI_NX * MULTI_NY) - (2 * chunk_size / sizeof(int))];
+        bufs[MULTI_NCHUNKS - 2] = &wdata[(MULTI_NX * MULTI_NY) - (chunk_size / sizeof(int))];
+        if (H5Dwrite_chunks(did, H5P_DEFAULT, 2, filters, &offsets[MULTI_NCHUNKS - 2],
+                            &sizes[MULTI_NCHUNKS - 2], &bufs[MULTI_NCHUNKS - 2]) < 0)
+            FAIL_STACK_ERROR
+        bufs[MULTI_NCHUNKS - 1] = &wdata[0];
+        bufs[MULTI_NCHUNKS - 2] = &wdata[chunk_size / sizeof(int)];
+
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+            FAIL_STACK_ERROR
+        if (rdata[0] != wdata[(MULTI_NX * MULTI_NY) - 4] || rdata[1] != wdata[(MULTI_NX * MULTI_NY) - 3] ||
+            rdata[2] != wdata[(MULTI_NX * MULTI_NY) - 2] || rdata[3] != wdata[(MULTI_NX * MULTI_NY) - 1])
+            TEST_ERROR
+        for (u = 4; u < MULTI_NX * MULTI_NY; u++)
+            if (rdata[u] != wdata[u])
+                TEST_ERROR
+
+        /* A chunk may only be written once in a batch */
+        H5E_BEGIN_TRY
+        {
+            const hsize_t *dup_offsets[2] = {offsets[0], offsets[0]};
+
+            status = H5Dwrite_chunks(did, H5P_DEFAULT, 2, filters, dup_offsets, sizes, bufs);
+        }
+        H5E_END_TRY;
+        if (status >= 0)
+            TEST_ERROR
+
+        /* Chunks must be inside the dataset */
+        H5E_BEGIN_TRY
+        {
+            hsize_t        bad_offset[2]  = {MULTI_NX, 0};
+            const hsize_t *bad_offsets[1] = {bad_offset};
+
+            status = H5Dwrite_chunks(did, H5P_DEFAULT, 1, filters, bad_offsets, sizes, bufs);
+        }
+        H5E_END_TRY;
+        if (status >= 0)
+            TEST_ERROR
+
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR
+
+    HDremove(MULTI_FILE);
+
+    HDfree(wdata);
+    HDfree(rdata);
+    HDfree(offset_buf);
+    HDfree(offsets);
+    HDfree(bufs);
+    HDfree(filters);
+    HDfree(sizes);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+
+    HDfree(wdata);
+    HDfree(rdata);
+    HDfree(offset_buf);
+    HDfree(offsets);
+    HDfree(bufs);
+    HDfree(filters);
+    HDfree(sizes);
+
+    H5_FAILED();
+    return 1;
+} /* end test_direct_chunk_write_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_skip_compress_write1
  *
@@ -2267,6 +2486,8 @@ main(void)
     nerrors += test_skip_compress_write2(file_id);
     nerrors += test_data_conv(file_id);
     nerrors += test_invalid_parameters(file_id);
+    nerrors += test_direct_chunk_write_multi(FALSE);
+    nerrors += test_direct_chunk_write_multi(TRUE);
 
     /* Test direct chunk read */
 #ifdef H5_HAVE_FILTER_DEFLATE
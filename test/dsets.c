@@ -83,6 +83,9 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "zero_copy",           /* 27 */
+                          "sieve_windows",       /* 28 */
+                          "tconv_buf_size",      /* 29 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -14565,6 +14568,501 @@ error:
     return FAIL;
 } /* end test_compact_open_close_dirty() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_zero_copy_io
+ *
+ * Purpose:     Verify that I/O on contiguous selections without datatype
+ *              conversion is transferred directly between the application
+ *              buffer and the dataset's storage, for contiguous, compact and
+ *              unfiltered chunked datasets, and that I/O which requires
+ *              datatype conversion is not.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_zero_copy_io(hid_t fapl)
+{
+    hid_t        fid        = -1;                                         /* File ID */
+    hid_t        did        = -1;                                         /* Dataset ID */
+    hid_t        sid        = -1;                                         /* Dataspace ID */
+    hid_t        msid       = -1;                                         /* Memory dataspace ID */
+    hid_t        ssid       = -1;                                         /* Scalar memory dataspace ID */
+    hid_t        dcpl       = -1;                                         /* Dataset creation property list */
+    hsize_t      dims[1]    = {100};                                      /* Dimension */
+    hsize_t      chunk[1]   = {100};                                      /* Chunk dimension */
+    hsize_t      start[1]   = {10};                                       /* Hyperslab start */
+    hsize_t      count[1]   = {50};                                       /* Hyperslab count */
+    H5D_layout_t layouts[3] = {H5D_CONTIGUOUS, H5D_COMPACT, H5D_CHUNKED}; /* Layouts to test */
+    int          wbuf[100];                                               /* Write buffer */
+    int          rbuf[100];                                               /* Read buffer */
+    long long    lbuf[100];                                               /* Read buffer for converted data */
+    int          elmt;                                                    /* Read buffer for one element */
+    char         filename[FILENAME_BUF_SIZE];                             /* Filename */
+    char         dset_name[32];                                           /* Dataset name */
+    unsigned     nzero_copy, prev_nzero_copy;                             /* Zero-copy I/O counts */
+    unsigned     u;                                                       /* Local index variable */
+    int          i;                                                       /* Local index variable */
+
+    TESTING("zero-copy I/O for contiguous selections");
+
+    /* Create a file */
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+
+    /* Initialize data */
+    for (i = 0; i < 100; i++)
+        wbuf[i] = i;
+
+    /* Create dataspaces */
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((msid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+    if ((ssid = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
+
+    for (u = 0; u < 3; u++) {
+        /* Set up the layout */
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR
+        if (H5Pset_layout(dcpl, layouts[u]) < 0)
+            TEST_ERROR
+        if (layouts[u] == H5D_CHUNKED && H5Pset_chunk(dcpl, 1, chunk) < 0)
+            TEST_ERROR
+
+        /* Create the dataset */
+        HDsnprintf(dset_name, sizeof(dset_name), "zero_copy_%u", u);
+        if ((did = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+
+        /* Write the whole dataset, which should be a single direct transfer */
+        if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+        if (H5D__zero_copy_io_count_test(did, &nzero_copy) < 0)
+            TEST_ERROR
+        if (nzero_copy != 1)
+            TEST_ERROR
+
+        /* Read a contiguous hyperslab into a contiguous memory buffer */
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        if (H5D__zero_copy_io_count_test(did, &nzero_copy) < 0)
+            TEST_ERROR
+        if (nzero_copy != 2)
+            TEST_ERROR
+        for (i = 0; i < (int)count[0]; i++)
+            if (rbuf[i] != wbuf[i + (int)start[0]])
+                TEST_ERROR
+
+        /* Read a single element, which isn't counted as a direct transfer */
+        prev_nzero_copy = nzero_copy;
+        if (H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)1, start) < 0)
+            TEST_ERROR
+        if (H5Dread(did, H5T_NATIVE_INT, ssid, sid, H5P_DEFAULT, &elmt) < 0)
+            TEST_ERROR
+        if (H5D__zero_copy_io_count_test(did, &nzero_copy) < 0)
+            TEST_ERROR
+        if (nzero_copy != prev_nzero_copy)
+            TEST_ERROR
+        if (elmt != wbuf[start[0]])
+            TEST_ERROR
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+
+        /* Read with datatype conversion, which must not take the direct path */
+        if (H5Dread(did, H5T_NATIVE_LLONG, msid, sid, H5P_DEFAULT, lbuf) < 0)
+            TEST_ERROR
+        if (H5D__zero_copy_io_count_test(did, &nzero_copy) < 0)
+            TEST_ERROR
+        if (nzero_copy != prev_nzero_copy)
+            TEST_ERROR
+        for (i = 0; i < (int)count[0]; i++)
+            if (lbuf[i] != (long long)wbuf[i + (int)start[0]])
+                TEST_ERROR
+
+        if (H5Sselect_all(sid) < 0)
+            TEST_ERROR
+        if (H5Dclose(did) < 0)
+            TEST_ERROR
+        if (H5Pclose(dcpl) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Close the dataspaces */
+    if (H5Sclose(ssid) < 0)
+        TEST_ERROR
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+
+    /* Close the file */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(ssid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Dclose(did);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_zero_copy_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_tconv_buf_size
+ *
+ * Purpose:     Verify that the datatype conversion buffer is sized from
+ *              the number of selected elements without going above the
+ *              default buffer size, and that a maximum size set with
+ *              H5Pset_buffer() is honored.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_tconv_buf_size(hid_t fapl)
+{
+    hid_t      fid      = -1;                                      /* File ID */
+    hid_t      did      = -1;                                      /* Dataset ID */
+    hid_t      sid      = -1;                                      /* Dataspace ID */
+    hid_t      msid     = -1;                                      /* Memory dataspace ID */
+    hid_t      dxpl     = -1;                                      /* Dataset transfer property list */
+    hsize_t    dims[1]  = {(2 * H5D_TEMP_BUF_SIZE) / sizeof(int)}; /* Dimension */
+    hsize_t    start[1] = {100};                                   /* Hyperslab start */
+    hsize_t    count[1] = {10};                                    /* Hyperslab count */
+    int *      ibuf     = NULL;                                    /* Buffer for unconverted data */
+    long long *lbuf     = NULL;                                    /* Buffer for converted data */
+    char       filename[FILENAME_BUF_SIZE];                        /* Filename */
+    size_t     buf_size;                                           /* Type conversion buffer size */
+    size_t     u;                                                  /* Local index variable */
+
+    TESTING("type conversion buffer sized from the selection");
+
+    /* Allocate buffers */
+    if (NULL == (ibuf = (int *)HDmalloc((size_t)dims[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (lbuf = (long long *)HDmalloc((size_t)dims[0] * sizeof(long long))))
+        TEST_ERROR
+
+    /* Create a file */
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+
+    /* Create the dataset */
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write the whole dataset with conversion: with the default settings the
+     * buffer is capped at the default buffer size.
+     */
+    for (u = 0; u < (size_t)dims[0]; u++)
+        lbuf[u] = (long long)u;
+    if (H5Dwrite(did, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, lbuf) < 0)
+        TEST_ERROR
+    if (H5D__tconv_buf_size_test(did, &buf_size) < 0)
+        TEST_ERROR
+    if (buf_size != H5D_TEMP_BUF_SIZE)
+        TEST_ERROR
+
+    /* Verify the data without conversion */
+    HDmemset(ibuf, 0, (size_t)dims[0] * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, ibuf) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (ibuf[u] != (int)u)
+            TEST_ERROR
+
+    /* Read a small selection with conversion: the buffer should be sized
+     * from the selection, rounded up to a power of two.
+     */
+    if ((msid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    HDmemset(lbuf, 0, (size_t)count[0] * sizeof(long long));
+    if (H5Dread(did, H5T_NATIVE_LLONG, msid, sid, H5P_DEFAULT, lbuf) < 0)
+        TEST_ERROR
+    if (H5D__tconv_buf_size_test(did, &buf_size) < 0)
+        TEST_ERROR
+    if (buf_size != H5VM_power2up((hsize_t)count[0] * sizeof(long long)))
+        TEST_ERROR
+    for (u = 0; u < (size_t)count[0]; u++)
+        if (lbuf[u] != (long long)(u + start[0]))
+            TEST_ERROR
+
+    /* Raise the maximum buffer size: the whole dataset is now converted at
+     * once, while small selections still get a buffer sized from the
+     * selection.
+     */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pset_buffer(dxpl, (size_t)H5D_TEMP_BUF_MAX_SIZE, NULL, NULL) < 0)
+        TEST_ERROR
+    HDmemset(lbuf, 0, (size_t)dims[0] * sizeof(long long));
+    if (H5Dread(did, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, dxpl, lbuf) < 0)
+        TEST_ERROR
+    if (H5D__tconv_buf_size_test(did, &buf_size) < 0)
+        TEST_ERROR
+    if (buf_size != (size_t)dims[0] * sizeof(long long) || buf_size <= H5D_TEMP_BUF_SIZE)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (lbuf[u] != (long long)u)
+            TEST_ERROR
+    HDmemset(lbuf, 0, (size_t)count[0] * sizeof(long long));
+    if (H5Dread(did, H5T_NATIVE_LLONG, msid, sid, dxpl, lbuf) < 0)
+        TEST_ERROR
+    if (H5D__tconv_buf_size_test(did, &buf_size) < 0)
+        TEST_ERROR
+    if (buf_size != H5VM_power2up((hsize_t)count[0] * sizeof(long long)))
+        TEST_ERROR
+    for (u = 0; u < (size_t)count[0]; u++)
+        if (lbuf[u] != (long long)(u + start[0]))
+            TEST_ERROR
+
+    /* Read the whole dataset with a small maximum buffer size, which
+     * converts the data in many strips.
+     */
+    if (H5Pset_buffer(dxpl, (size_t)4096, NULL, NULL) < 0)
+        TEST_ERROR
+    HDmemset(lbuf, 0, (size_t)dims[0] * sizeof(long long));
+    if (H5Dread(did, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, dxpl, lbuf) < 0)
+        TEST_ERROR
+    if (H5D__tconv_buf_size_test(did, &buf_size) < 0)
+        TEST_ERROR
+    if (buf_size != 4096)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (lbuf[u] != (long long)u)
+            TEST_ERROR
+
+    /* Close everything */
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+
+    HDfree(lbuf);
+    HDfree(ibuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(lbuf);
+    HDfree(ibuf);
+    return FAIL;
+} /* end test_tconv_buf_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sieve_windows
+ *
+ * Purpose:     Tests interleaved small I/O operations on several regions
+ *              of a contiguous dataset, which are cached in separate
+ *              data sieve buffer windows.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SIEVE_WIN_DIM      4096
+#define SIEVE_WIN_NSTEPS   512
+#define SIEVE_WIN_BUF_SIZE 256
+static herr_t
+test_sieve_windows(hid_t fapl)
+{
+    hid_t   fid       = -1;                 /* File ID */
+    hid_t   did       = -1;                 /* Dataset ID */
+    hid_t   sid       = -1;                 /* Dataspace ID */
+    hid_t   msid      = -1;                 /* Memory dataspace ID */
+    hid_t   my_fapl   = -1;                 /* File access property list */
+    hsize_t dims[1]   = {SIEVE_WIN_DIM};    /* Dimension */
+    hsize_t one[1]    = {1};                /* Single element */
+    hsize_t start[1];                       /* Hyperslab start */
+    hsize_t count[1];                       /* Hyperslab count */
+    hsize_t offs[3];                        /* Offsets of the interleaved streams */
+    int *   expect = NULL;                  /* Expected dataset contents */
+    int *   rbuf   = NULL;                  /* Read buffer */
+    int     val;                            /* Single element value */
+    char    filename[FILENAME_BUF_SIZE];    /* Filename */
+    int     i, j;                           /* Local index variables */
+
+    TESTING("interleaved I/O with multiple sieve buffer windows");
+
+    if (NULL == (expect = (int *)HDmalloc(sizeof(int) * SIEVE_WIN_DIM)))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(sizeof(int) * SIEVE_WIN_DIM)))
+        TEST_ERROR
+
+    /* Use a small sieve buffer, so each stream needs several windows */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+    if (H5Pset_sieve_buf_size(my_fapl, (size_t)SIEVE_WIN_BUF_SIZE) < 0)
+        TEST_ERROR
+
+    /* Create a file and a contiguous dataset */
+    h5_fixname(FILENAME[28], my_fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        TEST_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((msid = H5Screate_simple(1, one, NULL)) < 0)
+        TEST_ERROR
+    if ((did = H5Dcreate2(fid, "sieve_windows", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT,
+                          H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write the whole dataset (larger than the sieve buffer) */
+    for (i = 0; i < SIEVE_WIN_DIM; i++)
+        expect[i] = i;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, expect) < 0)
+        TEST_ERROR
+
+    /* Interleave single element writes to three streams: two walking
+     * forward from different places and one walking backward from the end
+     */
+    for (i = 0; i < SIEVE_WIN_NSTEPS; i++) {
+        offs[0] = (hsize_t)i;
+        offs[1] = (hsize_t)(SIEVE_WIN_DIM / 2 + i);
+        offs[2] = (hsize_t)(SIEVE_WIN_DIM - 1 - i);
+
+        for (j = 0; j < 3; j++) {
+            val             = -(int)offs[j] - 1;
+            expect[offs[j]] = val;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, &offs[j], NULL, one, NULL) < 0)
+                TEST_ERROR
+            if (H5Dwrite(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, &val) < 0)
+                TEST_ERROR
+        } /* end for */
+    }     /* end for */
+
+    /* Interleave single element reads from the same streams */
+    for (i = 0; i < SIEVE_WIN_NSTEPS; i++) {
+        offs[0] = (hsize_t)(SIEVE_WIN_NSTEPS - 1 - i);
+        offs[1] = (hsize_t)(SIEVE_WIN_DIM / 2 + i);
+        offs[2] = (hsize_t)(SIEVE_WIN_DIM - SIEVE_WIN_NSTEPS + i);
+
+        for (j = 0; j < 3; j++) {
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, &offs[j], NULL, one, NULL) < 0)
+                TEST_ERROR
+            if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, &val) < 0)
+                TEST_ERROR
+            if (val != expect[offs[j]])
+                TEST_ERROR
+        } /* end for */
+    }     /* end for */
+
+    /* Write small hyperslabs straddling the windows cached so far */
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    count[0] = 40;
+    if ((msid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+    for (i = 0; i < 40; i++)
+        rbuf[i] = 1000000 + i;
+    for (start[0] = 20; start[0] + count[0] <= SIEVE_WIN_DIM; start[0] += 500) {
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if (H5Dwrite(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        for (i = 0; i < 40; i++)
+            expect[start[0] + (hsize_t)i] = rbuf[i];
+    } /* end for */
+
+    /* Verify the whole dataset before and after re-opening the file */
+    if (H5Sclose(msid) < 0)
+        TEST_ERROR
+    msid = -1;
+    if (H5Sselect_all(sid) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * SIEVE_WIN_DIM);
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for (i = 0; i < SIEVE_WIN_DIM; i++)
+        if (rbuf[i] != expect[i])
+            TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+        TEST_ERROR
+    if ((did = H5Dopen2(fid, "sieve_windows", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * SIEVE_WIN_DIM);
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for (i = 0; i < SIEVE_WIN_DIM; i++)
+        if (rbuf[i] != expect[i])
+            TEST_ERROR
+
+    if (H5Dclose(did) < 0)
+        TEST_ERROR
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        TEST_ERROR
+
+    HDfree(expect);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(expect);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_sieve_windows() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_versionbounds
  *
@@ -15207,7 +15705,10 @@ main(void)
                 nerrors += (test_compact_io(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_max_compact(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_compact_open_close_dirty(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_zero_copy_io(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_sieve_windows(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_conv_buffer(file) < 0 ? 1 : 0);
+                nerrors += (test_tconv_buf_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_tconv(file) < 0 ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0 ? 1 : 0);
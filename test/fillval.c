@@ -27,7 +27,8 @@
 /* #define NO_FILLING */
 
 const char *FILENAME[] = {"fillval_1", "fillval_2", "fillval_3", "fillval_4", "fillval_5",
-                          "fillval_6", "fillval_7", "fillval_8", "fillval_9", NULL};
+                          "fillval_6", "fillval_7", "fillval_8", "fillval_9", "fillval_10",
+                          NULL};
 
 /* Common type for compound datatype operations */
 typedef struct {
@@ -2635,6 +2636,111 @@ error:
     return nerrors;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_batch_fill
+ *
+ * Purpose:     Tests fill values for early-allocated chunked datasets that
+ *              have more chunks than fit in one batched fill write, so the
+ *              fill values are written in several batches.  Checked both
+ *              with and without a filter on the chunks.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_batch_fill(hid_t fapl, const char *base_name)
+{
+    char    filename[1024];
+    hid_t   file = -1, dcpl = -1, space = -1, dset = -1;
+    hsize_t ch_size[1] = {(1024 * 1024) / sizeof(int)}; /* 1 MiB chunks */
+    hsize_t ds_size[1];
+    int     fillval = 0x5a5a5a5a;
+    int *   buf     = NULL;
+    size_t  nelmts;
+    size_t  u;
+    int     filtered;
+    char    dname[32];
+
+    TESTING("chunked dataset fill values written in batches");
+
+    /* Use enough chunks to need more than one batch of 16 MiB */
+    ds_size[0] = 17 * ch_size[0];
+    nelmts     = (size_t)ds_size[0];
+    if (NULL == (buf = (int *)HDmalloc(nelmts * sizeof(int))))
+        goto error;
+
+    h5_fixname(base_name, fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if ((space = H5Screate_simple(1, ds_size, NULL)) < 0)
+        goto error;
+
+    for (filtered = 0; filtered < 2; filtered++) {
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            goto error;
+        if (H5Pset_chunk(dcpl, 1, ch_size) < 0)
+            goto error;
+        if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+            goto error;
+        if (H5Pset_fill_time(dcpl, H5D_FILL_TIME_ALLOC) < 0)
+            goto error;
+        if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fillval) < 0)
+            goto error;
+
+        /* The checksum makes the filtered fill image a little larger than
+         * the chunk, so the batches don't line up with the unfiltered case.
+         */
+        if (filtered && H5Pset_fletcher32(dcpl) < 0)
+            goto error;
+
+        HDsnprintf(dname, sizeof(dname), "dset%d", filtered);
+        if ((dset = H5Dcreate2(file, dname, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            goto error;
+
+        /* Every element, on both sides of the batch boundary, must hold the
+         * fill value
+         */
+        HDmemset(buf, 0, nelmts * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            goto error;
+        for (u = 0; u < nelmts; u++)
+            if (buf[u] != fillval) {
+                H5_FAILED();
+                HDfprintf(stdout, "%u: Value read was not a fill value.\n", (unsigned)__LINE__);
+                HDprintf("    Elmt={%lu}, read: %d, Fill value: %d\n", (unsigned long)u, buf[u], fillval);
+                goto error;
+            }
+
+        if (H5Dclose(dset) < 0)
+            goto error;
+        if (H5Pclose(dcpl) < 0)
+            goto error;
+    } /* end for */
+
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Fclose(file) < 0)
+        goto error;
+    HDfree(buf);
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    HDfree(buf);
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -2707,6 +2813,7 @@ main(int argc, char *argv[])
             nerrors += test_rdwr(my_fapl, FILENAME[2], H5D_CHUNKED);
             nerrors += test_extend(my_fapl, FILENAME[4], H5D_CHUNKED);
             nerrors += test_partalloc(my_fapl, FILENAME[8]);
+            nerrors += test_batch_fill(my_fapl, FILENAME[9]);
         } /* end if */
 
         /* Contiguous storage layout tests */
@@ -1034,6 +1034,13 @@ h5_get_vfd_fapl(hid_t fapl)
          */
         if (H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             goto error;
+#endif
+#ifdef H5_HAVE_URING
+    }
+    else if (!HDstrcmp(tok, "uring")) {
+        /* Linux io_uring, with the default queue depth and block size */
+        if (H5Pset_fapl_uring(fapl, 0, 0, FALSE) < 0)
+            goto error;
 #endif
     }
     else {
@@ -1383,6 +1390,9 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
             driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_URING
+            driver == H5FD_URING ||
+#endif /* H5_HAVE_URING */
             driver == H5FD_LOG) {
             /* Get the file's statistics */
             if (0 == HDstat(filename, &sb))
@@ -1050,6 +1050,124 @@ error:
     return FAIL;
 } /* end test_array_fill() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_column_copy
+ *
+ * Purpose:     Tests H5VM_memcpyvv() and H5VM_stride_copy() by using them
+ *              to extract one column of ELMT_SIZE-byte elements from a
+ *              2-D array, as done when reading one field or column of a
+ *              dataset.
+ *
+ * Return:      Success:    SUCCEED
+ *
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_column_copy(size_t nx, size_t ny, size_t elmt_size)
+{
+    uint8_t *src     = NULL; /* Source array */
+    uint8_t *dst     = NULL; /* Destination column */
+    hsize_t *src_off = NULL; /* Source sequence offsets */
+    size_t * src_len = NULL; /* Source sequence lengths */
+    hsize_t *dst_off = NULL; /* Destination sequence offsets */
+    size_t * dst_len = NULL; /* Destination sequence lengths */
+    hsize_t  size[1];        /* Size of stride copy */
+    hsize_t  src_stride[1];  /* Source stride */
+    hsize_t  dst_stride[1];  /* Destination stride */
+    size_t   src_curr_seq, dst_curr_seq;
+    size_t   col = ny / 2; /* Column to extract */
+    size_t   u, v;         /* Local index variables */
+    char     s[256];
+
+    HDsprintf(s, "column copy of %4lux%-4lu %2lu-byte elements", (unsigned long)nx, (unsigned long)ny,
+              (unsigned long)elmt_size);
+    TESTING(s);
+
+    /* Initialize */
+    if (NULL == (src = (uint8_t *)HDmalloc(nx * ny * elmt_size)))
+        TEST_ERROR
+    if (NULL == (dst = (uint8_t *)HDcalloc(nx, elmt_size)))
+        TEST_ERROR
+    if (NULL == (src_off = (hsize_t *)HDmalloc(nx * sizeof(hsize_t))))
+        TEST_ERROR
+    if (NULL == (src_len = (size_t *)HDmalloc(nx * sizeof(size_t))))
+        TEST_ERROR
+    if (NULL == (dst_off = (hsize_t *)HDmalloc(nx * sizeof(hsize_t))))
+        TEST_ERROR
+    if (NULL == (dst_len = (size_t *)HDmalloc(nx * sizeof(size_t))))
+        TEST_ERROR
+    for (u = 0; u < nx * ny * elmt_size; u++)
+        src[u] = (uint8_t)(u * 7);
+
+    /* Copy the column with one sequence per element on both sides */
+    for (u = 0; u < nx; u++) {
+        src_off[u] = (hsize_t)(((u * ny) + col) * elmt_size);
+        src_len[u] = elmt_size;
+        dst_off[u] = (hsize_t)(u * elmt_size);
+        dst_len[u] = elmt_size;
+    } /* end for */
+    src_curr_seq = dst_curr_seq = 0;
+    if (H5VM_memcpyvv(dst, nx, &dst_curr_seq, dst_len, dst_off, src, nx, &src_curr_seq, src_len, src_off) !=
+        (ssize_t)(nx * elmt_size))
+        TEST_ERROR
+    for (u = 0; u < nx; u++)
+        for (v = 0; v < elmt_size; v++)
+            if (dst[(u * elmt_size) + v] != src[(((u * ny) + col) * elmt_size) + v])
+                TEST_ERROR
+
+    /* Copy the column into a single destination sequence */
+    HDmemset(dst, 0, nx * elmt_size);
+    dst_off[0] = 0;
+    dst_len[0] = nx * elmt_size;
+    src_curr_seq = dst_curr_seq = 0;
+    if (H5VM_memcpyvv(dst, (size_t)1, &dst_curr_seq, dst_len, dst_off, src, nx, &src_curr_seq, src_len,
+                      src_off) != (ssize_t)(nx * elmt_size))
+        TEST_ERROR
+    for (u = 0; u < nx; u++)
+        for (v = 0; v < elmt_size; v++)
+            if (dst[(u * elmt_size) + v] != src[(((u * ny) + col) * elmt_size) + v])
+                TEST_ERROR
+
+    /* Copy the column with a stride copy */
+    HDmemset(dst, 0, nx * elmt_size);
+    size[0]       = nx;
+    src_stride[0] = (hsize_t)(ny * elmt_size);
+    dst_stride[0] = (hsize_t)elmt_size;
+    H5VM_stride_copy(1, (hsize_t)elmt_size, size, dst_stride, dst, src_stride, src + (col * elmt_size));
+    for (u = 0; u < nx; u++)
+        for (v = 0; v < elmt_size; v++)
+            if (dst[(u * elmt_size) + v] != src[(((u * ny) + col) * elmt_size) + v])
+                TEST_ERROR
+
+    PASSED();
+
+    HDfree(src);
+    HDfree(dst);
+    HDfree(src_off);
+    HDfree(src_len);
+    HDfree(dst_off);
+    HDfree(dst_len);
+
+    return SUCCEED;
+
+error:
+    if (src)
+        HDfree(src);
+    if (dst)
+        HDfree(dst);
+    if (src_off)
+        HDfree(src_off);
+    if (src_len)
+        HDfree(src_len);
+    if (dst_off)
+        HDfree(dst_off);
+    if (dst_len)
+        HDfree(dst_len);
+    return FAIL;
+} /* end test_column_copy() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_array_offset_n_calc
  *
@@ -1355,6 +1473,25 @@ main(int argc, char *argv[])
         nerrors += status < 0 ? 1 : 0;
     } /* end if */
 
+    /*-------------------------
+     * TEST COLUMN COPY OPERATIONS
+     *-------------------------
+     */
+    if (size_of_test & TEST_SMALL) {
+        size_t elmt_size;
+
+        for (elmt_size = 1; elmt_size <= 16; elmt_size++) {
+            status = test_column_copy((size_t)11, (size_t)7, elmt_size);
+            nerrors += status < 0 ? 1 : 0;
+        } /* end for */
+    }     /* end if */
+    if (size_of_test & TEST_MEDIUM) {
+        status = test_column_copy((size_t)100000, (size_t)3, (size_t)4);
+        nerrors += status < 0 ? 1 : 0;
+        status = test_column_copy((size_t)100000, (size_t)3, (size_t)8);
+        nerrors += status < 0 ? 1 : 0;
+    } /* end if */
+
     /*-------------------------
      * TEST ARRAY FILL OPERATIONS
      *-------------------------
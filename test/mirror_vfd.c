@@ -1220,6 +1220,101 @@ test_xmit_encode_decode(void)
 
     } while (0); /* end xmit write en/decode */
 
+    /* Test xmit batch structure and batch entry encode/decode
+     * Write bogus but easily verifiable data to inside a buffer, and compare.
+     * Then decode the buffer and compare the structure contents.
+     */
+    do {
+        unsigned char             buf[H5FD_MIRROR_XMIT_BATCH_SIZE + 8];
+        unsigned char             expected[H5FD_MIRROR_XMIT_BATCH_SIZE + 8];
+        H5FD_mirror_xmit_batch_t  xmit_in;
+        H5FD_mirror_xmit_batch_t  xmit_out;
+        H5FD_mirror_batch_entry_t entry_in;
+        H5FD_mirror_batch_entry_t entry_out;
+        size_t                    i = 0;
+
+        /* sanity check */
+        if ((14 + 12) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            FAIL_PUTS_ERROR("Header size definition does not match test\n");
+        }
+        if (18 != H5FD_MIRROR_BATCH_ENTRY_SIZE) {
+            FAIL_PUTS_ERROR("Batch entry size definition does not match test\n");
+        }
+
+        /* Populate the expected buffer; expect end padding of 0xFF
+         */
+        HDmemset(expected, 0xFF, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+        for (i = 0; i < H5FD_MIRROR_XMIT_BATCH_SIZE; i++) {
+            expected[i + 2] = (unsigned char)i;
+        }
+
+        /* Set xmit_in
+         */
+        xmit_in.pub   = xmit_mock; /* shared/common */
+        xmit_in.count = 0x0E0F1011;
+        xmit_in.size  = 0x1213141516171819;
+
+        /* Encode, and compare buffer contents
+         */
+        HDmemset(buf, 0xFF, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+        if (H5FD_mirror_xmit_encode_batch((buf + 2), &xmit_in) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            TEST_ERROR;
+        }
+        if (HDmemcmp(buf, expected, H5FD_MIRROR_XMIT_BATCH_SIZE + 8) != 0) {
+            PRINT_BUFFER_DIFF(buf, expected, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+            TEST_ERROR;
+        }
+
+        /* Decode from buffer
+         */
+        if (H5FD_mirror_xmit_decode_batch(&xmit_out, (buf + 2)) != H5FD_MIRROR_XMIT_BATCH_SIZE) {
+            TEST_ERROR;
+        }
+        if (xmit_out.pub.magic != xmit_mock.magic)
+            TEST_ERROR;
+        if (xmit_out.pub.xmit_count != xmit_mock.xmit_count)
+            TEST_ERROR;
+        if (xmit_out.pub.op != xmit_mock.op)
+            TEST_ERROR;
+        if (xmit_out.count != 0x0E0F1011)
+            TEST_ERROR;
+        if (xmit_out.size != 0x1213141516171819)
+            TEST_ERROR;
+
+        /* Batch entry, at the start of the buffer
+         */
+        HDmemset(expected, 0xFF, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+        for (i = 0; i < H5FD_MIRROR_BATCH_ENTRY_SIZE; i++) {
+            expected[i] = (unsigned char)i;
+        }
+
+        entry_in.op     = 0x00;
+        entry_in.type   = 0x01;
+        entry_in.offset = 0x0203040506070809;
+        entry_in.size   = 0x0A0B0C0D0E0F1011;
+
+        HDmemset(buf, 0xFF, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+        if (H5FD_mirror_xmit_encode_batch_entry(buf, &entry_in) != H5FD_MIRROR_BATCH_ENTRY_SIZE) {
+            TEST_ERROR;
+        }
+        if (HDmemcmp(buf, expected, H5FD_MIRROR_XMIT_BATCH_SIZE + 8) != 0) {
+            PRINT_BUFFER_DIFF(buf, expected, H5FD_MIRROR_XMIT_BATCH_SIZE + 8);
+            TEST_ERROR;
+        }
+        if (H5FD_mirror_xmit_decode_batch_entry(&entry_out, buf) != H5FD_MIRROR_BATCH_ENTRY_SIZE) {
+            TEST_ERROR;
+        }
+        if (entry_out.op != 0x00)
+            TEST_ERROR;
+        if (entry_out.type != 0x01)
+            TEST_ERROR;
+        if (entry_out.offset != 0x0203040506070809)
+            TEST_ERROR;
+        if (entry_out.size != 0x0A0B0C0D0E0F1011)
+            TEST_ERROR;
+
+    } while (0); /* end xmit batch en/decode */
+
     PASSED();
     return 0;
 
@@ -1587,6 +1587,185 @@ error:
 
 } /* test_cmp */
 
+/*---------------------------------------------------------------------------
+ *
+ * Function: test_cache()
+ *
+ * Purpose:
+ *
+ *     Verify the block cache configuration and that reads through a small
+ *     cache -- spanning cached and missing blocks, evicting, and larger
+ *     than the whole cache -- match reads with the cache disabled.
+ *
+ * Return:
+ *
+ *     PASSED : 0
+ *     FAILED : 1
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+test_cache(void)
+{
+
+    /*********************
+     * test-local macros *
+     *********************/
+
+#define CACHE_BLOCK_SIZE 64
+#define CACHE_NBLOCKS    8
+
+    /*************************
+     * test-local structures *
+     *************************/
+
+    struct testcase {
+        haddr_t addr; /* offset of read in file */
+        size_t  len;  /* length of read in file */
+    };
+
+    /************************
+     * test-local variables *
+     ************************/
+
+    struct testcase cases[] = {
+        {5691, 32},   /* beyond the prefetch, one run of misses             */
+        {5700, 10},   /* cache hit                                         */
+        {100, 200},   /* hits from the prefetch                            */
+        {1000, 64},   /* straddles two missing blocks                      */
+        {900, 400},   /* mix of cached and missing blocks, several runs    */
+        {3000, 1000}, /* larger than the cache, read straight through      */
+        {6400, 64},   /* short last block                                  */
+        {0, 6464},    /* whole file                                        */
+        {5691, 32},   /* evicted and read again                            */
+    };
+    unsigned        testcase_count = 9;
+    unsigned        test_i         = 0;
+    struct testcase test;
+    char            buf_cached[6464];
+    char            buf_direct[6464];
+    size_t          block_size    = 0;
+    size_t          nblocks       = 0;
+    size_t          prefetch_size = 0;
+    H5FD_t *        fd_cached     = NULL;
+    H5FD_t *        fd_direct     = NULL;
+    hid_t           fapl_cached   = -1;
+    hid_t           fapl_direct   = -1;
+
+    TESTING("ROS3 block cache");
+
+    /*********
+     * SETUP *
+     *********/
+
+    fapl_cached = H5Pcreate(H5P_FILE_ACCESS);
+    FAIL_IF(fapl_cached < 0)
+    fapl_direct = H5Pcreate(H5P_FILE_ACCESS);
+    FAIL_IF(fapl_direct < 0)
+
+    /* Defaults until set */
+    JSVERIFY(SUCCEED, H5Pget_fapl_ros3_cache(fapl_cached, &block_size, &nblocks, &prefetch_size), NULL)
+    JSVERIFY(H5FD_ROS3_CACHE_BLOCK_SIZE_DEF, block_size, NULL)
+    JSVERIFY(H5FD_ROS3_CACHE_NBLOCKS_DEF, nblocks, NULL)
+    JSVERIFY(H5FD_ROS3_CACHE_PREFETCH_SIZE_DEF, prefetch_size, NULL)
+
+    /* Set twice, to both insert and update the property */
+    JSVERIFY(SUCCEED, H5Pset_fapl_ros3_cache(fapl_cached, 1, 1, 1), NULL)
+    JSVERIFY(SUCCEED, H5Pset_fapl_ros3_cache(fapl_cached, CACHE_BLOCK_SIZE, CACHE_NBLOCKS, 4 * CACHE_BLOCK_SIZE),
+             NULL)
+    JSVERIFY(SUCCEED, H5Pget_fapl_ros3_cache(fapl_cached, &block_size, &nblocks, &prefetch_size), NULL)
+    JSVERIFY(CACHE_BLOCK_SIZE, block_size, NULL)
+    JSVERIFY(CACHE_NBLOCKS, nblocks, NULL)
+    JSVERIFY(4 * CACHE_BLOCK_SIZE, prefetch_size, NULL)
+    JSVERIFY(SUCCEED, H5Pset_fapl_ros3(fapl_cached, &restricted_access_fa), NULL)
+
+    JSVERIFY(SUCCEED, H5Pset_fapl_ros3(fapl_direct, &restricted_access_fa), NULL)
+    JSVERIFY(SUCCEED, H5Pset_fapl_ros3_cache(fapl_direct, 0, 0, 0), NULL)
+
+    if (s3_test_credentials_loaded == 0) {
+        SKIPPED();
+        HDputs("    s3 credentials are not loaded");
+        HDfflush(stdout);
+        goto skip;
+    }
+
+    if (FALSE == s3_test_bucket_defined) {
+        SKIPPED();
+        HDputs("    environment variable HDF5_ROS3_TEST_BUCKET_URL not defined");
+        HDfflush(stdout);
+        goto skip;
+    }
+
+    fd_cached = H5FDopen(url_text_public, H5F_ACC_RDONLY, fapl_cached, HADDR_UNDEF);
+    FAIL_IF(NULL == fd_cached)
+    fd_direct = H5FDopen(url_text_public, H5F_ACC_RDONLY, fapl_direct, HADDR_UNDEF);
+    FAIL_IF(NULL == fd_direct)
+
+    JSVERIFY(6464, H5FDget_eof(fd_cached, H5FD_MEM_DEFAULT), NULL)
+    FAIL_IF(FAIL == H5FD_set_eoa(fd_cached, H5FD_MEM_DEFAULT, 6464))
+    FAIL_IF(FAIL == H5FD_set_eoa(fd_direct, H5FD_MEM_DEFAULT, 6464))
+
+    /*********
+     * TESTS *
+     *********/
+
+    for (test_i = 0; test_i < testcase_count; test_i++) {
+        test = cases[test_i];
+
+        HDmemset(buf_cached, 0, sizeof(buf_cached));
+        HDmemset(buf_direct, 0, sizeof(buf_direct));
+
+        JSVERIFY(SUCCEED, H5FDread(fd_cached, H5FD_MEM_DRAW, H5P_DEFAULT, test.addr, test.len, buf_cached),
+                 NULL)
+        JSVERIFY(SUCCEED, H5FDread(fd_direct, H5FD_MEM_DRAW, H5P_DEFAULT, test.addr, test.len, buf_direct),
+                 NULL)
+        JSVERIFY(0, HDmemcmp(buf_cached, buf_direct, test.len), "cached read differs")
+    }
+
+    /************
+     * TEARDOWN *
+     ************/
+
+    FAIL_IF(FAIL == H5FDclose(fd_cached))
+    fd_cached = NULL;
+    FAIL_IF(FAIL == H5FDclose(fd_direct))
+    fd_direct = NULL;
+
+    PASSED();
+
+skip:
+    FAIL_IF(FAIL == H5Pclose(fapl_cached))
+    fapl_cached = -1;
+    FAIL_IF(FAIL == H5Pclose(fapl_direct))
+    fapl_direct = -1;
+
+    return 0;
+
+error:
+    /***********
+     * CLEANUP *
+     ***********/
+
+    if (fd_cached)
+        (void)H5FDclose(fd_cached);
+    if (fd_direct)
+        (void)H5FDclose(fd_direct);
+    H5E_BEGIN_TRY
+    {
+        if (fapl_cached >= 0)
+            (void)H5Pclose(fapl_cached);
+        if (fapl_direct >= 0)
+            (void)H5Pclose(fapl_direct);
+    }
+    H5E_END_TRY;
+
+    return 1;
+
+#undef CACHE_BLOCK_SIZE
+#undef CACHE_NBLOCKS
+
+} /* test_cache */
+
 /*---------------------------------------------------------------------------
  *
  * Function: test_H5F_integration()
@@ -1800,6 +1979,7 @@ main(void)
     nerrors += test_read();
     nerrors += test_noops_and_autofails();
     nerrors += test_cmp();
+    nerrors += test_cache();
     nerrors += test_H5F_integration();
 
     if (nerrors > 0) {
@@ -20,6 +20,14 @@
 
 #include "h5test.h"
 
+#define H5FD_FRIEND /*suppress error about including H5FDpkg      */
+#define H5FD_TESTING
+#include "H5FDpkg.h"
+
+#ifdef H5_HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 #define KB            1024U
 #define FAMILY_NUMBER 4
 #define FAMILY_SIZE   (1 * KB)
@@ -32,6 +40,10 @@
 #define CORE_DSET_NAME "core dset"
 #define CORE_DSET_DIM1 1024
 #define CORE_DSET_DIM2 32
+#define CORE_DSET2_NAME "core big dset"
+#define CORE_DSET2_DIM  (3 * 1024 * KB / sizeof(int) + 7) /* spans several core VFD pages */
+#define CORE_DSET3_NAME "core unwritten dset"
+#define CORE_DSET3_DIM  (2 * 1024 * KB / sizeof(int)) /* spans several core VFD pages */
 
 #define DSET1_NAME "dset1"
 #define DSET1_DIM1 1024
@@ -46,8 +58,20 @@
 #define THRESHOLD  1
 #define DSET2_NAME "dset2"
 #define DSET2_DIM  4
+#define DSET3_DIM  (16 * FBSIZE / sizeof(int))
 #endif /* H5_HAVE_DIRECT */
 
+/* Macros for io_uring VFD */
+#define URING_QUEUE_DEPTH 4
+#define URING_BLOCK_SIZE  (8 * KB)
+#define URING_DSET2_NAME  "uring dset2"
+#define URING_DSET2_DIM   5
+
+/* Macros for mmap VFD */
+#define MMAP_GROUP_NAME "mmap group"
+#define MMAP_DSET2_NAME "mmap chunked dset"
+#define MMAP_NSLABS     64 /* More than the driver's threshold for random access */
+
 const char *FILENAME[] = {"sec2_file",          /*0*/
                           "core_file",          /*1*/
                           "family_file",        /*2*/
@@ -62,6 +86,8 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "uring_file",         /*14*/
+                          "mmap_file",          /*15*/
                           NULL};
 
 #define LOG_FILENAME "log_vfd_out.log"
@@ -99,7 +125,8 @@ static int splitter_create_single_file_at(const char *filename, hid_t fapl_id,
                                           const struct splitter_dataset_def *data);
 static int splitter_compare_expected_data(hid_t file_id, const struct splitter_dataset_def *data);
 static int run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_errors,
-                             hbool_t provide_logfile_path, hid_t sub_fapl_ids[2]);
+                             hbool_t provide_logfile_path, hid_t sub_fapl_ids[2],
+                             const H5FD_splitter_wo_queue_t *wo_queue);
 static int splitter_RO_test(const struct splitter_dataset_def *data, hid_t child_fapl_id);
 static int splitter_tentative_open_test(hid_t child_fapl_id);
 static int file_exists(const char *filename, hid_t fapl_id);
@@ -242,6 +269,7 @@ test_core(void)
     unsigned long driver_flags = 0;         /* VFD feature flags            */
     hid_t         did          = -1;        /* dataset ID                   */
     hid_t         sid          = -1;        /* dataspace ID                 */
+    hid_t         dcpl_id      = -1;        /* dataset creation plist ID    */
     char          filename[1024];           /* filename                     */
     void *        os_file_handle = NULL;    /* OS file handle               */
     hsize_t       file_size;                /* file size                    */
@@ -251,6 +279,12 @@ test_core(void)
     size_t        write_tracking_page_size; /* write tracking page size     */
     int *         data_w = NULL;            /* data written to the dataset  */
     int *         data_r = NULL;            /* data read from the dataset   */
+    int *         big_w  = NULL;            /* data for the big dataset     */
+    int *         big_r  = NULL;            /* big dataset read back        */
+    unsigned char *image = NULL;            /* file image                   */
+    ssize_t       image_size;               /* size of file image           */
+    haddr_t       big_offset;               /* big dataset's address        */
+    haddr_t       unwritten_offset;         /* unwritten dataset's address  */
     int           val;                      /* data value                   */
     int *         pw = NULL, *pr = NULL;    /* pointers for iterating over
                                                data arrays (write & read)   */
@@ -547,6 +581,110 @@ test_core(void)
 
     HDfree(data_w);
     HDfree(data_r);
+    data_w = data_r = NULL;
+
+    /************************************************************************
+     * Write a dataset which spans several of the pages the core VFD keeps
+     * the file in, and check it through the file image, after the dirty
+     * pages are flushed to the backing store, and after the pages are
+     * gathered into one buffer by H5Fget_vfd_handle().
+     ************************************************************************/
+
+    if (NULL == (big_w = (int *)HDmalloc(CORE_DSET2_DIM * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for input array");
+    if (NULL == (big_r = (int *)HDmalloc(CORE_DSET2_DIM * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for output array");
+    for (i = 0; i < (int)CORE_DSET2_DIM; i++)
+        big_w[i] = i * 3 + 1;
+
+    dims[0] = CORE_DSET2_DIM;
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dcreate2(fid, CORE_DSET2_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big_w) < 0)
+        TEST_ERROR;
+    if (HADDR_UNDEF == (big_offset = H5Dget_offset(did)))
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+
+    /* Allocate a dataset at the end of the file without writing to it, so
+     * its pages are never dirty.  Flushing must still extend the backing
+     * store over it.
+     */
+    dims[0] = CORE_DSET3_DIM;
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_alloc_time(dcpl_id, H5D_ALLOC_TIME_EARLY) < 0)
+        TEST_ERROR;
+    if (H5Pset_fill_time(dcpl_id, H5D_FILL_TIME_NEVER) < 0)
+        TEST_ERROR;
+    if ((did = H5Dcreate2(fid, CORE_DSET3_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (HADDR_UNDEF == (unwritten_offset = H5Dget_offset(did)))
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    if (h5_get_file_size(filename, fapl_id) <
+        (h5_stat_size_t)(unwritten_offset + CORE_DSET3_DIM * sizeof(int)))
+        FAIL_PUTS_ERROR("backing store not extended to the end of the file on flush");
+
+    /* Check the file image */
+    if ((image_size = H5Fget_file_image(fid, NULL, (size_t)0)) < 0)
+        TEST_ERROR;
+    if ((size_t)image_size < big_offset + CORE_DSET2_DIM * sizeof(int))
+        FAIL_PUTS_ERROR("file image too small");
+    if (NULL == (image = (unsigned char *)HDmalloc((size_t)image_size)))
+        FAIL_PUTS_ERROR("unable to allocate memory for file image");
+    if (H5Fget_file_image(fid, image, (size_t)image_size) != image_size)
+        TEST_ERROR;
+    if (HDmemcmp(image + big_offset, big_w, CORE_DSET2_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("big dataset differs in file image");
+
+    /* Close and reopen, so the data comes back from the backing store */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dopen2(fid, CORE_DSET2_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(big_r, 0, CORE_DSET2_DIM * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big_r) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(big_r, big_w, CORE_DSET2_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("big dataset differs after reopening file");
+
+    /* Gather the file into one buffer and read through it */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(*(unsigned char **)os_file_handle + big_offset, big_w, CORE_DSET2_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("big dataset differs in file handle buffer");
+    HDmemset(big_r, 0, CORE_DSET2_DIM * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big_r) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(big_r, big_w, CORE_DSET2_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("big dataset differs after getting file handle");
+
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+
+    HDfree(big_w);
+    HDfree(big_r);
+    HDfree(image);
 
     /* Close and delete the file */
     if (H5Fclose(fid) < 0)
@@ -565,6 +703,7 @@ error:
     {
         H5Sclose(sid);
         H5Dclose(did);
+        H5Pclose(dcpl_id);
         H5Pclose(fapl_id_out);
         H5Pclose(fapl_id);
         H5Fclose(fid);
@@ -575,6 +714,12 @@ error:
         HDfree(data_w);
     if (data_r)
         HDfree(data_r);
+    if (big_w)
+        HDfree(big_w);
+    if (big_r)
+        HDfree(big_r);
+    if (image)
+        HDfree(image);
 
     return -1;
 } /* end test_core() */
@@ -597,15 +742,17 @@ test_direct(void)
 {
 #ifdef H5_HAVE_DIRECT
     hid_t   file = -1, fapl = -1, access_fapl = -1;
-    hid_t   dset1 = -1, dset2 = -1, space1 = -1, space2 = -1;
+    hid_t   dset1 = -1, dset2 = -1, dset3 = -1, space1 = -1, space2 = -1, space3 = -1, mspace = -1;
     char    filename[1024];
     int *   fhandle = NULL;
     hsize_t file_size;
-    hsize_t dims1[2], dims2[1];
+    hsize_t dims1[2], dims2[1], dims3[1], start3[1], count3[1];
+    haddr_t offset3;
     size_t  mbound;
     size_t  fbsize;
     size_t  cbsize;
-    void *  proto_points = NULL, *proto_check = NULL;
+    void *  proto_points = NULL, *proto_check = NULL, *proto_buf3 = NULL;
+    int *   buf3 = NULL;
     int *   points = NULL, *check = NULL, *p1 = NULL, *p2 = NULL;
     int     wdata2[DSET2_DIM] = {11, 12, 13, 14};
     int     rdata2[DSET2_DIM];
@@ -750,36 +897,576 @@ test_direct(void)
     if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata2) < 0)
         TEST_ERROR;
 
-    /* Check that the values read are the same as the values written */
-    for (i = 0; i < DSET2_DIM; i++)
-        if (wdata2[i] != rdata2[i]) {
-            H5_FAILED();
-            HDprintf("    Read different values than written in data set 2.\n");
-            HDprintf("    At index %d\n", i);
+    /* Check that the values read are the same as the values written */
+    for (i = 0; i < DSET2_DIM; i++)
+        if (wdata2[i] != rdata2[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written in data set 2.\n");
+            HDprintf("    At index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+
+    /* Create data set 3, large enough to span many file blocks.  Its
+     * allocation is aligned because of H5Pset_alignment above.
+     */
+    dims3[0] = DSET3_DIM;
+    if ((space3 = H5Screate_simple(1, dims3, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset3 =
+             H5Dcreate2(file, DSET3_NAME, H5T_NATIVE_INT, space3, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (HADDR_UNDEF == (offset3 = H5Dget_offset(dset3)))
+        TEST_ERROR;
+    if (offset3 % FBSIZE)
+        TEST_ERROR;
+
+    /* Overwrite all but the first 3 and last 5 elements, so that both ends
+     * of the write fall in the middle of a file block.  The first time the
+     * memory buffer is aligned where the whole blocks start and they're
+     * written straight from it, the second time it isn't and they're copied.
+     */
+    if (0 != HDposix_memalign(&proto_buf3, (size_t)MBOUNDARY, (size_t)((DSET3_DIM + 3) * sizeof(int))))
+        TEST_ERROR;
+    start3[0] = 3;
+    count3[0] = DSET3_DIM - 8;
+    if (H5Sselect_hyperslab(space3, H5S_SELECT_SET, start3, NULL, count3, NULL) < 0)
+        TEST_ERROR;
+    if ((mspace = H5Screate_simple(1, count3, NULL)) < 0)
+        TEST_ERROR;
+    for (n = 0; n < 2; n++) {
+        buf3 = (int *)proto_buf3 + (n ? 1 : 3);
+        for (i = 0; i < (int)count3[0]; i++)
+            buf3[i] = -(i + n * 100);
+
+        if (H5Dwrite(dset3, H5T_NATIVE_INT, mspace, space3, H5P_DEFAULT, buf3) < 0)
+            TEST_ERROR;
+
+        /* Read the whole data set back... */
+        HDmemset(check, 0, DSET3_DIM * sizeof(int));
+        if (H5Dread(dset3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (i = 0; i < (int)DSET3_DIM; i++)
+            if (check[i] != ((i < 3 || i >= (int)DSET3_DIM - 5) ? points[i] : -((i - 3) + n * 100))) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set 3.\n");
+                HDprintf("    At index %d, pass %d\n", i, n);
+                TEST_ERROR;
+            } /* end if */
+
+        /* ...and the unaligned part into the unaligned buffer */
+        HDmemset(buf3, 0, count3[0] * sizeof(int));
+        if (H5Dread(dset3, H5T_NATIVE_INT, mspace, space3, H5P_DEFAULT, buf3) < 0)
+            TEST_ERROR;
+        for (i = 0; i < (int)count3[0]; i++)
+            if (buf3[i] != -(i + n * 100)) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set 3 selection.\n");
+                HDprintf("    At index %d, pass %d\n", i, n);
+                TEST_ERROR;
+            } /* end if */
+    }     /* end for */
+
+    if (H5Sclose(space1) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset1) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space2) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space3) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset3) < 0)
+        TEST_ERROR;
+
+    HDfree(points);
+    HDfree(check);
+    HDfree(proto_buf3);
+
+    /* Close and delete the file */
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[5], fapl);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Sclose(space1);
+        H5Dclose(dset1);
+        H5Sclose(space2);
+        H5Dclose(dset2);
+        H5Sclose(mspace);
+        H5Sclose(space3);
+        H5Dclose(dset3);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    if (proto_points)
+        HDfree(proto_points);
+    if (proto_check)
+        HDfree(proto_check);
+    if (proto_buf3)
+        HDfree(proto_buf3);
+
+    return -1;
+#endif /*H5_HAVE_DIRECT*/
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_uring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver,
+ *              with and without O_DIRECT.  The datasets span several
+ *              blocks so that more than one request is in flight, and one
+ *              is neither aligned nor a whole number of blocks.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_uring(void)
+{
+#ifdef H5_HAVE_URING
+    hid_t    file = -1, fapl = -1, access_fapl = -1;
+    hid_t    dset1 = -1, dset2 = -1, space1 = -1, space2 = -1;
+    char     filename[1024];
+    int *    fhandle = NULL;
+    hsize_t  dims1[2], dims2[1];
+    unsigned queue_depth;
+    size_t   block_size;
+    hbool_t  use_direct;
+    int *    points = NULL, *check = NULL;
+    int      wdata2[URING_DSET2_DIM] = {21, 22, 23, 24, 25};
+    int      rdata2[URING_DSET2_DIM];
+    int      direct;
+    int      i;
+#endif /* H5_HAVE_URING */
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_URING
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_URING */
+
+    if (NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    for (direct = 0; direct < 2; direct++) {
+        /* Set property list and file name for io_uring driver */
+        if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_uring(fapl, URING_QUEUE_DEPTH, URING_BLOCK_SIZE, (hbool_t)direct) < 0)
+            TEST_ERROR;
+        h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
+
+        /* Verify the file access properties */
+        if (H5Pget_fapl_uring(fapl, &queue_depth, &block_size, &use_direct) < 0)
+            TEST_ERROR;
+        if (queue_depth != URING_QUEUE_DEPTH || block_size != URING_BLOCK_SIZE ||
+            use_direct != (hbool_t)direct)
+            TEST_ERROR;
+
+        H5E_BEGIN_TRY { file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl); }
+        H5E_END_TRY;
+        if (file < 0) {
+            /* io_uring may be disabled in the kernel, and not every file
+             * system supports O_DIRECT
+             */
+            H5Pclose(fapl);
+            fapl = -1;
+            if (direct)
+                break;
+            HDfree(points);
+            HDfree(check);
+            SKIPPED();
+            HDprintf("  Probably io_uring isn't available on this system\n");
+            return 0;
+        }
+
+        /* Check that the driver is correct */
+        if ((access_fapl = H5Fget_access_plist(file)) < 0)
+            TEST_ERROR;
+        if (H5FD_URING != H5Pget_driver(access_fapl))
+            TEST_ERROR;
+        if (H5Pclose(access_fapl) < 0)
+            TEST_ERROR;
+
+        /* Check file handle API */
+        if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+            TEST_ERROR;
+        if (*fhandle < 0)
+            TEST_ERROR;
+
+        /* Write a dataset spanning many blocks and one which isn't aligned */
+        dims1[0] = DSET1_DIM1;
+        dims1[1] = DSET1_DIM2;
+        if ((space1 = H5Screate_simple(2, dims1, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset1 = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space1, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset1) < 0)
+            TEST_ERROR;
+
+        dims2[0] = URING_DSET2_DIM;
+        if ((space2 = H5Screate_simple(1, dims2, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset2 = H5Dcreate2(file, URING_DSET2_NAME, H5T_NATIVE_INT, space2, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata2) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset2) < 0)
+            TEST_ERROR;
+
+        if (H5Sclose(space1) < 0)
+            TEST_ERROR;
+        if (H5Sclose(space2) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Read the data back through the driver, then through the default
+         * driver to check that the file is an ordinary HDF5 file.
+         */
+        for (i = 0; i < 2; i++) {
+            int j;
+
+            if ((file = H5Fopen(filename, H5F_ACC_RDONLY, i ? H5P_DEFAULT : fapl)) < 0)
+                TEST_ERROR;
+
+            HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+            if ((dset1 = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Dread(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+                TEST_ERROR;
+            if (H5Dclose(dset1) < 0)
+                TEST_ERROR;
+            for (j = 0; j < DSET1_DIM1 * DSET1_DIM2; j++)
+                if (points[j] != check[j]) {
+                    H5_FAILED();
+                    HDprintf("    Read different values than written in data set 1.\n");
+                    HDprintf("    At index %d, direct = %d\n", j, direct);
+                    TEST_ERROR;
+                }
+
+            HDmemset(rdata2, 0, sizeof(rdata2));
+            if ((dset2 = H5Dopen2(file, URING_DSET2_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata2) < 0)
+                TEST_ERROR;
+            if (H5Dclose(dset2) < 0)
+                TEST_ERROR;
+            for (j = 0; j < URING_DSET2_DIM; j++)
+                if (wdata2[j] != rdata2[j]) {
+                    H5_FAILED();
+                    HDprintf("    Read different values than written in data set 2.\n");
+                    HDprintf("    At index %d, direct = %d\n", j, direct);
+                    TEST_ERROR;
+                }
+
+            if (H5Fclose(file) < 0)
+                TEST_ERROR;
+        }
+
+        /* Delete the file */
+        h5_delete_test_file(FILENAME[14], fapl);
+
+        /* Close the fapl */
+        if (H5Pclose(fapl) < 0)
+            TEST_ERROR;
+        fapl = -1;
+    }
+
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Sclose(space1);
+        H5Dclose(dset1);
+        H5Sclose(space2);
+        H5Dclose(dset2);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    if (points)
+        HDfree(points);
+    if (check)
+        HDfree(check);
+
+    return -1;
+#endif /* H5_HAVE_URING */
+} /* end test_uring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only memory-mapped driver on a file written
+ *              with the default driver.  Metadata and both contiguous and
+ *              chunked raw data are read through the mapping, with whole
+ *              dataset and hyperslab selections, and a run of sequential
+ *              reads must not be taken for random accesses.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP
+    hid_t   file = -1, fapl = -1, access_fapl = -1, dcpl = -1;
+    hid_t   gid = -1, dset1 = -1, dset2 = -1, space = -1, mspace = -1;
+    char    filename[1024];
+    int *   fhandle = NULL;
+    hsize_t dims[2], chunk_dims[2], start[2], count[2];
+    int *   points = NULL, *check = NULL;
+    int     advice;
+    int     i, j;
+#endif /* H5_HAVE_MMAP */
+
+    TESTING("mmap file driver");
+
+#ifndef H5_HAVE_MMAP
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_MMAP */
+
+    if (NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    /* Set property list and file name for mmap driver */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mmap(fapl) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[15], fapl, filename, sizeof filename);
+
+    /* The driver can't create files */
+    H5E_BEGIN_TRY { file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl); }
+    H5E_END_TRY;
+    if (file >= 0)
+        TEST_ERROR;
+
+    /* Write the file with the default driver */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((gid = H5Gcreate2(file, MMAP_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    dims[0] = DSET1_DIM1;
+    dims[1] = DSET1_DIM2;
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset1 = H5Dcreate2(gid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT,
+                            H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset1) < 0)
+        TEST_ERROR;
+
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    chunk_dims[0] = DSET1_DIM1 / 8;
+    chunk_dims[1] = DSET1_DIM2 / 2;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset2 = H5Dcreate2(gid, MMAP_DSET2_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if (H5Gclose(gid) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* The driver can't open files for writing */
+    H5E_BEGIN_TRY { file = H5Fopen(filename, H5F_ACC_RDWR, fapl); }
+    H5E_END_TRY;
+    if (file >= 0)
+        TEST_ERROR;
+
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if ((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if (H5FD_MMAP != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if (H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if (*fhandle < 0)
+        TEST_ERROR;
+
+    if ((gid = H5Gopen2(file, MMAP_GROUP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    for (i = 0; i < 2; i++) {
+        if ((dset1 = H5Dopen2(gid, i ? MMAP_DSET2_NAME : DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+
+        /* Read the whole dataset */
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (j = 0; j < DSET1_DIM1 * DSET1_DIM2; j++)
+            if (points[j] != check[j]) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set %d.\n", i + 1);
+                HDprintf("    At index %d\n", j);
+                goto error;
+            }
+
+        /* Read a hyperslab which cuts across rows and chunks */
+        start[0] = 3;
+        start[1] = 5;
+        count[0] = DSET1_DIM1 / 2;
+        count[1] = DSET1_DIM2 / 2;
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0 ||
+            (mspace = H5Screate_simple(2, count, NULL)) < 0)
+            TEST_ERROR;
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset1, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (j = 0; j < (int)(count[0] * count[1]); j++) {
+            int row = (int)start[0] + j / (int)count[1];
+            int col = (int)start[1] + j % (int)count[1];
+
+            if (points[row * DSET1_DIM2 + col] != check[j]) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set %d hyperslab.\n", i + 1);
+                HDprintf("    At index %d\n", j);
+                goto error;
+            }
+        }
+        if (H5Sclose(mspace) < 0)
+            TEST_ERROR;
+        mspace = -1;
+
+        if (H5Dclose(dset1) < 0)
+            TEST_ERROR;
+        dset1 = -1;
+    }
+
+    /* Read the contiguous dataset in many slabs, from start to end: the
+     * driver must see a sequential run and leave read-ahead on
+     */
+    if ((dset1 = H5Dopen2(gid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    count[0] = DSET1_DIM1 / MMAP_NSLABS;
+    count[1] = DSET1_DIM2;
+    if ((mspace = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    start[1] = 0;
+    for (i = 0; i < MMAP_NSLABS; i++) {
+        start[0] = (hsize_t)i * count[0];
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dread(dset1, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (j = 0; j < (int)(count[0] * count[1]); j++)
+            if (points[(int)start[0] * DSET1_DIM2 + j] != check[j]) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in slab %d.\n", i);
+                HDprintf("    At index %d\n", j);
+                goto error;
+            }
+    }
+    if (H5FD__mmap_get_advice_test(file, &advice) < 0)
+        TEST_ERROR;
+    if (POSIX_MADV_RANDOM == advice) {
+        H5_FAILED();
+        HDprintf("    Sequential reads were taken for random accesses.\n");
+        goto error;
+    }
+
+    /* The same slabs read from end to start are not sequential */
+    for (i = MMAP_NSLABS - 1; i >= 0; i--) {
+        start[0] = (hsize_t)i * count[0];
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
             TEST_ERROR;
-        } /* end if */
+        if (H5Dread(dset1, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+    }
+    if (H5FD__mmap_get_advice_test(file, &advice) < 0)
+        TEST_ERROR;
+    if (POSIX_MADV_RANDOM != advice) {
+        H5_FAILED();
+        HDprintf("    Backward reads weren't taken for random accesses.\n");
+        goto error;
+    }
 
-    if (H5Sclose(space1) < 0)
+    if (H5Sclose(mspace) < 0)
         TEST_ERROR;
+    mspace = -1;
     if (H5Dclose(dset1) < 0)
         TEST_ERROR;
-    if (H5Sclose(space2) < 0)
+    dset1 = -1;
+
+    if (H5Sclose(space) < 0)
         TEST_ERROR;
-    if (H5Dclose(dset2) < 0)
+    if (H5Gclose(gid) < 0)
         TEST_ERROR;
-
-    HDfree(points);
-    HDfree(check);
-
-    /* Close and delete the file */
     if (H5Fclose(file) < 0)
         TEST_ERROR;
-    h5_delete_test_file(FILENAME[5], fapl);
+
+    /* Delete the file */
+    h5_delete_test_file(FILENAME[15], fapl);
 
     /* Close the fapl */
     if (H5Pclose(fapl) < 0)
         TEST_ERROR;
 
+    HDfree(points);
+    HDfree(check);
+
     PASSED();
     return 0;
 
@@ -787,22 +1474,25 @@ error:
     H5E_BEGIN_TRY
     {
         H5Pclose(fapl);
-        H5Sclose(space1);
+        H5Pclose(access_fapl);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Sclose(mspace);
         H5Dclose(dset1);
-        H5Sclose(space2);
         H5Dclose(dset2);
+        H5Gclose(gid);
         H5Fclose(file);
     }
     H5E_END_TRY;
 
-    if (proto_points)
-        HDfree(proto_points);
-    if (proto_check)
-        HDfree(proto_check);
+    if (points)
+        HDfree(points);
+    if (check)
+        HDfree(check);
 
     return -1;
-#endif /*H5_HAVE_DIRECT*/
-}
+#endif /* H5_HAVE_MMAP */
+} /* end test_mmap() */
 
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
@@ -1079,6 +1769,109 @@ error:
     return FAIL;
 } /* end test_family() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_family_threads
+ *
+ * Purpose:     Tests reads and writes that span several family members,
+ *              which are split across the member threads, and checks that
+ *              the data matches what one-member-at-a-time access sees.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_family_threads(void)
+{
+    hid_t          fapl = -1;
+    H5FD_t *       file = NULL;
+    char           filename[1024];
+    unsigned char *wbuf = NULL;
+    unsigned char *rbuf = NULL;
+    haddr_t        addr = FAMILY_SIZE / 3; /* Start part way into the first member */
+    size_t         size = 13 * FAMILY_SIZE + 17;
+    size_t         u;
+
+    TESTING("FAMILY file driver concurrent member I/O");
+
+    if (NULL == (wbuf = (unsigned char *)HDmalloc(size)))
+        TEST_ERROR;
+    if (NULL == (rbuf = (unsigned char *)HDmalloc(size)))
+        TEST_ERROR;
+    for (u = 0; u < size; u++)
+        wbuf[u] = (unsigned char)(u * 7 + u / 251);
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_family(fapl, (hsize_t)FAMILY_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[2], fapl, filename, sizeof(filename));
+
+    /* Write, flush and truncate using the member threads, and read back */
+    if (HDsetenv("HDF5_FAMILY_THREADS", "4", 1) < 0)
+        TEST_ERROR;
+    if (NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        TEST_ERROR;
+    if (H5FDset_eoa(file, H5FD_MEM_DRAW, addr + size) < 0)
+        TEST_ERROR;
+    if (H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, addr, size, wbuf) < 0)
+        TEST_ERROR;
+    if (H5FDflush(file, H5P_DEFAULT, FALSE) < 0)
+        TEST_ERROR;
+    if (H5FDtruncate(file, H5P_DEFAULT, FALSE) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, size);
+    if (H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addr, size, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, size) != 0)
+        FAIL_PUTS_ERROR("data read with member threads doesn't match");
+    if (H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+
+    /* The members must hold the same bytes one-at-a-time access sees */
+    if (HDsetenv("HDF5_FAMILY_THREADS", "1", 1) < 0)
+        TEST_ERROR;
+    if (NULL == (file = H5FDopen(filename, H5F_ACC_RDONLY, fapl, HADDR_UNDEF)))
+        TEST_ERROR;
+    if (H5FDset_eoa(file, H5FD_MEM_DRAW, addr + size) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, size);
+    if (H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addr, size, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, size) != 0)
+        FAIL_PUTS_ERROR("data read without member threads doesn't match");
+    if (H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+
+    if (HDsetenv("HDF5_FAMILY_THREADS", "", 1) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[2], fapl);
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (file)
+            H5FDclose(file);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDsetenv("HDF5_FAMILY_THREADS", "", 1);
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return FAIL;
+} /* end test_family_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_family_compat
  *
@@ -1599,6 +2392,110 @@ error:
     return FAIL;
 } /* end test_multi() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_threads
+ *
+ * Purpose:     Tests flushing and truncating the members of a MULTI file
+ *              with the member threads, and checks that the data reads
+ *              back the same with one-member-at-a-time access.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_threads(void)
+{
+    hid_t   file = -1, fapl = -1, dset = -1, space = -1;
+    hsize_t dims[2] = {MULTI_SIZE, MULTI_SIZE};
+    char    filename[1024];
+    int *   wbuf = NULL;
+    int *   rbuf = NULL;
+    int     i;
+
+    TESTING("MULTI file driver concurrent member flush");
+
+    if (NULL == (wbuf = (int *)HDmalloc(MULTI_SIZE * MULTI_SIZE * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = (int *)HDcalloc(MULTI_SIZE * MULTI_SIZE, sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < MULTI_SIZE * MULTI_SIZE; i++)
+        wbuf[i] = i * 3 + 1;
+
+    /* The default MULTI layout has a member for each type of data */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_multi(fapl, NULL, NULL, NULL, NULL, TRUE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[4], fapl, filename, sizeof(filename));
+
+    /* Write and flush several times using the member threads */
+    if (HDsetenv("HDF5_MULTI_THREADS", "4", 1) < 0)
+        TEST_ERROR;
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < 3; i++) {
+        wbuf[i] = -i;
+        if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR;
+        if (H5Fflush(file, H5F_SCOPE_GLOBAL) < 0)
+            TEST_ERROR;
+    }
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Read back one member at a time */
+    if (HDsetenv("HDF5_MULTI_THREADS", "1", 1) < 0)
+        TEST_ERROR;
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dopen2(file, "dset", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, MULTI_SIZE * MULTI_SIZE * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("data flushed with member threads doesn't match");
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    if (HDsetenv("HDF5_MULTI_THREADS", "", 1) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[4], fapl);
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDsetenv("HDF5_MULTI_THREADS", "", 1);
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return FAIL;
+} /* end test_multi_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_multi_compat
  *
@@ -1906,6 +2803,131 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_log_trace
+ *
+ * Purpose:     Tests the I/O trace mode of the log driver: the JSON
+ *              summary is appended to the log and the binary trace is
+ *              written next to it.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_log_trace(void)
+{
+    hid_t    file  = -1;
+    hid_t    fapl  = -1;
+    hid_t    space = -1;
+    hid_t    dset  = -1;
+    hsize_t  dims  = 1024;
+    int      wbuf[1024];
+    char     filename[1024];
+    char     line[1024];
+    uint8_t  header[H5FD_LOG_TRACE_HEADER_SIZE];
+    uint8_t  record[H5FD_LOG_TRACE_RECORD_SIZE];
+    uint64_t nrecords = 0;
+    uint64_t u;
+    hbool_t  found = FALSE;
+    FILE *   fp    = NULL;
+    int      i;
+
+    TESTING("LOG file driver I/O trace");
+
+    for (i = 0; i < 1024; i++)
+        wbuf[i] = i;
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_log(fapl, LOG_FILENAME, H5FD_LOG_TRACE, 0) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+
+    /* Create a file with a contiguous dataset, so there is raw data I/O */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if ((space = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* The summary is written to the log when the file is closed */
+    if (NULL == (fp = HDfopen(LOG_FILENAME, "r")))
+        TEST_ERROR;
+    while (HDfgets(line, sizeof(line), fp))
+        if (HDstrstr(line, "\"requests\": ") && HDstrstr(line, "\"small_io_bytes\": "))
+            found = TRUE;
+    HDfclose(fp);
+    fp = NULL;
+    if (!found)
+        FAIL_PUTS_ERROR("I/O trace summary not found in log");
+
+    /* Check the binary trace */
+    if (NULL == (fp = HDfopen(LOG_FILENAME ".trace", "rb")))
+        TEST_ERROR;
+    if (1 != HDfread(header, sizeof(header), 1, fp))
+        TEST_ERROR;
+    if (HDmemcmp(header, H5FD_LOG_TRACE_MAGIC, 8) != 0)
+        FAIL_PUTS_ERROR("bad trace file signature");
+    for (i = 7; i >= 0; i--)
+        nrecords = (nrecords << 8) | header[8 + i];
+    if (0 == nrecords || nrecords > H5FD_LOG_TRACE_NRECORDS)
+        FAIL_PUTS_ERROR("bad trace record count");
+
+    /* Every record must be a read or a write, and the dataset must be written */
+    found = FALSE;
+    for (u = 0; u < nrecords; u++) {
+        uint64_t size = 0;
+
+        if (1 != HDfread(record, sizeof(record), 1, fp))
+            FAIL_PUTS_ERROR("trace file is truncated");
+        for (i = 7; i >= 0; i--)
+            size = (size << 8) | record[24 + i];
+        if (record[32] != H5FD_LOG_TRACE_READ && record[32] != H5FD_LOG_TRACE_WRITE)
+            FAIL_PUTS_ERROR("bad trace record operation");
+        if (record[32] == H5FD_LOG_TRACE_WRITE && record[33] == H5FD_MEM_DRAW && size == sizeof(wbuf))
+            found = TRUE;
+    }
+    if (1 == HDfread(record, 1, 1, fp))
+        FAIL_PUTS_ERROR("trailing data in trace file");
+    HDfclose(fp);
+    fp = NULL;
+    if (!found)
+        FAIL_PUTS_ERROR("raw data write not traced");
+
+    HDremove(LOG_FILENAME ".trace");
+    h5_delete_test_file(FILENAME[6], fapl);
+
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    if (fp)
+        HDfclose(fp);
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return -1;
+} /* end test_log_trace() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_stdio
  *
@@ -2332,11 +3354,16 @@ done:
  *              After writing, compares read-write and write-only files.
  *              Includes FAPL sanity testing.
  *
+ *              If WO_QUEUE is not NULL, the W/O channel is written in the
+ *              background with that configuration, and at the
+ *              H5FD_SPLITTER_WO_FLUSH level the files are also compared
+ *              after a flush.
+ *
  *-------------------------------------------------------------------------
  */
 static int
 run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_errors,
-                  hbool_t provide_logfile_path, hid_t sub_fapl_ids[2])
+                  hbool_t provide_logfile_path, hid_t sub_fapl_ids[2], const H5FD_splitter_wo_queue_t *wo_queue)
 {
     hid_t                       file_id     = H5I_INVALID_HID;
     hid_t                       fapl_id     = H5I_INVALID_HID;
@@ -2383,6 +3410,20 @@ run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_err
         SPLITTER_TEST_FAULT("information mismatch\n");
     }
 
+    if (wo_queue != NULL) {
+        H5FD_splitter_wo_queue_t wo_queue_out;
+
+        if (H5Pset_fapl_splitter_wo_queue(fapl_id, wo_queue) < 0) {
+            SPLITTER_TEST_FAULT("can't set W/O queue\n");
+        }
+        if (H5Pget_fapl_splitter_wo_queue(fapl_id, &wo_queue_out) < 0) {
+            SPLITTER_TEST_FAULT("can't get W/O queue\n");
+        }
+        if (wo_queue_out.durability != wo_queue->durability || wo_queue_out.queue_size != wo_queue->queue_size) {
+            SPLITTER_TEST_FAULT("W/O queue mismatch\n");
+        }
+    }
+
     /*
      * Copy property list, light compare, and close the copy.
      * Helps test driver-implemented FAPL-copying and library ID management.
@@ -2442,6 +3483,16 @@ run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_err
         SPLITTER_TEST_FAULT("can't write data to dataset\n");
     }
 
+    /* A flush brings the W/O file up to date with the R/W file */
+    if (wo_queue != NULL && H5FD_SPLITTER_WO_FLUSH == wo_queue->durability) {
+        if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0) {
+            SPLITTER_TEST_FAULT("can't flush file\n");
+        }
+        if (h5_compare_file_bytes(filename_rw, vfd_config->wo_path) < 0) {
+            SPLITTER_TEST_FAULT("files are not byte-for-byte equivalent after flush\n");
+        }
+    }
+
     /* Close everything */
     if (H5Dclose(dset_id) < 0) {
         SPLITTER_TEST_FAULT("can't close dset\n");
@@ -3277,7 +4328,7 @@ test_splitter(void)
             child_fapl_ids[0] = (j & 1) ? child_fapl_id : H5P_DEFAULT;
             child_fapl_ids[1] = (j & 2) ? child_fapl_id : H5P_DEFAULT;
 
-            if (run_splitter_test(&data, ignore_wo_errors, provide_logfile_path, child_fapl_ids) < 0) {
+            if (run_splitter_test(&data, ignore_wo_errors, provide_logfile_path, child_fapl_ids, NULL) < 0) {
                 TEST_ERROR;
             }
 
@@ -3285,6 +4336,100 @@ test_splitter(void)
 
     } /* end for behavior-flag loops */
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Test the W/O channel written in the background, with a queue small
+     * enough that most writes wait for room in it.
+     */
+    for (i = 0; i < 2; i++) {
+        H5FD_splitter_wo_queue_t wo_queue;
+        hid_t                    child_fapl_ids[2] = {H5P_DEFAULT, H5I_INVALID_HID};
+
+        wo_queue.durability = (i == 0) ? H5FD_SPLITTER_WO_FLUSH : H5FD_SPLITTER_WO_ASYNC;
+        wo_queue.queue_size = 64;
+
+        if ((child_fapl_ids[1] = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_sec2(child_fapl_ids[1]) < 0)
+            TEST_ERROR;
+        if (run_splitter_test(&data, FALSE, FALSE, child_fapl_ids, &wo_queue) < 0) {
+            H5Pclose(child_fapl_ids[1]);
+            TEST_ERROR;
+        }
+        if (H5Pclose(child_fapl_ids[1]) < 0)
+            TEST_ERROR;
+    }
+
+    /* The background thread can't use W/O drivers other than sec2 */
+    {
+        H5FD_splitter_vfd_config_t *vfd_config = NULL;
+        H5FD_splitter_wo_queue_t    wo_queue;
+        char                        filename_rw[H5FD_SPLITTER_PATH_MAX + 1];
+        hid_t                       fapl_id = H5I_INVALID_HID;
+        hid_t                       file_id = H5I_INVALID_HID;
+
+        wo_queue.durability = H5FD_SPLITTER_WO_FLUSH;
+        wo_queue.queue_size = H5FD_SPLITTER_WO_QUEUE_SIZE_DEF;
+
+        if (NULL == (vfd_config = HDcalloc(1, sizeof(H5FD_splitter_vfd_config_t))))
+            TEST_ERROR;
+        vfd_config->magic          = H5FD_SPLITTER_MAGIC;
+        vfd_config->version        = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
+        vfd_config->ignore_wo_errs = FALSE;
+        vfd_config->rw_fapl_id     = H5P_DEFAULT;
+        if ((vfd_config->wo_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_log(vfd_config->wo_fapl_id, NULL, (unsigned long long)0, (size_t)0) < 0)
+            TEST_ERROR;
+        if (splitter_prepare_file_paths(vfd_config, filename_rw) < 0)
+            TEST_ERROR;
+        vfd_config->log_file_path[0] = '\0';
+
+        if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_splitter(fapl_id, vfd_config) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_splitter_wo_queue(fapl_id, &wo_queue) < 0)
+            TEST_ERROR;
+        H5E_BEGIN_TRY
+        {
+            file_id = H5Fcreate(filename_rw, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+        }
+        H5E_END_TRY;
+        if (file_id >= 0)
+            FAIL_PUTS_ERROR("background W/O writes allowed with the log driver");
+
+        if (H5Pclose(fapl_id) < 0)
+            TEST_ERROR;
+        if (H5Pclose(vfd_config->wo_fapl_id) < 0)
+            TEST_ERROR;
+        HDremove(filename_rw);
+        HDremove(vfd_config->wo_path);
+        HDfree(vfd_config);
+    }
+#else
+    /* Without a thread-safe library, only synchronous W/O writes are allowed */
+    {
+        H5FD_splitter_wo_queue_t wo_queue;
+        hid_t                    wo_fapl_id;
+        herr_t                   ret;
+
+        wo_queue.durability = H5FD_SPLITTER_WO_FLUSH;
+        wo_queue.queue_size = H5FD_SPLITTER_WO_QUEUE_SIZE_DEF;
+
+        if ((wo_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        H5E_BEGIN_TRY
+        {
+            ret = H5Pset_fapl_splitter_wo_queue(wo_fapl_id, &wo_queue);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            FAIL_PUTS_ERROR("background W/O writes allowed without a thread-safe library");
+        if (H5Pclose(wo_fapl_id) < 0)
+            TEST_ERROR;
+    }
+#endif /* H5_HAVE_THREADSAFE */
+
     /* TODO: SWMR open? */
     /* Concurrent opens with both drivers using the Splitter */
 
@@ -3325,12 +4470,17 @@ main(void)
     nerrors += test_sec2() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
+    nerrors += test_uring() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
+    nerrors += test_family_threads() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
     nerrors += test_multi() < 0 ? 1 : 0;
+    nerrors += test_multi_threads() < 0 ? 1 : 0;
     nerrors += test_multi_compat() < 0 ? 1 : 0;
     nerrors += test_log() < 0 ? 1 : 0;
+    nerrors += test_log_trace() < 0 ? 1 : 0;
     nerrors += test_stdio() < 0 ? 1 : 0;
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
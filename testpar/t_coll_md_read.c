@@ -39,6 +39,13 @@
 #define LINK_CHUNK_IO_SORT_CHUNK_ISSUE_CHUNK_SIZE   1
 #define LINK_CHUNK_IO_SORT_CHUNK_ISSUE_DIMS         1
 
+#define BULK_COLL_MD_READ_DEPTH     8
+#define BULK_COLL_MD_READ_NDSETS    8
+#define BULK_COLL_MD_READ_DIM       16
+#define BULK_COLL_MD_READ_EXT_DSET  "ext_dset"
+#define BULK_COLL_MD_READ_EXT_LINK  "ext_link"
+#define BULK_COLL_MD_READ_EXT_SUFX  ".ext"
+
 /*
  * A test for issue HDFFV-10501. A parallel hang was reported which occurred
  * in linked-chunk I/O when collective metadata reads are enabled and some ranks
@@ -521,3 +528,211 @@ test_link_chunk_io_sort_chunk_issue(void)
     VRFY((H5Pclose(fapl_id) >= 0), "H5Pclose succeeded");
     VRFY((H5Fclose(file_id) >= 0), "H5Fclose succeeded");
 }
+
+/*
+ * A test for bulk collective metadata reads when opening objects by name.
+ * With collective metadata reads enabled, opening an object by path resolves
+ * each link and object header on rank 0 and broadcasts the metadata read along
+ * the way to the other ranks in a single message, rather than broadcasting each
+ * piece separately. This test opens datasets, groups and objects at the bottom
+ * of a deep group hierarchy, through an external link (which rank 0 cannot
+ * record, forcing all ranks to fall back to opening the object collectively
+ * piece by piece) and by a name which does not exist, and checks that every
+ * rank ends up with the same, correct result.
+ */
+void
+test_bulk_coll_md_read_open(void)
+{
+    const char *filename;
+    char        ext_filename[1024];
+    char        path[1024];
+    char        name[1024];
+    hsize_t     dims[1] = {BULK_COLL_MD_READ_DIM};
+    hid_t       fapl_id = H5I_INVALID_HID, file_id = H5I_INVALID_HID, ext_file_id = H5I_INVALID_HID;
+    hid_t       group_id = H5I_INVALID_HID, dset_id = H5I_INVALID_HID, obj_id = H5I_INVALID_HID;
+    hid_t       space_id = H5I_INVALID_HID;
+    hid_t       dapl_id = H5I_INVALID_HID, gapl_id = H5I_INVALID_HID, lapl_id = H5I_INVALID_HID;
+    double      open_time;
+    int         buf[BULK_COLL_MD_READ_DIM];
+    int         mpi_rank, mpi_size;
+    int         i, j;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    filename = GetTestParameters();
+    HDsnprintf(ext_filename, sizeof(ext_filename), "%s%s", filename, BULK_COLL_MD_READ_EXT_SUFX);
+
+    fapl_id = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl_id >= 0), "create_faccess_plist succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(fapl_id, true) >= 0), "Set collective metadata reads succeeded");
+
+    /*
+     * Opening objects is only done with collective metadata reads when the
+     * access property list used for it asks for them
+     */
+    dapl_id = H5Pcreate(H5P_DATASET_ACCESS);
+    VRFY((dapl_id >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(dapl_id, true) >= 0), "Set collective metadata reads succeeded");
+    gapl_id = H5Pcreate(H5P_GROUP_ACCESS);
+    VRFY((gapl_id >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(gapl_id, true) >= 0), "Set collective metadata reads succeeded");
+    lapl_id = H5Pcreate(H5P_LINK_ACCESS);
+    VRFY((lapl_id >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(lapl_id, true) >= 0), "Set collective metadata reads succeeded");
+
+    space_id = H5Screate_simple(1, dims, NULL);
+    VRFY((space_id >= 0), "H5Screate_simple succeeded");
+
+    /*
+     * Create the external file with a single dataset in it
+     */
+    ext_file_id = H5Fcreate(ext_filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((ext_file_id >= 0), "H5Fcreate succeeded");
+
+    dset_id = H5Dcreate2(ext_file_id, BULK_COLL_MD_READ_EXT_DSET, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                         H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset_id >= 0), "H5Dcreate2 succeeded");
+
+    for (i = 0; i < BULK_COLL_MD_READ_DIM; i++)
+        buf[i] = -i;
+    VRFY((H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) >= 0), "H5Dwrite succeeded");
+
+    VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+    VRFY((H5Fclose(ext_file_id) >= 0), "H5Fclose succeeded");
+
+    /*
+     * Create a deep group hierarchy with datasets at the bottom of it
+     */
+    file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((file_id >= 0), "H5Fcreate succeeded");
+
+    HDstrcpy(path, "");
+    for (i = 0; i < BULK_COLL_MD_READ_DEPTH; i++) {
+        HDsnprintf(name, sizeof(name), "/group_%d", i);
+        HDstrcat(path, name);
+
+        group_id = H5Gcreate2(file_id, path, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((group_id >= 0), "H5Gcreate2 succeeded");
+        VRFY((H5Gclose(group_id) >= 0), "H5Gclose succeeded");
+    }
+
+    for (i = 0; i < BULK_COLL_MD_READ_NDSETS; i++) {
+        HDsnprintf(name, sizeof(name), "%s/dset_%d", path, i);
+
+        dset_id = H5Dcreate2(file_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((dset_id >= 0), "H5Dcreate2 succeeded");
+
+        for (j = 0; j < BULK_COLL_MD_READ_DIM; j++)
+            buf[j] = i * 1000 + j;
+        VRFY((H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) >= 0),
+             "H5Dwrite succeeded");
+
+        VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+    }
+
+    VRFY((H5Lcreate_external(ext_filename, BULK_COLL_MD_READ_EXT_DSET, file_id, BULK_COLL_MD_READ_EXT_LINK,
+                             H5P_DEFAULT, H5P_DEFAULT) >= 0),
+         "H5Lcreate_external succeeded");
+
+    VRFY((H5Fclose(file_id) >= 0), "H5Fclose succeeded");
+
+    /*
+     * Re-open the file, so that nothing but the root group is cached, and
+     * open everything by its full path
+     */
+    file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    VRFY((file_id >= 0), "H5Fopen succeeded");
+
+    open_time = MPI_Wtime();
+    for (i = 0; i < BULK_COLL_MD_READ_NDSETS; i++) {
+        HDsnprintf(name, sizeof(name), "%s/dset_%d", path, i);
+
+        dset_id = H5Dopen2(file_id, name, dapl_id);
+        VRFY((dset_id >= 0), "H5Dopen2 succeeded");
+
+        HDmemset(buf, 0, sizeof(buf));
+        VRFY((H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) >= 0),
+             "H5Dread succeeded");
+        for (j = 0; j < BULK_COLL_MD_READ_DIM; j++)
+            VRFY((buf[j] == i * 1000 + j), "Data verification succeeded");
+
+        VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+    }
+    open_time = MPI_Wtime() - open_time;
+
+    if (VERBOSE_MED && MAINPROCESS)
+        HDprintf("Opened %d datasets at depth %d in %f seconds\n", BULK_COLL_MD_READ_NDSETS,
+                 BULK_COLL_MD_READ_DEPTH, open_time);
+
+    group_id = H5Gopen2(file_id, path, gapl_id);
+    VRFY((group_id >= 0), "H5Gopen2 succeeded");
+
+    obj_id = H5Oopen(group_id, "dset_0", lapl_id);
+    VRFY((obj_id >= 0), "H5Oopen succeeded");
+    VRFY((H5Iget_type(obj_id) == H5I_DATASET), "H5Oopen opened a dataset");
+    VRFY((H5Oclose(obj_id) >= 0), "H5Oclose succeeded");
+
+    obj_id = H5Oopen(file_id, "/group_0", lapl_id);
+    VRFY((obj_id >= 0), "H5Oopen succeeded");
+    VRFY((H5Iget_type(obj_id) == H5I_GROUP), "H5Oopen opened a group");
+    VRFY((H5Oclose(obj_id) >= 0), "H5Oclose succeeded");
+
+    /*
+     * Opening a name which does not exist must fail on every rank
+     */
+    H5E_BEGIN_TRY
+    {
+        dset_id = H5Dopen2(group_id, "no_such_dset", dapl_id);
+    }
+    H5E_END_TRY;
+    VRFY((dset_id < 0), "H5Dopen2 of missing dataset failed");
+
+    VRFY((H5Gclose(group_id) >= 0), "H5Gclose succeeded");
+
+    /*
+     * Opening through an external link falls back to the regular open
+     */
+    dset_id = H5Dopen2(file_id, BULK_COLL_MD_READ_EXT_LINK, dapl_id);
+    VRFY((dset_id >= 0), "H5Dopen2 through external link succeeded");
+
+    HDmemset(buf, 0, sizeof(buf));
+    VRFY((H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) >= 0), "H5Dread succeeded");
+    for (j = 0; j < BULK_COLL_MD_READ_DIM; j++)
+        VRFY((buf[j] == -j), "Data verification succeeded");
+
+    VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+
+    /*
+     * The fallbacks only mark the metadata rank 0 read by itself as
+     * independent, so opening everything again, with the rest of the
+     * collectively read metadata still cached, must work on every rank
+     */
+    for (i = 0; i < BULK_COLL_MD_READ_NDSETS; i++) {
+        HDsnprintf(name, sizeof(name), "%s/dset_%d", path, i);
+
+        dset_id = H5Dopen2(file_id, name, dapl_id);
+        VRFY((dset_id >= 0), "H5Dopen2 succeeded");
+
+        HDmemset(buf, 0, sizeof(buf));
+        VRFY((H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) >= 0),
+             "H5Dread succeeded");
+        for (j = 0; j < BULK_COLL_MD_READ_DIM; j++)
+            VRFY((buf[j] == i * 1000 + j), "Data verification succeeded");
+
+        VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+    }
+
+    VRFY((H5Fclose(file_id) >= 0), "H5Fclose succeeded");
+
+    VRFY((H5Sclose(space_id) >= 0), "H5Sclose succeeded");
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (MAINPROCESS)
+        HDremove(ext_filename);
+
+    VRFY((H5Pclose(dapl_id) >= 0), "H5Pclose succeeded");
+    VRFY((H5Pclose(gapl_id) >= 0), "H5Pclose succeeded");
+    VRFY((H5Pclose(lapl_id) >= 0), "H5Pclose succeeded");
+    VRFY((H5Pclose(fapl_id) >= 0), "H5Pclose succeeded");
+}
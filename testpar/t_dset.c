@@ -4003,6 +4003,421 @@ no_collective_cause_tests(void)
     return;
 }
 
+/*
+ * Function: mpio_type_cache_test
+ *
+ * Purpose: Writes the same regular and irregular hyperslab selections
+ *          collectively several times, checking that the MPI datatypes
+ *          built for them are found in the file's datatype cache after
+ *          the first write and that the construction time is reported.
+ */
+#define DSET_TYPE_CACHE "type_cache"
+void
+mpio_type_cache_test(void)
+{
+    const char *filename;
+    int         mpi_size, mpi_rank;
+    hid_t       fid = -1, fapl = -1, dxpl = -1;
+    hid_t       dataset = -1, file_space = -1, mem_space = -1;
+    hsize_t     dims[RANK], start[RANK], stride[RANK], count[RANK], block[RANK];
+    hsize_t     nelmts;
+    int *       wbuf = NULL, *rbuf = NULL;
+    double      construct_time;
+    unsigned    cache_hits;
+    int         irregular, step;
+    hsize_t     u;
+    herr_t      ret;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    filename = (const char *)GetTestParameters();
+
+    fapl = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl >= 0), "create_faccess_plist succeeded");
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+
+    dims[0]    = (hsize_t)dim0;
+    dims[1]    = (hsize_t)dim1;
+    file_space = H5Screate_simple(RANK, dims, NULL);
+    VRFY((file_space >= 0), "H5Screate_simple succeeded");
+    dataset = H5Dcreate2(fid, DSET_TYPE_CACHE, H5T_NATIVE_INT, file_space, H5P_DEFAULT, H5P_DEFAULT,
+                         H5P_DEFAULT);
+    VRFY((dataset >= 0), "H5Dcreate2 succeeded");
+
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    wbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+
+    for (irregular = 0; irregular < 2; irregular++) {
+        /* Each process takes every mpi_size'th row, starting at its rank */
+        start[0]  = (hsize_t)mpi_rank;
+        start[1]  = 0;
+        stride[0] = (hsize_t)mpi_size;
+        stride[1] = 1;
+        count[0]  = dims[0] / (hsize_t)mpi_size;
+        count[1]  = 1;
+        block[0]  = 1;
+        block[1]  = irregular ? dims[1] / 2 : dims[1];
+        ret       = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, stride, count, block);
+        VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+        nelmts = count[0] * block[1];
+
+        /* Add the last element of the process's first row */
+        if (irregular) {
+            start[1] = dims[1] - 1;
+            count[0] = count[1] = 1;
+            ret                 = H5Sselect_hyperslab(file_space, H5S_SELECT_OR, start, NULL, count, NULL);
+            VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+            nelmts++;
+        }
+        VRFY((H5Sis_regular_hyperslab(file_space) == (irregular ? FALSE : TRUE)),
+             "hyperslab regularity matches");
+
+        mem_space = H5Screate_simple(1, &nelmts, NULL);
+        VRFY((mem_space >= 0), "H5Screate_simple succeeded");
+
+        for (step = 0; step < 3; step++) {
+            for (u = 0; u < nelmts; u++)
+                wbuf[u] = (mpi_rank + 1) * 1000 + step * 100 + (int)u;
+
+            ret = H5Dwrite(dataset, H5T_NATIVE_INT, mem_space, file_space, dxpl, wbuf);
+            VRFY((ret >= 0), "H5Dwrite succeeded");
+
+            ret = H5Pget_mpio_type_construct_info(dxpl, &construct_time, &cache_hits);
+            VRFY((ret >= 0), "H5Pget_mpio_type_construct_info succeeded");
+            VRFY((construct_time >= 0.0), "construction time reported");
+
+            /* Only the file selection is a hyperslab, so its datatype is the
+             * only one cached, and is reused from the second write on
+             */
+            VRFY((cache_hits == (step > 0 ? 1U : 0U)), "datatype cache hits match");
+        }
+
+        /* Read the data back through the cached datatype */
+        HDmemset(rbuf, 0, (size_t)nelmts * sizeof(int));
+        ret = H5Dread(dataset, H5T_NATIVE_INT, mem_space, file_space, dxpl, rbuf);
+        VRFY((ret >= 0), "H5Dread succeeded");
+        ret = H5Pget_mpio_type_construct_info(dxpl, NULL, &cache_hits);
+        VRFY((ret >= 0), "H5Pget_mpio_type_construct_info succeeded");
+        VRFY((cache_hits == 1), "datatype cache hit on read");
+        for (u = 0; u < nelmts; u++)
+            VRFY((rbuf[u] == wbuf[u]), "data read back matches");
+
+        ret = H5Sclose(mem_space);
+        VRFY((ret >= 0), "H5Sclose succeeded");
+    }
+
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Sclose(file_space);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(dxpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    ret = H5Pclose(fapl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+}
+
+/*
+ * Function: mpio_arena_alloc_test
+ *
+ * Purpose: Writes chunks of a dataset independently from every process
+ *          with per-process raw data arenas enabled, then writes more
+ *          chunks collectively, checking that the data (and the fill
+ *          values of partially written chunks) can be read back before
+ *          and after the chunks are indexed, and after reopening the
+ *          file.  Then fills up the arenas with independent writes,
+ *          checking that a write that doesn't fit fails without writing
+ *          anything and succeeds once the arenas are refilled, and that
+ *          datasets with chunks larger than an arena are rejected.
+ */
+#define DSET_ARENA        "arena_alloc"
+#define DSET_ARENA_FULL   "arena_full"
+#define DSET_ARENA_LARGE  "arena_large"
+#define ARENA_CHUNK0      4
+#define ARENA_CHUNK1      8
+#define ARENA_FILL        (-1)
+#define ARENA_SIZE        (64 * 1024)
+#define ARENA_NCHUNKS     (ARENA_SIZE / (ARENA_CHUNK0 * ARENA_CHUNK1 * (int)sizeof(int)))
+#define ARENA_VALUE(i, j) ((int)((i)*1000 + (j)))
+void
+mpio_arena_alloc_test(void)
+{
+    const char *filename;
+    int         mpi_size, mpi_rank;
+    hid_t       fid = -1, fapl = -1, dcpl = -1, dxpl = -1;
+    hid_t       dataset = -1, file_space = -1;
+    hsize_t     dims[RANK], chunk_dims[RANK], start[RANK], count[RANK];
+    hsize_t     arena_size = 0;
+    hsize_t     i, j;
+    int *       wbuf = NULL, *rbuf = NULL;
+    int         fill = ARENA_FILL;
+    int         expect;
+    int         step;
+    int         neven;
+    herr_t      ret;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    filename = (const char *)GetTestParameters();
+
+    fapl = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl >= 0), "create_faccess_plist succeeded");
+    ret = H5Pset_mpio_arena_size(fapl, (hsize_t)ARENA_SIZE);
+    VRFY((ret >= 0), "H5Pset_mpio_arena_size succeeded");
+    ret = H5Pget_mpio_arena_size(fapl, &arena_size);
+    VRFY((ret >= 0), "H5Pget_mpio_arena_size succeeded");
+    VRFY((arena_size == ARENA_SIZE), "arena size matches");
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+
+    /* Two rows of chunks for each process, two chunks per row */
+    dims[0]       = (hsize_t)(2 * mpi_size * ARENA_CHUNK0);
+    dims[1]       = 2 * ARENA_CHUNK1;
+    chunk_dims[0] = ARENA_CHUNK0;
+    chunk_dims[1] = ARENA_CHUNK1;
+    file_space    = H5Screate_simple(RANK, dims, NULL);
+    VRFY((file_space >= 0), "H5Screate_simple succeeded");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_chunk(dcpl, RANK, chunk_dims);
+    VRFY((ret >= 0), "H5Pset_chunk succeeded");
+    ret = H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill);
+    VRFY((ret >= 0), "H5Pset_fill_value succeeded");
+
+    dataset = H5Dcreate2(fid, DSET_ARENA, H5T_NATIVE_INT, file_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dataset >= 0), "H5Dcreate2 succeeded");
+
+    wbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+    for (i = 0; i < dims[0]; i++)
+        for (j = 0; j < dims[1]; j++)
+            wbuf[i * dims[1] + j] = ARENA_VALUE(i, j);
+
+    /* Each process writes all of the first chunk in its row of chunks and
+     * one line of the second one, independently
+     */
+    start[0] = (hsize_t)mpi_rank * ARENA_CHUNK0;
+    start[1] = 0;
+    count[0] = ARENA_CHUNK0;
+    count[1] = ARENA_CHUNK1;
+    ret      = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    start[1] = ARENA_CHUNK1;
+    count[0] = 1;
+    ret      = H5Sselect_hyperslab(file_space, H5S_SELECT_OR, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    ret = H5Dwrite(dataset, H5T_NATIVE_INT, file_space, file_space, H5P_DEFAULT, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+
+    /* The process sees its own chunks before they are indexed */
+    start[1] = 0;
+    count[0] = ARENA_CHUNK0;
+    count[1] = 2 * ARENA_CHUNK1;
+    ret      = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    HDmemset(rbuf, 0, (size_t)(dims[0] * dims[1]) * sizeof(int));
+    ret = H5Dread(dataset, H5T_NATIVE_INT, file_space, file_space, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for (i = start[0]; i < start[0] + ARENA_CHUNK0; i++)
+        for (j = 0; j < dims[1]; j++) {
+            expect = (j < ARENA_CHUNK1 || i == start[0]) ? ARENA_VALUE(i, j) : ARENA_FILL;
+            VRFY((rbuf[i * dims[1] + j] == expect), "data read back before indexing matches");
+        }
+
+    /* Index the chunks, then read the next process's chunks */
+    ret = H5Dflush(dataset);
+    VRFY((ret >= 0), "H5Dflush succeeded");
+    start[0] = (hsize_t)((mpi_rank + 1) % mpi_size) * ARENA_CHUNK0;
+    ret      = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    HDmemset(rbuf, 0, (size_t)(dims[0] * dims[1]) * sizeof(int));
+    ret = H5Dread(dataset, H5T_NATIVE_INT, file_space, file_space, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for (i = start[0]; i < start[0] + ARENA_CHUNK0; i++)
+        for (j = 0; j < dims[1]; j++) {
+            expect = (j < ARENA_CHUNK1 || i == start[0]) ? ARENA_VALUE(i, j) : ARENA_FILL;
+            VRFY((rbuf[i * dims[1] + j] == expect), "other process's data matches");
+        }
+
+    /* Each process writes half of the first chunk in its second row of
+     * chunks collectively, which allocates the chunks collectively
+     */
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    start[0] = (hsize_t)(mpi_size + mpi_rank) * ARENA_CHUNK0;
+    count[0] = ARENA_CHUNK0 / 2;
+    count[1] = ARENA_CHUNK1;
+    ret      = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    ret = H5Dwrite(dataset, H5T_NATIVE_INT, file_space, file_space, dxpl, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Read the whole dataset back collectively (some chunks were never
+     * written), then independently
+     */
+    fid = H5Fopen(filename, H5F_ACC_RDWR, fapl);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    dataset = H5Dopen2(fid, DSET_ARENA, H5P_DEFAULT);
+    VRFY((dataset >= 0), "H5Dopen2 succeeded");
+    VRFY((H5Dget_storage_size(dataset) ==
+          (hsize_t)(3 * mpi_size * ARENA_CHUNK0 * ARENA_CHUNK1) * sizeof(int)),
+         "all written chunks are indexed");
+
+    for (step = 0; step < 2; step++) {
+        HDmemset(rbuf, 0, (size_t)(dims[0] * dims[1]) * sizeof(int));
+        ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, step ? H5P_DEFAULT : dxpl, rbuf);
+        VRFY((ret >= 0), "H5Dread succeeded");
+        for (i = 0; i < dims[0]; i++)
+            for (j = 0; j < dims[1]; j++) {
+                hsize_t row = i % ARENA_CHUNK0; /* Line within the chunk */
+
+                if (i < (hsize_t)mpi_size * ARENA_CHUNK0)
+                    expect = (j < ARENA_CHUNK1 || row == 0) ? ARENA_VALUE(i, j) : ARENA_FILL;
+                else
+                    expect = (j < ARENA_CHUNK1 && row < ARENA_CHUNK0 / 2) ? ARENA_VALUE(i, j) : ARENA_FILL;
+                VRFY((rbuf[i * dims[1] + j] == expect), "data read back after reopening matches");
+            }
+    }
+
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Sclose(file_space);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    /* A band of chunks for each process, holding 5/4 of an arena, one chunk wide */
+    dims[0]    = (hsize_t)(mpi_size * ARENA_NCHUNKS * 5 / 4 * ARENA_CHUNK0);
+    dims[1]    = ARENA_CHUNK1;
+    file_space = H5Screate_simple(RANK, dims, NULL);
+    VRFY((file_space >= 0), "H5Screate_simple succeeded");
+    dataset = H5Dcreate2(fid, DSET_ARENA_FULL, H5T_NATIVE_INT, file_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dataset >= 0), "H5Dcreate2 succeeded");
+
+    wbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)(dims[0] * dims[1]) * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+    for (i = 0; i < dims[0]; i++)
+        for (j = 0; j < dims[1]; j++)
+            wbuf[i * dims[1] + j] = ARENA_VALUE(i, j);
+
+    /* The even processes use up 3/4 of their arenas */
+    neven    = (mpi_size + 1) / 2;
+    start[0] = (hsize_t)(mpi_rank * ARENA_NCHUNKS * 5 / 4 * ARENA_CHUNK0);
+    start[1] = 0;
+    count[0] = (hsize_t)(ARENA_NCHUNKS * 3 / 4 * ARENA_CHUNK0);
+    count[1] = ARENA_CHUNK1;
+    if (mpi_rank % 2 == 0) {
+        ret = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+        VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+        ret = H5Dwrite(dataset, H5T_NATIVE_INT, file_space, file_space, H5P_DEFAULT, wbuf);
+        VRFY((ret >= 0), "H5Dwrite succeeded");
+    }
+
+    /* Half an arena's worth of new chunks doesn't fit in what is left */
+    start[0] += count[0];
+    count[0] = (hsize_t)(ARENA_NCHUNKS / 2 * ARENA_CHUNK0);
+    ret      = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    if (mpi_rank % 2 == 0) {
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dwrite(dataset, H5T_NATIVE_INT, file_space, file_space, H5P_DEFAULT, wbuf);
+        }
+        H5E_END_TRY;
+        VRFY((ret < 0), "H5Dwrite failed with the arena used up");
+    }
+
+    /* Nothing was written, and the even processes get new arenas */
+    ret = H5Dflush(dataset);
+    VRFY((ret >= 0), "H5Dflush succeeded");
+    VRFY((H5Dget_storage_size(dataset) ==
+          (hsize_t)(neven * ARENA_NCHUNKS * 3 / 4) * ARENA_CHUNK0 * ARENA_CHUNK1 * sizeof(int)),
+         "only the chunks that fit are indexed");
+
+    /* All processes write the last part of their band, the odd ones into
+     * the arenas they kept
+     */
+    ret = H5Dwrite(dataset, H5T_NATIVE_INT, file_space, file_space, H5P_DEFAULT, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded after the arenas were refilled");
+    ret = H5Dflush(dataset);
+    VRFY((ret >= 0), "H5Dflush succeeded");
+    VRFY((H5Dget_storage_size(dataset) ==
+          (hsize_t)(neven * ARENA_NCHUNKS * 3 / 4 + mpi_size * ARENA_NCHUNKS / 2) * ARENA_CHUNK0 *
+              ARENA_CHUNK1 * sizeof(int)),
+         "all written chunks are indexed");
+
+    HDmemset(rbuf, 0, (size_t)(dims[0] * dims[1]) * sizeof(int));
+    ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for (i = 0; i < dims[0]; i++)
+        for (j = 0; j < dims[1]; j++) {
+            hsize_t row = i % (hsize_t)(ARENA_NCHUNKS * 5 / 4 * ARENA_CHUNK0); /* Line within the band */
+            hsize_t band = i / (hsize_t)(ARENA_NCHUNKS * 5 / 4 * ARENA_CHUNK0); /* Process writing it */
+
+            expect = (band % 2 == 0 || row >= (hsize_t)(ARENA_NCHUNKS * 3 / 4 * ARENA_CHUNK0))
+                         ? ARENA_VALUE(i, j)
+                         : ARENA_FILL;
+            VRFY((rbuf[i * dims[1] + j] == expect), "data written after refilling matches");
+        }
+
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+
+    /* Chunks must fit in an arena */
+    chunk_dims[0] = ARENA_SIZE / sizeof(int);
+    chunk_dims[1] = 2;
+    ret           = H5Pset_chunk(dcpl, RANK, chunk_dims);
+    VRFY((ret >= 0), "H5Pset_chunk succeeded");
+    H5E_BEGIN_TRY
+    {
+        dataset =
+            H5Dcreate2(fid, DSET_ARENA_LARGE, H5T_NATIVE_INT, file_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    VRFY((dataset < 0), "H5Dcreate2 failed with chunks larger than the arena");
+
+    ret = H5Sclose(file_space);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(dcpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(dxpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    ret = H5Pclose(fapl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+}
+
 /*
  * Test consistency semantics of atomic mode
  */
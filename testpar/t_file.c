@@ -945,3 +945,139 @@ test_file_properties(void)
     VRFY((mpi_ret >= 0), "MPI_Info_free succeeded");
 
 } /* end test_file_properties() */
+
+/*
+ * Test aggregated independent writes (H5F_MPIO_AGGREGATE_KEY).
+ *
+ * Every process writes every mpi_size'th element of a few contiguous
+ * datasets independently, which the MPI-IO driver issues as many small
+ * writes.  With a small stripe and a buffer for two datasets' writes, the
+ * first dataset's writes are spilled when read back, the next two fill the
+ * buffer and are spilled by the fourth's, and the fourth's are drained to
+ * the aggregators when the file is closed.
+ * The file is then reopened without aggregation and checked.
+ */
+#define AGG_NDSETS 4
+#define AGG_NELMTS 8192
+
+void
+test_aggregated_indep_write(void)
+{
+    hid_t       fid     = H5I_INVALID_HID;
+    hid_t       fapl_id = H5I_INVALID_HID;
+    hid_t       dxpl_id = H5I_INVALID_HID;
+    hid_t       dset_id, fspace_id, mspace_id;
+    hsize_t     dims[1], start[1], stride[1], count[1];
+    char        dname[32];
+    int *       wbuf = NULL, *rbuf = NULL;
+    const char *filename;
+    MPI_Info    info = MPI_INFO_NULL;
+    herr_t      ret;
+    int         mpi_ret;
+    int         d, i;
+
+    filename = (const char *)GetTestParameters();
+    if (VERBOSE_MED)
+        HDprintf("Aggregated independent write test on file %s\n", filename);
+
+    /* set up MPI parameters */
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    /* Two aggregators, 4 KiB stripes and room for two datasets' writes */
+    mpi_ret = MPI_Info_create(&info);
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Info_create succeeded");
+    mpi_ret = MPI_Info_set(info, H5F_MPIO_AGGREGATE_KEY, "2");
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Info_set succeeded");
+    mpi_ret = MPI_Info_set(info, H5F_MPIO_AGGREGATE_BUFFER_KEY, "65536");
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Info_set succeeded");
+    mpi_ret = MPI_Info_set(info, "striping_unit", "4096");
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Info_set succeeded");
+
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl_id >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, info);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio succeeded");
+    dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl_id >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_INDEPENDENT);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    wbuf = (int *)HDmalloc(AGG_NELMTS * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)mpi_size * AGG_NELMTS * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+
+    dims[0]   = (hsize_t)mpi_size * AGG_NELMTS;
+    start[0]  = (hsize_t)mpi_rank;
+    stride[0] = (hsize_t)mpi_size;
+    count[0]  = AGG_NELMTS;
+    fspace_id = H5Screate_simple(1, dims, NULL);
+    VRFY((fspace_id >= 0), "H5Screate_simple succeeded");
+    ret = H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    mspace_id = H5Screate_simple(1, count, NULL);
+    VRFY((mspace_id >= 0), "H5Screate_simple succeeded");
+
+    for (d = 0; d < AGG_NDSETS; d++) {
+        HDsnprintf(dname, sizeof(dname), "dset%d", d);
+        dset_id = H5Dcreate2(fid, dname, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((dset_id >= 0), "H5Dcreate2 succeeded");
+
+        for (i = 0; i < AGG_NELMTS; i++)
+            wbuf[i] = (d * mpi_size + mpi_rank) * AGG_NELMTS + i;
+        ret = H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, wbuf);
+        VRFY((ret >= 0), "H5Dwrite succeeded");
+
+        /* Read the first dataset's elements back before they are drained */
+        if (0 == d) {
+            HDmemset(rbuf, 0, AGG_NELMTS * sizeof(int));
+            ret = H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, rbuf);
+            VRFY((ret >= 0), "H5Dread succeeded");
+            VRFY((0 == HDmemcmp(rbuf, wbuf, AGG_NELMTS * sizeof(int))), "held back data read back");
+        }
+
+        ret = H5Dclose(dset_id);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+    }
+
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Reopen without aggregation and check every element */
+    ret = H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio succeeded");
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    for (d = 0; d < AGG_NDSETS; d++) {
+        HDsnprintf(dname, sizeof(dname), "dset%d", d);
+        dset_id = H5Dopen2(fid, dname, H5P_DEFAULT);
+        VRFY((dset_id >= 0), "H5Dopen2 succeeded");
+        ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, rbuf);
+        VRFY((ret >= 0), "H5Dread succeeded");
+        for (i = 0; i < mpi_size * AGG_NELMTS; i++)
+            VRFY((rbuf[i] == (d * mpi_size + i % mpi_size) * AGG_NELMTS + i / mpi_size),
+                 "aggregated data verified");
+        ret = H5Dclose(dset_id);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+    }
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    ret = H5Sclose(fspace_id);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(mspace_id);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(dxpl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    mpi_ret = MPI_Info_free(&info);
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Info_free succeeded");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_aggregated_indep_write() */
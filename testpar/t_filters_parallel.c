@@ -90,6 +90,9 @@ static void test_read_cmpd_filtered_dataset_type_conversion_shared(void);
 #if MPI_VERSION >= 3
 /* Other miscellaneous tests */
 static void test_shrinking_growing_chunks(void);
+static void test_many_shared_chunks(void);
+static void test_unbalanced_filter_load(void);
+static void test_filter_mask_change(void);
 #endif
 
 /*
@@ -146,6 +149,9 @@ static void (*tests[])(void) = {
 #if MPI_VERSION >= 3
     test_write_parallel_read_serial,
     test_shrinking_growing_chunks,
+    test_many_shared_chunks,
+    test_unbalanced_filter_load,
+    test_filter_mask_change,
 #endif
 };
 
@@ -6053,6 +6059,488 @@ test_shrinking_growing_chunks(void)
 
     return;
 }
+
+/*
+ * Tests repeated collective writes to a filtered dataset where
+ * every chunk is shared by all ranks (each rank writes one row
+ * of every chunk), with both linked-chunk and multi-chunk I/O.
+ * This stresses the redistribution of shared chunks and the
+ * collective re-allocation of chunks whose size changes. At
+ * medium verbosity it also reports the slowest rank's time per
+ * write, so the test can be used to see how both scale with the
+ * number of ranks.
+ */
+static void
+test_many_shared_chunks(void)
+{
+    C_DATATYPE *data      = NULL;
+    C_DATATYPE *read_buf  = NULL;
+    const char *opt_names[] = {"linked-chunk", "multi-chunk"};
+    H5FD_mpio_chunk_opt_t opts[] = {H5FD_MPIO_CHUNK_ONE_IO, H5FD_MPIO_CHUNK_MULTI_IO};
+    hsize_t     dataset_dims[MANY_SHARED_CHUNKS_DATASET_DIMS];
+    hsize_t     chunk_dims[MANY_SHARED_CHUNKS_DATASET_DIMS];
+    hsize_t     sel_dims[MANY_SHARED_CHUNKS_DATASET_DIMS];
+    hsize_t     start[MANY_SHARED_CHUNKS_DATASET_DIMS];
+    hsize_t     stride[MANY_SHARED_CHUNKS_DATASET_DIMS];
+    hsize_t     count[MANY_SHARED_CHUNKS_DATASET_DIMS];
+    size_t      i, j, k, data_size, read_buf_size;
+    hid_t       file_id = -1, dset_id = -1, plist_id = -1;
+    hid_t       filespace = -1, memspace = -1;
+
+    if (MAINPROCESS)
+        HDputs("Testing write to many chunks shared by all ranks");
+
+    CHECK_CUR_FILTER_AVAIL();
+
+    /* Set up file access property list with parallel I/O access */
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((plist_id >= 0), "FAPL creation succeeded");
+
+    VRFY((H5Pset_fapl_mpio(plist_id, comm, info) >= 0), "Set FAPL MPIO succeeded");
+
+    VRFY((H5Pset_libver_bounds(plist_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) >= 0),
+         "Set libver bounds succeeded");
+
+    file_id = H5Fopen(filenames[0], H5F_ACC_RDWR, plist_id);
+    VRFY((file_id >= 0), "Test file open succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "FAPL close succeeded");
+
+    dataset_dims[0] = (hsize_t)MANY_SHARED_CHUNKS_NROWS;
+    dataset_dims[1] = (hsize_t)MANY_SHARED_CHUNKS_NCOLS;
+    chunk_dims[0]   = (hsize_t)MANY_SHARED_CHUNKS_CH_NROWS;
+    chunk_dims[1]   = (hsize_t)MANY_SHARED_CHUNKS_CH_NCOLS;
+    sel_dims[0]     = (hsize_t)MANY_SHARED_CHUNKS_NROWS / (hsize_t)mpi_size;
+    sel_dims[1]     = (hsize_t)MANY_SHARED_CHUNKS_NCOLS;
+
+    data_size     = sel_dims[0] * sel_dims[1] * sizeof(*data);
+    read_buf_size = dataset_dims[0] * dataset_dims[1] * sizeof(*read_buf);
+
+    data = (C_DATATYPE *)HDcalloc(1, data_size);
+    VRFY((NULL != data), "HDcalloc succeeded");
+
+    read_buf = (C_DATATYPE *)HDcalloc(1, read_buf_size);
+    VRFY((NULL != read_buf), "HDcalloc succeeded");
+
+    for (k = 0; k < NELMTS(opts); k++) {
+        char   dset_name[64];
+        double max_time = 0.0;
+
+        HDsnprintf(dset_name, sizeof(dset_name), "%s_%s", MANY_SHARED_CHUNKS_DATASET_NAME, opt_names[k]);
+
+        filespace = H5Screate_simple(MANY_SHARED_CHUNKS_DATASET_DIMS, dataset_dims, NULL);
+        VRFY((filespace >= 0), "File dataspace creation succeeded");
+
+        memspace = H5Screate_simple(MANY_SHARED_CHUNKS_DATASET_DIMS, sel_dims, NULL);
+        VRFY((memspace >= 0), "Memory dataspace creation succeeded");
+
+        /* Create chunked dataset */
+        plist_id = H5Pcreate(H5P_DATASET_CREATE);
+        VRFY((plist_id >= 0), "DCPL creation succeeded");
+
+        VRFY((H5Pset_chunk(plist_id, MANY_SHARED_CHUNKS_DATASET_DIMS, chunk_dims) >= 0), "Chunk size set");
+
+        /* Add test filter to the pipeline */
+        VRFY((set_dcpl_filter(plist_id) >= 0), "Filter set");
+
+        dset_id = H5Dcreate2(file_id, dset_name, HDF5_DATATYPE_NAME, filespace, H5P_DEFAULT, plist_id,
+                             H5P_DEFAULT);
+        VRFY((dset_id >= 0), "Dataset creation succeeded");
+
+        VRFY((H5Pclose(plist_id) >= 0), "DCPL close succeeded");
+
+        /* Each rank selects every mpi_size-th row, starting at its own rank */
+        start[0]  = (hsize_t)mpi_rank;
+        start[1]  = 0;
+        stride[0] = (hsize_t)mpi_size;
+        stride[1] = 1;
+        count[0]  = sel_dims[0];
+        count[1]  = sel_dims[1];
+
+        VRFY((H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, stride, count, NULL) >= 0),
+             "Hyperslab selection succeeded");
+
+        /* Create property list for collective dataset write */
+        plist_id = H5Pcreate(H5P_DATASET_XFER);
+        VRFY((plist_id >= 0), "DXPL creation succeeded");
+
+        VRFY((H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE) >= 0), "Set DXPL MPIO succeeded");
+        VRFY((H5Pset_dxpl_mpio_chunk_opt(plist_id, opts[k]) >= 0), "Set DXPL chunk opt succeeded");
+
+        /* Write different data each time, so that the filtered chunks change size */
+        for (i = 0; i < MANY_SHARED_CHUNKS_NLOOPS; i++) {
+            double start_time, elapsed;
+
+            for (j = 0; j < data_size / sizeof(*data); j++) {
+                hsize_t row = ((hsize_t)j / sel_dims[1]) * (hsize_t)mpi_size + (hsize_t)mpi_rank;
+
+                data[j] = (C_DATATYPE)((row * sel_dims[1] + (hsize_t)j % sel_dims[1]) * (i + 1));
+            }
+
+            start_time = MPI_Wtime();
+            VRFY((H5Dwrite(dset_id, HDF5_DATATYPE_NAME, memspace, filespace, plist_id, data) >= 0),
+                 "Dataset write succeeded");
+            elapsed = MPI_Wtime() - start_time;
+
+            VRFY((MPI_SUCCESS == MPI_Allreduce(&elapsed, &start_time, 1, MPI_DOUBLE, MPI_MAX, comm)),
+                 "MPI_Allreduce succeeded");
+            max_time = MAX(max_time, start_time);
+        }
+
+        /* Verify the data from the last write */
+        VRFY((H5Dread(dset_id, HDF5_DATATYPE_NAME, H5S_ALL, H5S_ALL, plist_id, read_buf) >= 0),
+             "Dataset read succeeded");
+
+        for (j = 0; j < read_buf_size / sizeof(*read_buf); j++)
+            if (read_buf[j] != (C_DATATYPE)(j * MANY_SHARED_CHUNKS_NLOOPS)) {
+                VRFY(FALSE, "Data verification succeeded");
+                break;
+            }
+
+        if (VERBOSE_MED && MAINPROCESS)
+            HDprintf("    %s I/O: %" PRIuHSIZE " chunks shared by %d ranks, slowest write %.3f s\n",
+                     opt_names[k], (dataset_dims[0] / chunk_dims[0]) * (dataset_dims[1] / chunk_dims[1]),
+                     mpi_size, max_time);
+
+        VRFY((H5Dclose(dset_id) >= 0), "Dataset close succeeded");
+        VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+        VRFY((H5Sclose(memspace) >= 0), "Memory dataspace close succeeded");
+        VRFY((H5Pclose(plist_id) >= 0), "DXPL close succeeded");
+    }
+
+    HDfree(data);
+    HDfree(read_buf);
+
+    VRFY((H5Fclose(file_id) >= 0), "File close succeeded");
+
+    return;
+}
+
+/*
+ * Tests repeated linked-chunk collective writes to a filtered
+ * dataset where rank 0 writes most of the chunks and every
+ * other rank writes a single chunk, so that rank 0 hands some
+ * of its chunks off to the other ranks to be filtered.
+ */
+static void
+test_unbalanced_filter_load(void)
+{
+    C_DATATYPE *data     = NULL;
+    C_DATATYPE *read_buf = NULL;
+    hsize_t     dataset_dims[UNBALANCED_FILTER_LOAD_DATASET_DIMS];
+    hsize_t     chunk_dims[UNBALANCED_FILTER_LOAD_DATASET_DIMS];
+    hsize_t     sel_dims[UNBALANCED_FILTER_LOAD_DATASET_DIMS];
+    hsize_t     start[UNBALANCED_FILTER_LOAD_DATASET_DIMS];
+    size_t      i, j, data_size, read_buf_size;
+    hid_t       file_id = -1, dset_id = -1, plist_id = -1;
+    hid_t       filespace = -1, memspace = -1;
+
+    if (MAINPROCESS)
+        HDputs("Testing write to filtered chunks unevenly spread among ranks");
+
+    CHECK_CUR_FILTER_AVAIL();
+
+    /* Set up file access property list with parallel I/O access */
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((plist_id >= 0), "FAPL creation succeeded");
+
+    VRFY((H5Pset_fapl_mpio(plist_id, comm, info) >= 0), "Set FAPL MPIO succeeded");
+
+    VRFY((H5Pset_libver_bounds(plist_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) >= 0),
+         "Set libver bounds succeeded");
+
+    file_id = H5Fopen(filenames[0], H5F_ACC_RDWR, plist_id);
+    VRFY((file_id >= 0), "Test file open succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "FAPL close succeeded");
+
+    dataset_dims[0] = (hsize_t)UNBALANCED_FILTER_LOAD_NROWS;
+    dataset_dims[1] = (hsize_t)UNBALANCED_FILTER_LOAD_NCOLS;
+    chunk_dims[0]   = (hsize_t)UNBALANCED_FILTER_LOAD_CH_NROWS;
+    chunk_dims[1]   = (hsize_t)UNBALANCED_FILTER_LOAD_CH_NCOLS;
+
+    /* Rank 0 writes all the chunks but the last mpi_size - 1, which the
+     * other ranks write one each
+     */
+    if (MAINPROCESS) {
+        start[0]    = 0;
+        sel_dims[0] = (hsize_t)(UNBALANCED_FILTER_LOAD_NCHUNKS - mpi_size + 1) * chunk_dims[0];
+    }
+    else {
+        start[0]    = (hsize_t)(UNBALANCED_FILTER_LOAD_NCHUNKS - mpi_size + mpi_rank) * chunk_dims[0];
+        sel_dims[0] = chunk_dims[0];
+    }
+    start[1]    = 0;
+    sel_dims[1] = dataset_dims[1];
+
+    data_size     = sel_dims[0] * sel_dims[1] * sizeof(*data);
+    read_buf_size = dataset_dims[0] * dataset_dims[1] * sizeof(*read_buf);
+
+    data = (C_DATATYPE *)HDcalloc(1, data_size);
+    VRFY((NULL != data), "HDcalloc succeeded");
+
+    read_buf = (C_DATATYPE *)HDcalloc(1, read_buf_size);
+    VRFY((NULL != read_buf), "HDcalloc succeeded");
+
+    filespace = H5Screate_simple(UNBALANCED_FILTER_LOAD_DATASET_DIMS, dataset_dims, NULL);
+    VRFY((filespace >= 0), "File dataspace creation succeeded");
+
+    memspace = H5Screate_simple(UNBALANCED_FILTER_LOAD_DATASET_DIMS, sel_dims, NULL);
+    VRFY((memspace >= 0), "Memory dataspace creation succeeded");
+
+    /* Create chunked dataset */
+    plist_id = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((plist_id >= 0), "DCPL creation succeeded");
+
+    VRFY((H5Pset_chunk(plist_id, UNBALANCED_FILTER_LOAD_DATASET_DIMS, chunk_dims) >= 0), "Chunk size set");
+
+    /* Add test filter to the pipeline */
+    VRFY((set_dcpl_filter(plist_id) >= 0), "Filter set");
+
+    dset_id = H5Dcreate2(file_id, UNBALANCED_FILTER_LOAD_DATASET_NAME, HDF5_DATATYPE_NAME, filespace,
+                         H5P_DEFAULT, plist_id, H5P_DEFAULT);
+    VRFY((dset_id >= 0), "Dataset creation succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "DCPL close succeeded");
+
+    VRFY((H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, sel_dims, NULL) >= 0),
+         "Hyperslab selection succeeded");
+
+    /* Create property list for collective dataset write */
+    plist_id = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((plist_id >= 0), "DXPL creation succeeded");
+
+    VRFY((H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE) >= 0), "Set DXPL MPIO succeeded");
+    VRFY((H5Pset_dxpl_mpio_chunk_opt(plist_id, H5FD_MPIO_CHUNK_ONE_IO) >= 0), "Set DXPL chunk opt succeeded");
+
+    /* Write different data each time, so that the filtered chunks change size */
+    for (i = 0; i < UNBALANCED_FILTER_LOAD_NLOOPS; i++) {
+        for (j = 0; j < data_size / sizeof(*data); j++)
+            data[j] = (C_DATATYPE)((start[0] * sel_dims[1] + (hsize_t)j) * (i + 1));
+
+        VRFY((H5Dwrite(dset_id, HDF5_DATATYPE_NAME, memspace, filespace, plist_id, data) >= 0),
+             "Dataset write succeeded");
+    }
+
+    /* Verify the data from the last write */
+    VRFY((H5Dread(dset_id, HDF5_DATATYPE_NAME, H5S_ALL, H5S_ALL, plist_id, read_buf) >= 0),
+         "Dataset read succeeded");
+
+    for (j = 0; j < read_buf_size / sizeof(*read_buf); j++)
+        if (read_buf[j] != (C_DATATYPE)(j * UNBALANCED_FILTER_LOAD_NLOOPS)) {
+            VRFY(FALSE, "Data verification succeeded");
+            break;
+        }
+
+    HDfree(data);
+    HDfree(read_buf);
+
+    VRFY((H5Dclose(dset_id) >= 0), "Dataset close succeeded");
+    VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+    VRFY((H5Sclose(memspace) >= 0), "Memory dataspace close succeeded");
+    VRFY((H5Pclose(plist_id) >= 0), "DXPL close succeeded");
+    VRFY((H5Fclose(file_id) >= 0), "File close succeeded");
+
+    return;
+}
+/* Whether the optional filter of the filter mask change test fails */
+static hbool_t skip_invert_filter = FALSE;
+
+/*
+ * Optional filter which inverts the bits of a chunk, and fails
+ * when writing while skip_invert_filter is set, so that the
+ * library skips it and records that in the chunk's filter mask.
+ */
+static size_t
+invert_filter(unsigned int filter_flags, size_t H5_ATTR_UNUSED nelmts,
+              const unsigned int H5_ATTR_UNUSED *values, size_t nbytes, size_t H5_ATTR_UNUSED *buf_size,
+              void **buf)
+{
+    unsigned char *bytes = (unsigned char *)*buf;
+    size_t         i;
+
+    if (!(filter_flags & H5Z_FLAG_REVERSE) && skip_invert_filter)
+        return 0;
+
+    for (i = 0; i < nbytes; i++)
+        bytes[i] = (unsigned char)~bytes[i];
+
+    return nbytes;
+}
+
+static const H5Z_class2_t H5Z_INVERT[1] = {{
+    H5Z_CLASS_T_VERS,             /* H5Z_class_t version */
+    FILTER_MASK_CHANGE_FILTER_ID, /* Filter id number */
+    1, 1,                         /* Encoding and decoding enabled */
+    "invert",                     /* Filter name for debugging */
+    NULL,                         /* The "can apply" callback */
+    NULL,                         /* The "set local" callback */
+    invert_filter,                /* The actual filter function */
+}};
+
+/*
+ * Tests repeated collective writes to a filtered dataset with an
+ * optional filter which is skipped on every other write, so that
+ * the filter mask of each chunk changes while its size usually
+ * doesn't. Rank 0 writes most of the chunks, so that some are
+ * filtered by other ranks with linked-chunk I/O. The chunk index
+ * must record the new filter mask of every chunk, or the chunks
+ * can't be read back.
+ */
+static void
+test_filter_mask_change(void)
+{
+    C_DATATYPE *data     = NULL;
+    C_DATATYPE *read_buf = NULL;
+    const char *opt_names[] = {"linked-chunk", "multi-chunk"};
+    H5FD_mpio_chunk_opt_t opts[] = {H5FD_MPIO_CHUNK_ONE_IO, H5FD_MPIO_CHUNK_MULTI_IO};
+    hsize_t     dataset_dims[FILTER_MASK_CHANGE_DATASET_DIMS];
+    hsize_t     chunk_dims[FILTER_MASK_CHANGE_DATASET_DIMS];
+    hsize_t     sel_dims[FILTER_MASK_CHANGE_DATASET_DIMS];
+    hsize_t     start[FILTER_MASK_CHANGE_DATASET_DIMS];
+    hsize_t     nchunks;
+    size_t      i, j, k, data_size, read_buf_size;
+    hid_t       file_id = -1, dset_id = -1, plist_id = -1;
+    hid_t       filespace = -1, memspace = -1;
+
+    if (MAINPROCESS)
+        HDputs("Testing write to filtered chunks whose filter mask changes");
+
+    CHECK_CUR_FILTER_AVAIL();
+
+    VRFY((H5Zregister(H5Z_INVERT) >= 0), "Filter registration succeeded");
+
+    /* Set up file access property list with parallel I/O access */
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((plist_id >= 0), "FAPL creation succeeded");
+
+    VRFY((H5Pset_fapl_mpio(plist_id, comm, info) >= 0), "Set FAPL MPIO succeeded");
+
+    VRFY((H5Pset_libver_bounds(plist_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) >= 0),
+         "Set libver bounds succeeded");
+
+    file_id = H5Fopen(filenames[0], H5F_ACC_RDWR, plist_id);
+    VRFY((file_id >= 0), "Test file open succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "FAPL close succeeded");
+
+    dataset_dims[0] = (hsize_t)FILTER_MASK_CHANGE_NROWS;
+    dataset_dims[1] = (hsize_t)FILTER_MASK_CHANGE_NCOLS;
+    chunk_dims[0]   = (hsize_t)FILTER_MASK_CHANGE_CH_NROWS;
+    chunk_dims[1]   = (hsize_t)FILTER_MASK_CHANGE_CH_NCOLS;
+
+    /* Rank 0 writes all the chunks but the last mpi_size - 1, which the
+     * other ranks write one each
+     */
+    if (MAINPROCESS) {
+        start[0]    = 0;
+        sel_dims[0] = (hsize_t)(FILTER_MASK_CHANGE_NCHUNKS - mpi_size + 1) * chunk_dims[0];
+    }
+    else {
+        start[0]    = (hsize_t)(FILTER_MASK_CHANGE_NCHUNKS - mpi_size + mpi_rank) * chunk_dims[0];
+        sel_dims[0] = chunk_dims[0];
+    }
+    start[1]    = 0;
+    sel_dims[1] = dataset_dims[1];
+
+    data_size     = sel_dims[0] * sel_dims[1] * sizeof(*data);
+    read_buf_size = dataset_dims[0] * dataset_dims[1] * sizeof(*read_buf);
+
+    data = (C_DATATYPE *)HDcalloc(1, data_size);
+    VRFY((NULL != data), "HDcalloc succeeded");
+
+    read_buf = (C_DATATYPE *)HDcalloc(1, read_buf_size);
+    VRFY((NULL != read_buf), "HDcalloc succeeded");
+
+    for (k = 0; k < NELMTS(opts); k++) {
+        char dset_name[64];
+
+        HDsnprintf(dset_name, sizeof(dset_name), "%s_%s", FILTER_MASK_CHANGE_DATASET_NAME, opt_names[k]);
+
+        filespace = H5Screate_simple(FILTER_MASK_CHANGE_DATASET_DIMS, dataset_dims, NULL);
+        VRFY((filespace >= 0), "File dataspace creation succeeded");
+
+        memspace = H5Screate_simple(FILTER_MASK_CHANGE_DATASET_DIMS, sel_dims, NULL);
+        VRFY((memspace >= 0), "Memory dataspace creation succeeded");
+
+        /* Create chunked dataset */
+        plist_id = H5Pcreate(H5P_DATASET_CREATE);
+        VRFY((plist_id >= 0), "DCPL creation succeeded");
+
+        VRFY((H5Pset_chunk(plist_id, FILTER_MASK_CHANGE_DATASET_DIMS, chunk_dims) >= 0), "Chunk size set");
+
+        /* Add the optional filter, then the test filter, to the pipeline */
+        VRFY((H5Pset_filter(plist_id, FILTER_MASK_CHANGE_FILTER_ID, H5Z_FLAG_OPTIONAL, 0, NULL) >= 0),
+             "Filter set");
+        VRFY((set_dcpl_filter(plist_id) >= 0), "Filter set");
+
+        dset_id = H5Dcreate2(file_id, dset_name, HDF5_DATATYPE_NAME, filespace, H5P_DEFAULT, plist_id,
+                             H5P_DEFAULT);
+        VRFY((dset_id >= 0), "Dataset creation succeeded");
+
+        VRFY((H5Pclose(plist_id) >= 0), "DCPL close succeeded");
+
+        VRFY((H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, sel_dims, NULL) >= 0),
+             "Hyperslab selection succeeded");
+
+        /* Create property list for collective dataset write */
+        plist_id = H5Pcreate(H5P_DATASET_XFER);
+        VRFY((plist_id >= 0), "DXPL creation succeeded");
+
+        VRFY((H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE) >= 0), "Set DXPL MPIO succeeded");
+        VRFY((H5Pset_dxpl_mpio_chunk_opt(plist_id, opts[k]) >= 0), "Set DXPL chunk opt succeeded");
+
+        /* Skip the optional filter on every other write, checking the data
+         * and the filter mask of every chunk after each write
+         */
+        for (i = 0; i < FILTER_MASK_CHANGE_NLOOPS; i++) {
+            unsigned expected_mask;
+
+            skip_invert_filter = (i % 2) ? TRUE : FALSE;
+            expected_mask      = skip_invert_filter ? 0x1 : 0;
+
+            for (j = 0; j < data_size / sizeof(*data); j++)
+                data[j] = (C_DATATYPE)((start[0] * sel_dims[1] + (hsize_t)j) * (i + 1));
+
+            VRFY((H5Dwrite(dset_id, HDF5_DATATYPE_NAME, memspace, filespace, plist_id, data) >= 0),
+                 "Dataset write succeeded");
+
+            VRFY((H5Dread(dset_id, HDF5_DATATYPE_NAME, H5S_ALL, H5S_ALL, plist_id, read_buf) >= 0),
+                 "Dataset read succeeded");
+
+            for (j = 0; j < read_buf_size / sizeof(*read_buf); j++)
+                if (read_buf[j] != (C_DATATYPE)(j * (i + 1))) {
+                    VRFY(FALSE, "Data verification succeeded");
+                    break;
+                }
+
+            VRFY((H5Dget_num_chunks(dset_id, H5S_ALL, &nchunks) >= 0), "Chunk count retrieval succeeded");
+            VRFY((nchunks == (hsize_t)FILTER_MASK_CHANGE_NCHUNKS), "Chunk count verification succeeded");
+
+            for (j = 0; j < (size_t)nchunks; j++) {
+                unsigned filter_mask = 0;
+
+                VRFY((H5Dget_chunk_info(dset_id, H5S_ALL, (hsize_t)j, NULL, &filter_mask, NULL, NULL) >= 0),
+                     "Chunk info retrieval succeeded");
+                VRFY((filter_mask == expected_mask), "Filter mask verification succeeded");
+            }
+        }
+        skip_invert_filter = FALSE;
+
+        VRFY((H5Dclose(dset_id) >= 0), "Dataset close succeeded");
+        VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+        VRFY((H5Sclose(memspace) >= 0), "Memory dataspace close succeeded");
+        VRFY((H5Pclose(plist_id) >= 0), "DXPL close succeeded");
+    }
+
+    HDfree(data);
+    HDfree(read_buf);
+
+    VRFY((H5Fclose(file_id) >= 0), "File close succeeded");
+    VRFY((H5Zunregister(FILTER_MASK_CHANGE_FILTER_ID) >= 0), "Filter unregistration succeeded");
+
+    return;
+}
 #endif
 
 int
@@ -383,4 +383,34 @@ typedef struct {
 #define SHRINKING_GROWING_CHUNKS_CH_NCOLS     (SHRINKING_GROWING_CHUNKS_NCOLS / mpi_size)
 #define SHRINKING_GROWING_CHUNKS_NLOOPS       20
 
+/* Defines for the many shared chunks test */
+#define MANY_SHARED_CHUNKS_DATASET_NAME "many_shared_chunks_test"
+#define MANY_SHARED_CHUNKS_DATASET_DIMS 2
+#define MANY_SHARED_CHUNKS_CH_NROWS     (mpi_size) /* Every rank writes one row of every chunk */
+#define MANY_SHARED_CHUNKS_CH_NCOLS     16
+#define MANY_SHARED_CHUNKS_NROWS        (MANY_SHARED_CHUNKS_CH_NROWS * 16)
+#define MANY_SHARED_CHUNKS_NCOLS        (MANY_SHARED_CHUNKS_CH_NCOLS * 16)
+#define MANY_SHARED_CHUNKS_NLOOPS       3
+
+/* Defines for the unbalanced filter load test */
+#define UNBALANCED_FILTER_LOAD_DATASET_NAME "unbalanced_filter_load_test"
+#define UNBALANCED_FILTER_LOAD_DATASET_DIMS 2
+#define UNBALANCED_FILTER_LOAD_CH_NROWS     8
+#define UNBALANCED_FILTER_LOAD_CH_NCOLS     64
+#define UNBALANCED_FILTER_LOAD_NCHUNKS      (mpi_size * 8)
+#define UNBALANCED_FILTER_LOAD_NROWS        (UNBALANCED_FILTER_LOAD_NCHUNKS * UNBALANCED_FILTER_LOAD_CH_NROWS)
+#define UNBALANCED_FILTER_LOAD_NCOLS        (UNBALANCED_FILTER_LOAD_CH_NCOLS)
+#define UNBALANCED_FILTER_LOAD_NLOOPS       3
+
+/* Defines for the filter mask change test */
+#define FILTER_MASK_CHANGE_DATASET_NAME "filter_mask_change_test"
+#define FILTER_MASK_CHANGE_DATASET_DIMS 2
+#define FILTER_MASK_CHANGE_CH_NROWS     8
+#define FILTER_MASK_CHANGE_CH_NCOLS     64
+#define FILTER_MASK_CHANGE_NCHUNKS      (mpi_size * 4)
+#define FILTER_MASK_CHANGE_NROWS        (FILTER_MASK_CHANGE_NCHUNKS * FILTER_MASK_CHANGE_CH_NROWS)
+#define FILTER_MASK_CHANGE_NCOLS        (FILTER_MASK_CHANGE_CH_NCOLS)
+#define FILTER_MASK_CHANGE_NLOOPS       3
+#define FILTER_MASK_CHANGE_FILTER_ID    312 /* Optional filter skipped on every other write */
+
 #endif /* TEST_PARALLEL_FILTERS_H_ */
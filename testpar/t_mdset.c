@@ -846,6 +846,120 @@ dataset_fillvalue(void)
     HDfree(wdata);
 }
 
+/* Example of using PHDF5 to create a contiguous dataset with a fill value.
+ * The dataset is large enough for the fill value to be written in several
+ * pieces, which are spread round-robin across the processes.  Every process
+ * then reads back the entire dataset and verifies it holds the fill value.
+ */
+void
+dataset_fillvalue_contig(void)
+{
+    int         mpi_size, mpi_rank;   /* MPI info */
+    int         err_num;              /* Number of errors */
+    hid_t       iof;                  /* File ID */
+    hid_t       fapl;                 /* File access property list ID */
+    hid_t       dcpl;                 /* Dataset creation property list ID */
+    hid_t       dxpl;                 /* Data transfer property list ID */
+    hid_t       dataset;              /* Dataset ID */
+    hid_t       filespace;            /* Dataset's dataspace ID */
+    hsize_t     dset_dims[1];         /* Dataset dimensions */
+    int         fillval = 0x2a2a2a2a; /* Fill value */
+    int *       rdata;                /* Buffer for data to read */
+    size_t      nelmts;               /* Number of elements in the dataset */
+    size_t      u;                    /* Local index variable */
+    int         ii;                   /* Local index variable */
+    herr_t      ret;                  /* Generic return value */
+    const char *filename;             /* Name of the test file */
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    filename = GetTestParameters();
+
+    /* Fill values are written in pieces of the default temporary buffer
+     * size (1 MiB).  Use two pieces per process, plus a partial one, so
+     * every process writes more than one piece.
+     */
+    nelmts       = (size_t)(2 * mpi_size + 1) * ((1024 * 1024) / sizeof(int)) + 100;
+    dset_dims[0] = (hsize_t)nelmts;
+
+    rdata = HDmalloc(nelmts * sizeof(int));
+    VRFY((rdata != NULL), "HDmalloc succeeded for read buffer");
+
+    fapl = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl >= 0), "create_faccess_plist succeeded");
+
+    iof = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((iof >= 0), "H5Fcreate succeeded");
+
+    filespace = H5Screate_simple(1, dset_dims, NULL);
+    VRFY((filespace >= 0), "File H5Screate_simple succeeded");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_layout(dcpl, H5D_CONTIGUOUS);
+    VRFY((ret >= 0), "H5Pset_layout succeeded");
+    ret = H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fillval);
+    VRFY((ret >= 0), "H5Pset_fill_value succeeded");
+    ret = H5Pset_fill_time(dcpl, H5D_FILL_TIME_ALLOC);
+    VRFY((ret >= 0), "H5Pset_fill_time succeeded");
+
+    /* Creating the dataset allocates its storage and writes the fill value */
+    dataset = H5Dcreate2(iof, "dataset", H5T_NATIVE_INT, filespace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dataset >= 0), "H5Dcreate2 succeeded");
+
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+
+    for (ii = 0; ii < 2; ii++) {
+        if (ii == 0)
+            ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_INDEPENDENT);
+        else
+            ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+        VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+        /* set entire read buffer with the constant 2 */
+        HDmemset(rdata, 2, nelmts * sizeof(int));
+
+        /* Read the entire dataset back */
+        ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rdata);
+        VRFY((ret >= 0), "H5Dread succeeded");
+
+        /* Verify all data read are the fill value, whichever process wrote them */
+        err_num = 0;
+        for (u = 0; u < nelmts; u++)
+            if (rdata[u] != fillval)
+                if (err_num++ < MAX_ERR_REPORT || VERBOSE_MED)
+                    HDprintf("Dataset Verify failed at [%lu]: expect %d, got %d\n", (unsigned long)u,
+                             fillval, rdata[u]);
+        if (err_num > MAX_ERR_REPORT && !VERBOSE_MED)
+            HDprintf("[more errors ...]\n");
+        if (err_num) {
+            HDprintf("%d errors found in check_value\n", err_num);
+            nerrors++;
+        }
+    }
+
+    /* Close all file objects */
+    ret = H5Dclose(dataset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Sclose(filespace);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Fclose(iof);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Close property lists */
+    ret = H5Pclose(dxpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(dcpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(fapl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* free the buffer */
+    HDfree(rdata);
+}
+
 /* combined cngrpw and ingrpr tests because ingrpr reads file created by cngrpw. */
 void
 collective_group_write_independent_group_read(void)
@@ -0,0 +1,563 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Tests for the subfiling driver: every rank writes part of a few datasets
+ * (independently and collectively) into a file striped over several
+ * subfiles, the file is read back in parallel and by a single rank, and
+ * h5fuse (when it can be found next to this program) is checked to turn
+ * it into a regular HDF5 file.  A larger file is written and read with
+ * contiguous collective transfers, and the time taken is reported.
+ */
+
+#include "testpar.h"
+
+#define SUBF_FILENAME    "t_subfiling"
+#define SUBF_FUSED       "t_subfiling_fused"
+#define SUBF_STRIPE_SIZE 1024 /* Small, so that every dataset spans many stripes */
+#define SUBF_ROWS        37   /* Rows per rank */
+#define SUBF_COLS        50
+#define SUBF_CHUNK_ROWS  10
+
+#define SUBF_LARGE_FILENAME     "t_subfiling_large"
+#define SUBF_LARGE_STRIPE_SIZE  (64 * 1024)
+#define SUBF_LARGE_STRIPE_COUNT 3
+#define SUBF_LARGE_ELMTS        (1024 * 1024) /* Elements per rank: 4 MiB of ints */
+
+int nerrors = 0;
+
+static int   mpi_rank;
+static int   mpi_size;
+static char *test_argv0 = NULL;
+
+#define SUBF_VALUE(R, C) ((int)((R)*1000 + (C)))
+
+/*-------------------------------------------------------------------------
+ * Function:    write_file
+ *
+ * Purpose:     Creates NAME with STRIPE_COUNT subfiles and writes three
+ *              datasets: "indep" (each rank writes its block of rows
+ *              independently), "coll" (each rank writes every
+ *              mpi_size-th row collectively, so that the file datatype
+ *              is strided) and "chunked" (blocks of rows, collectively).
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+write_file(const char *name, int stripe_count)
+{
+    H5FD_subfiling_fapl_t fa;
+    hsize_t               dims[2]  = {(hsize_t)(SUBF_ROWS * mpi_size), SUBF_COLS};
+    hsize_t               chunk[2] = {SUBF_CHUNK_ROWS, SUBF_COLS};
+    hsize_t               start[2], stride[2], count[2];
+    hsize_t               mdims[2] = {SUBF_ROWS, SUBF_COLS};
+    hid_t                 fapl, file, space, mspace, dset, dcpl, dxpl, attr, ascalar;
+    int *                 buf;
+    int                   r, c;
+    herr_t                ret;
+
+    buf = (int *)HDmalloc(SUBF_ROWS * SUBF_COLS * sizeof(int));
+    VRFY((buf != NULL), "HDmalloc succeeded");
+
+    fa.magic        = H5FD_SUBFILING_FAPL_MAGIC;
+    fa.version      = H5FD_SUBFILING_CURR_FAPL_VERSION;
+    fa.stripe_size  = SUBF_STRIPE_SIZE;
+    fa.stripe_count = stripe_count;
+
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fapl_subfiling(fapl, MPI_COMM_WORLD, MPI_INFO_NULL, &fa);
+    VRFY((ret >= 0), "H5Pset_fapl_subfiling succeeded");
+
+    file = H5Fcreate(name, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((file >= 0), "H5Fcreate succeeded");
+
+    space = H5Screate_simple(2, dims, NULL);
+    VRFY((space >= 0), "H5Screate_simple succeeded");
+    mspace = H5Screate_simple(2, mdims, NULL);
+    VRFY((mspace >= 0), "H5Screate_simple succeeded");
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+
+    /* Independent: this rank's block of rows */
+    for (r = 0; r < SUBF_ROWS; r++)
+        for (c = 0; c < SUBF_COLS; c++)
+            buf[r * SUBF_COLS + c] = SUBF_VALUE(mpi_rank * SUBF_ROWS + r, c);
+    dset = H5Dcreate2(file, "indep", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    start[0] = (hsize_t)(mpi_rank * SUBF_ROWS);
+    start[1] = 0;
+    ret      = H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, mdims, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_INDEPENDENT);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    ret = H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, dxpl, buf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Dclose(dset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+
+    /* Collective: every mpi_size-th row, starting at this rank */
+    for (r = 0; r < SUBF_ROWS; r++)
+        for (c = 0; c < SUBF_COLS; c++)
+            buf[r * SUBF_COLS + c] = SUBF_VALUE(r * mpi_size + mpi_rank, c);
+    dset = H5Dcreate2(file, "coll", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    start[0]  = (hsize_t)mpi_rank;
+    stride[0] = (hsize_t)mpi_size;
+    stride[1] = 1;
+    count[0]  = SUBF_ROWS;
+    count[1]  = SUBF_COLS;
+    ret       = H5Sselect_hyperslab(space, H5S_SELECT_SET, start, stride, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    ret = H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, dxpl, buf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Dclose(dset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+
+    /* Chunked, collective: this rank's block of rows again */
+    for (r = 0; r < SUBF_ROWS; r++)
+        for (c = 0; c < SUBF_COLS; c++)
+            buf[r * SUBF_COLS + c] = SUBF_VALUE(mpi_rank * SUBF_ROWS + r, c);
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_chunk(dcpl, 2, chunk);
+    VRFY((ret >= 0), "H5Pset_chunk succeeded");
+    dset = H5Dcreate2(file, "chunked", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    start[0] = (hsize_t)(mpi_rank * SUBF_ROWS);
+    ret      = H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, mdims, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    ret = H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, dxpl, buf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Dclose(dset);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+
+    /* Some metadata too */
+    ascalar = H5Screate(H5S_SCALAR);
+    VRFY((ascalar >= 0), "H5Screate succeeded");
+    attr = H5Acreate2(file, "nprocs", H5T_NATIVE_INT, ascalar, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((attr >= 0), "H5Acreate2 succeeded");
+    ret = H5Awrite(attr, H5T_NATIVE_INT, &mpi_size);
+    VRFY((ret >= 0), "H5Awrite succeeded");
+    ret = H5Aclose(attr);
+    VRFY((ret >= 0), "H5Aclose succeeded");
+    H5Sclose(ascalar);
+
+    H5Pclose(dcpl);
+    H5Pclose(dxpl);
+    H5Sclose(mspace);
+    H5Sclose(space);
+    ret = H5Fclose(file);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    H5Pclose(fapl);
+    HDfree(buf);
+} /* end write_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    verify_file
+ *
+ * Purpose:     Opens NAME with FAPL and checks everything write_file()
+ *              wrote, reading the datasets whole with transfer mode
+ *              XFER_MODE.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+verify_file(const char *name, hid_t fapl, H5FD_mpio_xfer_t xfer_mode, int rank)
+{
+    const char *dsets[] = {"indep", "coll", "chunked"};
+    hid_t       file, dset, dxpl, attr;
+    int *       buf;
+    int         nrows = SUBF_ROWS * mpi_size;
+    int         nprocs = 0;
+    int         r, c;
+    size_t      u;
+    herr_t      ret;
+
+    buf = (int *)HDmalloc((size_t)(nrows * SUBF_COLS) * sizeof(int));
+    VRFY_IMPL((buf != NULL), "HDmalloc succeeded", rank);
+
+    file = H5Fopen(name, H5F_ACC_RDONLY, fapl);
+    VRFY_IMPL((file >= 0), "H5Fopen succeeded", rank);
+
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY_IMPL((dxpl >= 0), "H5Pcreate succeeded", rank);
+    if (H5P_DEFAULT != fapl && H5FD_SUBFILING == H5Pget_driver(fapl)) {
+        ret = H5Pset_dxpl_mpio(dxpl, xfer_mode);
+        VRFY_IMPL((ret >= 0), "H5Pset_dxpl_mpio succeeded", rank);
+    }
+
+    for (u = 0; u < NELMTS(dsets); u++) {
+        dset = H5Dopen2(file, dsets[u], H5P_DEFAULT);
+        VRFY_IMPL((dset >= 0), "H5Dopen2 succeeded", rank);
+        HDmemset(buf, 0, (size_t)(nrows * SUBF_COLS) * sizeof(int));
+        ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, buf);
+        VRFY_IMPL((ret >= 0), "H5Dread succeeded", rank);
+        for (r = 0; r < nrows; r++)
+            for (c = 0; c < SUBF_COLS; c++)
+                if (buf[r * SUBF_COLS + c] != SUBF_VALUE(r, c)) {
+                    HDprintf("Proc %d: %s[%d][%d] = %d, expected %d\n", rank, dsets[u], r, c,
+                             buf[r * SUBF_COLS + c], SUBF_VALUE(r, c));
+                    VRFY_IMPL((FALSE), "dataset values are correct", rank);
+                    r = nrows;
+                    break;
+                }
+        ret = H5Dclose(dset);
+        VRFY_IMPL((ret >= 0), "H5Dclose succeeded", rank);
+    }
+
+    attr = H5Aopen(file, "nprocs", H5P_DEFAULT);
+    VRFY_IMPL((attr >= 0), "H5Aopen succeeded", rank);
+    ret = H5Aread(attr, H5T_NATIVE_INT, &nprocs);
+    VRFY_IMPL((ret >= 0 && nprocs == mpi_size), "attribute value is correct", rank);
+    H5Aclose(attr);
+
+    H5Pclose(dxpl);
+    ret = H5Fclose(file);
+    VRFY_IMPL((ret >= 0), "H5Fclose succeeded", rank);
+    HDfree(buf);
+} /* end verify_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_subfiling
+ *
+ * Purpose:     Writes and checks a file with STRIPE_COUNT subfiles (0 for
+ *              one per node).  The file is left for test_h5fuse().
+ *
+ * Return:      The number of subfiles
+ *-------------------------------------------------------------------------
+ */
+static int
+test_subfiling(int stripe_count)
+{
+    H5FD_subfiling_fapl_t fa;
+    char                  name[1024];
+    hid_t                 fapl, file, acc;
+    int                   expect_count = stripe_count;
+    herr_t                ret;
+
+    h5_fixname(SUBF_FILENAME, H5P_DEFAULT, name, sizeof(name));
+
+    if (0 == expect_count) {
+        /* One subfile per node */
+        MPI_Comm node_comm;
+        int      node_rank, leader;
+
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+        MPI_Comm_rank(node_comm, &node_rank);
+        MPI_Comm_free(&node_comm);
+        leader = (0 == node_rank);
+        MPI_Allreduce(&leader, &expect_count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    }
+
+    write_file(name, stripe_count);
+
+    /* Reopen in parallel; the layout comes from the configuration record */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fapl_subfiling(fapl, MPI_COMM_WORLD, MPI_INFO_NULL, NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_subfiling succeeded");
+    verify_file(name, fapl, H5FD_MPIO_COLLECTIVE, mpi_rank);
+    verify_file(name, fapl, H5FD_MPIO_INDEPENDENT, mpi_rank);
+
+    file = H5Fopen(name, H5F_ACC_RDONLY, fapl);
+    VRFY((file >= 0), "H5Fopen succeeded");
+    acc = H5Fget_access_plist(file);
+    VRFY((acc >= 0), "H5Fget_access_plist succeeded");
+    HDmemset(&fa, 0, sizeof(fa));
+    ret = H5Pget_fapl_subfiling(acc, NULL, NULL, &fa);
+    VRFY((ret >= 0), "H5Pget_fapl_subfiling succeeded");
+    VRFY((fa.stripe_size == SUBF_STRIPE_SIZE && fa.stripe_count == expect_count), "layout is reported");
+    H5Pclose(acc);
+    ret = H5Fclose(file);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    H5Pclose(fapl);
+
+    /* Creating it again exclusively must fail on every rank */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fapl_subfiling(fapl, MPI_COMM_WORLD, MPI_INFO_NULL, NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_subfiling succeeded");
+    H5E_BEGIN_TRY
+    {
+        file = H5Fcreate(name, H5F_ACC_EXCL, H5P_DEFAULT, fapl);
+    }
+    H5E_END_TRY;
+    VRFY((file < 0), "H5Fcreate with H5F_ACC_EXCL failed");
+    H5Pclose(fapl);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    if (MAINPROCESS) {
+        char subfile[1100];
+        int  i;
+
+        /* The subfiles are where the configuration record says */
+        for (i = 0; i < expect_count; i++) {
+            HDsnprintf(subfile, sizeof(subfile), H5FD_SUBFILING_NAME_FORMAT, name, i, expect_count);
+            VRFY((0 == HDaccess(subfile, F_OK)), "subfile exists");
+        }
+
+        /* A serial open needs nothing but the record and the subfiles */
+        fapl = H5Pcreate(H5P_FILE_ACCESS);
+        VRFY((fapl >= 0), "H5Pcreate succeeded");
+        ret = H5Pset_fapl_subfiling(fapl, MPI_COMM_SELF, MPI_INFO_NULL, NULL);
+        VRFY((ret >= 0), "H5Pset_fapl_subfiling succeeded");
+        verify_file(name, fapl, H5FD_MPIO_INDEPENDENT, mpi_rank);
+        H5Pclose(fapl);
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    return expect_count;
+} /* end test_subfiling() */
+
+/*-------------------------------------------------------------------------
+ * Function:    remove_subfiled
+ *
+ * Purpose:     Removes the file NAME and its SUBFILE_COUNT subfiles.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+remove_subfiled(const char *name, int subfile_count)
+{
+    char subfile[1100];
+    int  i;
+
+    if (MAINPROCESS) {
+        for (i = 0; i < subfile_count; i++) {
+            HDsnprintf(subfile, sizeof(subfile), H5FD_SUBFILING_NAME_FORMAT, name, i, subfile_count);
+            HDremove(subfile);
+        }
+        HDremove(name);
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+} /* end remove_subfiled() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_h5fuse
+ *
+ * Purpose:     Fuses the file left by test_subfiling() with the h5fuse
+ *              program next to this one and reads the result with the
+ *              default driver.
+ *
+ * Return:      TRUE if h5fuse was found, FALSE if the check was skipped
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+test_h5fuse(void)
+{
+    char        name[1024];
+    char        fused[1024];
+    char        cmd[4096];
+    const char *slash;
+    int         found = 0;
+
+    h5_fixname(SUBF_FILENAME, H5P_DEFAULT, name, sizeof(name));
+    h5_fixname(SUBF_FUSED, H5P_DEFAULT, fused, sizeof(fused));
+
+    if (MAINPROCESS) {
+        slash = HDstrrchr(test_argv0, '/');
+        HDsnprintf(cmd, sizeof(cmd), "%.*sh5fuse", slash ? (int)(slash - test_argv0 + 1) : 0, test_argv0);
+        if (0 == HDaccess(cmd, X_OK)) {
+            found = 1;
+            HDsnprintf(cmd + HDstrlen(cmd), sizeof(cmd) - HDstrlen(cmd), " %s %s", name, fused);
+            VRFY((0 == HDsystem(cmd)), "h5fuse succeeded");
+            verify_file(fused, H5P_DEFAULT, H5FD_MPIO_INDEPENDENT, mpi_rank);
+            HDremove(fused);
+        }
+    }
+
+    MPI_Bcast(&found, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    return (hbool_t)found;
+} /* end test_h5fuse() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_large_xfer
+ *
+ * Purpose:     Writes and reads a dataset large enough for the transfer
+ *              rate to be measured, collectively, where the library passes
+ *              contiguous selections down as runs of MPI_BYTE.  Each rank
+ *              writes its own contiguous block and then reads the whole
+ *              dataset with H5S_ALL.  The times taken are returned in
+ *              T_WRITE and T_READ.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+test_large_xfer(double *t_write, double *t_read)
+{
+    H5FD_subfiling_fapl_t fa;
+    char                  name[1024];
+    hsize_t               dims[1]  = {(hsize_t)SUBF_LARGE_ELMTS * (hsize_t)mpi_size};
+    hsize_t               mdims[1] = {SUBF_LARGE_ELMTS};
+    hsize_t               start[1];
+    hid_t                 fapl, file, space, mspace, dset, dxpl;
+    size_t                u;
+    int *                 buf;
+    herr_t                ret;
+
+    h5_fixname(SUBF_LARGE_FILENAME, H5P_DEFAULT, name, sizeof(name));
+
+    buf = (int *)HDmalloc((size_t)dims[0] * sizeof(int));
+    VRFY((buf != NULL), "HDmalloc succeeded");
+
+    fa.magic        = H5FD_SUBFILING_FAPL_MAGIC;
+    fa.version      = H5FD_SUBFILING_CURR_FAPL_VERSION;
+    fa.stripe_size  = SUBF_LARGE_STRIPE_SIZE;
+    fa.stripe_count = SUBF_LARGE_STRIPE_COUNT;
+
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fapl_subfiling(fapl, MPI_COMM_WORLD, MPI_INFO_NULL, &fa);
+    VRFY((ret >= 0), "H5Pset_fapl_subfiling succeeded");
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    file = H5Fcreate(name, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((file >= 0), "H5Fcreate succeeded");
+    space = H5Screate_simple(1, dims, NULL);
+    VRFY((space >= 0), "H5Screate_simple succeeded");
+    mspace = H5Screate_simple(1, mdims, NULL);
+    VRFY((mspace >= 0), "H5Screate_simple succeeded");
+    dset = H5Dcreate2(file, "large", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+
+    /* Each rank writes its own block */
+    for (u = 0; u < SUBF_LARGE_ELMTS; u++)
+        buf[u] = mpi_rank * SUBF_LARGE_ELMTS + (int)u;
+    start[0] = (hsize_t)mpi_rank * SUBF_LARGE_ELMTS;
+    ret      = H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, mdims, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    MPI_Barrier(MPI_COMM_WORLD);
+    *t_write = MPI_Wtime();
+    ret      = H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, dxpl, buf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    MPI_Barrier(MPI_COMM_WORLD);
+    *t_write = MPI_Wtime() - *t_write;
+
+    /* Every rank reads the whole dataset */
+    HDmemset(buf, 0, (size_t)dims[0] * sizeof(int));
+    *t_read = MPI_Wtime();
+    ret     = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, buf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    MPI_Barrier(MPI_COMM_WORLD);
+    *t_read = MPI_Wtime() - *t_read;
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (buf[u] != (int)u) {
+            HDprintf("Proc %d: large[%zu] = %d, expected %d\n", mpi_rank, u, buf[u], (int)u);
+            VRFY((FALSE), "dataset values are correct");
+            break;
+        }
+
+    H5Dclose(dset);
+    H5Sclose(mspace);
+    H5Sclose(space);
+    ret = H5Fclose(file);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    H5Pclose(dxpl);
+    H5Pclose(fapl);
+    HDfree(buf);
+
+    remove_subfiled(name, SUBF_LARGE_STRIPE_COUNT);
+} /* end test_large_xfer() */
+
+int
+main(int argc, char **argv)
+{
+    int    stripe_counts[] = {3, 0}; /* 0 for one subfile per node */
+    char   name[1024];
+    char   desc[256];
+    int    subfile_count;
+    int    nerrors_before;
+    double t_write, t_read;
+    size_t u;
+
+    test_argv0 = HDstrdup(argv[0]);
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    H5open();
+
+    h5_fixname(SUBF_FILENAME, H5P_DEFAULT, name, sizeof(name));
+
+    for (u = 0; u < NELMTS(stripe_counts); u++) {
+        if (MAINPROCESS) {
+            if (stripe_counts[u] > 0)
+                HDsnprintf(desc, sizeof(desc), "subfiling driver with %d subfiles", stripe_counts[u]);
+            else
+                HDsnprintf(desc, sizeof(desc), "subfiling driver with one subfile per node");
+            TESTING(desc);
+        }
+        nerrors_before = nerrors;
+        subfile_count  = test_subfiling(stripe_counts[u]);
+        if (MAINPROCESS) {
+            if (nerrors == nerrors_before)
+                PASSED();
+            else
+                H5_FAILED()
+        }
+
+        if (MAINPROCESS)
+            TESTING("fusing the subfiles with h5fuse");
+        nerrors_before = nerrors;
+        if (!test_h5fuse()) {
+            if (MAINPROCESS) {
+                SKIPPED();
+                HDprintf("    h5fuse not found next to %s\n", test_argv0);
+            }
+        }
+        else if (MAINPROCESS) {
+            if (nerrors == nerrors_before)
+                PASSED();
+            else
+                H5_FAILED()
+        }
+
+        remove_subfiled(name, subfile_count);
+    }
+
+    if (MAINPROCESS)
+        TESTING("large contiguous collective transfers");
+    nerrors_before = nerrors;
+    test_large_xfer(&t_write, &t_read);
+    if (MAINPROCESS) {
+        if (nerrors == nerrors_before) {
+            PASSED();
+            HDprintf("    wrote %d MiB in %.3f s, read %d MiB per rank in %.3f s\n",
+                     (int)(SUBF_LARGE_ELMTS * sizeof(int) / (1024 * 1024)) * mpi_size, t_write,
+                     (int)(SUBF_LARGE_ELMTS * sizeof(int) / (1024 * 1024)) * mpi_size, t_read);
+        }
+        else
+            H5_FAILED()
+    }
+
+    HDfree(test_argv0);
+    H5close();
+
+    MPI_Finalize();
+
+    return (nerrors != 0);
+}
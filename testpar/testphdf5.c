@@ -353,6 +353,8 @@ main(int argc, char **argv)
 
     AddTest("props", test_file_properties, NULL, "Coll Metadata file property settings", PARATESTFILE);
 
+    AddTest("aggindep", test_aggregated_indep_write, NULL, "aggregated independent writes", PARATESTFILE);
+
     AddTest("idsetw", dataset_writeInd, NULL, "dataset independent write", PARATESTFILE);
     AddTest("idsetr", dataset_readInd, NULL, "dataset independent read", PARATESTFILE);
 
@@ -398,6 +400,8 @@ main(int argc, char **argv)
     HDprintf("big dataset test will be skipped on Windows (JIRA HDDFV-8064)\n");
 #endif
     AddTest("fill", dataset_fillvalue, NULL, "dataset fill value", PARATESTFILE);
+    AddTest("cfill", dataset_fillvalue_contig, NULL, "contiguous dataset fill value across processes",
+            PARATESTFILE);
 
     AddTest("cchunk1", coll_chunk1, NULL, "simple collective chunk io", PARATESTFILE);
     AddTest("cchunk2", coll_chunk2, NULL, "noncontiguous collective chunk io", PARATESTFILE);
@@ -465,6 +469,15 @@ main(int argc, char **argv)
     AddTest("nocolcause", no_collective_cause_tests, NULL, "test cause for broken collective io",
             PARATESTFILE);
 
+    if ((mpi_size < 2) && MAINPROCESS) {
+        HDprintf("MPI datatype cache test needs at least 2 processes.\n");
+        HDprintf("MPI datatype cache test will be skipped \n");
+    }
+    AddTest((mpi_size < 2) ? "-typecache" : "typecache", mpio_type_cache_test, NULL,
+            "test MPI datatype cache for selections", PARATESTFILE);
+    AddTest("arenaalloc", mpio_arena_alloc_test, NULL, "independent chunk allocation from raw data arenas",
+            PARATESTFILE);
+
     AddTest("edpl", test_plist_ed, NULL, "encode/decode Property Lists", NULL);
 
     AddTest("extlink", external_links, NULL, "test external links", NULL);
@@ -495,6 +508,8 @@ main(int argc, char **argv)
             "Collective MD read with multi chunk I/O (H5D__chunk_addrmap)", PARATESTFILE);
     AddTest("LC_coll_MD_read", test_link_chunk_io_sort_chunk_issue, NULL,
             "Collective MD read with link chunk I/O (H5D__sort_chunk)", PARATESTFILE);
+    AddTest("bulkcollmdread", test_bulk_coll_md_read_open, NULL,
+            "Bulk collective MD read when opening objects by name", PARATESTFILE);
 
     /* Display testing information */
     TestInfo(argv[0]);
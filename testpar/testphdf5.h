@@ -247,6 +247,7 @@ void independent_group_read(void);
 void test_fapl_mpio_dup(void);
 void test_split_comm_access(void);
 void test_page_buffer_access(void);
+void test_aggregated_indep_write(void);
 void dataset_atomicity(void);
 void dataset_writeInd(void);
 void dataset_writeAll(void);
@@ -260,12 +261,15 @@ void extend_readAll(void);
 void none_selection_chunk(void);
 void actual_io_mode_tests(void);
 void no_collective_cause_tests(void);
+void mpio_type_cache_test(void);
+void mpio_arena_alloc_test(void);
 void test_chunk_alloc(void);
 void test_filter_read(void);
 void compact_dataset(void);
 void null_dataset(void);
 void big_dataset(void);
 void dataset_fillvalue(void);
+void dataset_fillvalue_contig(void);
 void coll_chunk1(void);
 void coll_chunk2(void);
 void coll_chunk3(void);
@@ -299,6 +303,7 @@ void test_dense_attr(void);
 void test_partial_no_selection_coll_md_read(void);
 void test_multi_chunk_io_addrmap_issue(void);
 void test_link_chunk_io_sort_chunk_issue(void);
+void test_bulk_coll_md_read_open(void);
 
 /* commonly used prototypes */
 hid_t      create_faccess_plist(MPI_Comm comm, MPI_Info info, int l_facc_type);
@@ -42,6 +42,10 @@ static int  get_hyperslab(hid_t dcpl_id, int rank_dset, hsize_t dims_dset[], siz
 static void print_dataset_info(hid_t dcpl_id, char *objname, double per, int pr);
 static int  do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *options);
 static int  copy_user_block(const char *infile, const char *outfile, hsize_t size);
+#ifdef H5_HAVE_PARALLEL
+static int  copy_hyperslabs_par(hid_t dset_in, hid_t dset_out, hid_t wtype_id, hid_t dcpl_tmp,
+                                hid_t f_space_id, int rank, hsize_t dims[], size_t msize);
+#endif
 #if defined(H5REPACK_DEBUG_USER_BLOCK)
 static void print_user_block(const char *filename, hid_t fid);
 #endif
@@ -75,7 +79,8 @@ copy_objects(const char *fnamein, const char *fnameout, pack_opt_t *options)
     hsize_t               in_threshold;    /* Free-space section threshold from input file */
     hsize_t               in_pagesize;     /* File space page size from input file */
     unsigned              crt_order_flags; /* group creation order flag */
-    int                   ret_value = 0;
+    hbool_t               ublock_writer = TRUE; /* this process writes the user block */
+    int                   ret_value     = 0;
 
     /*-------------------------------------------------------------------------
      * open input file
@@ -117,9 +122,26 @@ copy_objects(const char *fnamein, const char *fnameout, pack_opt_t *options)
             H5TOOLS_GOTO_ERROR((-1), "H5Pclose failed to close property list");
     }
 
+#ifdef H5_HAVE_PARALLEL
+    /* only one process writes the user block of a file created in parallel */
+    if (g_Parallel) {
+        int mpi_rank;
+
+        MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+        ublock_writer = (mpi_rank == 0);
+    }
+#endif
+
     if (options->latest)
         options->low_bound = options->high_bound = H5F_LIBVER_LATEST;
 
+#ifdef H5_HAVE_PARALLEL
+    /* In parallel the output file is always written with the MPI-IO driver,
+     * which would replace the file access the user chose */
+    if (g_Parallel && options->fout_fapl != H5P_DEFAULT)
+        H5TOOLS_GOTO_ERROR((-1), "the output file VOL connector can't be set with more than one process");
+#endif
+
     /* Create file access property list */
     if (options->fout_fapl == H5P_DEFAULT)
         if ((options->fout_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
@@ -129,6 +151,17 @@ copy_objects(const char *fnamein, const char *fnameout, pack_opt_t *options)
     if (H5Pset_libver_bounds(options->fout_fapl, options->low_bound, options->high_bound) < 0)
         H5TOOLS_GOTO_ERROR((-1), "H5Pset_libver_bounds failed to set format version bounds");
 
+#ifdef H5_HAVE_PARALLEL
+    /* In parallel, all processes create and write the output file together;
+     * the input file is read by each of them on its own */
+    if (g_Parallel) {
+        if (H5Pset_fapl_mpio(options->fout_fapl, MPI_COMM_WORLD, MPI_INFO_NULL) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pset_fapl_mpio failed");
+        if (H5Pset_coll_metadata_write(options->fout_fapl, TRUE) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pset_coll_metadata_write failed");
+    }
+#endif
+
     /* Check if we need to create a non-default file creation property list */
     if (options->low_bound >= H5F_LIBVER_V18 || ub_size > 0) {
         /* Create file creation property list */
@@ -308,7 +341,7 @@ copy_objects(const char *fnamein, const char *fnameout, pack_opt_t *options)
      * write a new user block if requested
      *-------------------------------------------------------------------------
      */
-    if (options->ublock_size > 0)
+    if (options->ublock_size > 0 && ublock_writer)
         if (copy_user_block(options->ublock_filename, fnameout, options->ublock_size) < 0)
             H5TOOLS_GOTO_ERROR((-1), "Could not copy user block. Exiting...");
 
@@ -350,7 +383,7 @@ copy_objects(const char *fnamein, const char *fnameout, pack_opt_t *options)
      *-------------------------------------------------------------------------
      */
 
-    if (ub_size > 0 && options->ublock_size == 0)
+    if (ub_size > 0 && options->ublock_size == 0 && ublock_writer)
         if (copy_user_block(fnamein, fnameout, ub_size) < 0)
             H5TOOLS_GOTO_ERROR((-1), "Could not copy user block. Exiting...");
 
@@ -529,6 +562,161 @@ done:
     return ret_value;
 } /* end get_hyperslab() */
 
+#ifdef H5_HAVE_PARALLEL
+/*-------------------------------------------------------------------------
+ * Function: copy_hyperslabs_par
+ *
+ * Purpose: Copy the raw data of a dataset with all the processes of a
+ *          parallel repack. The dataset is cut in the hyperslabs given by
+ *          get_hyperslab(), which are dealt out round-robin: in round r,
+ *          process p copies hyperslab (r * g_nTasks + p). Each process reads
+ *          its hyperslab from the input file on its own and all of them
+ *          write the round collectively, so the chunks of filtered datasets
+ *          are compressed in parallel and allocated in the same order on
+ *          every run.
+ *
+ *          When there are fewer hyperslabs than processes, the hyperslabs
+ *          are shrunk (in whole chunks) starting from the first dimension
+ *          so that every process gets some of the work.
+ *
+ * Return:  0 - SUCCEED, -1 FAILED
+ *
+ * Parameters:
+ *   dset_in : [IN] dataset to read from.
+ *   dset_out : [IN] dataset to write to.
+ *   wtype_id : [IN] memory type used for the copy.
+ *   dcpl_tmp : [IN] creation property list the hyperslabs are aligned to.
+ *   f_space_id : [IN] file dataspace of the dataset.
+ *   rank : [IN] dataset rank.
+ *   dims[] : [IN] dataset dimensions.
+ *   msize : [IN] size of a data element in byte.
+ *-------------------------------------------------------------------------
+ */
+static int
+copy_hyperslabs_par(hid_t dset_in, hid_t dset_out, hid_t wtype_id, hid_t dcpl_tmp, hid_t f_space_id,
+                    int rank, hsize_t dims[], size_t msize)
+{
+    hid_t   dxpl_id     = H5I_INVALID_HID; /* collective transfer property list */
+    hid_t   hslab_space = H5I_INVALID_HID; /* hyperslab data space */
+    void *  hslab_buf   = NULL;            /* hyperslab buffer for raw data */
+    hsize_t hslab_dims[H5S_MAX_RANK];      /* hyperslab dims */
+    hsize_t hslab_nbytes;                  /* bytes per hyperslab */
+    hsize_t hslab_nelmts;                  /* elements per hyperslab */
+    hsize_t unit_dims[H5S_MAX_RANK];       /* hyperslab dims must be a multiple of these */
+    hsize_t nslabs_dims[H5S_MAX_RANK];     /* number of hyperslabs along each dim */
+    hsize_t nslabs;                        /* total number of hyperslabs */
+    hsize_t nrounds;                       /* number of collective writes */
+    hsize_t round, slab;
+    hsize_t hs_sel_offset[H5S_MAX_RANK]; /* selection offset */
+    hsize_t hs_sel_count[H5S_MAX_RANK];  /* selection count */
+    hsize_t hs_select_nelmts;            /* selected elements */
+    hsize_t zero = 0;
+    int     mpi_rank;
+    int     k;
+    int     ret_value = 0;
+
+    /* variable-length data cannot be written in parallel */
+    if (H5Tdetect_class(wtype_id, H5T_VLEN) == TRUE)
+        H5TOOLS_GOTO_ERROR((-1), "variable-length data can not be repacked in parallel");
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    /* get hyperslab dims and size in byte */
+    if (get_hyperslab(dcpl_tmp, rank, dims, msize, hslab_dims, &hslab_nbytes) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "get_hyperslab failed");
+
+    /* the hyperslabs are only shrunk in whole chunks, and not at all
+     * when a chunk does not fit in the hyperslab buffer */
+    for (k = 0; k < rank; k++)
+        unit_dims[k] = 1;
+    if (H5Pget_layout(dcpl_tmp) == H5D_CHUNKED)
+        if (H5Pget_chunk(dcpl_tmp, rank, unit_dims) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk failed");
+
+    for (k = 0, nslabs = 1; k < rank; k++) {
+        nslabs_dims[k] = (dims[k] + hslab_dims[k] - 1) / hslab_dims[k];
+        nslabs *= nslabs_dims[k];
+    }
+    for (k = 0; k < rank && nslabs < (hsize_t)g_nTasks; k++)
+        while (nslabs < (hsize_t)g_nTasks && hslab_dims[k] > unit_dims[k]) {
+            hsize_t nunits = (hslab_dims[k] / unit_dims[k] + 1) / 2;
+
+            hslab_nbytes  = (hslab_nbytes / hslab_dims[k]) * (nunits * unit_dims[k]);
+            hslab_dims[k] = nunits * unit_dims[k];
+            nslabs /= nslabs_dims[k];
+            nslabs_dims[k] = (dims[k] + hslab_dims[k] - 1) / hslab_dims[k];
+            nslabs *= nslabs_dims[k];
+        }
+    nrounds = (nslabs + (hsize_t)g_nTasks - 1) / (hsize_t)g_nTasks;
+
+    if ((hslab_buf = HDmalloc((size_t)hslab_nbytes)) == NULL)
+        H5TOOLS_GOTO_ERROR((-1), "can't allocate space for hyperslab");
+
+    hslab_nelmts = hslab_nbytes / msize;
+    if ((hslab_space = H5Screate_simple(1, &hslab_nelmts, NULL)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Screate_simple failed");
+
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pcreate failed");
+    if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pset_dxpl_mpio failed");
+
+    /* every process takes part in every round, with an empty selection
+     * once the hyperslabs have run out */
+    for (round = 0; round < nrounds; round++) {
+        slab = round * (hsize_t)g_nTasks + (hsize_t)mpi_rank;
+
+        if (slab >= nslabs) {
+            if (H5Sselect_none(f_space_id) < 0)
+                H5TOOLS_GOTO_ERROR((-1), "H5Sselect_none failed");
+            if (H5Sselect_none(hslab_space) < 0)
+                H5TOOLS_GOTO_ERROR((-1), "H5Sselect_none failed");
+        }
+        else {
+            if (rank > 0) {
+                /* the hyperslab index counts the last dimension fastest,
+                 * as the serial selection loop walks them */
+                for (k = rank, hs_select_nelmts = 1; k > 0; --k) {
+                    hs_sel_offset[k - 1] = (slab % nslabs_dims[k - 1]) * hslab_dims[k - 1];
+                    slab /= nslabs_dims[k - 1];
+                    hs_sel_count[k - 1] = MIN(dims[k - 1] - hs_sel_offset[k - 1], hslab_dims[k - 1]);
+                    hs_select_nelmts *= hs_sel_count[k - 1];
+                }
+
+                if (H5Sselect_hyperslab(f_space_id, H5S_SELECT_SET, hs_sel_offset, NULL, hs_sel_count,
+                                        NULL) < 0)
+                    H5TOOLS_GOTO_ERROR((-1), "H5Sselect_hyperslab failed");
+                if (H5Sselect_hyperslab(hslab_space, H5S_SELECT_SET, &zero, NULL, &hs_select_nelmts,
+                                        NULL) < 0)
+                    H5TOOLS_GOTO_ERROR((-1), "H5Sselect_hyperslab failed");
+            } /* end if rank > 0 */
+            else {
+                H5Sselect_all(f_space_id);
+                H5Sselect_all(hslab_space);
+            } /* end (else) rank  == 0 */
+
+            if (H5Dread(dset_in, wtype_id, hslab_space, f_space_id, H5P_DEFAULT, hslab_buf) < 0)
+                H5TOOLS_GOTO_ERROR((-1), "H5Dread failed");
+        }
+
+        if (H5Dwrite(dset_out, wtype_id, hslab_space, f_space_id, dxpl_id, hslab_buf) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Dwrite failed");
+    } /* end for (round) */
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+        H5Sclose(hslab_space);
+    }
+    H5E_END_TRY;
+    if (hslab_buf != NULL)
+        HDfree(hslab_buf);
+
+    return ret_value;
+} /* end copy_hyperslabs_par() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function: do_copy_objects
  *
@@ -784,6 +972,13 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
                     use_h5ocopy = !(options->op_tbl->nelems || options->all_filter == 1 ||
                                     options->all_layout == 1 || is_ref || is_named);
 
+#ifdef H5_HAVE_PARALLEL
+                    /* a parallel repack copies the raw data itself, so that it can
+                     * be spread across the processes */
+                    if (g_Parallel)
+                        use_h5ocopy = FALSE;
+#endif
+
                     /*
                      * Check if we are using different source and destination VOL connectors.
                      * In this case, we currently have to avoid usage of H5Ocopy since it
@@ -963,11 +1158,20 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
                                  *-------------------------------------------------------------------------
                                  */
                                 if (nelmts > 0 && space_status != H5D_SPACE_STATUS_NOT_ALLOCATED) {
-                                    size_t need = (size_t)(nelmts * msize); /* bytes needed */
+                                    size_t  need     = (size_t)(nelmts * msize); /* bytes needed */
+                                    hbool_t par_copy = FALSE; /* copy shared by all processes */
+
+#ifdef H5_HAVE_PARALLEL
+                                    /* in parallel, only compact data (which every process has to
+                                     * write whole) is not spread across the processes */
+                                    if (g_Parallel && H5Pget_layout(apply_f ? dcpl_out : dcpl_in) !=
+                                                          H5D_COMPACT)
+                                        par_copy = TRUE;
+#endif
 
                                     /* have to read the whole dataset if there is only one element in the
                                      * dataset */
-                                    if (need < H5TOOLS_MALLOCSIZE)
+                                    if (need < H5TOOLS_MALLOCSIZE && !par_copy)
                                         buf = HDmalloc(need);
 
                                     if (buf != NULL) {
@@ -990,6 +1194,22 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
                                             buf = NULL;
                                         }
                                     }
+#ifdef H5_HAVE_PARALLEL
+                                    else if (par_copy) {
+                                        hid_t dcpl_tmp = H5I_INVALID_HID;
+
+                                        /* align the hyperslabs to the chunks of the written
+                                         * dataset, else to those of the read one */
+                                        if (apply_f && H5Pget_layout(dcpl_out) == H5D_CHUNKED)
+                                            dcpl_tmp = dcpl_out;
+                                        else if (H5Pget_layout(dcpl_in) == H5D_CHUNKED)
+                                            dcpl_tmp = dcpl_in;
+
+                                        if (copy_hyperslabs_par(dset_in, dset_out, wtype_id, dcpl_tmp,
+                                                                f_space_id, rank, dims, msize) < 0)
+                                            H5TOOLS_GOTO_ERROR((-1), "copy_hyperslabs_par failed");
+                                    }
+#endif
                                     else { /* possibly not enough memory, read/write by hyperslabs */
                                         size_t       p_type_nbytes = msize;  /*size of memory type */
                                         hsize_t      p_nelmts      = nelmts; /*total elements */
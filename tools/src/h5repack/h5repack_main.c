@@ -16,7 +16,11 @@
 #include "h5repack.h"
 
 /* Name of tool */
+#ifdef H5REPACK_PARALLEL
+#define PROGRAMNAME "ph5repack"
+#else
 #define PROGRAMNAME "h5repack"
+#endif
 
 static int  parse_command_line(int argc, const char **argv, pack_opt_t *options);
 static void leave(int ret) H5_ATTR_NORETURN;
@@ -332,6 +336,9 @@ usage(const char *prog)
 static void
 leave(int ret)
 {
+#ifdef H5REPACK_PARALLEL
+    MPI_Finalize();
+#endif
     h5tools_close();
     HDexit(ret);
 }
@@ -862,6 +869,9 @@ main(int argc, const char **argv)
 {
     pack_opt_t options; /*the global options */
     int        parse_ret;
+#ifdef H5REPACK_PARALLEL
+    int        mpi_rank;
+#endif
 
     HDmemset(&options, 0, sizeof(pack_opt_t));
 
@@ -871,6 +881,15 @@ main(int argc, const char **argv)
     h5tools_setprogname(PROGRAMNAME);
     h5tools_setstatus(EXIT_SUCCESS);
 
+#ifdef H5REPACK_PARALLEL
+    /* The processes share the copy of the raw data; with only one, this
+     * is a serial repack */
+    MPI_Init(&argc, (char ***)&argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &g_nTasks);
+    g_Parallel = (unsigned char)(g_nTasks > 1);
+#endif
+
     /* update hyperslab buffer size from H5TOOLS_BUFSIZE env if exist */
     if (h5tools_getenv_update_hyperslab_bufsize() < 0) {
         HDprintf("Error occurred while retrieving H5TOOLS_BUFSIZE value\n");
@@ -900,6 +919,12 @@ main(int argc, const char **argv)
         goto done;
     }
 
+#ifdef H5REPACK_PARALLEL
+    /* only the first process reports what is being copied */
+    if (mpi_rank > 0)
+        options.verbose = 0;
+#endif
+
     /* enable error reporting if command line option */
     h5tools_error_report();
 
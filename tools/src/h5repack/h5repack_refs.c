@@ -14,6 +14,7 @@
 #include "h5repack.h"
 #include "h5diff.h"
 #include "h5tools.h"
+#include "h5tools_utils.h"
 
 /*-------------------------------------------------------------------------
  * local functions
@@ -136,6 +137,13 @@ do_copy_refobjs(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
                      */
                     dset_out = FAIL;
 
+#ifdef H5_HAVE_PARALLEL
+                    /* the library can not write references in parallel */
+                    if (g_Parallel &&
+                        (H5Tequal(mtype_id, H5T_STD_REF_OBJ) || H5Tequal(mtype_id, H5T_STD_REF_DSETREG)))
+                        H5TOOLS_GOTO_ERROR((-1), "references can not be repacked in parallel");
+#endif
+
                     /*-------------------------------------------------------------------------
                      * object references are a special case
                      * we cannot just copy the buffers, but instead we recreate the reference
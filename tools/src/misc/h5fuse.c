@@ -0,0 +1,181 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* h5fuse tool
+ *
+ * Reassembles a file written with the subfiling driver (H5FD_SUBFILING)
+ * into one regular HDF5 file, which any driver and tool can then open.
+ * It decodes the configuration record with the driver's own parser, reads
+ * the subfiles directly and needs neither MPI nor a parallel build.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5MMprivate.h"
+#include "H5FDsubfiling_priv.h"
+
+#define FUSE_BUF_SIZE (4 * 1024 * 1024)
+
+static void
+usage(void)
+{
+    HDfprintf(stderr, "Usage: h5fuse [-v] <config> <output>\n");
+    HDfprintf(stderr, "  <config>  the name the file was created with (its configuration record)\n");
+    HDfprintf(stderr, "  <output>  the regular HDF5 file to write\n");
+    HDfprintf(stderr, "  -v        describe the layout and progress\n");
+}
+
+int
+main(int argc, const char *argv[])
+{
+    H5FD_subfiling_fapl_t fa;
+    FILE *                out    = NULL;
+    FILE **               subs   = NULL;
+    char **               names  = NULL;
+    char *                config = NULL;
+    char *                buf    = NULL;
+    const char *          config_name = NULL;
+    const char *          out_name    = NULL;
+    hbool_t               verbose     = FALSE;
+    hsize_t               stripe_size;
+    hsize_t               eof = 0;
+    hsize_t               stripe, nstripes;
+    int                   stripe_count = 0;
+    int                   argno, i;
+
+    for (argno = 1; argno < argc; argno++) {
+        if (!HDstrcmp(argv[argno], "-v"))
+            verbose = TRUE;
+        else if ('-' != argv[argno][0] && NULL == config_name)
+            config_name = argv[argno];
+        else if ('-' != argv[argno][0] && NULL == out_name)
+            out_name = argv[argno];
+        else {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (NULL == config_name || NULL == out_name) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    if (H5open() < 0) {
+        HDfprintf(stderr, "h5fuse: unable to initialize the library\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Read the configuration record with the driver's own parser and open
+     * the subfiles it lists
+     */
+    if (NULL == (config = H5FD__subfiling_read_config(config_name)) ||
+        H5FD__subfiling_parse_config(config_name, config, &fa, &names) < 0) {
+        H5Eprint2(H5E_DEFAULT, stderr);
+        HDfprintf(stderr, "h5fuse: unable to read the subfiling configuration record %s\n", config_name);
+        goto error;
+    }
+    stripe_size  = fa.stripe_size;
+    stripe_count = (int)fa.stripe_count;
+    if (NULL == (subs = (FILE **)HDcalloc((size_t)stripe_count, sizeof(FILE *))))
+        goto error;
+    for (i = 0; i < stripe_count; i++)
+        if (NULL == (subs[i] = HDfopen(names[i], "rb"))) {
+            HDfprintf(stderr, "h5fuse: unable to open subfile %s\n", names[i]);
+            goto error;
+        }
+
+    /* The logical EOF is the furthest stripe byte held by any subfile */
+    for (i = 0; i < stripe_count; i++) {
+        h5_stat_t sb;
+        hsize_t   last;
+
+        if (HDfstat(HDfileno(subs[i]), &sb) < 0) {
+            HDfprintf(stderr, "h5fuse: unable to stat subfile %d\n", i);
+            goto error;
+        }
+        if (0 == sb.st_size)
+            continue;
+        last = (hsize_t)sb.st_size - 1;
+        last = ((last / stripe_size) * (hsize_t)stripe_count + (hsize_t)i) * stripe_size + last % stripe_size + 1;
+        eof  = MAX(eof, last);
+    }
+    if (verbose)
+        HDfprintf(stdout, "%s: %d subfiles, stripe size %" PRIuHSIZE ", logical size %" PRIuHSIZE "\n",
+                  config_name, stripe_count, stripe_size, eof);
+
+    /* Copy the stripes out in logical order */
+    if (NULL == (out = HDfopen(out_name, "wb"))) {
+        HDfprintf(stderr, "h5fuse: unable to create %s\n", out_name);
+        goto error;
+    }
+    if (NULL == (buf = (char *)HDmalloc(FUSE_BUF_SIZE)))
+        goto error;
+    nstripes = (eof + stripe_size - 1) / stripe_size;
+    for (stripe = 0; stripe < nstripes; stripe++) {
+        FILE *  sub  = subs[stripe % (hsize_t)stripe_count];
+        hsize_t left = MIN(stripe_size, eof - stripe * stripe_size);
+
+        if (HDfseek(sub, (HDoff_t)((stripe / (hsize_t)stripe_count) * stripe_size), SEEK_SET) < 0) {
+            HDfprintf(stderr, "h5fuse: unable to seek in subfile\n");
+            goto error;
+        }
+        while (left > 0) {
+            size_t want = (size_t)MIN(left, FUSE_BUF_SIZE);
+            size_t got  = HDfread(buf, 1, want, sub);
+
+            /* A short subfile reads as zeros */
+            if (got < want) {
+                if (HDferror(sub)) {
+                    HDfprintf(stderr, "h5fuse: unable to read subfile\n");
+                    goto error;
+                }
+                HDmemset(buf + got, 0, want - got);
+            }
+            if (want != HDfwrite(buf, 1, want, out)) {
+                HDfprintf(stderr, "h5fuse: unable to write %s\n", out_name);
+                goto error;
+            }
+            left -= want;
+        }
+    }
+    if (0 != HDfclose(out)) {
+        out = NULL;
+        HDfprintf(stderr, "h5fuse: unable to write %s\n", out_name);
+        goto error;
+    }
+    out = NULL;
+
+    if (verbose)
+        HDfprintf(stdout, "wrote %" PRIuHSIZE " bytes to %s\n", eof, out_name);
+
+    for (i = 0; i < stripe_count; i++)
+        HDfclose(subs[i]);
+    HDfree(subs);
+    HDfree(buf);
+    H5FD__subfiling_free_names(names, stripe_count);
+    H5MM_xfree(config);
+
+    return EXIT_SUCCESS;
+
+error:
+    if (out)
+        HDfclose(out);
+    for (i = 0; subs && i < stripe_count; i++)
+        if (subs[i])
+            HDfclose(subs[i]);
+    HDfree(subs);
+    HDfree(buf);
+    H5FD__subfiling_free_names(names, stripe_count);
+    H5MM_xfree(config);
+
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,381 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* h5heatmap tool
+ *
+ * Turns the binary I/O trace written by the log driver (H5FD_LOG_TRACE)
+ * into an access heatmap: time runs down the rows and file address runs
+ * across the columns, and each cell holds the number of bytes (or
+ * requests) that touched that address range during that time slice.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME "h5heatmap"
+
+#define HEATMAP_ROWS_DEF 24
+#define HEATMAP_COLS_DEF 64
+
+/* One decoded trace record */
+typedef struct heatmap_rec_t {
+    uint64_t start;
+    uint64_t latency;
+    uint64_t addr;
+    uint64_t size;
+    unsigned op;
+    unsigned type;
+} heatmap_rec_t;
+
+static const char *heatmap_shades_g = " .:-=+*#%@";
+
+static const char *fname_g   = NULL;
+static unsigned    rows_g    = HEATMAP_ROWS_DEF;
+static unsigned    cols_g    = HEATMAP_COLS_DEF;
+static int         op_g      = -1;
+static hbool_t     by_reqs_g = FALSE;
+static hbool_t     csv_g     = FALSE;
+
+/*
+ * Command-line options: The user can specify short or long-named
+ * parameters.
+ */
+static const char *        s_opts   = "hVr:c:o:nC";
+static struct long_options l_opts[] = {{"help", no_arg, 'h'},     {"version", no_arg, 'V'},
+                                       {"rows", require_arg, 'r'}, {"cols", require_arg, 'c'},
+                                       {"op", require_arg, 'o'},   {"requests", no_arg, 'n'},
+                                       {"csv", no_arg, 'C'},       {NULL, 0, '\0'}};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] tracefile\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "   -r R, --rows=R            Number of time slices (default %d)\n",
+              HEATMAP_ROWS_DEF);
+    HDfprintf(stdout, "   -c C, --cols=C            Number of address ranges (default %d)\n",
+              HEATMAP_COLS_DEF);
+    HDfprintf(stdout, "   -o OP, --op=OP            Only count read, write or all (default) requests\n");
+    HDfprintf(stdout, "   -n, --requests            Count requests instead of bytes\n");
+    HDfprintf(stdout, "   -C, --csv                 Print the cells as CSV instead of a character map\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  tracefile is the \"<logfile>.trace\" written by the log driver with\n");
+    HDfprintf(stdout, "  H5FD_LOG_TRACE.\n");
+} /* usage() */
+
+/*-------------------------------------------------------------------------
+ * Function:    parse_command_line
+ *
+ * Purpose:     Parses command line and sets up global variables to control
+ *              output
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+    /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while ((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch ((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'r':
+                if (0 == (rows_g = (unsigned)HDstrtoul(opt_arg, NULL, 0))) {
+                    error_msg("number of rows must be positive\n");
+                    usage(h5tools_getprogname());
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'c':
+                if (0 == (cols_g = (unsigned)HDstrtoul(opt_arg, NULL, 0))) {
+                    error_msg("number of columns must be positive\n");
+                    usage(h5tools_getprogname());
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'o':
+                if (!HDstrcmp(opt_arg, "read"))
+                    op_g = H5FD_LOG_TRACE_READ;
+                else if (!HDstrcmp(opt_arg, "write"))
+                    op_g = H5FD_LOG_TRACE_WRITE;
+                else if (!HDstrcmp(opt_arg, "all"))
+                    op_g = -1;
+                else {
+                    error_msg("unknown operation \"%s\"\n", opt_arg);
+                    usage(h5tools_getprogname());
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'n':
+                by_reqs_g = TRUE;
+                break;
+
+            case 'C':
+                csv_g = TRUE;
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    }     /* end while */
+
+    /* check for file name to be processed */
+    if (argc <= opt_ind) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    fname_g = argv[opt_ind];
+
+done:
+    return 0;
+
+error:
+    return -1;
+} /* parse_command_line() */
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    HDexit(ret);
+} /* leave() */
+
+static uint64_t
+decode_u64(const uint8_t *p)
+{
+    uint64_t v = 0;
+    int      i;
+
+    for (i = 7; i >= 0; i--)
+        v = (v << 8) | p[i];
+
+    return v;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Reads the trace, bins its requests by time and address and
+ *              prints the result
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, const char *argv[])
+{
+    uint8_t        header[H5FD_LOG_TRACE_HEADER_SIZE];
+    uint8_t        buf[H5FD_LOG_TRACE_RECORD_SIZE];
+    heatmap_rec_t *recs = NULL;
+    uint64_t *     map  = NULL;
+    uint64_t       nrecs, dropped, u;
+    uint64_t       t_max = 1, a_max = 1, cell_max = 0;
+    FILE *         fp = NULL;
+    unsigned       r, c;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    /* Parse command line options */
+    if (parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if (fname_g == NULL)
+        goto done;
+
+    /* Read the trace */
+    if (NULL == (fp = HDfopen(fname_g, "rb"))) {
+        error_msg("unable to open %s\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    if (1 != HDfread(header, sizeof(header), 1, fp) ||
+        HDmemcmp(header, H5FD_LOG_TRACE_MAGIC, HDstrlen(H5FD_LOG_TRACE_MAGIC)) != 0) {
+        error_msg("%s is not an HDF5 log driver trace\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    nrecs   = decode_u64(header + 8);
+    dropped = decode_u64(header + 16);
+    if (nrecs > H5FD_LOG_TRACE_NRECORDS) {
+        error_msg("bad record count in %s\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    if (nrecs && NULL == (recs = (heatmap_rec_t *)HDcalloc((size_t)nrecs, sizeof(heatmap_rec_t)))) {
+        error_msg("unable to allocate trace records\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    for (u = 0; u < nrecs; u++) {
+        if (1 != HDfread(buf, sizeof(buf), 1, fp)) {
+            error_msg("%s is truncated\n", fname_g);
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+        recs[u].start   = decode_u64(buf);
+        recs[u].latency = decode_u64(buf + 8);
+        recs[u].addr    = decode_u64(buf + 16);
+        recs[u].size    = decode_u64(buf + 24);
+        recs[u].op      = buf[32];
+        recs[u].type    = buf[33];
+
+        if (op_g >= 0 && recs[u].op != (unsigned)op_g)
+            continue;
+        t_max = MAX(t_max, recs[u].start + 1);
+        a_max = MAX(a_max, recs[u].addr + MAX(recs[u].size, 1));
+    }
+    HDfclose(fp);
+    fp = NULL;
+
+    /* Bin the requests, spreading each one over the columns it covers */
+    if (NULL == (map = (uint64_t *)HDcalloc((size_t)rows_g * cols_g, sizeof(uint64_t)))) {
+        error_msg("unable to allocate heatmap\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    for (u = 0; u < nrecs; u++) {
+        uint64_t lo, hi;
+        unsigned c_lo, c_hi;
+
+        if (op_g >= 0 && recs[u].op != (unsigned)op_g)
+            continue;
+
+        r    = (unsigned)((double)recs[u].start / (double)t_max * rows_g);
+        lo   = recs[u].addr;
+        hi   = recs[u].addr + MAX(recs[u].size, 1);
+        c_lo = (unsigned)((double)lo / (double)a_max * cols_g);
+        c_hi = (unsigned)((double)(hi - 1) / (double)a_max * cols_g);
+        r    = MIN(r, rows_g - 1);
+        c_lo = MIN(c_lo, cols_g - 1);
+        c_hi = MIN(c_hi, cols_g - 1);
+        for (c = c_lo; c <= c_hi; c++) {
+            uint64_t *cell   = &map[(size_t)r * cols_g + c];
+            uint64_t  col_lo = (uint64_t)((double)c * (double)a_max / cols_g);
+            uint64_t  col_hi = (uint64_t)((double)(c + 1) * (double)a_max / cols_g);
+
+            /* Rounding can put a column at either end outside the request */
+            if (MIN(hi, col_hi) <= MAX(lo, col_lo))
+                continue;
+
+            if (by_reqs_g)
+                *cell += 1;
+            else
+                *cell += MIN(hi, col_hi) - MAX(lo, col_lo);
+            cell_max = MAX(cell_max, *cell);
+        }
+    }
+
+    /* Print it */
+    if (csv_g) {
+        HDfprintf(stdout, "time_ns");
+        for (c = 0; c < cols_g; c++)
+            HDfprintf(stdout, ",%" PRIu64, (uint64_t)((double)c * (double)a_max / cols_g));
+        HDfprintf(stdout, "\n");
+        for (r = 0; r < rows_g; r++) {
+            HDfprintf(stdout, "%" PRIu64, (uint64_t)((double)r * (double)t_max / rows_g));
+            for (c = 0; c < cols_g; c++)
+                HDfprintf(stdout, ",%" PRIu64, map[(size_t)r * cols_g + c]);
+            HDfprintf(stdout, "\n");
+        }
+    }
+    else {
+        size_t nshades = HDstrlen(heatmap_shades_g);
+
+        HDfprintf(stdout, "%s: %" PRIu64 " requests (%" PRIu64 " dropped), %.6f s, %" PRIu64 " bytes\n",
+                  fname_g, nrecs, dropped, (double)t_max / 1.0e9, a_max);
+        HDfprintf(stdout, "rows: %.6f s each; columns: %" PRIu64 " bytes each; '%c' = %" PRIu64 " %s\n",
+                  (double)t_max / 1.0e9 / rows_g, (a_max + cols_g - 1) / cols_g,
+                  heatmap_shades_g[nshades - 1], cell_max, by_reqs_g ? "requests" : "bytes");
+        for (r = 0; r < rows_g; r++) {
+            HDfputc('|', stdout);
+            for (c = 0; c < cols_g; c++) {
+                uint64_t v     = map[(size_t)r * cols_g + c];
+                size_t   shade = 0;
+
+                /* Any access at all gets at least the lightest mark */
+                if (v)
+                    shade = 1 + (size_t)((double)v / (double)cell_max * (double)(nshades - 2));
+                HDfputc(heatmap_shades_g[MIN(shade, nshades - 1)], stdout);
+            }
+            HDfprintf(stdout, "|\n");
+        }
+    }
+
+done:
+    if (fp)
+        HDfclose(fp);
+    HDfree(map);
+    HDfree(recs);
+
+    leave(h5tools_getstatus());
+} /* main() */
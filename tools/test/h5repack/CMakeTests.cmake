@@ -311,6 +311,30 @@
     endif ()
   endmacro ()
 
+  macro (ADD_PH5_TEST testname testfile)
+    add_test (
+        NAME MPI_TEST_H5REPACK-${testname}-clear-objects
+        COMMAND ${CMAKE_COMMAND} -E remove testfiles/out-par-${testname}.${testfile}
+    )
+    set_tests_properties (MPI_TEST_H5REPACK-${testname}-clear-objects PROPERTIES
+        FIXTURES_REQUIRED clear_h5repack
+    )
+    add_test (
+        NAME MPI_TEST_H5REPACK-${testname}
+        COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${MPIEXEC_MAX_NUMPROCS} ${MPIEXEC_PREFLAGS} $<TARGET_FILE:ph5repack${tgt_file_ext}> ${MPIEXEC_POSTFLAGS} --enable-error-stack ${ARGN} ${PROJECT_BINARY_DIR}/testfiles/${testfile} ${PROJECT_BINARY_DIR}/testfiles/out-par-${testname}.${testfile}
+    )
+    set_tests_properties (MPI_TEST_H5REPACK-${testname} PROPERTIES
+        DEPENDS MPI_TEST_H5REPACK-${testname}-clear-objects
+    )
+    add_test (
+        NAME MPI_TEST_H5REPACK-${testname}_DFF
+        COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:h5diff${tgt_file_ext}> --enable-error-stack ${PROJECT_BINARY_DIR}/testfiles/${testfile} ${PROJECT_BINARY_DIR}/testfiles/out-par-${testname}.${testfile}
+    )
+    set_tests_properties (MPI_TEST_H5REPACK-${testname}_DFF PROPERTIES
+        DEPENDS MPI_TEST_H5REPACK-${testname}
+    )
+  endmacro ()
+
   macro (ADD_H5_FILTER_TEST testname testfilter testtype resultcode resultfile)
     if ("${testtype}" STREQUAL "SKIP")
       if (NOT HDF5_ENABLE_USING_MEMCHECKER)
@@ -1148,6 +1172,15 @@
   ADD_H5_TEST (layout "TEST" ${FILE4})
   ADD_H5_TEST (early "TEST" ${FILE5})
 
+# copy files with the processes sharing the raw data (these files have no VL data)
+  if (H5_HAVE_PARALLEL AND HDF5_TEST_PARALLEL AND NOT HDF5_ENABLE_USING_MEMCHECKER)
+    ADD_PH5_TEST (layout ${FILE4})
+    ADD_PH5_TEST (layout_shuffle ${FILE4} -f SHUF)
+    ADD_PH5_TEST (layout_chunk ${FILE4} -l CHUNK=5x5)
+    ADD_PH5_TEST (layout_compact ${FILE4} -l COMPA)
+    ADD_PH5_TEST (early ${FILE5})
+  endif ()
+
 # nested 8bit enum in both deflated and non-deflated datafiles
   if (NOT USE_FILTER_DEFLATE)
     ADD_H5_TEST (nested_8bit_enum "TEST" h5repack_nested_8bit_enum.h5)
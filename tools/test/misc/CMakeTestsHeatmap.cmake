@@ -0,0 +1,106 @@
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of HDF5.  The full HDF5 copyright notice, including
+# terms governing use, modification, and redistribution, is contained in
+# the COPYING file, which can be found at the root of the source code
+# distribution tree, or in https://www.hdfgroup.org/licenses.
+# If you do not have access to either file, you may request a copy from
+# help@hdfgroup.org.
+#
+
+##############################################################################
+##############################################################################
+###           T E S T I N G                                                ###
+##############################################################################
+##############################################################################
+
+  # --------------------------------------------------------------------
+  # Copy the trace and the expected output into the test directory.
+  # h5heatmap.trace holds four requests (write 0+1024 at 0 ns, read
+  # 1024+1024 at 100 ns, write 2048+2048 at 200 ns and read 512+3000 at
+  # 300 ns), so the expected heatmaps can be worked out by hand.
+  # --------------------------------------------------------------------
+  set (HDF5_HEATMAP_TEST_FILES
+      h5heatmap.trace
+      h5heatmap_badop.err
+      h5heatmap_badop.txt
+      h5heatmap_csv.txt
+      h5heatmap_help.txt
+      h5heatmap_map.txt
+      h5heatmap_reads.txt
+  )
+
+  # make test dir
+  file (MAKE_DIRECTORY "${PROJECT_BINARY_DIR}/testfiles")
+
+  foreach (h5_heatmap_file ${HDF5_HEATMAP_TEST_FILES})
+    HDFTEST_COPY_FILE("${HDF5_TOOLS_TEST_MISC_SOURCE_DIR}/testfiles/${h5_heatmap_file}" "${PROJECT_BINARY_DIR}/testfiles/${h5_heatmap_file}" "h5heatmap_files")
+  endforeach ()
+  add_custom_target(h5heatmap_files ALL COMMENT "Copying files needed by h5heatmap tests" DEPENDS ${h5heatmap_files_list})
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S  M A C R O S                               ###
+##############################################################################
+##############################################################################
+
+  macro (ADD_H5_CMP resultfile resultcode)
+    if (HDF5_ENABLE_USING_MEMCHECKER)
+      add_test (NAME H5HEATMAP_CMP-${resultfile} COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:h5heatmap${tgt_file_ext}> ${ARGN})
+      set_tests_properties (H5HEATMAP_CMP-${resultfile} PROPERTIES
+          WORKING_DIRECTORY "${PROJECT_BINARY_DIR}/testfiles"
+      )
+    else ()
+      add_test (
+          NAME H5HEATMAP_CMP-${resultfile}
+          COMMAND "${CMAKE_COMMAND}"
+              -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+              -D "TEST_PROGRAM=$<TARGET_FILE:h5heatmap${tgt_file_ext}>"
+              -D "TEST_ARGS:STRING=${ARGN}"
+              -D "TEST_FOLDER=${PROJECT_BINARY_DIR}/testfiles"
+              -D "TEST_OUTPUT=${resultfile}.out"
+              -D "TEST_EXPECT=${resultcode}"
+              -D "TEST_REFERENCE=${resultfile}.txt"
+              -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+      )
+    endif ()
+  endmacro ()
+
+  macro (ADD_H5_ERR_CMP resultfile resultcode)
+    if (NOT HDF5_ENABLE_USING_MEMCHECKER)
+      add_test (
+          NAME H5HEATMAP_CMP-${resultfile}
+          COMMAND "${CMAKE_COMMAND}"
+              -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+              -D "TEST_PROGRAM=$<TARGET_FILE:h5heatmap${tgt_file_ext}>"
+              -D "TEST_ARGS:STRING=${ARGN}"
+              -D "TEST_FOLDER=${PROJECT_BINARY_DIR}/testfiles"
+              -D "TEST_OUTPUT=${resultfile}.out"
+              -D "TEST_EXPECT=${resultcode}"
+              -D "TEST_REFERENCE=${resultfile}.txt"
+              -D "TEST_ERRREF=${resultfile}.err"
+              -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+      )
+    endif ()
+  endmacro ()
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S                                            ###
+##############################################################################
+##############################################################################
+
+  # Check that help is displayed properly
+  ADD_H5_CMP (h5heatmap_help 0 -h)
+
+  # Bytes per cell as a character map and as CSV
+  ADD_H5_CMP (h5heatmap_map 0 -r 4 -c 4 h5heatmap.trace)
+  ADD_H5_CMP (h5heatmap_csv 0 -r 4 -c 3 -C h5heatmap.trace)
+
+  # Read requests per cell
+  ADD_H5_CMP (h5heatmap_reads 0 -r 2 -c 4 -o read -n -C h5heatmap.trace)
+
+  # Unknown operation
+  ADD_H5_ERR_CMP (h5heatmap_badop 1 -o bogus h5heatmap.trace)
@@ -0,0 +1,187 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Measures write throughput of the Mirror VFD against a
+ *              running mirror server.
+ *
+ *              Start the server first, e.g.
+ *                  mirror_server --port=3000 &
+ *                  mirror_perf -p 3000
+ *                  mirror_server_stop --port=3000
+ *
+ *              For each write size, a file is created on the server and
+ *              filled with back-to-back writes, then flushed, so that the
+ *              time includes every write reaching the remote Writer.
+ */
+
+#include "h5test.h"
+
+#ifdef H5_HAVE_MIRROR_VFD
+
+#define MIRROR_PERF_FILENAME "mirror_perf.h5"
+#define MIRROR_PERF_IP       "127.0.0.1"
+#define MIRROR_PERF_PORT     3000
+#define MIRROR_PERF_TOTAL    (64 * 1024 * 1024) /* Bytes written per write size */
+
+static const size_t write_sizes_g[] = {64, 512, 4096, 65536, 1048576};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message and exits.
+ *
+ * Return:      never returns
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stderr, "usage: %s [-i IP] [-p PORT] [-t TOTAL_BYTES]\n", prog);
+    HDfprintf(stderr, "  -i IP           address of the mirror server (default %s)\n", MIRROR_PERF_IP);
+    HDfprintf(stderr, "  -p PORT         handshake port of the mirror server (default %d)\n", MIRROR_PERF_PORT);
+    HDfprintf(stderr, "  -t TOTAL_BYTES  bytes to write for each write size (default %d)\n", MIRROR_PERF_TOTAL);
+    HDexit(EXIT_FAILURE);
+} /* end usage() */
+
+/*-------------------------------------------------------------------------
+ * Function:    run_size
+ *
+ * Purpose:     Writes TOTAL bytes in writes of SIZE bytes through the
+ *              mirror fapl and reports the rate.
+ *
+ * Return:      0 on success, -1 on failure
+ *-------------------------------------------------------------------------
+ */
+static int
+run_size(hid_t fapl_id, size_t size, size_t total)
+{
+    H5FD_t *file   = NULL;
+    char *  buf    = NULL;
+    size_t  nwrite = total / size;
+    size_t  u;
+    double  start, elapsed;
+
+    if (NULL == (buf = (char *)HDmalloc(size)))
+        goto error;
+    for (u = 0; u < size; u++)
+        buf[u] = (char)u;
+
+    if (NULL == (file = H5FDopen(MIRROR_PERF_FILENAME, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id,
+                                 HADDR_UNDEF)))
+        goto error;
+
+    start = H5_get_time();
+
+    if (H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)(nwrite * size)) < 0)
+        goto error;
+    for (u = 0; u < nwrite; u++)
+        if (H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(u * size), size, buf) < 0)
+            goto error;
+    if (H5FDflush(file, H5P_DEFAULT, FALSE) < 0)
+        goto error;
+
+    elapsed = H5_get_time() - start;
+
+    if (H5FDclose(file) < 0) {
+        file = NULL;
+        goto error;
+    }
+    file = NULL;
+
+    HDfprintf(stdout, "%10zu %10zu %12.3f %12.1f %12.2f\n", size, nwrite, elapsed, (double)nwrite / elapsed,
+              (double)(nwrite * size) / (elapsed * 1024.0 * 1024.0));
+
+    HDfree(buf);
+    return 0;
+
+error:
+    if (file) {
+        H5E_BEGIN_TRY { H5FDclose(file); }
+        H5E_END_TRY;
+    }
+    if (buf)
+        HDfree(buf);
+    return -1;
+} /* end run_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Runs the benchmark for each write size.
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    H5FD_mirror_fapl_t fa;
+    hid_t              fapl_id = H5I_INVALID_HID;
+    size_t             total   = MIRROR_PERF_TOTAL;
+    size_t             u;
+    int                i;
+
+    fa.magic          = H5FD_MIRROR_FAPL_MAGIC;
+    fa.version        = H5FD_MIRROR_CURR_FAPL_T_VERSION;
+    fa.handshake_port = MIRROR_PERF_PORT;
+    HDstrncpy(fa.remote_ip, MIRROR_PERF_IP, H5FD_MIRROR_MAX_IP_LEN);
+    fa.remote_ip[H5FD_MIRROR_MAX_IP_LEN] = '\0';
+
+    for (i = 1; i < argc; i++) {
+        if (!HDstrcmp(argv[i], "-i") && i + 1 < argc) {
+            HDstrncpy(fa.remote_ip, argv[++i], H5FD_MIRROR_MAX_IP_LEN);
+            fa.remote_ip[H5FD_MIRROR_MAX_IP_LEN] = '\0';
+        }
+        else if (!HDstrcmp(argv[i], "-p") && i + 1 < argc)
+            fa.handshake_port = HDatoi(argv[++i]);
+        else if (!HDstrcmp(argv[i], "-t") && i + 1 < argc)
+            total = (size_t)HDstrtoul(argv[++i], NULL, 0);
+        else
+            usage(argv[0]);
+    }
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_fapl_mirror(fapl_id, &fa) < 0)
+        goto error;
+
+    HDfprintf(stdout, "Mirror VFD write throughput to %s:%d\n", fa.remote_ip, fa.handshake_port);
+    HDfprintf(stdout, "%10s %10s %12s %12s %12s\n", "size", "writes", "seconds", "writes/s", "MiB/s");
+
+    for (u = 0; u < NELMTS(write_sizes_g); u++)
+        if (run_size(fapl_id, write_sizes_g[u], MAX(total, write_sizes_g[u])) < 0) {
+            HDfprintf(stderr, "write size %zu failed; is the mirror server running?\n", write_sizes_g[u]);
+            goto error;
+        }
+
+    if (H5Pclose(fapl_id) < 0)
+        goto error;
+
+    return EXIT_SUCCESS;
+
+error:
+    H5E_BEGIN_TRY { H5Pclose(fapl_id); }
+    H5E_END_TRY;
+    return EXIT_FAILURE;
+} /* end main() */
+
+#else /* H5_HAVE_MIRROR_VFD */
+
+int
+main(void)
+{
+    HDprintf("Mirror VFD is not built; skipping benchmark.\n");
+    return EXIT_SUCCESS;
+} /* end main() */
+
+#endif /* H5_HAVE_MIRROR_VFD */
@@ -57,6 +57,9 @@
 /* The following three must have the same type */
 #define ELMT_H5_TYPE H5T_NATIVE_UCHAR
 
+/* Size in bytes of each attribute written by the attribute scenario */
+#define SCENARIO_ATTR_SIZE 64
+
 #define GOTOERROR(errcode)                                                                                   \
     {                                                                                                        \
         ret_code = errcode;                                                                                  \
@@ -111,6 +114,9 @@ static int clean_file_g = -1; /*whether to cleanup temporary test     */
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif /* !MIN */
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif /* !MAX */
 
 /* the different types of file descriptors we can expect */
 typedef union _file_descr {
@@ -373,6 +379,279 @@ done:
     return res;
 }
 
+/*
+ * Function:        do_pio_scenario
+ * Purpose:         Run one of the metadata-heavy or filtered-write scenarios
+ *                  with the PHDF5 API.  Each scenario works on
+ *                  PARAM.num_dsets objects in each of PARAM.num_files files:
+ *
+ *                  SCENARIO_DSETS    - datasets of PARAM.num_bytes bytes,
+ *                                      each process writing its own
+ *                                      contiguous part of each of them
+ *                  SCENARIO_ATTRS    - small attributes on a single group
+ *                  SCENARIO_GROUPS   - groups in the root group
+ *                  SCENARIO_FILTERED - datasets as for SCENARIO_DSETS, but
+ *                                      chunked, compressed with deflate (or
+ *                                      shuffled if deflate isn't available)
+ *                                      and always written collectively
+ *                  SCENARIO_OPEN     - datasets created beforehand (not
+ *                                      timed), then opened by all processes
+ *                                      with collective metadata reads
+ *
+ *                  The time this process spends in each phase is returned
+ *                  in PHASE_TIME, accumulated over all the files.
+ * Return:          SUCCESS or FAIL
+ */
+herr_t
+do_pio_scenario(parameters param, scenario sc, double phase_time[NUM_PHASES])
+{
+    herr_t         ret_code   = SUCCESS;         /* Return code               */
+    hid_t          fapl       = H5I_INVALID_HID; /* File access plist         */
+    hid_t          dcpl       = H5I_INVALID_HID; /* Dataset creation plist    */
+    hid_t          dxpl       = H5I_INVALID_HID; /* Dataset transfer plist    */
+    hid_t          fid        = H5I_INVALID_HID; /* File ID                   */
+    hid_t          gid        = H5I_INVALID_HID; /* Group holding attributes  */
+    hid_t          file_space = H5I_INVALID_HID; /* Dataset dataspace         */
+    hid_t          mem_space  = H5I_INVALID_HID; /* Memory dataspace          */
+    hid_t          attr_space = H5I_INVALID_HID; /* Attribute dataspace       */
+    hid_t *        ids        = NULL;            /* Objects being timed       */
+    unsigned char *buffer     = NULL;            /* Data buffer               */
+    char           fname[FILENAME_MAX];
+    char           name[64];
+    hsize_t        dims[1], start[1], count[1], chunk[1];
+    size_t         bsize; /* Size of the data buffer   */
+    long           nf, n, nobjs;
+    int            p;
+    double         t;
+
+    for (p = 0; p < NUM_PHASES; p++)
+        phase_time[p] = 0.0;
+
+    nobjs = param.num_dsets;
+    if (nobjs <= 0) {
+        HDfprintf(stderr, "number of objects per file must be > 0 (%ld)\n", nobjs);
+        GOTOERROR(FAIL);
+    }
+    if ((param.num_bytes % pio_mpi_nprocs_g) != 0) {
+        HDfprintf(stderr,
+                  "Dataset size (%" H5_PRINTF_LL_WIDTH "d) must be a multiple of the "
+                  "number of processes (%d)\n",
+                  (long long)param.num_bytes, pio_mpi_nprocs_g);
+        GOTOERROR(FAIL);
+    }
+
+    /* Each process writes its own contiguous part of each dataset */
+    dims[0]  = (hsize_t)param.num_bytes;
+    count[0] = dims[0] / (hsize_t)pio_mpi_nprocs_g;
+    start[0] = count[0] * (hsize_t)pio_mpi_rank_g;
+
+    /* The attributes are written with the same data by every process, so
+     * the data doesn't depend on the rank
+     */
+    bsize = MAX((size_t)count[0], (size_t)SCENARIO_ATTR_SIZE);
+    if (NULL == (buffer = (unsigned char *)HDmalloc(bsize))) {
+        HDfprintf(stderr, "malloc for data buffer size (%zu) failed\n", bsize);
+        GOTOERROR(FAIL);
+    }
+    for (n = 0; n < (long)bsize; n++)
+        buffer[n] = (unsigned char)(n % 64);
+
+    if (NULL == (ids = (hid_t *)HDmalloc((size_t)nobjs * sizeof(hid_t)))) {
+        HDfprintf(stderr, "malloc for %ld object IDs failed\n", nobjs);
+        GOTOERROR(FAIL);
+    }
+    for (n = 0; n < nobjs; n++)
+        ids[n] = H5I_INVALID_HID;
+
+    /* Set up the property lists */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate failed");
+    VRFY((H5Pset_fapl_mpio(fapl, pio_comm_g, h5_io_info_g) >= 0), "H5Pset_fapl_mpio failed");
+    VRFY((H5Pset_alignment(fapl, param.h5_thresh, param.h5_align) >= 0), "H5Pset_alignment failed");
+    if (param.collective || sc == SCENARIO_OPEN) {
+        VRFY((H5Pset_all_coll_metadata_ops(fapl, TRUE) >= 0), "H5Pset_all_coll_metadata_ops failed");
+        VRFY((H5Pset_coll_metadata_write(fapl, TRUE) >= 0), "H5Pset_coll_metadata_write failed");
+    }
+
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate failed");
+    if (param.collective || sc == SCENARIO_FILTERED)
+        VRFY((H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE) >= 0), "H5Pset_dxpl_mpio failed");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate failed");
+    if (param.h5_use_chunks || sc == SCENARIO_FILTERED) {
+        chunk[0] = MIN((hsize_t)param.blk_size, dims[0]);
+        VRFY((H5Pset_chunk(dcpl, 1, chunk) >= 0), "H5Pset_chunk failed");
+    }
+    if (sc == SCENARIO_FILTERED) {
+        if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+            VRFY((H5Pset_deflate(dcpl, 6) >= 0), "H5Pset_deflate failed");
+        else
+            VRFY((H5Pset_shuffle(dcpl) >= 0), "H5Pset_shuffle failed");
+    }
+
+    file_space = H5Screate_simple(1, dims, NULL);
+    VRFY((file_space >= 0), "H5Screate_simple failed");
+    VRFY((H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL) >= 0),
+         "H5Sselect_hyperslab failed");
+    mem_space = H5Screate_simple(1, count, NULL);
+    VRFY((mem_space >= 0), "H5Screate_simple failed");
+    dims[0]    = SCENARIO_ATTR_SIZE;
+    attr_space = H5Screate_simple(1, dims, NULL);
+    VRFY((attr_space >= 0), "H5Screate_simple failed");
+
+    for (nf = 1; nf <= param.num_files; nf++) {
+        char base_name[256];
+
+        HDsprintf(base_name, "#pio_scenario_%lu", nf);
+        pio_create_filename(PHDF5, base_name, fname, sizeof(fname));
+        /* The scenario report is JSON, so debug text goes to stderr */
+        if (pio_debug_level > 0)
+            HDfprintf(stderr, "rank %d: data filename=%s\n", pio_mpi_rank_g, fname);
+
+        /* Populate the file to be opened, without timing it */
+        if (sc == SCENARIO_OPEN) {
+            fid = H5Fcreate(fname, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+            VRFY((fid >= 0), "H5Fcreate failed");
+            for (n = 0; n < nobjs; n++) {
+                HDsnprintf(name, sizeof(name), "Dataset_%ld", n);
+                ids[n] = H5DCREATE(fid, name, ELMT_H5_TYPE, file_space, dcpl);
+                VRFY((ids[n] >= 0), "H5Dcreate failed");
+                VRFY((H5Dclose(ids[n]) >= 0), "H5Dclose failed");
+                ids[n] = H5I_INVALID_HID;
+            }
+            VRFY((H5Fclose(fid) >= 0), "H5Fclose failed");
+            fid = H5I_INVALID_HID;
+        }
+
+        /* Need barrier to make sure everyone starts at the same time */
+        MPI_Barrier(pio_comm_g);
+
+        /* Open (or create) the file */
+        t = MPI_Wtime();
+        if (sc == SCENARIO_OPEN) {
+            fid = H5Fopen(fname, H5F_ACC_RDONLY, fapl);
+            VRFY((fid >= 0), "H5Fopen failed");
+            for (n = 0; n < nobjs; n++) {
+                HDsnprintf(name, sizeof(name), "Dataset_%ld", n);
+                ids[n] = H5DOPEN(fid, name);
+                VRFY((ids[n] >= 0), "H5Dopen failed");
+            }
+        }
+        else {
+            fid = H5Fcreate(fname, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+            VRFY((fid >= 0), "H5Fcreate failed");
+        }
+        phase_time[PHASE_OPEN] += MPI_Wtime() - t;
+
+        /* Create the objects */
+        t = MPI_Wtime();
+        if (sc == SCENARIO_ATTRS) {
+            gid = H5Gcreate2(fid, "Attributes", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            VRFY((gid >= 0), "H5Gcreate2 failed");
+        }
+        for (n = 0; n < nobjs && sc != SCENARIO_OPEN; n++) {
+            switch (sc) {
+                case SCENARIO_DSETS:
+                case SCENARIO_FILTERED:
+                    HDsnprintf(name, sizeof(name), "Dataset_%ld", n);
+                    ids[n] = H5DCREATE(fid, name, ELMT_H5_TYPE, file_space, dcpl);
+                    break;
+                case SCENARIO_ATTRS:
+                    HDsnprintf(name, sizeof(name), "Attribute_%ld", n);
+                    ids[n] = H5Acreate2(gid, name, ELMT_H5_TYPE, attr_space, H5P_DEFAULT, H5P_DEFAULT);
+                    break;
+                case SCENARIO_GROUPS:
+                    HDsnprintf(name, sizeof(name), "Group_%ld", n);
+                    ids[n] = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+                    break;
+                default:
+                    break;
+            }
+            VRFY((ids[n] >= 0), "object create failed");
+        }
+        phase_time[PHASE_CREATE] += MPI_Wtime() - t;
+
+        /* Write the objects' data */
+        t = MPI_Wtime();
+        for (n = 0; n < nobjs; n++) {
+            if (sc == SCENARIO_DSETS || sc == SCENARIO_FILTERED)
+                VRFY((H5Dwrite(ids[n], ELMT_H5_TYPE, mem_space, file_space, dxpl, buffer) >= 0),
+                     "H5Dwrite failed");
+            else if (sc == SCENARIO_ATTRS)
+                VRFY((H5Awrite(ids[n], ELMT_H5_TYPE, buffer) >= 0), "H5Awrite failed");
+        }
+        phase_time[PHASE_WRITE] += MPI_Wtime() - t;
+
+        /* Flush the file */
+        t = MPI_Wtime();
+        VRFY((H5Fflush(fid, H5F_SCOPE_LOCAL) >= 0), "H5Fflush failed");
+        phase_time[PHASE_FLUSH] += MPI_Wtime() - t;
+
+        /* Close the objects and the file */
+        t = MPI_Wtime();
+        for (n = 0; n < nobjs; n++) {
+            if (ids[n] >= 0) {
+                herr_t hrc;
+
+                if (sc == SCENARIO_ATTRS)
+                    hrc = H5Aclose(ids[n]);
+                else if (sc == SCENARIO_GROUPS)
+                    hrc = H5Gclose(ids[n]);
+                else
+                    hrc = H5Dclose(ids[n]);
+                VRFY((hrc >= 0), "object close failed");
+                ids[n] = H5I_INVALID_HID;
+            }
+        }
+        if (gid >= 0) {
+            VRFY((H5Gclose(gid) >= 0), "H5Gclose failed");
+            gid = H5I_INVALID_HID;
+        }
+        VRFY((H5Fclose(fid) >= 0), "H5Fclose failed");
+        fid = H5I_INVALID_HID;
+        phase_time[PHASE_CLOSE] += MPI_Wtime() - t;
+
+        /* Need barrier to make sure everyone is done with the file */
+        /* before it may be removed by do_cleanupfile */
+        MPI_Barrier(pio_comm_g);
+        do_cleanupfile(PHDF5, fname);
+    }
+
+done:
+    /* release HDF5 objects */
+    H5E_BEGIN_TRY
+    {
+        if (ids)
+            for (n = 0; n < nobjs; n++)
+                if (ids[n] >= 0) {
+                    if (sc == SCENARIO_ATTRS)
+                        H5Aclose(ids[n]);
+                    else if (sc == SCENARIO_GROUPS)
+                        H5Gclose(ids[n]);
+                    else
+                        H5Dclose(ids[n]);
+                }
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Sclose(attr_space);
+        H5Sclose(mem_space);
+        H5Sclose(file_space);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+
+    /* release generic resources */
+    if (ids)
+        HDfree(ids);
+    if (buffer)
+        HDfree(buffer);
+    return ret_code;
+}
+
 /*
  * Function:    pio_create_filename
  * Purpose:     Create a new filename to write to. Determine the correct
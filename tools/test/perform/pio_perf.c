@@ -52,6 +52,30 @@
  *
  *      . . .
  *
+ * When scenarios are selected with --scenario, the bandwidth tests aren't
+ * run.  Instead, each scenario is run with PHDF5 for each number of
+ * processes and the report is a single JSON document holding the minimum,
+ * maximum and average time (in seconds, across processes and iterations)
+ * of each phase of each run:
+ *
+ *  {
+ *    "program": "h5perf",
+ *    "hdf5_version": "1.13.0",
+ *    "time_unit": "s",
+ *    "results": [
+ *      {
+ *        "scenario": "groups",
+ *        "nprocs": 4,
+ *        . . .
+ *        "phases": {
+ *          "open": { "min": x, "max": x, "avg": x },
+ *          . . .
+ *          "total": { "min": x, "max": x, "avg": x }
+ *        }
+ *      },
+ *      . . .
+ *    ]
+ *  }
  */
 
 /* system header files */
@@ -119,7 +143,7 @@ static const char *progname = "h5perf";
  * adding more, make sure that they don't clash with each other.
  */
 #if 1
-static const char *s_opts = "a:A:B:cCd:D:e:F:ghi:Imno:p:P:stT:wx:X:";
+static const char *s_opts = "a:A:B:cCd:D:e:F:ghi:Imno:p:P:sS:tT:wx:X:";
 #else
 static const char *s_opts = "a:A:bB:cCd:D:e:F:ghi:Imno:p:P:stT:wx:X:";
 #endif /* 1 */
@@ -247,6 +271,13 @@ static struct long_options l_opts[] = {{"align", require_arg, 'a'},
                                        {"outp", require_arg, 'o'},
                                        {"out", require_arg, 'o'},
                                        {"ou", require_arg, 'o'},
+                                       {"scenario", require_arg, 'S'},
+                                       {"scenari", require_arg, 'S'},
+                                       {"scenar", require_arg, 'S'},
+                                       {"scena", require_arg, 'S'},
+                                       {"scen", require_arg, 'S'},
+                                       {"sce", require_arg, 'S'},
+                                       {"sc", require_arg, 'S'},
                                        {"threshold", require_arg, 'T'},
                                        {"threshol", require_arg, 'T'},
                                        {"thresho", require_arg, 'T'},
@@ -287,6 +318,7 @@ struct options {
     int         h5_use_chunks; /* Make HDF5 dataset chunked            */
     int         h5_write_only; /* Perform the write tests only         */
     int         verify;        /* Verify data correctness              */
+    long        scenarios;     /* bitmask of which scenarios to run    */
 };
 
 typedef struct _minmax {
@@ -296,11 +328,21 @@ typedef struct _minmax {
     int    num;
 } minmax;
 
+/* Names of the scenarios, as given to --scenario and in the JSON report */
+static const char *scenario_names[NUM_SCENARIOS] = {"dsets", "attrs", "groups", "filtered", "open"};
+
+/* Names of the phases timed in each scenario, in the JSON report */
+static const char *phase_names[NUM_PHASES] = {"open", "create", "write", "flush", "close"};
+
+/* Whether the next scenario run is the first in the JSON report */
+static int json_first_run_g = TRUE;
+
 /* local functions */
 static off_t           parse_size_directive(const char *size);
 static struct options *parse_command_line(int argc, char *argv[]);
 static void            run_test_loop(struct options *options);
 static int             run_test(iotype iot, parameters parms, struct options *opts);
+static int             run_scenario(scenario sc, parameters parms);
 static void            output_all_info(minmax *mm, int count, int indent_level);
 static void            get_minmax(minmax *mm, double val);
 static minmax          accumulate_minmax_stuff(minmax *mm, int count);
@@ -385,11 +427,26 @@ main(int argc, char *argv[])
         }
     }
 
-    if ((pio_debug_level == 0 && comm_world_rank_g == 0) || pio_debug_level > 0)
+    if (opts->scenarios) {
+        if (comm_world_rank_g == 0) {
+            unsigned maj, min, rel;
+
+            H5get_libversion(&maj, &min, &rel);
+            HDfprintf(output, "{\n");
+            HDfprintf(output, "  \"program\": \"%s\",\n", progname);
+            HDfprintf(output, "  \"hdf5_version\": \"%u.%u.%u\",\n", maj, min, rel);
+            HDfprintf(output, "  \"time_unit\": \"s\",\n");
+            HDfprintf(output, "  \"results\": [");
+        }
+    }
+    else if ((pio_debug_level == 0 && comm_world_rank_g == 0) || pio_debug_level > 0)
         report_parameters(opts);
 
     run_test_loop(opts);
 
+    if (opts->scenarios && comm_world_rank_g == 0)
+        HDfprintf(output, "\n  ]\n}\n");
+
 finish:
     MPI_Finalize();
     free(opts);
@@ -455,7 +512,22 @@ run_test_loop(struct options *opts)
         }
 
         /* only processes doing PIO will run the tests */
-        if (doing_pio) {
+        if (doing_pio && opts->scenarios) {
+            int sc;
+
+            parms.io_type   = PHDF5;
+            parms.num_bytes = (off_t)opts->num_bpp * parms.num_procs;
+            parms.buf_size  = opts->max_xfer_size;
+
+            for (sc = 0; sc < NUM_SCENARIOS; sc++)
+                if (opts->scenarios & (1L << sc))
+                    run_scenario((scenario)sc, parms);
+
+            if (destroy_comm_world() != SUCCESS) {
+                /* do something harsh */
+            }
+        }
+        else if (doing_pio) {
             output_report("Number of processors = %ld\n", parms.num_procs);
 
             /* multiply the xfer buffer size by 2 for each loop iteration */
@@ -827,6 +899,89 @@ run_test(iotype iot, parameters parms, struct options *opts)
     return ret_value;
 }
 
+/*
+ * Function:    run_scenario
+ * Purpose:     Run a scenario PARMS.num_iters times and add the minimum,
+ *              maximum and average time of each of its phases across all
+ *              processes and iterations to the JSON report.
+ * Return:      SUCCESS or FAIL
+ */
+static int
+run_scenario(scenario sc, parameters parms)
+{
+    minmax phase_mm[NUM_PHASES + 1]; /* The phases, followed by their total */
+    double phase_time[NUM_PHASES];
+    int    ret_value = SUCCESS;
+    int    i, p;
+
+    for (p = 0; p <= NUM_PHASES; p++) {
+        phase_mm[p].min = DBL_MAX;
+        phase_mm[p].max = -DBL_MAX;
+        phase_mm[p].sum = 0.0;
+        phase_mm[p].num = 0;
+    }
+
+    for (i = 0; i < parms.num_iters; ++i) {
+        double total = 0.0;
+        int    ret, all_ret;
+
+        MPI_Barrier(pio_comm_g);
+        ret = do_pio_scenario(parms, sc, phase_time) < 0 ? FAIL : SUCCESS;
+
+        /* Stop at the first iteration that failed on any process */
+        MPI_Allreduce(&ret, &all_ret, 1, MPI_INT, MPI_MIN, pio_comm_g);
+        if (all_ret != SUCCESS) {
+            ret_value = FAIL;
+            break;
+        }
+
+        for (p = 0; p <= NUM_PHASES; p++) {
+            minmax mm;
+            double t = (p < NUM_PHASES) ? phase_time[p] : total;
+
+            if (p < NUM_PHASES)
+                total += t;
+
+            get_minmax(&mm, t);
+            if (mm.min < phase_mm[p].min)
+                phase_mm[p].min = mm.min;
+            if (mm.max > phase_mm[p].max)
+                phase_mm[p].max = mm.max;
+            phase_mm[p].sum += mm.sum;
+            phase_mm[p].num += mm.num;
+        }
+    }
+
+    output_report("%s\n    {\n", json_first_run_g ? "" : ",");
+    json_first_run_g = FALSE;
+    output_report("      \"scenario\": \"%s\",\n", scenario_names[sc]);
+    output_report("      \"nprocs\": %d,\n", parms.num_procs);
+    output_report("      \"iterations\": %d,\n", parms.num_iters);
+    output_report("      \"files\": %ld,\n", parms.num_files);
+    output_report("      \"objects\": %ld,\n", parms.num_dsets);
+    output_report("      \"bytes_per_process\": %lld,\n", (long long)(parms.num_bytes / parms.num_procs));
+    output_report("      \"block_size\": %zu,\n", parms.blk_size);
+    output_report("      \"chunked\": %s,\n",
+                  (parms.h5_use_chunks || sc == SCENARIO_FILTERED) ? "true" : "false");
+    output_report("      \"collective\": %s,\n",
+                  (parms.collective || sc == SCENARIO_FILTERED) ? "true" : "false");
+    output_report("      \"status\": \"%s\"", ret_value == SUCCESS ? "ok" : "failed");
+
+    if (ret_value == SUCCESS) {
+        output_report(",\n      \"phases\": {\n");
+        for (p = 0; p <= NUM_PHASES; p++)
+            output_report("        \"%s\": { \"min\": %.9f, \"max\": %.9f, \"avg\": %.9f }%s\n",
+                          p < NUM_PHASES ? phase_names[p] : "total", phase_mm[p].min, phase_mm[p].max,
+                          phase_mm[p].sum / phase_mm[p].num, p < NUM_PHASES ? "," : "");
+        output_report("      }\n");
+    }
+    else
+        output_report("\n");
+    output_report("    }");
+
+    return ret_value;
+}
+
 /*
  * Function:    output_all_info
  * Purpose:
@@ -1285,6 +1440,7 @@ parse_command_line(int argc, char *argv[])
     cl_opts->h5_use_chunks = FALSE; /* Don't chunk the HDF5 dataset by default */
     cl_opts->h5_write_only = FALSE; /* Do both read and write by default */
     cl_opts->verify        = FALSE; /* No Verify data correctness by default */
+    cl_opts->scenarios     = 0;     /* Run the bandwidth tests by default */
 
     while ((opt = get_option(argc, (const char **)argv, s_opts, l_opts)) != EOF) {
         switch ((char)opt) {
@@ -1425,6 +1581,42 @@ parse_command_line(int argc, char *argv[])
             case 'P':
                 cl_opts->max_num_procs = HDatoi(opt_arg);
                 break;
+            case 'S': {
+                const char *end = opt_arg;
+
+                while (end && *end != '\0') {
+                    char buf[10];
+                    int  i, sc;
+
+                    HDmemset(buf, '\0', sizeof(buf));
+
+                    for (i = 0; *end != '\0' && *end != ','; ++end)
+                        if (HDisalnum(*end) && i < 9)
+                            buf[i++] = *end;
+
+                    if (!HDstrcasecmp(buf, "all"))
+                        cl_opts->scenarios |= (1L << NUM_SCENARIOS) - 1;
+                    else {
+                        for (sc = 0; sc < NUM_SCENARIOS; sc++)
+                            if (!HDstrcasecmp(buf, scenario_names[sc]))
+                                break;
+
+                        if (sc == NUM_SCENARIOS) {
+                            HDfprintf(stderr, "pio_perf: invalid --scenario option %s\n", buf);
+                            HDexit(EXIT_FAILURE);
+                        }
+
+                        cl_opts->scenarios |= 1L << sc;
+                    }
+
+                    if (*end == '\0')
+                        break;
+
+                    end++;
+                }
+            }
+
+            break;
             case 'T':
                 cl_opts->h5_threshold = parse_size_directive(opt_arg);
                 break;
@@ -1590,6 +1782,9 @@ usage(const char *prog)
         HDprintf("     -p N, --min-num-processes=N Minimum number of processes to use [default: 1]\n");
         HDprintf("     -P N, --max-num-processes=N Maximum number of processes to use\n");
         HDprintf("                                 [default: all MPI_COMM_WORLD processes ]\n");
+        HDprintf("     -S SL, --scenario=SL        Run the scenarios in SL with PHDF5 instead of the\n");
+        HDprintf("                                 bandwidth tests and report their timings in JSON\n");
+        HDprintf("                                 [default: run the bandwidth tests]\n");
         HDprintf("     -T S, --threshold=S         Threshold for alignment of objects in HDF5 file\n");
         HDprintf("                                 [default: 1]\n");
         HDprintf("     -w, --write-only            Perform write tests not the read tests\n");
@@ -1617,6 +1812,21 @@ usage(const char *prog)
         HDprintf("\n");
         HDprintf("      Example: --api=mpiio,phdf5\n");
         HDprintf("\n");
+        HDprintf("  SL - is a scenario list. Valid values are:\n");
+        HDprintf("          dsets    - Create and write num-dsets small datasets\n");
+        HDprintf("          attrs    - Create and write num-dsets attributes on one group\n");
+        HDprintf("          groups   - Create num-dsets groups\n");
+        HDprintf("          filtered - Collectively write num-dsets deflated, chunked datasets\n");
+        HDprintf("                     (chunk size is block-size)\n");
+        HDprintf("          open     - Open num-dsets datasets with collective metadata reads\n");
+        HDprintf("          all      - All of the above\n");
+        HDprintf("\n");
+        HDprintf("      Each scenario times the file open (or create), object create, write,\n");
+        HDprintf("      flush and close phases.  The datasets are bytes-per-process *\n");
+        HDprintf("      num-processes bytes, with each process writing its own part.\n");
+        HDprintf("\n");
+        HDprintf("      Example: --scenario=dsets,filtered\n");
+        HDprintf("\n");
         HDprintf("  Dataset size:\n");
         HDprintf("      Depending on the selected geometry, each test dataset is either a linear\n");
         HDprintf("      array of size bytes-per-process * num-processes, or a square array of size\n");
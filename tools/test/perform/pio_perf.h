@@ -35,6 +35,19 @@ typedef enum iotype_ {
     /*NUM_TYPES*/
 } iotype;
 
+/* The metadata-heavy and filtered-write scenarios (PHDF5 only) */
+typedef enum scenario_ {
+    SCENARIO_DSETS,    /* Many small datasets                  */
+    SCENARIO_ATTRS,    /* Attribute-heavy object               */
+    SCENARIO_GROUPS,   /* Group creation storm                 */
+    SCENARIO_FILTERED, /* Filtered collective write            */
+    SCENARIO_OPEN,     /* Collective metadata open storm       */
+    NUM_SCENARIOS
+} scenario;
+
+/* The phases timed in each scenario */
+typedef enum phase_ { PHASE_OPEN, PHASE_CREATE, PHASE_WRITE, PHASE_FLUSH, PHASE_CLOSE, NUM_PHASES } phase;
+
 typedef struct parameters_ {
     iotype   io_type;       /* The type of IO test to perform       */
     int      num_procs;     /* Maximum number of processes to use   */
@@ -92,6 +105,7 @@ extern "C" {
 #endif /* __cplusplus */
 
 extern results do_pio(parameters param);
+extern herr_t  do_pio_scenario(parameters param, scenario sc, double phase_time[NUM_PHASES]);
 
 #ifdef __cplusplus
 }
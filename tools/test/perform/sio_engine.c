@@ -1202,6 +1202,13 @@ set_vfd(parameters *param)
          * and copy buffer size to the default values. */
         if (H5Pset_fapl_direct(my_fapl, 1024, 4096, 8 * 4096) < 0)
             return -1;
+#endif
+    }
+    else if (vfd == uring) {
+#ifdef H5_HAVE_URING
+        /* Linux io_uring with the default queue depth and block size */
+        if (H5Pset_fapl_uring(my_fapl, 0, 0, FALSE) < 0)
+            return -1;
 #endif
     }
     else {
@@ -43,7 +43,8 @@ typedef enum vfdtype_ {
     split,
     multi,
     family,
-    direct
+    direct,
+    uring
     /*NUM_TYPES*/
 } vfdtype;
 
@@ -81,6 +81,19 @@
  *      reply info (update xmit_count, status code, and message) before
  *      transmission.
  *
+ * in_batch (int)
+ *      "Boolean" flag set while a BATCH xmit is being handled.
+ *      A reply then acknowledges the batch: it carries the batch's
+ *      xmit_count and does not advance the session's count, as the Driver
+ *      may already have sent the xmits that follow.
+ *
+ * batch_buf (char *)
+ *      Buffer for receiving the data of batched writes, allocated on first
+ *      use and kept for the rest of the session.
+ *
+ * batch_buf_size (size_t)
+ *      Size of `batch_buf`.
+ *
  * ----------------------------------------------------------------------------
  */
 struct mirror_session {
@@ -91,6 +104,9 @@ struct mirror_session {
     H5FD_t *                 file;
     loginfo_t *              loginfo;
     H5FD_mirror_xmit_reply_t reply;
+    int                      in_batch;
+    char *                   batch_buf;
+    size_t                   batch_buf_size;
 };
 
 /* ---------------------------------------------------------------------------
@@ -207,11 +223,14 @@ session_init(struct mirror_writer_opts *opts)
         goto error;
     }
 
-    session->magic      = MW_SESSION_MAGIC;
-    session->sockfd     = -1;
-    session->xmit_count = 0;
-    session->token      = 0;
-    session->file       = NULL;
+    session->magic          = MW_SESSION_MAGIC;
+    session->sockfd         = -1;
+    session->xmit_count     = 0;
+    session->token          = 0;
+    session->file           = NULL;
+    session->in_batch       = 0;
+    session->batch_buf      = NULL;
+    session->batch_buf_size = 0;
 
     session->reply.pub.magic         = H5FD_MIRROR_XMIT_MAGIC;
     session->reply.pub.version       = H5FD_MIRROR_XMIT_CURR_VERSION;
@@ -260,6 +279,9 @@ session_stop(struct mirror_session *session)
         }
     }
 
+    if (session->batch_buf)
+        HDfree(session->batch_buf);
+
     /* Socket will be closed by parent side of server fork after exit */
 
     /* Close custom logging stream */
@@ -354,7 +376,10 @@ _xmit_reply(struct mirror_session *session)
 
     mirror_log(session->loginfo, V_ALL, "_xmit_reply()");
 
-    reply->pub.xmit_count = session->xmit_count++;
+    if (session->in_batch)
+        reply->pub.xmit_count = session->xmit_count - 1;
+    else
+        reply->pub.xmit_count = session->xmit_count++;
     if (H5FD_mirror_xmit_encode_reply(xmit_buf, (const H5FD_mirror_xmit_reply_t *)reply) !=
         H5FD_MIRROR_XMIT_REPLY_SIZE) {
         mirror_log(session->loginfo, V_ERR, "can't encode reply");
@@ -825,6 +850,185 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
     return 0;
 } /* end do_write() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    read_exact
+ *
+ * Purpose:     Read exactly `size` bytes from the session socket, as the
+ *              Driver may send several xmits without waiting for replies.
+ *
+ * Return:      Number of bytes read, which is less than `size` only if the
+ *              Driver closed the connection; -1 if error.
+ * ---------------------------------------------------------------------------
+ */
+static ssize_t
+read_exact(struct mirror_session *session, char *buf, size_t size)
+{
+    size_t nread = 0;
+
+    HDassert(session && (session->magic == MW_SESSION_MAGIC) && buf);
+
+    while (nread < size) {
+        ssize_t read_ret = HDread(session->sockfd, buf + nread, size - nread);
+
+        if (read_ret < 0) {
+            if (EINTR == errno)
+                continue;
+            return -1;
+        }
+        if (read_ret == 0)
+            break;
+        nread += (size_t)read_ret;
+    }
+
+    return (ssize_t)nread;
+} /* end read_exact() */
+
+/* ---------------------------------------------------------------------------
+ * Function:    do_batch
+ *
+ * Purpose:     Handle a BATCH operation.
+ *              Receives and performs each write and EOA update of the batch
+ *              in order, then acknowledges the batch with a single reply.
+ *
+ * Return:      0 on success, -1 if error.
+ * ---------------------------------------------------------------------------
+ */
+static int
+do_batch(struct mirror_session *session, const unsigned char *xmit_buf)
+{
+    size_t                   decode_ret = 0;
+    uint64_t                 sum_bytes  = 0;
+    uint32_t                 i          = 0;
+    H5FD_mirror_xmit_batch_t xmit_batch;
+
+    HDassert(session && (session->magic == MW_SESSION_MAGIC) && xmit_buf);
+
+    mirror_log(session->loginfo, V_INFO, "do_batch()");
+
+    session->in_batch = 1;
+
+    if (NULL == session->file) {
+        mirror_log(session->loginfo, V_ERR, "no open file!");
+        reply_error(session, "no file open on remote");
+        return -1;
+    }
+
+    decode_ret = H5FD_mirror_xmit_decode_batch(&xmit_batch, xmit_buf);
+    if (H5FD_MIRROR_XMIT_BATCH_SIZE != decode_ret) {
+        mirror_log(session->loginfo, V_ERR, "can't decode batch xmit");
+        reply_error(session, "remote xmit_batch_t decoding size failure");
+        return -1;
+    }
+
+    if (!H5FD_mirror_xmit_is_batch(&xmit_batch)) {
+        mirror_log(session->loginfo, V_ERR, "not a batch xmit");
+        reply_error(session, "remote xmit_batch_t decode failure");
+        return -1;
+    }
+
+    mirror_log(session->loginfo, V_INFO, "batch of %u entries in %zu bytes", xmit_batch.count,
+               xmit_batch.size);
+
+    for (i = 0; i < xmit_batch.count; i++) {
+        unsigned char             entry_buf[H5FD_MIRROR_BATCH_ENTRY_SIZE];
+        H5FD_mirror_batch_entry_t entry;
+        uint64_t                  sum_bytes_written = 0;
+
+        if (read_exact(session, (char *)entry_buf, H5FD_MIRROR_BATCH_ENTRY_SIZE) !=
+            H5FD_MIRROR_BATCH_ENTRY_SIZE) {
+            mirror_log(session->loginfo, V_ERR, "can't read batch entry");
+            reply_error(session, "can't read batch entry");
+            return -1;
+        }
+        H5FD_mirror_xmit_decode_batch_entry(&entry, entry_buf);
+        sum_bytes += H5FD_MIRROR_BATCH_ENTRY_SIZE;
+
+        switch (entry.op) {
+            case H5FD_MIRROR_OP_SET_EOA:
+                mirror_log(session->loginfo, V_INFO, "set EOA addr %zu", entry.offset);
+                if (H5FDset_eoa(session->file, (H5FD_mem_t)entry.type, (haddr_t)entry.offset) < 0) {
+                    mirror_log(session->loginfo, V_ERR, "H5FDset_eoa()");
+                    reply_error(session, "remote H5FDset_eoa() failure");
+                    return -1;
+                }
+                break;
+
+            case H5FD_MIRROR_OP_WRITE:
+                mirror_log(session->loginfo, V_INFO, "to write %zu bytes at %zu", entry.size, entry.offset);
+
+                /* Grow the receiving buffer as needed, up to the maximum;
+                 * larger writes are ingested in slices.
+                 */
+                if (session->batch_buf_size < entry.size &&
+                    session->batch_buf_size < H5FD_MIRROR_DATA_BUFFER_MAX) {
+                    size_t new_size = (size_t)MIN(entry.size, H5FD_MIRROR_DATA_BUFFER_MAX);
+
+                    new_size = MAX(new_size, H5FD_MIRROR_BATCH_BUFFER_MAX);
+                    if (session->batch_buf)
+                        HDfree(session->batch_buf);
+                    session->batch_buf_size = 0;
+                    if (NULL == (session->batch_buf = (char *)HDmalloc(new_size))) {
+                        mirror_log(session->loginfo, V_ERR, "can't allocate databuffer");
+                        reply_error(session, "can't allocate buffer for receiving data");
+                        return -1;
+                    }
+                    session->batch_buf_size = new_size;
+                }
+
+                while (sum_bytes_written < entry.size) {
+                    size_t nbytes = (size_t)MIN(entry.size - sum_bytes_written, session->batch_buf_size);
+
+                    if (read_exact(session, session->batch_buf, nbytes) != (ssize_t)nbytes) {
+                        mirror_log(session->loginfo, V_ERR, "can't read into databuffer");
+                        reply_error(session, "can't read data buffer");
+                        return -1;
+                    }
+
+                    if (HEXDUMP_WRITEDATA) {
+                        mirror_log(session->loginfo, V_ALL, "DATA:\n```");
+                        mirror_log_bytes(session->loginfo, V_ALL, nbytes,
+                                         (const unsigned char *)session->batch_buf);
+                        mirror_log(session->loginfo, V_ALL, "```");
+                    }
+
+                    if (H5FDwrite(session->file, (H5FD_mem_t)entry.type, H5P_DEFAULT,
+                                  (haddr_t)(entry.offset + sum_bytes_written), nbytes,
+                                  session->batch_buf) < 0) {
+                        mirror_log(session->loginfo, V_ERR, "H5FDwrite()");
+                        reply_error(session, "remote H5FDwrite() failure");
+                        return -1;
+                    }
+
+                    sum_bytes_written += nbytes;
+                }
+                sum_bytes += entry.size;
+                break;
+
+            default:
+                mirror_log(session->loginfo, V_ERR, "unrecognized batch entry");
+                reply_error(session, "unrecognized batch entry");
+                return -1;
+        } /* end switch (entry.op) */
+    }     /* end for each entry */
+
+    if (sum_bytes != xmit_batch.size) {
+        mirror_log(session->loginfo, V_ERR, "batch size mismatch");
+        reply_error(session, "batch size mismatch");
+        return -1;
+    }
+
+    /* acknowledge the whole batch */
+    if (reply_ok(session) < 0) {
+        mirror_log(session->loginfo, V_ERR, "can't reply");
+        reply_error(session, "ok reply failed; session contaminated");
+        return -1;
+    }
+
+    session->in_batch = 0;
+
+    return 0;
+} /* end do_batch() */
+
 /* ---------------------------------------------------------------------------
  * Function:    receive_communique
  *
@@ -856,11 +1060,48 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
 
     mirror_log(session->loginfo, V_INFO, "ready to receive"); /* TODO */
 
-    read_ret = HDread(session->sockfd, comm->raw, H5FD_MIRROR_XMIT_BUFFER_MAX);
+    /* Read exactly one xmit: the header, then the rest of the structure
+     * for its op.  A pipelining Driver may have sent more behind it.
+     */
+    read_ret = read_exact(session, comm->raw, H5FD_MIRROR_XMIT_HEADER_SIZE);
     if (-1 == read_ret) {
         mirror_log(session->loginfo, V_ERR, "read:%zd", read_ret);
         goto error;
     }
+    if (H5FD_MIRROR_XMIT_HEADER_SIZE == read_ret) {
+        size_t  xmit_size = H5FD_MIRROR_XMIT_HEADER_SIZE;
+        ssize_t rest_ret  = 0;
+
+        /* op is the last byte of the header */
+        switch ((uint8_t)comm->raw[H5FD_MIRROR_XMIT_HEADER_SIZE - 1]) {
+            case H5FD_MIRROR_OP_BATCH:
+                xmit_size = H5FD_MIRROR_XMIT_BATCH_SIZE;
+                break;
+            case H5FD_MIRROR_OP_LOCK:
+                xmit_size = H5FD_MIRROR_XMIT_LOCK_SIZE;
+                break;
+            case H5FD_MIRROR_OP_OPEN:
+                xmit_size = H5FD_MIRROR_XMIT_OPEN_SIZE;
+                break;
+            case H5FD_MIRROR_OP_SET_EOA:
+                xmit_size = H5FD_MIRROR_XMIT_EOA_SIZE;
+                break;
+            case H5FD_MIRROR_OP_WRITE:
+                xmit_size = H5FD_MIRROR_XMIT_WRITE_SIZE;
+                break;
+            default:
+                break;
+        }
+        if (xmit_size > H5FD_MIRROR_XMIT_HEADER_SIZE) {
+            rest_ret = read_exact(session, comm->raw + H5FD_MIRROR_XMIT_HEADER_SIZE,
+                                  xmit_size - H5FD_MIRROR_XMIT_HEADER_SIZE);
+            if (-1 == rest_ret) {
+                mirror_log(session->loginfo, V_ERR, "read:%zd", rest_ret);
+                goto error;
+            }
+            read_ret += rest_ret;
+        }
+    }
 
     mirror_log(session->loginfo, V_INFO, "received %zd bytes", read_ret);
     if (HEXDUMP_XMITS) {
@@ -954,6 +1195,11 @@ process_instructions(struct mirror_session *session)
         }
 
         switch (xmit_recd.op) {
+            case H5FD_MIRROR_OP_BATCH:
+                if (do_batch(session, (const unsigned char *)xmit_buf) < 0) {
+                    return -1;
+                }
+                break;
             case H5FD_MIRROR_OP_CLOSE:
                 if (do_close(session) < 0) {
                     return -1;